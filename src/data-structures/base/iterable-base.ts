@@ -1,4 +1,14 @@
-import { ElementCallback, EntryCallback, ReduceElementCallback, ReduceEntryCallback } from '../../types';
+import {
+  ElementCallback,
+  EntryCallback,
+  InstrumentationOptions,
+  InstrumentationStats,
+  InstrumentedMethods,
+  LazyIteratorStage,
+  ReduceElementCallback,
+  ReduceEntryCallback
+} from '../../types';
+import { Instrumentation } from '../../utils';
 
 export abstract class IterableEntryBase<K = any, V = any> {
   /**
@@ -279,6 +289,69 @@ export abstract class IterableEntryBase<K = any, V = any> {
     return accumulator;
   }
 
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `lazy` function returns a view of the `[key, value]` pairs whose `filter`, `map`, `take` and
+   * `skip` steps run together in one pass when a terminal method such as `toArray` or `collectInto`
+   * is called, with no container built in between.
+   * @returns A LazyIterator over the entries.
+   */
+  lazy(): LazyIterator<[K, V]> {
+    return new LazyIterator<[K, V]>(this, lazySizeOf(this));
+  }
+
+  protected _instrumentation: Instrumentation | undefined = undefined;
+
+  /**
+   * Time Complexity: O(m), where m is the number of instrumented methods.
+   * Space Complexity: O(m)
+   *
+   * The `enableStats` function starts counting this instance's hot internal operations, such as key comparisons,
+   * rotations, probes, sifts or edge relaxations, depending on the structure. No methods are added to the instance,
+   * so it keeps its hidden class when stats are turned on and off; once any instance of a class has enabled stats,
+   * the instrumented methods of that class check one field per call. See `Instrumentation`.
+   * @param {InstrumentationOptions} [options] - `timing` also records a duration histogram per counter.
+   */
+  enableStats(options?: InstrumentationOptions): void {
+    this.disableStats();
+    this._instrumentation = new Instrumentation(options);
+    this._instrumentation.instrument(this, this._instrumentedMethods());
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `disableStats` function stops counting and drops the counters.
+   */
+  disableStats(): void {
+    this._instrumentation = undefined;
+  }
+
+  /**
+   * Time Complexity: O(c), where c is the number of counters.
+   * Space Complexity: O(1)
+   *
+   * The `resetStats` function zeroes the counters without disabling them.
+   */
+  resetStats(): void {
+    this._instrumentation?.reset();
+  }
+
+  /**
+   * Time Complexity: O(c), where c is the number of counters.
+   * Space Complexity: O(c)
+   *
+   * The `stats` function returns a plain, JSON-serializable copy of the counters, for a metrics pipeline.
+   * @returns The stats, with `enabled` false and no counters while stats are disabled.
+   */
+  stats(): InstrumentationStats {
+    const name = this.constructor.name;
+    return this._instrumentation ? this._instrumentation.snapshot(name) : { name, enabled: false, counters: {} };
+  }
+
   /**
    * Time Complexity: O(n)
    * Space Complexity: O(n)
@@ -297,6 +370,14 @@ export abstract class IterableEntryBase<K = any, V = any> {
 
   abstract filter(...args: any[]): any;
 
+  /**
+   * The methods `enableStats` wraps, mapped to the counters they update. Structures with hot internal operations
+   * override it.
+   */
+  protected _instrumentedMethods(): InstrumentedMethods {
+    return {};
+  }
+
   protected abstract _getIterator(...args: any[]): IterableIterator<[K, V]>;
 }
 
@@ -493,6 +574,69 @@ export abstract class IterableElementBase<E = any, C = any> {
     return accumulator;
   }
 
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `lazy` function returns a view of the elements whose `filter`, `map`, `take` and `skip` steps
+   * run together in one pass when a terminal method such as `toArray` or `collectInto` is called,
+   * with no container built in between.
+   * @returns A LazyIterator over the elements.
+   */
+  lazy(): LazyIterator<E> {
+    return new LazyIterator<E>(this, lazySizeOf(this));
+  }
+
+  protected _instrumentation: Instrumentation | undefined = undefined;
+
+  /**
+   * Time Complexity: O(m), where m is the number of instrumented methods.
+   * Space Complexity: O(m)
+   *
+   * The `enableStats` function starts counting this instance's hot internal operations, such as key comparisons,
+   * rotations, probes, sifts or edge relaxations, depending on the structure. No methods are added to the instance,
+   * so it keeps its hidden class when stats are turned on and off; once any instance of a class has enabled stats,
+   * the instrumented methods of that class check one field per call. See `Instrumentation`.
+   * @param {InstrumentationOptions} [options] - `timing` also records a duration histogram per counter.
+   */
+  enableStats(options?: InstrumentationOptions): void {
+    this.disableStats();
+    this._instrumentation = new Instrumentation(options);
+    this._instrumentation.instrument(this, this._instrumentedMethods());
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `disableStats` function stops counting and drops the counters.
+   */
+  disableStats(): void {
+    this._instrumentation = undefined;
+  }
+
+  /**
+   * Time Complexity: O(c), where c is the number of counters.
+   * Space Complexity: O(1)
+   *
+   * The `resetStats` function zeroes the counters without disabling them.
+   */
+  resetStats(): void {
+    this._instrumentation?.reset();
+  }
+
+  /**
+   * Time Complexity: O(c), where c is the number of counters.
+   * Space Complexity: O(c)
+   *
+   * The `stats` function returns a plain, JSON-serializable copy of the counters, for a metrics pipeline.
+   * @returns The stats, with `enabled` false and no counters while stats are disabled.
+   */
+  stats(): InstrumentationStats {
+    const name = this.constructor.name;
+    return this._instrumentation ? this._instrumentation.snapshot(name) : { name, enabled: false, counters: {} };
+  }
+
   /**
    * Time Complexity: O(n)
    * Space Complexity: O(n)
@@ -511,5 +655,272 @@ export abstract class IterableElementBase<E = any, C = any> {
 
   abstract filter(...args: any[]): any;
 
+  /**
+   * The methods `enableStats` wraps, mapped to the counters they update. Structures with hot internal operations
+   * override it.
+   */
+  protected _instrumentedMethods(): InstrumentedMethods {
+    return {};
+  }
+
   protected abstract _getIterator(...args: any[]): IterableIterator<E>;
 }
+
+// The `size` of a container when it has a numeric one, so collectors can allocate their result once
+const lazySizeOf = (container: object): number | undefined => {
+  const size = (container as { size?: unknown }).size;
+  return typeof size === 'number' ? size : undefined;
+};
+
+// Returned by LazyIterator._apply for a value that a `filter` or `skip` step dropped
+const LAZY_SKIP: unique symbol = Symbol('lazy-skip');
+
+/**
+ * A lazy, fused pipeline over any iterable.
+ * 1. `filter`, `map`, `take` and `skip` only record a step and return a new LazyIterator, so each
+ *    view can be reused or extended.
+ * 2. Terminal methods pull every source value through all the steps inside one loop. Nothing is
+ *    buffered between steps and iteration stops as soon as a `take` step is full.
+ * 3. When the source size is known and no step filters, `toArray` knows the exact result length
+ *    and allocates it once.
+ */
+export class LazyIterator<T> implements Iterable<T> {
+  /**
+   * The constructor creates a pipeline over a source.
+   * @param source - The iterable to read from.
+   * @param {number} [sizeHint] - The number of values in `source`, if known.
+   * @param stages - The steps recorded so far.
+   */
+  constructor(source: Iterable<any>, sizeHint?: number, stages: LazyIteratorStage[] = []) {
+    this._source = source;
+    this._sizeHint = sizeHint;
+    this._stages = stages;
+  }
+
+  protected _source: Iterable<any>;
+
+  protected _sizeHint: number | undefined;
+
+  protected _stages: LazyIteratorStage[];
+
+  /**
+   * The function returns the exact number of values the pipeline yields when it can be told without
+   * running it.
+   * @returns The length, or undefined if the source size is unknown or a step filters.
+   */
+  get knownLength(): number | undefined {
+    let length = this._sizeHint;
+    if (length === undefined) return undefined;
+    for (const stage of this._stages) {
+      if (stage.kind === 'filter') return undefined;
+      if (stage.kind === 'skip') length = Math.max(0, length - stage.count);
+      else if (stage.kind === 'take') length = Math.min(length, stage.count);
+    }
+    return length;
+  }
+
+  /**
+   * The `filter` function adds a step that keeps the values passing a predicate.
+   * @param predicate - Called with the value and its index among the values reaching this step.
+   * @returns A new LazyIterator.
+   */
+  filter(predicate: (value: T, index: number) => boolean): LazyIterator<T> {
+    return this._with({ kind: 'filter', fn: predicate });
+  }
+
+  /**
+   * The `map` function adds a step that transforms each value.
+   * @param callback - Called with the value and its index among the values reaching this step.
+   * @returns A new LazyIterator.
+   */
+  map<R>(callback: (value: T, index: number) => R): LazyIterator<R> {
+    return this._with({ kind: 'map', fn: callback });
+  }
+
+  /**
+   * The `take` function adds a step that passes at most `count` values and then ends the pipeline.
+   * @param {number} count - The number of values to pass, rounded down.
+   * @returns A new LazyIterator.
+   */
+  take(count: number): LazyIterator<T> {
+    return this._with({ kind: 'take', count: Math.max(0, Math.floor(count)) });
+  }
+
+  /**
+   * The `skip` function adds a step that drops the first `count` values reaching it.
+   * @param {number} count - The number of values to drop, rounded down.
+   * @returns A new LazyIterator.
+   */
+  skip(count: number): LazyIterator<T> {
+    return this._with({ kind: 'skip', count: Math.max(0, Math.floor(count)) });
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The function yields the values one at a time, so a pipeline can feed `for...of` or a spread.
+   */
+  *[Symbol.iterator](): IterableIterator<T> {
+    const counters = new Array<number>(this._stages.length).fill(0);
+    const state = { done: this._isEmptyByTake() };
+    if (state.done) return;
+    for (const source of this._source) {
+      const value = this._apply(source, counters, state);
+      if (value !== LAZY_SKIP) yield value;
+      if (state.done) return;
+    }
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The `forEach` function runs the pipeline and calls a function for each resulting value.
+   * @param callbackfn - Called with the value and its index in the result.
+   */
+  forEach(callbackfn: (value: T, index: number) => void): void {
+    let index = 0;
+    this._run(value => callbackfn(value, index++));
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The `reduce` function runs the pipeline and folds the resulting values into one.
+   * @param callbackfn - Called with the accumulator, the value and its index in the result.
+   * @param {U} initialValue - The starting accumulator.
+   * @returns The final accumulator.
+   */
+  reduce<U>(callbackfn: (accumulator: U, value: T, index: number) => U, initialValue: U): U {
+    let accumulator = initialValue;
+    let index = 0;
+    this._run(value => {
+      accumulator = callbackfn(accumulator, value, index++);
+    });
+    return accumulator;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The `count` function runs the pipeline and counts the resulting values.
+   * @returns The number of values.
+   */
+  count(): number {
+    const known = this._stages.some(stage => stage.kind === 'map') ? undefined : this.knownLength;
+    if (known !== undefined) return known;
+    let count = 0;
+    this._run(() => count++);
+    return count;
+  }
+
+  /**
+   * Time Complexity: O(n) in the worst case
+   * Space Complexity: O(1)
+   *
+   * The `first` function runs the pipeline until it yields a value.
+   * @returns The first resulting value, or undefined if there is none.
+   */
+  first(): T | undefined {
+    for (const value of this.take(1)) return value;
+    return undefined;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `toArray` function runs the pipeline into an array. When the exact length is known the array
+   * is allocated at that length and filled by index.
+   * @returns An array of the resulting values.
+   */
+  toArray(): T[] {
+    const length = this.knownLength;
+    if (length === undefined) {
+      const result: T[] = [];
+      this._run(value => {
+        result.push(value);
+      });
+      return result;
+    }
+    const result = new Array<T>(length);
+    let index = 0;
+    this._run(value => {
+      result[index++] = value;
+    });
+    return result;
+  }
+
+  /**
+   * Time Complexity: O(n) plus the cost of the constructor
+   * Space Complexity: O(n)
+   *
+   * The `collectInto` function runs the pipeline into a new container. The values are handed to the
+   * constructor as one array, so containers that size themselves from their input (`Deque` buckets,
+   * `Heap` heapify, `HashMap` reservation) build in a single step instead of growing one insert at a
+   * time.
+   * @param Ctor - A container class whose constructor takes an iterable and optional options.
+   * @param [options] - Options for the constructor.
+   * @returns The new container.
+   */
+  collectInto<C, O = any>(Ctor: new (elements: T[], options?: O) => C, options?: O): C {
+    return new Ctor(this.toArray(), options);
+  }
+
+  protected _with(stage: LazyIteratorStage): LazyIterator<any> {
+    return new LazyIterator<any>(this._source, this._sizeHint, [...this._stages, stage]);
+  }
+
+  protected _isEmptyByTake(): boolean {
+    for (const stage of this._stages) if (stage.kind === 'take' && stage.count === 0) return true;
+    return false;
+  }
+
+  /**
+   * The function passes one source value through every step.
+   * @param value - The source value.
+   * @param counters - How many values have reached each step so far.
+   * @param state - `done` is set once a `take` step is full, so the caller stops reading the source.
+   * @returns The resulting value, or LAZY_SKIP if a step dropped it.
+   */
+  protected _apply(value: any, counters: number[], state: { done: boolean }): any {
+    const stages = this._stages;
+    for (let i = 0; i < stages.length; i++) {
+      const stage = stages[i];
+      const index = counters[i]++;
+      switch (stage.kind) {
+        case 'filter':
+          if (!stage.fn(value, index)) return LAZY_SKIP;
+          break;
+        case 'map':
+          value = stage.fn(value, index);
+          break;
+        case 'skip':
+          if (index < stage.count) return LAZY_SKIP;
+          break;
+        case 'take':
+          if (index + 1 >= stage.count) state.done = true;
+          break;
+      }
+    }
+    return value;
+  }
+
+  protected _run(sink: (value: T) => void): void {
+    if (this._stages.length === 0) {
+      for (const value of this._source) sink(value);
+      return;
+    }
+    const counters = new Array<number>(this._stages.length).fill(0);
+    const state = { done: this._isEmptyByTake() };
+    if (state.done) return;
+    for (const source of this._source) {
+      const value = this._apply(source, counters, state);
+      if (value !== LAZY_SKIP) sink(value);
+      if (state.done) return;
+    }
+  }
+}
@@ -13,6 +13,7 @@ import type {
   BinaryTreeDeleteResult,
   BSTNKeyOrNode,
   BTNCallback,
+  InstrumentedMethods,
   KeyOrNodeOrEntry
 } from '../../types';
 import { IBinaryTree } from '../../interfaces';
@@ -110,6 +111,8 @@ export class AVLTree<
     return new AVLTree<K, V, NODE, TREE>([], {
       iterationType: this.iterationType,
       variant: this.variant,
+      comparator: this.comparator,
+      isOrderStatistic: this.isOrderStatistic,
       ...options
     }) as TREE;
   }
@@ -220,6 +223,118 @@ export class AVLTree<
     return undefined;
   }
 
+  /**
+   * The function sets the height of a node linked by `_buildBalanced` from its finished children.
+   * @param {NODE} node - The node that was linked.
+   */
+  protected override _onBuiltNode(node: NODE): void {
+    this._updateHeight(node);
+  }
+
+  /**
+   * Time Complexity: O(|h(left) - h(right)| + 1)
+   * Space Complexity: O(|h(left) - h(right)| + 1)
+   *
+   * The function joins two detached subtrees through a middle node. When their heights differ by more
+   * than one, it walks down the spine of the taller one to a subtree of about the height of the shorter
+   * one, links the middle node there and rotates on the way back up, as in the join-based AVL algorithm.
+   * @param {NODE | undefined} left - The root of the lesser subtree.
+   * @param {number} leftRank - Unused, the heights are stored in the nodes.
+   * @param {NODE} mid - The detached middle node.
+   * @param {NODE | undefined} right - The root of the greater subtree.
+   * @returns The root of the joined subtree and its rank.
+   */
+  protected override _joinNodes(
+    left: NODE | undefined,
+    leftRank: number,
+    mid: NODE,
+    right: NODE | undefined
+  ): [NODE, number] {
+    const leftHeight = this._heightOf(left);
+    const rightHeight = this._heightOf(right);
+    let root: NODE;
+    if (leftHeight > rightHeight + 1) root = this._joinRight(left!, mid, right);
+    else if (rightHeight > leftHeight + 1) root = this._joinLeft(left, mid, right!);
+    else {
+      this._linkChildren(mid, left, right);
+      root = mid;
+    }
+    return [root, root.height + 1];
+  }
+
+  /**
+   * The function walks down the right spine of `left` to attach `mid` and `right`, which is shorter.
+   * @param {NODE} left - The root of the taller, lesser subtree.
+   * @param {NODE} mid - The detached middle node.
+   * @param {NODE | undefined} right - The root of the greater subtree.
+   * @returns The root of the joined subtree.
+   */
+  protected _joinRight(left: NODE, mid: NODE, right: NODE | undefined): NODE {
+    const spine = left.right;
+    if (this._heightOf(spine) <= this._heightOf(right) + 1) {
+      this._linkChildren(mid, spine, right);
+      left.right = mid;
+      this._refreshNode(left);
+      if (mid.height <= this._heightOf(left.left) + 1) return left;
+      left.right = this._rotateSubtreeRight(mid);
+      this._refreshNode(left);
+      return this._rotateSubtreeLeft(left);
+    }
+    left.right = this._joinRight(spine!, mid, right);
+    this._refreshNode(left);
+    return left.right.height <= this._heightOf(left.left) + 1 ? left : this._rotateSubtreeLeft(left);
+  }
+
+  /**
+   * The function walks down the left spine of `right` to attach `left`, which is shorter, and `mid`.
+   * @param {NODE | undefined} left - The root of the lesser subtree.
+   * @param {NODE} mid - The detached middle node.
+   * @param {NODE} right - The root of the taller, greater subtree.
+   * @returns The root of the joined subtree.
+   */
+  protected _joinLeft(left: NODE | undefined, mid: NODE, right: NODE): NODE {
+    const spine = right.left;
+    if (this._heightOf(spine) <= this._heightOf(left) + 1) {
+      this._linkChildren(mid, left, spine);
+      right.left = mid;
+      this._refreshNode(right);
+      if (mid.height <= this._heightOf(right.right) + 1) return right;
+      right.left = this._rotateSubtreeLeft(mid);
+      this._refreshNode(right);
+      return this._rotateSubtreeRight(right);
+    }
+    right.left = this._joinLeft(left, mid, spine!);
+    this._refreshNode(right);
+    return right.left.height <= this._heightOf(right.right) + 1 ? right : this._rotateSubtreeRight(right);
+  }
+
+  /**
+   * The function ranks a subtree by its height plus one, so an empty subtree ranks 0.
+   * @param {NODE | undefined} node - The root of a subtree.
+   * @returns The rank of the subtree.
+   */
+  protected override _rankOf(node: NODE | undefined): number {
+    return this._heightOf(node) + 1;
+  }
+
+  /**
+   * The function recomputes the height and the subtree size of a node from its children.
+   * @param {NODE} node - The node.
+   */
+  protected override _refreshNode(node: NODE): void {
+    this._updateHeight(node);
+    this._updateSubtreeSize(node);
+  }
+
+  /**
+   * The function returns the height of a subtree, -1 if it is empty.
+   * @param {NODE | undefined} node - The root of a subtree.
+   * @returns The height.
+   */
+  protected _heightOf(node: NODE | undefined): number {
+    return node ? node.height : -1;
+  }
+
   /**
    * Time Complexity: O(1)
    * Space Complexity: O(1)
@@ -302,6 +417,8 @@ export class AVLTree<
     }
     this._updateHeight(A);
     if (B) this._updateHeight(B);
+    this._updateSubtreeSize(A);
+    if (B) this._updateSubtreeSize(B);
   }
 
   /**
@@ -358,6 +475,9 @@ export class AVLTree<
     this._updateHeight(A);
     B && this._updateHeight(B);
     C && this._updateHeight(C);
+    this._updateSubtreeSize(A);
+    B && this._updateSubtreeSize(B);
+    C && this._updateSubtreeSize(C);
   }
 
   /**
@@ -401,6 +521,8 @@ export class AVLTree<
     }
     this._updateHeight(A);
     B && this._updateHeight(B);
+    this._updateSubtreeSize(A);
+    B && this._updateSubtreeSize(B);
   }
 
   /**
@@ -456,6 +578,9 @@ export class AVLTree<
     this._updateHeight(A);
     B && this._updateHeight(B);
     C && this._updateHeight(C);
+    this._updateSubtreeSize(A);
+    B && this._updateSubtreeSize(B);
+    C && this._updateSubtreeSize(C);
   }
 
   /**
@@ -481,6 +606,7 @@ export class AVLTree<
       const A = path[i];
       // Update Heights: After inserting a node, backtrack from the insertion point to the root node, updating the height of each node along the way.
       this._updateHeight(A); // first O(1)
+      this._updateSubtreeSize(A);
       // Check Balance: Simultaneously with height updates, check if each node violates the balance property of an AVL tree.
       // Balance Restoration: If a balance issue is discovered after inserting a node, it requires balance restoration operations. Balance restoration includes four basic cases where rotation operations need to be performed to fix the balance:
       switch (
@@ -527,4 +653,20 @@ export class AVLTree<
 
     return super._replaceNode(oldNode, newNode);
   }
+
+  /**
+   * The function adds the single (LL, RR) and double (LR, RL) rotations to the comparisons of the BST.
+   * @returns The methods `enableStats` wraps.
+   */
+  protected override _instrumentedMethods(): InstrumentedMethods {
+    return {
+      ...super._instrumentedMethods(),
+      _balanceLL: 'rotations',
+      _balanceRR: 'rotations',
+      _balanceLR: 'doubleRotations',
+      _balanceRL: 'doubleRotations',
+      _rotateSubtreeLeft: 'rotations',
+      _rotateSubtreeRight: 'rotations'
+    };
+  }
 }
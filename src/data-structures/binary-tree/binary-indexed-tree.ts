@@ -5,8 +5,14 @@
  * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
  * @license MIT License
  */
+import type { BinaryIndexedTreeOptions, DenseBinaryIndexedTreeStorage } from '../../types';
 import { getMSB } from '../../utils';
 
+/**
+ * 1. Fenwick Tree: A BinaryIndexedTree keeps prefix sums of `max` frequencies. Slot i (1-based) holds the sum of the `i & -i` frequencies ending at i, so reads and updates touch O(log max) slots.
+ * 2. Storage: The `sparse` storage (default) keeps only the touched slots in `freqMap`, for huge index spaces. The `float64` and `int32` storages keep all slots in a typed array, which is faster when `max` fits in memory; `int32` wraps around on overflow like Int32Array.
+ * 3. Construction: `fromArray` builds a dense tree from initial frequencies in O(n) instead of n updates.
+ */
 export class BinaryIndexedTree {
   protected readonly _freq: number;
   protected readonly _max: number;
@@ -16,13 +22,52 @@ export class BinaryIndexedTree {
    * value, a freqMap data structure, the most significant bit, and the count of negative frequencies.
    * @param  - - `frequency`: The default frequency value. It is optional and has a default
    * value of 0.
+   * - `storage`: `sparse` (default), `float64` or `int32`.
    */
-  constructor({ frequency = 0, max }: { frequency?: number; max: number }) {
+  constructor({ frequency = 0, max, storage = 'sparse' }: BinaryIndexedTreeOptions) {
     this._freq = frequency;
     this._max = max;
     this._freqMap = { 0: 0 };
     this._msb = getMSB(max);
     this._negativeCount = frequency < 0 ? max : 0;
+    if (storage !== 'sparse') {
+      this._tree = storage === 'int32' ? new Int32Array(max + 1) : new Float64Array(max + 1);
+      if (frequency !== 0) for (let i = 1; i <= max; i++) this._tree[i] = frequency * (i & -i);
+    }
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The function builds a dense tree from initial frequencies: every slot adds itself to its parent
+   * once, instead of one O(log n) update per value.
+   * @param values - The frequency of each index; `max` is their number.
+   * @param [storage='float64'] - `float64` or `int32`.
+   * @returns {BinaryIndexedTree} A new BinaryIndexedTree.
+   */
+  static fromArray(values: ArrayLike<number>, storage: DenseBinaryIndexedTreeStorage = 'float64'): BinaryIndexedTree {
+    const n = values.length;
+    const bit = new BinaryIndexedTree({ max: n, storage });
+    const tree = bit._tree!;
+    for (let i = 1; i <= n; i++) {
+      const value = values[i - 1];
+      if (value < 0) bit._negativeCount++;
+      tree[i] += value;
+      const parent = i + (i & -i);
+      if (parent <= n) tree[parent] += tree[i];
+    }
+    return bit;
+  }
+
+  protected _tree?: Float64Array | Int32Array;
+
+  /**
+   * The function returns the typed array of the dense storages, slot 0 unused.
+   * @returns The `_tree` array, or `undefined` for the sparse storage.
+   */
+  get tree(): Float64Array | Int32Array | undefined {
+    return this._tree;
   }
 
   protected _freqMap: Record<number, number>;
@@ -181,6 +226,7 @@ export class BinaryIndexedTree {
    * @returns a number.
    */
   protected _getFrequency(index: number): number {
+    if (this._tree) return this._tree[index];
     if (index in this.freqMap) {
       return this.freqMap[index];
     }
@@ -196,7 +242,8 @@ export class BinaryIndexedTree {
    * added to the freqMap at the specified `index`.
    */
   protected _updateFrequency(index: number, delta: number): void {
-    this.freqMap[index] = this._getFrequency(index) + delta;
+    if (this._tree) this._tree[index] += delta;
+    else this.freqMap[index] = this._getFrequency(index) + delta;
   }
 
   /**
@@ -1879,24 +1879,24 @@ export class BinaryTree<
       let current: NODE | null | undefined = node;
 
       while (current || stack.length > 0) {
-        while (current && !isNaN(this.extractor(current.key))) {
+        while (this.isRealNode(current)) {
           stack.push(current);
           current = current.left;
         }
 
         current = stack.pop();
 
-        if (current && !isNaN(this.extractor(current.key))) {
+        if (this.isRealNode(current)) {
           yield [current.key, current.value];
           current = current.right;
         }
       }
     } else {
-      if (node.left && !isNaN(this.extractor(node.key))) {
+      if (this.isRealNode(node.left)) {
         yield* this[Symbol.iterator](node.left);
       }
       yield [node.key, node.value];
-      if (node.right && !isNaN(this.extractor(node.key))) {
+      if (this.isRealNode(node.right)) {
         yield* this[Symbol.iterator](node.right);
       }
     }
@@ -6,17 +6,34 @@
  * @license MIT License
  */
 import type {
+  BinaryTreeDeleteResult,
   BSTNested,
   BSTNodeNested,
+  BSTMergeValues,
   BSTOptions,
+  BSTRangeOptions,
+  BSTSplitPieces,
   BTNCallback,
+  BinarySnapshotOptions,
+  BinarySource,
+  BinaryWriterOptions,
   BTNodePureExemplar,
+  Comparator,
+  InstrumentedMethods,
   KeyOrNodeOrEntry
 } from '../../types';
-import { BSTVariant, CP, DFSOrderPattern, IterationType } from '../../types';
+import { BinarySnapshotKind, BSTVariant, CP, DFSOrderPattern, IterationType } from '../../types';
 import { BinaryTree, BinaryTreeNode } from './binary-tree';
 import { IBinaryTree } from '../../interfaces';
 import { Queue } from '../queue';
+import {
+  BinaryReader,
+  binaryCodecs,
+  BinaryWriter,
+  readSnapshotHeader,
+  toBinaryReader,
+  writeSnapshotHeader
+} from '../../utils';
 
 export class BSTNode<K = any, V = any, NODE extends BSTNode<K, V, NODE> = BSTNodeNested<K, V>> extends BinaryTreeNode<
   K,
@@ -30,6 +47,26 @@ export class BSTNode<K = any, V = any, NODE extends BSTNode<K, V, NODE> = BSTNod
     this.parent = undefined;
     this._left = undefined;
     this._right = undefined;
+    this._subtreeSize = 1;
+  }
+
+  protected _subtreeSize: number;
+
+  /**
+   * The function returns the number of nodes in the subtree rooted at this node. It is only kept up
+   * to date by trees created with the `isOrderStatistic` option.
+   * @returns The size of the subtree.
+   */
+  get subtreeSize(): number {
+    return this._subtreeSize;
+  }
+
+  /**
+   * The function sets the number of nodes in the subtree rooted at this node.
+   * @param {number} value - The size of the subtree.
+   */
+  set subtreeSize(value: number) {
+    this._subtreeSize = value;
   }
 
   protected override _left?: NODE;
@@ -107,8 +144,11 @@ export class BST<
     super([], options);
 
     if (options) {
-      const { variant } = options;
+      const { variant, comparator, extractor, isOrderStatistic } = options;
       if (variant) this._variant = variant;
+      if (isOrderStatistic) this._isOrderStatistic = isOrderStatistic;
+      if (comparator) this._comparator = comparator;
+      else if (extractor) this._comparator = (a: K, b: K) => extractor(a) - extractor(b);
     }
 
     this._root = undefined;
@@ -136,6 +176,32 @@ export class BST<
     return this._variant;
   }
 
+  protected _isOrderStatistic = false;
+
+  /**
+   * The function returns whether nodes keep their subtree sizes, which makes `rank`, `select` and
+   * `countRange` O(log n).
+   * @returns The value of the `_isOrderStatistic` property.
+   */
+  get isOrderStatistic(): boolean {
+    return this._isOrderStatistic;
+  }
+
+  protected _comparator: Comparator<K> = (a: K, b: K) => {
+    // Numeric keys skip the extractor entirely, which keeps the hot paths free of `Number()` coercion
+    if (typeof a === 'number' && typeof b === 'number') return a - b;
+    return this.extractor(a) - this.extractor(b);
+  };
+
+  /**
+   * The function returns the comparator used to order keys in the tree, before the variant is applied.
+   * @returns The `_comparator` property, a function returning a negative number, zero or a positive
+   * number.
+   */
+  get comparator(): Comparator<K> {
+    return this._comparator;
+  }
+
   /**
    * The function creates a new BSTNode with the given key and value and returns it.
    * @param {K} key - The key parameter is of type K, which represents the type of the key for the node
@@ -160,6 +226,8 @@ export class BST<
     return new BST<K, V, NODE, TREE>([], {
       iterationType: this.iterationType,
       variant: this.variant,
+      comparator: this.comparator,
+      isOrderStatistic: this.isOrderStatistic,
       ...options
     }) as TREE;
   }
@@ -258,12 +326,14 @@ export class BST<
     if (this.root === undefined) {
       this._setRoot(newNode);
       this._size++;
+      this._updateSubtreeSizesToRoot(newNode);
       return true;
     }
 
     let current = this.root;
     while (current !== undefined) {
-      if (this._compare(current.key, newNode.key) === CP.eq) {
+      const compared = this._compareKeys(current.key, newNode.key);
+      if (compared === 0) {
         // if (current !== newNode) {
         // The key value is the same but the reference is different, update the value of the existing node
         this._replaceNode(current, newNode);
@@ -275,10 +345,11 @@ export class BST<
 
         //   return;
         // }
-      } else if (this._compare(current.key, newNode.key) === CP.gt) {
+      } else if (compared > 0) {
         if (current.left === undefined) {
           current.left = newNode;
           this._size++;
+          this._updateSubtreeSizesToRoot(newNode);
           return true;
         }
         current = current.left;
@@ -286,6 +357,7 @@ export class BST<
         if (current.right === undefined) {
           current.right = newNode;
           this._size++;
+          this._updateSubtreeSizesToRoot(newNode);
           return true;
         }
         current = current.right;
@@ -357,16 +429,16 @@ export class BST<
     let sorted: BTNodePureExemplar<K, V, NODE>[] = [];
 
     sorted = realBTNExemplars.sort((a, b) => {
-      let aR: number, bR: number;
-      if (this.isEntry(a)) aR = this.extractor(a[0]);
-      else if (this.isRealNode(a)) aR = this.extractor(a.key);
-      else aR = this.extractor(a);
+      let aK: K, bK: K;
+      if (this.isEntry(a)) aK = a[0];
+      else if (this.isRealNode(a)) aK = a.key;
+      else aK = a;
 
-      if (this.isEntry(b)) bR = this.extractor(b[0]);
-      else if (this.isRealNode(b)) bR = this.extractor(b.key);
-      else bR = this.extractor(b);
+      if (this.isEntry(b)) bK = b[0];
+      else if (this.isRealNode(b)) bK = b.key;
+      else bK = b;
 
-      return aR - bR;
+      return this.comparator(aK, bK);
     });
 
     const _dfs = (arr: BTNodePureExemplar<K, V, NODE>[]) => {
@@ -406,6 +478,32 @@ export class BST<
     return inserted;
   }
 
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `delete` function removes the nodes matching an identifier and, for trees with
+   * `isOrderStatistic`, fixes the subtree sizes above the removed position.
+   * @param identifier - The key, node or value returned by `callback` that identifies the node.
+   * @param {C} callback - The function that maps a node to the value compared with `identifier`.
+   * @returns an array of `BinaryTreeDeleteResult<NODE>`.
+   */
+  override delete<C extends BTNCallback<NODE>>(
+    identifier: ReturnType<C>,
+    callback: C = this._defaultOneParamCallback as C
+  ): BinaryTreeDeleteResult<NODE>[] {
+    const deletedResults = super.delete(identifier, callback);
+    for (const { needBalanced } of deletedResults) {
+      if (needBalanced) this._updateSubtreeSizesToRoot(needBalanced);
+    }
+    return deletedResults;
+  }
+
   /**
    * Time Complexity: O(log n)
    * Space Complexity: O(1)
@@ -429,23 +527,21 @@ export class BST<
     if (!this.root) return undefined;
     if (iterationType === IterationType.RECURSIVE) {
       const _dfs = (cur: NODE): NODE | undefined => {
-        if (cur.key === key) return cur;
+        const compared = this._compareKeys(cur.key, key);
+        if (compared === 0) return cur;
         if (!cur.left && !cur.right) return;
 
-        if (this._compare(cur.key, key) === CP.gt && cur.left) return _dfs(cur.left);
-        if (this._compare(cur.key, key) === CP.lt && cur.right) return _dfs(cur.right);
+        if (compared > 0 && cur.left) return _dfs(cur.left);
+        if (compared < 0 && cur.right) return _dfs(cur.right);
       };
 
       return _dfs(this.root);
     } else {
-      const queue = new Queue<NODE>([this.root]);
-      while (queue.size > 0) {
-        const cur = queue.shift();
-        if (cur) {
-          if (this._compare(cur.key, key) === CP.eq) return cur;
-          if (this._compare(cur.key, key) === CP.gt) cur.left && queue.push(cur.left);
-          if (this._compare(cur.key, key) === CP.lt) cur.right && queue.push(cur.right);
-        }
+      let cur: NODE | undefined = this.root;
+      while (cur) {
+        const compared = this._compareKeys(cur.key, key);
+        if (compared === 0) return cur;
+        cur = compared > 0 ? cur.left : cur.right;
       }
     }
   }
@@ -500,8 +596,9 @@ export class BST<
         if (!cur.left && !cur.right) return;
         // TODO potential bug
         if (callback === this._defaultOneParamCallback) {
-          if (this._compare(cur.key, identifier as K) === CP.gt) cur.left && _traverse(cur.left);
-          if (this._compare(cur.key, identifier as K) === CP.lt) cur.right && _traverse(cur.right);
+          const compared = this._compareKeys(cur.key, identifier as K);
+          if (compared > 0) cur.left && _traverse(cur.left);
+          if (compared < 0) cur.right && _traverse(cur.right);
         } else {
           cur.left && _traverse(cur.left);
           cur.right && _traverse(cur.right);
@@ -521,8 +618,9 @@ export class BST<
           }
           // TODO potential bug
           if (callback === this._defaultOneParamCallback) {
-            if (this._compare(cur.key, identifier as K) === CP.gt) cur.left && queue.push(cur.left);
-            if (this._compare(cur.key, identifier as K) === CP.lt) cur.right && queue.push(cur.right);
+            const compared = this._compareKeys(cur.key, identifier as K);
+            if (compared > 0) cur.left && queue.push(cur.left);
+            if (compared < 0) cur.right && queue.push(cur.right);
           } else {
             cur.left && queue.push(cur.left);
             cur.right && queue.push(cur.right);
@@ -702,15 +800,16 @@ export class BST<
     if (!this.root) return ans;
 
     const targetKey = targetNode.key;
+    const sign = lesserOrGreater === CP.lt ? -1 : lesserOrGreater === CP.gt ? 1 : 0;
+    const _isMatched = (key: K) => Math.sign(this._compareKeys(key, targetKey)) === sign;
 
     if (iterationType === IterationType.RECURSIVE) {
       const _traverse = (cur: NODE) => {
-        const compared = this._compare(cur.key, targetKey);
-        if (compared === lesserOrGreater) ans.push(callback(cur));
+        if (_isMatched(cur.key)) ans.push(callback(cur));
 
         if (!cur.left && !cur.right) return;
-        if (cur.left && this._compare(cur.left.key, targetKey) === lesserOrGreater) _traverse(cur.left);
-        if (cur.right && this._compare(cur.right.key, targetKey) === lesserOrGreater) _traverse(cur.right);
+        if (cur.left && _isMatched(cur.left.key)) _traverse(cur.left);
+        if (cur.right && _isMatched(cur.right.key)) _traverse(cur.right);
       };
 
       _traverse(this.root);
@@ -720,11 +819,10 @@ export class BST<
       while (queue.size > 0) {
         const cur = queue.shift();
         if (cur) {
-          const compared = this._compare(cur.key, targetKey);
-          if (compared === lesserOrGreater) ans.push(callback(cur));
+          if (_isMatched(cur.key)) ans.push(callback(cur));
 
-          if (cur.left && this._compare(cur.left.key, targetKey) === lesserOrGreater) queue.push(cur.left);
-          if (cur.right && this._compare(cur.right.key, targetKey) === lesserOrGreater) queue.push(cur.right);
+          if (cur.left && _isMatched(cur.left.key)) queue.push(cur.left);
+          if (cur.right && _isMatched(cur.right.key)) queue.push(cur.right);
         }
       }
       return ans;
@@ -733,55 +831,516 @@ export class BST<
 
   /**
    * Time Complexity: O(log n)
-   * Space Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n) with `isOrderStatistic`, O(n) otherwise
+   * Space Complexity: O(1)
+   *
+   * The `rank` function counts the keys that come before a key in tree order. The key itself does not
+   * have to be in the tree.
+   * @param {K} key - The key to rank.
+   * @returns The number of keys lesser than `key`, which is also the index `key` has or would have in
+   * an in-order traversal.
    */
+  rank(key: K): number {
+    return this._countBefore(key, false);
+  }
 
   /**
    * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n) with `isOrderStatistic`, O(n) otherwise
+   * Space Complexity: O(1)
+   *
+   * The `select` function finds the node at an in-order index, so `select(0)` is the node with the
+   * least key.
+   * @param {number} index - The 0-based position of the node in tree order.
+   * @returns The node at `index`, or `undefined` if `index` is out of range.
+   */
+  select(index: number): NODE | undefined {
+    if (index < 0 || index >= this.size) return undefined;
+    if (!this._isOrderStatistic) return this.dfs(node => node, 'in')[index];
+
+    let node = this.root;
+    while (this.isRealNode(node)) {
+      const leftSize = node.left ? node.left.subtreeSize : 0;
+      if (index < leftSize) {
+        node = node.left;
+      } else if (index === leftSize) {
+        return node;
+      } else {
+        index -= leftSize + 1;
+        node = node.right;
+      }
+    }
+    return undefined;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n) with `isOrderStatistic`, O(n) otherwise
+   * Space Complexity: O(1)
+   *
+   * The `countRange` function counts the keys between two bounds in tree order, both inclusive.
+   * @param {K} lo - The lower bound.
+   * @param {K} hi - The upper bound.
+   * @returns The number of keys `k` with `lo <= k <= hi`.
+   */
+  countRange(lo: K, hi: K): number {
+    return Math.max(0, this._countBefore(hi, true) - this._countBefore(lo, false));
+  }
+
+  /**
+   * Time Complexity: O(log n + k)
+   * Space Complexity: O(log n)
+   */
+
+  /**
+   * Time Complexity: O(log n + k), where k is the number of nodes yielded
    * Space Complexity: O(log n)
    *
-   * The `perfectlyBalance` function balances a binary search tree by adding nodes in a way that
-   * ensures the tree is perfectly balanced.
-   * @param iterationType - The `iterationType` parameter is an optional parameter that specifies the
-   * type of iteration to use when building a balanced binary search tree. It can have two possible
-   * values:
-   * @returns The function `perfectlyBalance` returns a boolean value.
+   * The `rangeIterator` function lazily yields the nodes whose keys lie between two bounds, in tree
+   * order or in reverse. It descends once to the first node in range and then walks the tree in
+   * order, so stopping early costs nothing for the rest of the range and no array is built. The tree
+   * must not be modified while the iterator is in use.
+   * @param {K | undefined} lo - The lower bound, or `undefined` to start at the least key.
+   * @param {K | undefined} hi - The upper bound, or `undefined` to run up to the greatest key.
+   * @param {BSTRangeOptions} [options] - `inclusive` (default `true`) decides whether keys equal to a
+   * bound are yielded; with `reverse` the nodes are yielded from `hi` down to `lo`.
+   * @param {C} callback - Called on each node in range; by default it returns the key of the node.
+   * @returns A generator of the values returned by `callback`.
    */
-  perfectlyBalance(iterationType = this.iterationType): boolean {
-    const sorted = this.dfs(node => node, 'in'),
-      n = sorted.length;
-    this.clear();
+  *rangeIterator<C extends BTNCallback<NODE>>(
+    lo: K | undefined,
+    hi: K | undefined,
+    options?: BSTRangeOptions,
+    callback: C = this._defaultOneParamCallback as C
+  ): Generator<ReturnType<C>, void, undefined> {
+    const inclusive = options?.inclusive ?? true;
+    const reverse = options?.reverse ?? false;
+    const dir = reverse ? -1 : 1;
+    const start = reverse ? hi : lo;
+    const end = reverse ? lo : hi;
+    const near = reverse ? 'right' : 'left';
+    const far = reverse ? 'left' : 'right';
+
+    const stack: NODE[] = [];
+    let node = this.root;
+    while (this.isRealNode(node)) {
+      const compared = start === undefined ? 1 : this._compareKeys(node.key, start) * dir;
+      if (compared > 0 || (inclusive && compared === 0)) {
+        stack.push(node);
+        node = node[near];
+      } else {
+        node = node[far];
+      }
+    }
 
-    if (sorted.length < 1) return false;
-    if (iterationType === IterationType.RECURSIVE) {
-      const buildBalanceBST = (l: number, r: number) => {
-        if (l > r) return;
-        const m = l + Math.floor((r - l) / 2);
-        const midNode = sorted[m];
-        this.add([midNode.key, midNode.value]);
-        buildBalanceBST(l, m - 1);
-        buildBalanceBST(m + 1, r);
-      };
+    while (stack.length > 0) {
+      const cur = stack.pop()!;
+      if (end !== undefined) {
+        const compared = this._compareKeys(cur.key, end) * dir;
+        if (compared > 0 || (!inclusive && compared === 0)) return;
+      }
+      yield callback(cur);
+      node = cur[far];
+      while (this.isRealNode(node)) {
+        stack.push(node);
+        node = node[near];
+      }
+    }
+  }
 
-      buildBalanceBST(0, n - 1);
-      return true;
+  /**
+   * Time Complexity: O(log n + k)
+   * Space Complexity: O(log n)
+   */
+
+  /**
+   * Time Complexity: O(log n + k), where k is the number of keys yielded
+   * Space Complexity: O(log n)
+   *
+   * The `keysFrom` function is a cursor that lazily yields the keys from a key onwards, which suits
+   * paging: ask for the keys from the last key of the previous page and stop after a page.
+   * @param {K} key - The key to start at. It does not have to be in the tree.
+   * @param [reverse=false] - Whether to walk towards the least key instead of the greatest.
+   * @returns A generator of keys, starting with `key` itself if it is in the tree.
+   */
+  *keysFrom(key: K, reverse = false): Generator<K, void, undefined> {
+    const callback = (node: NODE) => node.key;
+    if (reverse) {
+      yield* this.rangeIterator(undefined, key, { reverse }, callback);
     } else {
-      const stack: [[number, number]] = [[0, n - 1]];
-      while (stack.length > 0) {
-        const popped = stack.pop();
-        if (popped) {
-          const [l, r] = popped;
-          if (l <= r) {
-            const m = l + Math.floor((r - l) / 2);
-            const midNode = sorted[m];
-            this.add([midNode.key, midNode.value]);
-            stack.push([m + 1, r]);
-            stack.push([l, m - 1]);
-          }
-        }
+      yield* this.rangeIterator(key, undefined, undefined, callback);
+    }
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `ceiling` function finds the node with the least key that is greater than or equal to a key.
+   * @param {K} key - The key to look up.
+   * @returns The node found, or `undefined` if there is none.
+   */
+  ceiling(key: K): NODE | undefined {
+    return this._getBound(key, 1, true);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `floor` function finds the node with the greatest key that is lesser than or equal to a key.
+   * @param {K} key - The key to look up.
+   * @returns The node found, or `undefined` if there is none.
+   */
+  floor(key: K): NODE | undefined {
+    return this._getBound(key, -1, true);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `higher` function finds the node with the least key that is strictly greater than a key.
+   * @param {K} key - The key to look up.
+   * @returns The node found, or `undefined` if there is none.
+   */
+  higher(key: K): NODE | undefined {
+    return this._getBound(key, 1, false);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `lower` function finds the node with the greatest key that is strictly lesser than a key.
+   * @param {K} key - The key to look up.
+   * @returns The node found, or `undefined` if there is none.
+   */
+  lower(key: K): NODE | undefined {
+    return this._getBound(key, -1, false);
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   */
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `buildFromSorted` function replaces the contents of the tree with keys, nodes or entries that
+   * are already in ascending tree order. The nodes are linked directly into a balanced shape in one
+   * linear pass, so loading a sorted snapshot needs no rotations and only the comparisons that check
+   * the order.
+   * @param keysOrNodesOrEntries - Keys, nodes or entries in strictly ascending order. `undefined` and
+   * `null` elements are skipped.
+   * @param [values] - An optional iterable of values paired with the keys in the same order.
+   * @returns The number of nodes in the tree.
+   */
+  buildFromSorted(
+    keysOrNodesOrEntries: Iterable<KeyOrNodeOrEntry<K, V, NODE>>,
+    values?: Iterable<V | undefined>
+  ): number {
+    const valuesIterator = values ? values[Symbol.iterator]() : undefined;
+    const nodes: NODE[] = [];
+    for (const kve of keysOrNodesOrEntries) {
+      const node = this.keyValueOrEntryToNode(kve, valuesIterator?.next().value);
+      if (node) nodes.push(node);
+    }
+    if (!this._isStrictlyAscending(nodes)) {
+      throw new Error('buildFromSorted requires distinct keys in ascending order');
+    }
+
+    this.clear();
+    this._buildBalanced(nodes);
+    return this.size;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(log n)
+   */
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(log n)
+   *
+   * The `writeBinary` function writes a binary snapshot of the tree: a header, the number of entries,
+   * then each key and value in ascending order through the codecs.
+   * @param {BinaryWriter} writer - The writer to append to.
+   * @param [options] - `keyCodec` and `valueCodec`, `binaryCodecs.any` by default.
+   */
+  writeBinary(writer: BinaryWriter, options?: BinarySnapshotOptions<K, V | undefined>): void {
+    const keyCodec = options?.keyCodec ?? binaryCodecs.any;
+    const valueCodec = options?.valueCodec ?? binaryCodecs.any;
+    writeSnapshotHeader(writer, BinarySnapshotKind.BST);
+    writer.writeVarUint(this.size);
+    for (const [key, value] of this) {
+      keyCodec.write(writer, key);
+      valueCodec.write(writer, value);
+    }
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `toBinary` function returns the snapshot `writeBinary` writes.
+   * @param [options] - The codecs, plus `BinaryWriter` options; with `onChunk` the snapshot is streamed
+   * and an empty array is returned.
+   * @returns The snapshot bytes.
+   */
+  toBinary(options?: BinarySnapshotOptions<K, V | undefined> & BinaryWriterOptions): Uint8Array {
+    const writer = new BinaryWriter(options);
+    this.writeBinary(writer, options);
+    return writer.finish();
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `loadBinary` function replaces the contents of the tree with a snapshot. The keys are already
+   * sorted, so the tree is linked in one pass by `buildFromSorted` with no rotations.
+   * @param source - The snapshot bytes, an iterable of chunks, or a reader positioned at a snapshot.
+   * @param [options] - The codecs the snapshot was written with.
+   * @returns The number of nodes in the tree.
+   */
+  loadBinary(source: BinarySource | BinaryReader, options?: BinarySnapshotOptions<K, V | undefined>): number {
+    const keyCodec = options?.keyCodec ?? binaryCodecs.any;
+    const valueCodec = options?.valueCodec ?? binaryCodecs.any;
+    const reader = toBinaryReader(source);
+    readSnapshotHeader(reader, BinarySnapshotKind.BST);
+    const count = reader.readVarUint();
+    const keys: K[] = new Array(count);
+    const values: (V | undefined)[] = new Array(count);
+    for (let i = 0; i < count; i++) {
+      keys[i] = keyCodec.read(reader);
+      values[i] = valueCodec.read(reader);
+    }
+    return this.buildFromSorted(keys, values);
+  }
+
+  /**
+   * Time Complexity: O(log n), plus O(k) to count the k moved keys unless the tree is order-statistic
+   * Space Complexity: O(log n)
+   */
+
+  /**
+   * Time Complexity: O(log n), plus O(k) to count the k moved keys unless the tree is order-statistic
+   * Space Complexity: O(log n)
+   *
+   * The `split` function moves the keys greater than or equal to `key` into a new tree and returns it,
+   * keeping the lesser keys. The path to `key` is cut and both halves are joined back together, so a
+   * balanced tree stays balanced without any rebalancing pass.
+   * @param {K} key - The key to split at.
+   * @returns A new tree, created by `createTree`, with the keys from `key` on.
+   */
+  split(key: K): TREE {
+    const root = this._detachedRoot();
+    const [less, , found, greater, greaterRank] = this._splitNodes(root, this._rankOf(root), key);
+    const [right] = found ? this._joinNodes(undefined, 0, found, greater, greaterRank) : [greater];
+    const tree = this.createTree();
+    this._shareLeaves(tree);
+    const moved = this._countNodes(right);
+    tree._setJoinedRoot(right, moved);
+    this._setJoinedRoot(less, this._size - moved);
+    return tree;
+  }
+
+  /**
+   * Time Complexity: O(log n + log m), or O(m) when a Red-Black tree adopts nodes it did not split off
+   * Space Complexity: O(log n)
+   */
+
+  /**
+   * Time Complexity: O(log n + log m), or O(m) when a Red-Black tree adopts nodes it did not split off
+   * Space Complexity: O(log n)
+   *
+   * The `join` function moves every node of `right`, whose keys must all be greater than the keys of this
+   * tree, to the end of this tree and empties `right`. It is the inverse of `split`.
+   * @param {TREE} right - A tree of the same kind with greater keys.
+   * @returns The number of nodes in the tree.
+   */
+  join(right: TREE): number {
+    if ((right as unknown) === this || right.size === 0) return this.size;
+    const leftRoot = this._detachedRoot();
+    if (leftRoot) {
+      let max = leftRoot;
+      while (this.isRealNode(max.right)) max = max.right;
+      let min = right.root!;
+      while (right.isRealNode(min.left)) min = min.left;
+      if (this._compareKeys(max.key, min.key) >= 0) {
+        throw new Error('join requires every key of the right tree to be greater than the keys of this tree');
       }
-      return true;
     }
+    const size = this._size + right.size;
+    this._shareLeaves(right);
+    const rightRoot = this._detachedRoot(right.root);
+    right.clear();
+    if (!leftRoot) {
+      this._setJoinedRoot(rightRoot, size);
+      return size;
+    }
+    const [rest, restRank, last] = this._splitLast(leftRoot, this._rankOf(leftRoot));
+    const [root] = this._joinNodes(rest, restRank, last, rightRoot, this._rankOf(rightRoot));
+    this._setJoinedRoot(root, size);
+    return size;
+  }
+
+  /**
+   * Time Complexity: O(m log(n / m + 1)), where m is the size of the smaller tree
+   * Space Complexity: O(log n + log m)
+   */
+
+  /**
+   * Time Complexity: O(m log(n / m + 1)), where m is the size of the smaller tree
+   * Space Complexity: O(log n + log m)
+   *
+   * The `union` function adds the entries of `other` to this tree by the join-based algorithm: this tree
+   * is split at the root key of `other`, each half is united with a subtree of `other`, and the results
+   * are joined. Merging a small tree into a large one therefore touches only the paths it needs, and
+   * merging trees of equal size is linear. `other` is left unchanged; a tree united with itself is
+   * united with a copy of itself.
+   * @param other - A tree ordered by the same comparator.
+   * @param [merge] - Gives the value of a key in both trees. By default the value of `other` wins, as
+   * with `add`.
+   * @returns The number of nodes in the tree.
+   */
+  union(other: BST<K, V, any, any>, merge?: BSTMergeValues<K, V>): number {
+    // Splitting this tree would also cut the nodes of `other` before they are read
+    if (other === this) other = this.clone();
+    let added = 0;
+    const unite = (node: NODE | undefined, rank: number, source: NODE | undefined): [NODE | undefined, number] => {
+      if (!other.isRealNode(source)) return [node, rank];
+      const [less, lessRank, found, greater, greaterRank] = this._splitNodes(node, rank, source.key);
+      const [left, leftRank] = unite(less, lessRank, source.left);
+      const [right, rightRank] = unite(greater, greaterRank, source.right);
+      let mid = found;
+      if (mid) this._mergeNodes(mid, source, merge);
+      else {
+        mid = this._copyNode(source);
+        added++;
+      }
+      return this._joinNodes(left, leftRank, mid, right, rightRank);
+    };
+
+    const root = this._detachedRoot();
+    const [united] = unite(root, this._rankOf(root), other.root);
+    this._setJoinedRoot(united, this._size + added);
+    return this._size;
+  }
+
+  /**
+   * Time Complexity: O(m log(n / m + 1)), where m is the size of the smaller tree
+   * Space Complexity: O(log n + log m)
+   */
+
+  /**
+   * Time Complexity: O(m log(n / m + 1)), where m is the size of the smaller tree
+   * Space Complexity: O(log n + log m)
+   *
+   * The `intersection` function keeps only the keys of this tree that are also in `other`, by the
+   * join-based algorithm. `other` is left unchanged; a tree intersected with itself keeps every key.
+   * @param other - A tree ordered by the same comparator.
+   * @param [merge] - Gives the value of a kept key. By default the value of this tree is kept.
+   * @returns The number of nodes in the tree.
+   */
+  intersection(other: BST<K, V, any, any>, merge?: BSTMergeValues<K, V>): number {
+    if (other === this) {
+      if (!merge) return this.size;
+      other = this.clone();
+    }
+    let kept = 0;
+    const intersect = (node: NODE | undefined, rank: number, source: NODE | undefined): [NODE | undefined, number] => {
+      if (!node || !other.isRealNode(source)) return [undefined, 0];
+      const [less, lessRank, found, greater, greaterRank] = this._splitNodes(node, rank, source.key);
+      const [left, leftRank] = intersect(less, lessRank, source.left);
+      const [right, rightRank] = intersect(greater, greaterRank, source.right);
+      if (!found) return this._joinPieces(left, leftRank, right, rightRank);
+      if (merge) found.value = merge(found.value, source.value, found.key);
+      kept++;
+      return this._joinNodes(left, leftRank, found, right, rightRank);
+    };
+
+    const root = this._detachedRoot();
+    const [intersected] = intersect(root, this._rankOf(root), other.root);
+    this._setJoinedRoot(intersected, kept);
+    return this._size;
+  }
+
+  /**
+   * Time Complexity: O(m log(n / m + 1)), where m is the size of the smaller tree
+   * Space Complexity: O(log n + log m)
+   */
+
+  /**
+   * Time Complexity: O(m log(n / m + 1)), where m is the size of the smaller tree
+   * Space Complexity: O(log n + log m)
+   *
+   * The `difference` function deletes the keys of `other` from this tree by the join-based algorithm.
+   * `other` is left unchanged; a tree minus itself is empty.
+   * @param other - A tree ordered by the same comparator.
+   * @returns The number of nodes in the tree.
+   */
+  difference(other: BST<K, V, any, any>): number {
+    if (other === this) {
+      this.clear();
+      return 0;
+    }
+    let removed = 0;
+    const subtract = (node: NODE | undefined, rank: number, source: NODE | undefined): [NODE | undefined, number] => {
+      if (!node) return [undefined, 0];
+      if (!other.isRealNode(source)) return [node, rank];
+      const [less, lessRank, found, greater, greaterRank] = this._splitNodes(node, rank, source.key);
+      if (found) {
+        removed++;
+        this._discardNode(found);
+      }
+      const [left, leftRank] = subtract(less, lessRank, source.left);
+      const [right, rightRank] = subtract(greater, greaterRank, source.right);
+      return this._joinPieces(left, leftRank, right, rightRank);
+    };
+
+    const root = this._detachedRoot();
+    const [rest] = subtract(root, this._rankOf(root), other.root);
+    this._setJoinedRoot(rest, this._size - removed);
+    return this._size;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   */
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `perfectlyBalance` function relinks the existing nodes of the tree into a perfectly balanced
+   * shape in one linear pass, without creating nodes or comparing keys.
+   * @returns The function `perfectlyBalance` returns a boolean value.
+   */
+  perfectlyBalance(): boolean {
+    const sorted = this.dfs(node => node, 'in');
+    this.clear();
+
+    if (sorted.length < 1) return false;
+    this._buildBalanced(sorted);
+    return true;
   }
 
   /**
@@ -852,6 +1411,401 @@ export class BST<
     return balanced;
   }
 
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(log n)
+   *
+   * The function links nodes in ascending order into a balanced tree by making the middle node of
+   * every range the root of that range, then sets it as the root of this tree. Subtrees are finished
+   * bottom-up, so `_onBuiltNode` sees its children complete. The tree must be empty.
+   * @param {NODE[]} nodes - The nodes in ascending tree order.
+   */
+  protected _buildBalanced(nodes: NODE[]): void {
+    const n = nodes.length;
+    if (n === 0) return;
+    // Every level but the deepest one is full
+    const maxDepth = Math.floor(Math.log2(n));
+
+    const build = (l: number, r: number, depth: number): NODE | undefined => {
+      if (l > r) return undefined;
+      const m = l + ((r - l) >> 1);
+      const node = nodes[m];
+      node.left = build(l, m - 1, depth + 1);
+      node.right = build(m + 1, r, depth + 1);
+      node.subtreeSize = r - l + 1;
+      this._onBuiltNode(node, depth, maxDepth);
+      return node;
+    };
+
+    this._setRoot(build(0, n - 1, 0));
+    this._size = n;
+  }
+
+  /**
+   * The function is called for every node linked by `_buildBalanced` once both of its subtrees are
+   * built. Subclasses use it to set their balancing metadata.
+   * @param {NODE} node - The node that was linked.
+   * @param {number} depth - The depth of the node, 0 for the root.
+   * @param {number} maxDepth - The depth of the deepest level of the tree.
+   */
+  protected _onBuiltNode(node: NODE, depth: number, maxDepth: number): void {}
+
+  /**
+   * The function checks whether the keys of nodes are strictly ascending in tree order.
+   * @param {NODE[]} nodes - The nodes to check.
+   * @returns a boolean value.
+   */
+  protected _isStrictlyAscending(nodes: NODE[]): boolean {
+    for (let i = 1; i < nodes.length; i++) {
+      if (this._compareKeys(nodes[i - 1].key, nodes[i].key) >= 0) return false;
+    }
+    return true;
+  }
+
+  /**
+   * The function returns the root of a tree, or `undefined` if it has no real root.
+   * @param {NODE | undefined} [root] - The root to check, this tree's root by default.
+   * @returns The root or `undefined`.
+   */
+  protected _detachedRoot(root: NODE | undefined = this.root): NODE | undefined {
+    return this.isRealNode(root) ? root : undefined;
+  }
+
+  /**
+   * The function detaches a node from its parent and its children, so it can be joined elsewhere.
+   * @param {NODE} node - The node to detach.
+   * @returns The left and right subtrees, `undefined` when empty.
+   */
+  protected _detachChildren(node: NODE): [NODE | undefined, NODE | undefined] {
+    const left = this.isRealNode(node.left) ? node.left : undefined;
+    const right = this.isRealNode(node.right) ? node.right : undefined;
+    if (left) left.parent = undefined;
+    if (right) right.parent = undefined;
+    node.left = undefined;
+    node.right = undefined;
+    node.parent = undefined;
+    return [left, right];
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(log n)
+   *
+   * The function splits a detached subtree at a key by cutting the path to the key and joining the
+   * subtrees hanging off it into the lesser and the greater piece.
+   * @param {NODE | undefined} node - The root of the subtree.
+   * @param {number} rank - The rank of the subtree.
+   * @param {K} key - The key to split at.
+   * @returns The lesser piece, the node with the key if any, and the greater piece, with their ranks.
+   */
+  protected _splitNodes(node: NODE | undefined, rank: number, key: K): BSTSplitPieces<NODE> {
+    if (!node) return [undefined, 0, undefined, undefined, 0];
+    const compared = this._compareKeys(key, node.key);
+    const [left, right] = this._detachChildren(node);
+    const leftRank = this._childRank(node, rank, left);
+    const rightRank = this._childRank(node, rank, right);
+    if (compared === 0) return [left, leftRank, node, right, rightRank];
+    if (compared < 0) {
+      const [less, lessRank, found, greater, greaterRank] = this._splitNodes(left, leftRank, key);
+      const [joined, joinedRank] = this._joinNodes(greater, greaterRank, node, right, rightRank);
+      return [less, lessRank, found, joined, joinedRank];
+    }
+    const [less, lessRank, found, greater, greaterRank] = this._splitNodes(right, rightRank, key);
+    const [joined, joinedRank] = this._joinNodes(left, leftRank, node, less, lessRank);
+    return [joined, joinedRank, found, greater, greaterRank];
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(log n)
+   *
+   * The function takes the greatest node out of a detached subtree.
+   * @param {NODE} node - The root of the subtree.
+   * @param {number} rank - The rank of the subtree.
+   * @returns The rest of the subtree, its rank and the greatest node.
+   */
+  protected _splitLast(node: NODE, rank: number): [NODE | undefined, number, NODE] {
+    const [left, right] = this._detachChildren(node);
+    const leftRank = this._childRank(node, rank, left);
+    if (!right) return [left, leftRank, node];
+    const [rest, restRank, last] = this._splitLast(right, this._childRank(node, rank, right));
+    const [joined, joinedRank] = this._joinNodes(left, leftRank, node, rest, restRank);
+    return [joined, joinedRank, last];
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(log n)
+   *
+   * The function joins two detached subtrees, all of whose keys in `left` are less than those in `right`.
+   * @param {NODE | undefined} left - The root of the lesser subtree.
+   * @param {number} leftRank - The rank of `left`.
+   * @param {NODE | undefined} right - The root of the greater subtree.
+   * @param {number} rightRank - The rank of `right`.
+   * @returns The root of the joined subtree and its rank.
+   */
+  protected _joinPieces(
+    left: NODE | undefined,
+    leftRank: number,
+    right: NODE | undefined,
+    rightRank: number
+  ): [NODE | undefined, number] {
+    if (!left) return [right, rightRank];
+    if (!right) return [left, leftRank];
+    const [rest, restRank, last] = this._splitLast(left, leftRank);
+    return this._joinNodes(rest, restRank, last, right, rightRank);
+  }
+
+  /**
+   * The function joins two detached subtrees through a middle node whose key lies between them. A plain
+   * BST just links them; balanced trees override it to rebalance along one spine only, in time
+   * proportional to the difference of the ranks.
+   * @param {NODE | undefined} left - The root of the lesser subtree.
+   * @param {number} leftRank - The rank of `left`.
+   * @param {NODE} mid - The detached middle node.
+   * @param {NODE | undefined} right - The root of the greater subtree.
+   * @param {number} rightRank - The rank of `right`.
+   * @returns The root of the joined subtree and its rank.
+   */
+  protected _joinNodes(
+    left: NODE | undefined,
+    leftRank: number,
+    mid: NODE,
+    right: NODE | undefined,
+    rightRank: number
+  ): [NODE, number] {
+    this._linkChildren(mid, left, right);
+    return [mid, 0];
+  }
+
+  /**
+   * The function returns the rank a balanced tree joins by. A plain BST does not balance, so it is 0.
+   * @param {NODE | undefined} node - The root of a subtree.
+   * @returns The rank of the subtree.
+   */
+  protected _rankOf(node: NODE | undefined): number {
+    return 0;
+  }
+
+  /**
+   * The function returns the rank of a child subtree from the rank of its parent.
+   * @param {NODE} parent - The parent node.
+   * @param {number} parentRank - The rank of the subtree rooted at `parent`.
+   * @param {NODE | undefined} child - The child subtree.
+   * @returns The rank of the child subtree.
+   */
+  protected _childRank(parent: NODE, parentRank: number, child: NODE | undefined): number {
+    return this._rankOf(child);
+  }
+
+  /**
+   * The function links the children of a node and refreshes its metadata.
+   * @param {NODE} node - The node.
+   * @param {NODE | undefined} left - The new left subtree.
+   * @param {NODE | undefined} right - The new right subtree.
+   */
+  protected _linkChildren(node: NODE, left: NODE | undefined, right: NODE | undefined): void {
+    node.left = left;
+    node.right = right;
+    this._refreshNode(node);
+  }
+
+  /**
+   * The function recomputes the metadata of a node from its children after they were relinked.
+   * @param {NODE} node - The node.
+   */
+  protected _refreshNode(node: NODE): void {
+    this._updateSubtreeSize(node);
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function rotates a detached subtree to the left and returns its new root.
+   * @param {NODE} node - The root of the subtree, which has a right child.
+   * @returns The new root.
+   */
+  protected _rotateSubtreeLeft(node: NODE): NODE {
+    const pivot = node.right!;
+    node.right = pivot.left;
+    this._refreshNode(node);
+    pivot.left = node;
+    this._refreshNode(pivot);
+    return pivot;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function rotates a detached subtree to the right and returns its new root.
+   * @param {NODE} node - The root of the subtree, which has a left child.
+   * @returns The new root.
+   */
+  protected _rotateSubtreeRight(node: NODE): NODE {
+    const pivot = node.left!;
+    node.left = pivot.right;
+    this._refreshNode(node);
+    pivot.right = node;
+    this._refreshNode(pivot);
+    return pivot;
+  }
+
+  /**
+   * The function installs the result of a split, join or set operation as the root of the tree.
+   * @param {NODE | undefined} root - The new root.
+   * @param {number} size - The number of nodes under it.
+   */
+  protected _setJoinedRoot(root: NODE | undefined, size: number): void {
+    this._setRoot(root);
+    this._size = size;
+  }
+
+  /**
+   * The function makes the nodes of another tree valid in this one before they are moved over. Only the
+   * Red-Black tree, whose leaves are its own Sentinel, needs to do anything.
+   * @param {TREE} tree - The tree whose nodes will be moved.
+   */
+  protected _shareLeaves(tree: TREE): void {}
+
+  /**
+   * Time Complexity: O(k), or O(1) for an order-statistic tree
+   * Space Complexity: O(log k)
+   *
+   * The function counts the nodes of a subtree.
+   * @param {NODE | undefined} node - The root of the subtree.
+   * @returns The number of nodes.
+   */
+  protected _countNodes(node: NODE | undefined): number {
+    if (!node) return 0;
+    if (this._isOrderStatistic) return node.subtreeSize;
+    let count = 0;
+    const stack: NODE[] = [node];
+    while (stack.length > 0) {
+      const cur = stack.pop()!;
+      count++;
+      if (this.isRealNode(cur.left)) stack.push(cur.left);
+      if (this.isRealNode(cur.right)) stack.push(cur.right);
+    }
+    return count;
+  }
+
+  /**
+   * The function creates the node `union` adds for a key that only `other` has.
+   * @param {NODE} source - The node of the other tree.
+   * @returns A new node of this tree.
+   */
+  protected _copyNode(source: NODE): NODE {
+    return this.createNode(source.key, source.value);
+  }
+
+  /**
+   * The function merges the node of another tree into the node of this tree with the same key.
+   * @param {NODE} target - The node of this tree.
+   * @param {NODE} source - The node of the other tree.
+   * @param [merge] - Gives the merged value; the value of `source` by default.
+   */
+  protected _mergeNodes(target: NODE, source: NODE, merge?: BSTMergeValues<K, V>): void {
+    target.value = merge ? merge(target.value, source.value, target.key) : source.value;
+  }
+
+  /**
+   * The function is called for every node `difference` removes from this tree.
+   * @param {NODE} node - The removed node.
+   */
+  protected _discardNode(node: NODE): void {}
+
+  /**
+   * The function counts the keys that come before a key in tree order, walking down from the root and
+   * adding up the sizes of the left subtrees it passes.
+   * @param {K} key - The key to count up to.
+   * @param {boolean} inclusive - Whether a node with the same key is counted too.
+   * @returns The number of keys before `key`.
+   */
+  protected _countBefore(key: K, inclusive: boolean): number {
+    let count = 0;
+    if (!this._isOrderStatistic) {
+      this.dfs(node => {
+        const compared = this._compareKeys(node.key, key);
+        if (compared < 0 || (inclusive && compared === 0)) count++;
+      });
+      return count;
+    }
+
+    let node = this.root;
+    while (this.isRealNode(node)) {
+      const compared = this._compareKeys(key, node.key);
+      if (compared > 0 || (inclusive && compared === 0)) {
+        count += (node.left ? node.left.subtreeSize : 0) + 1;
+        node = node.right;
+      } else {
+        node = node.left;
+      }
+    }
+    return count;
+  }
+
+  /**
+   * The function walks down from the root to the node closest to a key on one side of it, in tree
+   * order.
+   * @param {K} key - The key to look up.
+   * @param {1 | -1} dir - `1` looks for greater keys, `-1` for lesser keys.
+   * @param {boolean} inclusive - Whether a node with the same key qualifies.
+   * @returns The node found, or `undefined` if there is none.
+   */
+  protected _getBound(key: K, dir: 1 | -1, inclusive: boolean): NODE | undefined {
+    let found: NODE | undefined;
+    let node = this.root;
+    while (this.isRealNode(node)) {
+      const compared = this._compareKeys(node.key, key) * dir;
+      if (compared > 0 || (inclusive && compared === 0)) {
+        found = node;
+        node = dir === 1 ? node.left : node.right;
+      } else {
+        node = dir === 1 ? node.right : node.left;
+      }
+    }
+    return found;
+  }
+
+  /**
+   * The function recomputes the subtree size of a node from its children. It does nothing unless the
+   * tree was created with `isOrderStatistic`.
+   * @param {NODE} node - The node whose children are up to date.
+   */
+  protected _updateSubtreeSize(node: NODE): void {
+    if (!this._isOrderStatistic) return;
+    node.subtreeSize = 1 + (node.left ? node.left.subtreeSize : 0) + (node.right ? node.right.subtreeSize : 0);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function recomputes the subtree sizes on the path from a node up to the root, after the
+   * subtree below that node changed.
+   * @param {NODE | undefined} node - The lowest node whose subtree changed.
+   */
+  protected _updateSubtreeSizesToRoot(node: NODE | undefined): void {
+    if (!this._isOrderStatistic) return;
+    while (this.isRealNode(node)) {
+      this._updateSubtreeSize(node);
+      node = node.parent;
+    }
+  }
+
+  /**
+   * The function replaces an old node with a new node, which takes over its subtree size.
+   * @param {NODE} oldNode - The node being replaced.
+   * @param {NODE} newNode - The node that takes its place.
+   * @returns The new node.
+   */
+  protected override _replaceNode(oldNode: NODE, newNode: NODE): NODE {
+    newNode.subtreeSize = oldNode.subtreeSize;
+    return super._replaceNode(oldNode, newNode);
+  }
+
   /**
    * The function sets the root property of an object and updates the parent property of the new root.
    * @param {NODE | undefined} v - The parameter `v` is of type `NODE | undefined`. This means that it
@@ -864,6 +1818,19 @@ export class BST<
     this._root = v;
   }
 
+  /**
+   * The function compares two keys with the comparator, taking the variant of the tree into account.
+   * @param {K} a - The parameter "a" is of type K.
+   * @param {K} b - The parameter "b" in the above code represents a K.
+   * @returns a negative number if `a` goes to the left of `b`, a positive number if it goes to the
+   * right, and zero if both keys are equal.
+   */
+  protected _compareKeys(a: K, b: K): number {
+    const compared = this._variant === BSTVariant.STANDARD ? this._comparator(a, b) : this._comparator(b, a);
+    // Unordered keys (e.g. the NaN key of the Red-Black Tree Sentinel) compare as equal, as they did with CP
+    return compared || 0;
+  }
+
   /**
    * The function compares two values using a comparator function and returns whether the first value
    * is greater than, less than, or equal to the second value.
@@ -873,10 +1840,16 @@ export class BST<
    * than), CP.lt (less than), or CP.eq (equal).
    */
   protected _compare(a: K, b: K): CP {
-    const extractedA = this.extractor(a);
-    const extractedB = this.extractor(b);
-    const compared = this.variant === BSTVariant.STANDARD ? extractedA - extractedB : extractedB - extractedA;
+    const compared = this._compareKeys(a, b);
 
     return compared > 0 ? CP.gt : compared < 0 ? CP.lt : CP.eq;
   }
+
+  /**
+   * The function counts every key comparison, which all searches, insertions and range queries go through.
+   * @returns The methods `enableStats` wraps.
+   */
+  protected override _instrumentedMethods(): InstrumentedMethods {
+    return { ...super._instrumentedMethods(), _compareKeys: 'comparisons' };
+  }
 }
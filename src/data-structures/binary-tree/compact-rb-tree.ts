@@ -0,0 +1,869 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type {
+  CompactRBTreeCallback,
+  CompactRBTreeEntry,
+  CompactRBTreeOptions,
+  DFSOrderPattern,
+  EntryCallback
+} from '../../types';
+import { CP, RBTNColor } from '../../types';
+import { IterableEntryBase } from '../base';
+
+/**
+ * A Red-Black Tree with numeric keys whose nodes live in typed arrays instead of objects.
+ * 1. A node is an integer slot index; slot 0 is the shared black Sentinel.
+ * 2. Keys, child/parent links and colors are stored in `Float64Array`/`Int32Array`/`Uint8Array`, values in a dense array.
+ * 3. Deleted slots are recycled through a free-list, so long-running trees do not churn the garbage collector.
+ * 4. Capacity doubles when the free-list is empty and every slot is used.
+ */
+export class CompactRBTree<V = any> extends IterableEntryBase<number, V | undefined> {
+  /**
+   * The constructor function initializes a CompactRBTree with an optional collection of keys or
+   * entries and options.
+   * @param keysOrEntries - An iterable of numeric keys or `[key, value]` entries to add to the tree.
+   * @param [options] - The `options` parameter may contain `initialCapacity`, the number of node slots
+   * to preallocate.
+   */
+  constructor(keysOrEntries: Iterable<number | CompactRBTreeEntry<V>> = [], options?: CompactRBTreeOptions) {
+    super();
+    let capacity = 16;
+    if (options) {
+      const { initialCapacity } = options;
+      if (initialCapacity !== undefined && initialCapacity > 0) capacity = Math.ceil(initialCapacity);
+    }
+    this._capacity = capacity;
+    this._keys = new Float64Array(capacity + 1);
+    this._left = new Int32Array(capacity + 1);
+    this._right = new Int32Array(capacity + 1);
+    this._parent = new Int32Array(capacity + 1);
+    this._colors = new Uint8Array(capacity + 1);
+    this._keys[this.Sentinel] = NaN;
+    if (keysOrEntries) this.addMany(keysOrEntries);
+  }
+
+  protected _capacity: number;
+
+  /**
+   * The function returns the number of node slots that can be used before the arrays are grown.
+   * @returns The capacity of the tree.
+   */
+  get capacity(): number {
+    return this._capacity;
+  }
+
+  protected _keys: Float64Array;
+  protected _left: Int32Array;
+  protected _right: Int32Array;
+  protected _parent: Int32Array;
+  protected _colors: Uint8Array;
+  protected _values: (V | undefined)[] = [undefined];
+
+  /**
+   * The function returns the slot index of the Sentinel, which stands in for every missing child.
+   * @returns The Sentinel slot index, always 0.
+   */
+  get Sentinel(): number {
+    return 0;
+  }
+
+  protected _root: number = 0;
+
+  /**
+   * The function returns the slot index of the root node, or the Sentinel if the tree is empty.
+   * @returns The root slot index.
+   */
+  get root(): number {
+    return this._root;
+  }
+
+  protected _size: number = 0;
+
+  /**
+   * The function returns the number of keys stored in the tree.
+   * @returns The size of the tree.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  protected _nextSlot: number = 1;
+
+  protected _freeHead: number = 0;
+
+  /**
+   * The function checks whether a slot index refers to a live node.
+   * @param {number} node - The slot index to check.
+   * @returns a boolean value.
+   */
+  isRealNode(node: number | undefined): node is number {
+    return node !== undefined && node !== this.Sentinel;
+  }
+
+  /**
+   * The function returns the key stored in a node.
+   * @param {number} node - The slot index of the node.
+   * @returns The key of the node, `NaN` for the Sentinel.
+   */
+  getKey(node: number): number {
+    return this._keys[node];
+  }
+
+  /**
+   * The function returns the value stored in a node.
+   * @param {number} node - The slot index of the node.
+   * @returns The value of the node.
+   */
+  getValue(node: number): V | undefined {
+    return this._values[node];
+  }
+
+  /**
+   * The function returns the color of a node.
+   * @param {number} node - The slot index of the node.
+   * @returns The color of the node.
+   */
+  getColor(node: number): RBTNColor {
+    return this._colors[node];
+  }
+
+  /**
+   * The function returns the left child of a node.
+   * @param {number} node - The slot index of the node.
+   * @returns The slot index of the left child.
+   */
+  getLeft(node: number): number {
+    return this._left[node];
+  }
+
+  /**
+   * The function returns the right child of a node.
+   * @param {number} node - The slot index of the node.
+   * @returns The slot index of the right child.
+   */
+  getRight(node: number): number {
+    return this._right[node];
+  }
+
+  /**
+   * The function returns the parent of a node.
+   * @param {number} node - The slot index of the node.
+   * @returns The slot index of the parent, the Sentinel for the root.
+   */
+  getParent(node: number): number {
+    return this._parent[node];
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `add` function inserts a key into the tree, or replaces the value when the key already exists.
+   * @param keyOrEntry - A numeric key or a `[key, value]` entry.
+   * @param {V} [value] - The value associated with the key, ignored when an entry is given.
+   * @returns `true` if a new node was created, `false` if an existing value was replaced or the key is
+   * `NaN`.
+   */
+  add(keyOrEntry: number | CompactRBTreeEntry<V>, value?: V): boolean {
+    let key: number;
+    if (typeof keyOrEntry === 'number') {
+      key = keyOrEntry;
+    } else {
+      [key, value] = keyOrEntry;
+    }
+    if (Number.isNaN(key)) return false;
+
+    const keys = this._keys;
+    let parent = this.Sentinel;
+    let cur = this._root;
+    while (cur !== this.Sentinel) {
+      parent = cur;
+      const curKey = keys[cur];
+      if (key < curKey) {
+        cur = this._left[cur];
+      } else if (key > curKey) {
+        cur = this._right[cur];
+      } else {
+        this._values[cur] = value;
+        return false;
+      }
+    }
+
+    const node = this._allocate(key, value);
+    this._parent[node] = parent;
+    if (parent === this.Sentinel) {
+      this._root = node;
+    } else if (key < this._keys[parent]) {
+      this._left[parent] = node;
+    } else {
+      this._right[parent] = node;
+    }
+
+    this._fixInsert(node);
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(k log n)
+   * Space Complexity: O(k)
+   */
+
+  /**
+   * Time Complexity: O(k log n)
+   * Space Complexity: O(k)
+   *
+   * The `addMany` function adds every key or entry of an iterable to the tree.
+   * @param keysOrEntries - An iterable of numeric keys or `[key, value]` entries.
+   * @returns an array of booleans, one per element, as returned by `add`.
+   */
+  addMany(keysOrEntries: Iterable<number | CompactRBTreeEntry<V>>): boolean[] {
+    const inserted: boolean[] = [];
+    for (const keyOrEntry of keysOrEntries) {
+      inserted.push(this.add(keyOrEntry));
+    }
+    return inserted;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `delete` function removes the node holding a key and returns its slot to the free-list.
+   * @param {number} key - The key to remove.
+   * @returns `true` if the key was found and removed, `false` otherwise.
+   */
+  delete(key: number): boolean {
+    const z = this.getNode(key);
+    if (z === undefined) return false;
+
+    const left = this._left,
+      right = this._right,
+      parent = this._parent,
+      colors = this._colors;
+    let x: number;
+    let y = z;
+    let yOriginalColor = colors[y];
+    if (left[z] === this.Sentinel) {
+      x = right[z];
+      this._rbTransplant(z, right[z]);
+    } else if (right[z] === this.Sentinel) {
+      x = left[z];
+      this._rbTransplant(z, left[z]);
+    } else {
+      y = this.getLeftMost(right[z]);
+      yOriginalColor = colors[y];
+      x = right[y];
+      if (parent[y] === z) {
+        parent[x] = y;
+      } else {
+        this._rbTransplant(y, right[y]);
+        right[y] = right[z];
+        parent[right[y]] = y;
+      }
+      this._rbTransplant(z, y);
+      left[y] = left[z];
+      parent[left[y]] = y;
+      colors[y] = colors[z];
+    }
+    if (yOriginalColor === RBTNColor.BLACK) this._fixDelete(x);
+
+    this._release(z);
+    this._size--;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `getNode` function finds the node holding a key.
+   * @param {number} key - The key to search for.
+   * @returns the slot index of the node, or `undefined` if the key is not in the tree.
+   */
+  getNode(key: number): number | undefined {
+    const keys = this._keys;
+    let cur = this._root;
+    while (cur !== this.Sentinel) {
+      const curKey = keys[cur];
+      if (key < curKey) cur = this._left[cur];
+      else if (key > curKey) cur = this._right[cur];
+      else return cur;
+    }
+    return undefined;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function checks whether a key exists in the tree.
+   * @param {number} key - The key to search for.
+   * @returns a boolean value.
+   */
+  override has(key: number): boolean {
+    return this.getNode(key) !== undefined;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function returns the value associated with a key.
+   * @param {number} key - The key to search for.
+   * @returns the value of the key, or `undefined` if the key is not in the tree.
+   */
+  override get(key: number): V | undefined {
+    const node = this.getNode(key);
+    return node === undefined ? undefined : this._values[node];
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function returns the node with the smallest key in a subtree.
+   * @param {number} beginRoot - The root of the subtree, defaults to the root of the tree.
+   * @returns the slot index of the leftmost node, or the Sentinel if the subtree is empty.
+   */
+  getLeftMost(beginRoot: number = this._root): number {
+    if (beginRoot === this.Sentinel) return beginRoot;
+    let cur = beginRoot;
+    while (this._left[cur] !== this.Sentinel) cur = this._left[cur];
+    return cur;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function returns the node with the largest key in a subtree.
+   * @param {number} beginRoot - The root of the subtree, defaults to the root of the tree.
+   * @returns the slot index of the rightmost node, or the Sentinel if the subtree is empty.
+   */
+  getRightMost(beginRoot: number = this._root): number {
+    if (beginRoot === this.Sentinel) return beginRoot;
+    let cur = beginRoot;
+    while (this._right[cur] !== this.Sentinel) cur = this._right[cur];
+    return cur;
+  }
+
+  /**
+   * Time Complexity: O(log n + k)
+   * Space Complexity: O(log n + k)
+   */
+
+  /**
+   * Time Complexity: O(log n + k)
+   * Space Complexity: O(log n + k)
+   *
+   * The `lesserOrGreaterTraverse` function visits, in ascending key order, every node whose key is
+   * lesser than, equal to or greater than a target key, skipping subtrees that cannot match.
+   * @param callback - Called with the key, value and slot index of each matching node. Defaults to
+   * returning the key.
+   * @param {CP} lesserOrGreater - `CP.lt`, `CP.eq` or `CP.gt`.
+   * @param {number} targetKey - The key to compare against, defaults to the key of the root.
+   * @returns an array of the callback results.
+   */
+  lesserOrGreaterTraverse<C extends CompactRBTreeCallback<V>>(
+    callback: C = this._defaultCallback as C,
+    lesserOrGreater: CP = CP.lt,
+    targetKey: number = this._keys[this._root]
+  ): ReturnType<C>[] {
+    const ans: ReturnType<C>[] = [];
+    if (this._root === this.Sentinel || Number.isNaN(targetKey)) return ans;
+
+    const keys = this._keys;
+    const stack: number[] = [];
+    let cur = this._root;
+    while (cur !== this.Sentinel || stack.length > 0) {
+      while (cur !== this.Sentinel) {
+        stack.push(cur);
+        // Only descend left when keys smaller than the current one can still match
+        cur = lesserOrGreater === CP.lt || targetKey < keys[cur] ? this._left[cur] : this.Sentinel;
+      }
+      cur = stack.pop()!;
+      const key = keys[cur];
+      if (lesserOrGreater === CP.lt ? key < targetKey : lesserOrGreater === CP.gt ? key > targetKey : key === targetKey) {
+        ans.push(callback(key, this._values[cur], cur));
+      }
+      cur = lesserOrGreater === CP.gt || targetKey > key ? this._right[cur] : this.Sentinel;
+    }
+    return ans;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(log n)
+   */
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(log n)
+   *
+   * The `dfs` function performs an iterative depth-first traversal of the tree.
+   * @param callback - Called with the key, value and slot index of each node. Defaults to returning
+   * the key.
+   * @param {DFSOrderPattern} [pattern] - The traversal order: 'in', 'pre' or 'post'.
+   * @param {number} beginRoot - The root of the subtree to traverse, defaults to the root of the tree.
+   * @returns an array of the callback results.
+   */
+  dfs<C extends CompactRBTreeCallback<V>>(
+    callback: C = this._defaultCallback as C,
+    pattern: DFSOrderPattern = 'in',
+    beginRoot: number = this._root
+  ): ReturnType<C>[] {
+    const ans: ReturnType<C>[] = [];
+    if (beginRoot === this.Sentinel) return ans;
+
+    const left = this._left,
+      right = this._right;
+    const visit = (node: number) => ans.push(callback(this._keys[node], this._values[node], node));
+    const stack: number[] = [];
+    switch (pattern) {
+      case 'in': {
+        let cur = beginRoot;
+        while (cur !== this.Sentinel || stack.length > 0) {
+          while (cur !== this.Sentinel) {
+            stack.push(cur);
+            cur = left[cur];
+          }
+          cur = stack.pop()!;
+          visit(cur);
+          cur = right[cur];
+        }
+        break;
+      }
+      case 'pre': {
+        stack.push(beginRoot);
+        while (stack.length > 0) {
+          const cur = stack.pop()!;
+          visit(cur);
+          if (right[cur] !== this.Sentinel) stack.push(right[cur]);
+          if (left[cur] !== this.Sentinel) stack.push(left[cur]);
+        }
+        break;
+      }
+      case 'post': {
+        let cur = beginRoot;
+        let lastVisited = this.Sentinel;
+        while (cur !== this.Sentinel || stack.length > 0) {
+          while (cur !== this.Sentinel) {
+            stack.push(cur);
+            cur = left[cur];
+          }
+          const top = stack[stack.length - 1];
+          if (right[top] !== this.Sentinel && right[top] !== lastVisited) {
+            cur = right[top];
+          } else {
+            visit(top);
+            lastVisited = stack.pop()!;
+          }
+        }
+        break;
+      }
+    }
+    return ans;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function checks whether the tree has no nodes.
+   * @returns a boolean value.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The `clear` function removes every node. The typed arrays are kept for reuse, only the value
+   * references are released.
+   */
+  clear(): void {
+    this._root = this.Sentinel;
+    this._size = 0;
+    this._nextSlot = 1;
+    this._freeHead = this.Sentinel;
+    this._values.length = 1;
+    this._parent[this.Sentinel] = this.Sentinel;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `clone` function copies the typed arrays wholesale, so the copy has exactly the same shape
+   * without re-inserting any key.
+   * @returns a new CompactRBTree with the same entries.
+   */
+  clone(): CompactRBTree<V> {
+    const cloned = new CompactRBTree<V>([], { initialCapacity: this._capacity });
+    this._copyTo(cloned);
+    cloned._values = this._values.slice();
+    return cloned;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function creates a tree with the same keys whose values are the results of a callback.
+   * Since the keys do not change, the structure is copied rather than rebuilt.
+   * @param callback - Called with the value, key, index and the tree for every entry in key order.
+   * @param {any} [thisArg] - The value to use as `this` when executing the callback.
+   * @returns a new CompactRBTree with the mapped values.
+   */
+  map<U>(callback: EntryCallback<number, V | undefined, U>, thisArg?: any): CompactRBTree<U> {
+    const mapped = new CompactRBTree<U>([], { initialCapacity: this._capacity });
+    this._copyTo(mapped);
+    const values: (U | undefined)[] = new Array(this._values.length);
+    let index = 0;
+    this.dfs((key, value, node) => {
+      values[node] = callback.call(thisArg, value, key, index++, this);
+    });
+    mapped._values = values;
+    return mapped;
+  }
+
+  /**
+   * Time Complexity: O(n log n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function creates a tree with only the entries that satisfy a predicate.
+   * @param predicate - Called with the value, key, index and the tree for every entry in key order.
+   * @param {any} [thisArg] - The value to use as `this` when executing the predicate.
+   * @returns a new CompactRBTree with the entries that passed the predicate.
+   */
+  filter(predicate: EntryCallback<number, V | undefined, boolean>, thisArg?: any): CompactRBTree<V> {
+    const filtered = new CompactRBTree<V>();
+    let index = 0;
+    for (const [key, value] of this) {
+      if (predicate.call(thisArg, value, key, index++, this)) {
+        filtered.add(key, value);
+      }
+    }
+    return filtered;
+  }
+
+  protected _defaultCallback = (key: number) => key;
+
+  /**
+   * The function yields the entries of the tree in ascending key order.
+   */
+  protected* _getIterator(): IterableIterator<[number, V | undefined]> {
+    const stack: number[] = [];
+    let cur = this._root;
+    while (cur !== this.Sentinel || stack.length > 0) {
+      while (cur !== this.Sentinel) {
+        stack.push(cur);
+        cur = this._left[cur];
+      }
+      cur = stack.pop()!;
+      yield [this._keys[cur], this._values[cur]];
+      cur = this._right[cur];
+    }
+  }
+
+  /**
+   * The function takes a slot from the free-list, or the next unused slot, growing the arrays when
+   * needed, and initializes it as a red leaf.
+   * @param {number} key - The key of the new node.
+   * @param {V} [value] - The value of the new node.
+   * @returns the slot index of the new node.
+   */
+  protected _allocate(key: number, value?: V): number {
+    let node: number;
+    if (this._freeHead !== this.Sentinel) {
+      node = this._freeHead;
+      this._freeHead = this._right[node];
+    } else {
+      if (this._nextSlot > this._capacity) this._grow(this._capacity * 2);
+      node = this._nextSlot++;
+    }
+    this._keys[node] = key;
+    this._values[node] = value;
+    this._left[node] = this.Sentinel;
+    this._right[node] = this.Sentinel;
+    this._colors[node] = RBTNColor.RED;
+    return node;
+  }
+
+  /**
+   * The function pushes a slot onto the free-list, threading the list through the right links.
+   * @param {number} node - The slot index to release.
+   */
+  protected _release(node: number): void {
+    this._values[node] = undefined;
+    this._right[node] = this._freeHead;
+    this._freeHead = node;
+  }
+
+  /**
+   * The function reallocates the typed arrays with a larger capacity and copies the nodes over.
+   * @param {number} capacity - The new capacity.
+   */
+  protected _grow(capacity: number): void {
+    const keys = new Float64Array(capacity + 1);
+    const left = new Int32Array(capacity + 1);
+    const right = new Int32Array(capacity + 1);
+    const parent = new Int32Array(capacity + 1);
+    const colors = new Uint8Array(capacity + 1);
+    keys.set(this._keys);
+    left.set(this._left);
+    right.set(this._right);
+    parent.set(this._parent);
+    colors.set(this._colors);
+    this._keys = keys;
+    this._left = left;
+    this._right = right;
+    this._parent = parent;
+    this._colors = colors;
+    this._capacity = capacity;
+  }
+
+  /**
+   * The function copies the structure of this tree into another tree of the same capacity.
+   * @param target - The tree to copy into.
+   */
+  protected _copyTo(target: CompactRBTree<any>): void {
+    target._keys.set(this._keys);
+    target._left.set(this._left);
+    target._right.set(this._right);
+    target._parent.set(this._parent);
+    target._colors.set(this._colors);
+    target._root = this._root;
+    target._size = this._size;
+    target._nextSlot = this._nextSlot;
+    target._freeHead = this._freeHead;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function performs a left rotation on a node.
+   * @param {number} x - The slot index of the node to rotate.
+   */
+  protected _leftRotate(x: number): void {
+    const left = this._left,
+      right = this._right,
+      parent = this._parent;
+    const y = right[x];
+    right[x] = left[y];
+    if (left[y] !== this.Sentinel) parent[left[y]] = x;
+    parent[y] = parent[x];
+    if (parent[x] === this.Sentinel) {
+      this._root = y;
+    } else if (x === left[parent[x]]) {
+      left[parent[x]] = y;
+    } else {
+      right[parent[x]] = y;
+    }
+    left[y] = x;
+    parent[x] = y;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function performs a right rotation on a node.
+   * @param {number} x - The slot index of the node to rotate.
+   */
+  protected _rightRotate(x: number): void {
+    const left = this._left,
+      right = this._right,
+      parent = this._parent;
+    const y = left[x];
+    left[x] = right[y];
+    if (right[y] !== this.Sentinel) parent[right[y]] = x;
+    parent[y] = parent[x];
+    if (parent[x] === this.Sentinel) {
+      this._root = y;
+    } else if (x === right[parent[x]]) {
+      right[parent[x]] = y;
+    } else {
+      left[parent[x]] = y;
+    }
+    right[y] = x;
+    parent[x] = y;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `_fixInsert` function restores the red-black properties after an insertion.
+   * @param {number} z - The slot index of the inserted node.
+   */
+  protected _fixInsert(z: number): void {
+    const left = this._left,
+      right = this._right,
+      parent = this._parent,
+      colors = this._colors;
+    while (colors[parent[z]] === RBTNColor.RED) {
+      let p = parent[z];
+      const g = parent[p];
+      if (p === left[g]) {
+        const u = right[g];
+        if (colors[u] === RBTNColor.RED) {
+          colors[p] = RBTNColor.BLACK;
+          colors[u] = RBTNColor.BLACK;
+          colors[g] = RBTNColor.RED;
+          z = g;
+        } else {
+          if (z === right[p]) {
+            z = p;
+            this._leftRotate(z);
+            p = parent[z];
+          }
+          colors[p] = RBTNColor.BLACK;
+          colors[g] = RBTNColor.RED;
+          this._rightRotate(g);
+        }
+      } else {
+        const u = left[g];
+        if (colors[u] === RBTNColor.RED) {
+          colors[p] = RBTNColor.BLACK;
+          colors[u] = RBTNColor.BLACK;
+          colors[g] = RBTNColor.RED;
+          z = g;
+        } else {
+          if (z === left[p]) {
+            z = p;
+            this._rightRotate(z);
+            p = parent[z];
+          }
+          colors[p] = RBTNColor.BLACK;
+          colors[g] = RBTNColor.RED;
+          this._leftRotate(g);
+        }
+      }
+    }
+    colors[this._root] = RBTNColor.BLACK;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `_fixDelete` function restores the red-black properties after a deletion.
+   * @param {number} x - The slot index of the node that took the place of the removed one, possibly
+   * the Sentinel, whose parent link is set by `_rbTransplant`.
+   */
+  protected _fixDelete(x: number): void {
+    const left = this._left,
+      right = this._right,
+      parent = this._parent,
+      colors = this._colors;
+    while (x !== this._root && colors[x] === RBTNColor.BLACK) {
+      const p = parent[x];
+      if (x === left[p]) {
+        let s = right[p];
+        if (colors[s] === RBTNColor.RED) {
+          colors[s] = RBTNColor.BLACK;
+          colors[p] = RBTNColor.RED;
+          this._leftRotate(p);
+          s = right[p];
+        }
+        if (colors[left[s]] === RBTNColor.BLACK && colors[right[s]] === RBTNColor.BLACK) {
+          colors[s] = RBTNColor.RED;
+          x = p;
+        } else {
+          if (colors[right[s]] === RBTNColor.BLACK) {
+            colors[left[s]] = RBTNColor.BLACK;
+            colors[s] = RBTNColor.RED;
+            this._rightRotate(s);
+            s = right[p];
+          }
+          colors[s] = colors[p];
+          colors[p] = RBTNColor.BLACK;
+          colors[right[s]] = RBTNColor.BLACK;
+          this._leftRotate(p);
+          x = this._root;
+        }
+      } else {
+        let s = left[p];
+        if (colors[s] === RBTNColor.RED) {
+          colors[s] = RBTNColor.BLACK;
+          colors[p] = RBTNColor.RED;
+          this._rightRotate(p);
+          s = left[p];
+        }
+        if (colors[left[s]] === RBTNColor.BLACK && colors[right[s]] === RBTNColor.BLACK) {
+          colors[s] = RBTNColor.RED;
+          x = p;
+        } else {
+          if (colors[left[s]] === RBTNColor.BLACK) {
+            colors[right[s]] = RBTNColor.BLACK;
+            colors[s] = RBTNColor.RED;
+            this._leftRotate(s);
+            s = left[p];
+          }
+          colors[s] = colors[p];
+          colors[p] = RBTNColor.BLACK;
+          colors[left[s]] = RBTNColor.BLACK;
+          this._rightRotate(p);
+          x = this._root;
+        }
+      }
+    }
+    colors[x] = RBTNColor.BLACK;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function `_rbTransplant` replaces the subtree rooted at `u` with the subtree rooted at `v`.
+   * @param {number} u - The slot index of the node being replaced.
+   * @param {number} v - The slot index of the replacement, possibly the Sentinel.
+   */
+  protected _rbTransplant(u: number, v: number): void {
+    const parent = this._parent;
+    const p = parent[u];
+    if (p === this.Sentinel) {
+      this._root = v;
+    } else if (u === this._left[p]) {
+      this._left[p] = v;
+    } else {
+      this._right[p] = v;
+    }
+    parent[v] = p;
+  }
+}
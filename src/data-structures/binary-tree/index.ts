@@ -1,7 +1,12 @@
 export * from './binary-tree';
 export * from './bst';
 export * from './binary-indexed-tree';
+export * from './range-binary-indexed-tree';
+export * from './binary-indexed-tree-2d';
 export * from './segment-tree';
+export * from './lazy-segment-tree';
 export * from './avl-tree';
 export * from './rb-tree';
 export * from './tree-multimap';
+export * from './compact-rb-tree';
+export * from './persistent-rb-tree';
@@ -0,0 +1,431 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { LazySegmentTreeOptions, SegmentTreeMonoid } from '../../types';
+
+/**
+ * 1. Implicit Layout: A LazySegmentTree keeps the aggregates in one Float64Array of 2 * size slots, size being the least power of two not below the number of values. Node k has the children 2k and 2k + 1, the root is 1 and the leaf of index i is size + i, so there are no node objects.
+ * 2. Monoid: The aggregate is any associative `op` with an `identity`, such as sum, min, max or gcd. `add` and `assign` tell how a range update changes an aggregate of a given length; a monoid without them supports only point updates.
+ * 3. Lazy Propagation: A range update is stored on the O(log n) nodes covering the range as a pending "assign, then add" tag, and pushed to the children only when a later operation passes through.
+ * 4. Iterative: Updates and queries walk up from the leaves and binary searches walk down, without recursion. Ranges are inclusive, like `SegmentTree.querySumByRange`.
+ * 5. Binary Search: `maxRight` and `minLeft` find how far a range can grow while a monotone predicate holds on its aggregate, in O(log n).
+ */
+export class LazySegmentTree {
+  /**
+   * The monoid of sums. Range add adds `delta * length`.
+   */
+  static SUM: SegmentTreeMonoid = {
+    identity: 0,
+    op: (a, b) => a + b,
+    add: (aggregate, delta, length) => aggregate + delta * length,
+    assign: (value, length) => value * length
+  };
+
+  /**
+   * The monoid of minimums.
+   */
+  static MIN: SegmentTreeMonoid = {
+    identity: Infinity,
+    op: (a, b) => (a < b ? a : b),
+    add: (aggregate, delta) => aggregate + delta,
+    assign: value => value
+  };
+
+  /**
+   * The monoid of maximums.
+   */
+  static MAX: SegmentTreeMonoid = {
+    identity: -Infinity,
+    op: (a, b) => (a > b ? a : b),
+    add: (aggregate, delta) => aggregate + delta,
+    assign: value => value
+  };
+
+  /**
+   * The monoid of greatest common divisors of integers. Range add cannot be derived from a gcd, so
+   * only range assign is supported.
+   */
+  static GCD: SegmentTreeMonoid = {
+    identity: 0,
+    op: (a, b) => {
+      a = Math.abs(a);
+      b = Math.abs(b);
+      while (b !== 0) {
+        const r = a % b;
+        a = b;
+        b = r;
+      }
+      return a;
+    },
+    assign: value => Math.abs(value)
+  };
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The constructor builds the tree bottom-up over the values.
+   * @param values - The initial values, for example a zero-filled Float64Array.
+   * @param {LazySegmentTreeOptions} [options] - `monoid` (default `LazySegmentTree.SUM`).
+   */
+  constructor(values: ArrayLike<number> = [], options?: LazySegmentTreeOptions) {
+    this._monoid = options?.monoid ?? LazySegmentTree.SUM;
+    const n = values.length;
+    let size = 1,
+      log = 0;
+    while (size < n) {
+      size <<= 1;
+      log++;
+    }
+    this._length = n;
+    this._size = size;
+    this._log = log;
+    this._tree = new Float64Array(2 * size).fill(this._monoid.identity);
+    this._addTags = new Float64Array(size);
+    this._assignTags = new Float64Array(size);
+    this._isAssigned = new Uint8Array(size);
+    for (let i = 0; i < n; i++) this._tree[size + i] = values[i];
+    for (let k = size - 1; k >= 1; k--) this._pull(k);
+  }
+
+  protected _monoid: SegmentTreeMonoid;
+
+  /**
+   * The function returns the monoid the tree aggregates with.
+   * @returns The `_monoid` property is being returned.
+   */
+  get monoid(): SegmentTreeMonoid {
+    return this._monoid;
+  }
+
+  protected _length: number;
+
+  /**
+   * The function returns the number of values.
+   * @returns The `_length` property is being returned.
+   */
+  get length(): number {
+    return this._length;
+  }
+
+  protected _size: number;
+
+  protected _log: number;
+
+  protected _tree: Float64Array;
+
+  protected _addTags: Float64Array;
+
+  protected _assignTags: Float64Array;
+
+  protected _isAssigned: Uint8Array;
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `get` function returns the value at an index.
+   * @param {number} index - The index.
+   * @returns The value.
+   */
+  get(index: number): number {
+    this._checkIndex(index);
+    const leaf = index + this._size;
+    for (let i = this._log; i >= 1; i--) this._push(leaf >> i);
+    return this._tree[leaf];
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `set` function replaces the value at an index.
+   * @param {number} index - The index.
+   * @param {number} value - The new value.
+   */
+  set(index: number, value: number): void {
+    this._checkIndex(index);
+    const leaf = index + this._size;
+    for (let i = this._log; i >= 1; i--) this._push(leaf >> i);
+    this._tree[leaf] = value;
+    for (let i = 1; i <= this._log; i++) this._pull(leaf >> i);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `query` function aggregates the values from `start` to `end`, both inclusive.
+   * @param {number} start - The first index.
+   * @param {number} end - The last index; `start - 1` for an empty range.
+   * @returns The aggregate, the identity for an empty range.
+   */
+  query(start: number, end: number): number {
+    this._checkRange(start, end);
+    const { op, identity } = this._monoid;
+    const tree = this._tree;
+    let l = start + this._size,
+      r = end + 1 + this._size;
+    if (l === r) return identity;
+    this._pushBoundaries(l, r);
+
+    let left = identity,
+      right = identity;
+    while (l < r) {
+      if (l & 1) left = op(left, tree[l++]);
+      if (r & 1) right = op(tree[--r], right);
+      l >>= 1;
+      r >>= 1;
+    }
+    return op(left, right);
+  }
+
+  /**
+   * The function returns the aggregate of all values.
+   * @returns The value of the root, O(1).
+   */
+  all(): number {
+    return this._tree[1];
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `addRange` function adds a delta to every value from `start` to `end`, both inclusive.
+   * @param {number} start - The first index.
+   * @param {number} end - The last index.
+   * @param {number} delta - The amount to add.
+   */
+  addRange(start: number, end: number, delta: number): void {
+    if (!this._monoid.add) throw new Error('The monoid does not support range add.');
+    this._update(start, end, false, delta);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `assignRange` function sets every value from `start` to `end`, both inclusive.
+   * @param {number} start - The first index.
+   * @param {number} end - The last index.
+   * @param {number} value - The new value.
+   */
+  assignRange(start: number, end: number, value: number): void {
+    if (!this._monoid.assign) throw new Error('The monoid does not support range assign.');
+    this._update(start, end, true, value);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `maxRight` function finds the last index `end` for which `predicate(query(start, end))` holds,
+   * assuming the predicate holds for the identity and, once false, stays false as the range grows.
+   * @param {number} start - The first index of the range.
+   * @param predicate - A monotone test on an aggregate.
+   * @returns The greatest such `end`, `start - 1` if the predicate fails on `start` alone.
+   */
+  maxRight(start: number, predicate: (aggregate: number) => boolean): number {
+    this._checkRange(start, start - 1);
+    if (start === this._length) return this._length - 1;
+    const { op, identity } = this._monoid;
+    const tree = this._tree,
+      size = this._size;
+    let l = start + size;
+    for (let i = this._log; i >= 1; i--) this._push(l >> i);
+
+    let sum = identity;
+    do {
+      while ((l & 1) === 0) l >>= 1;
+      if (!predicate(op(sum, tree[l]))) {
+        while (l < size) {
+          this._push(l);
+          l <<= 1;
+          const next = op(sum, tree[l]);
+          if (predicate(next)) {
+            sum = next;
+            l++;
+          }
+        }
+        return l - size - 1;
+      }
+      sum = op(sum, tree[l]);
+      l++;
+    } while ((l & -l) !== l);
+    return this._length - 1;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `minLeft` function finds the first index `start` for which `predicate(query(start, end))`
+   * holds, assuming the predicate holds for the identity and, once false, stays false as the range
+   * grows.
+   * @param {number} end - The last index of the range.
+   * @param predicate - A monotone test on an aggregate.
+   * @returns The least such `start`, `end + 1` if the predicate fails on `end` alone.
+   */
+  minLeft(end: number, predicate: (aggregate: number) => boolean): number {
+    this._checkRange(end + 1, end);
+    if (end === -1) return 0;
+    const { op, identity } = this._monoid;
+    const tree = this._tree,
+      size = this._size;
+    let r = end + 1 + size;
+    for (let i = this._log; i >= 1; i--) this._push((r - 1) >> i);
+
+    let sum = identity;
+    do {
+      r--;
+      while (r > 1 && r & 1) r >>= 1;
+      if (!predicate(op(tree[r], sum))) {
+        while (r < size) {
+          this._push(r);
+          r = 2 * r + 1;
+          const next = op(tree[r], sum);
+          if (predicate(next)) {
+            sum = next;
+            r--;
+          }
+        }
+        return r + 1 - size;
+      }
+      sum = op(tree[r], sum);
+    } while ((r & -r) !== r);
+    return 0;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The function returns the current values once all pending updates are pushed to the leaves.
+   * @returns {Float64Array} A copy of the values.
+   */
+  toArray(): Float64Array {
+    for (let k = 1; k < this._size; k++) this._push(k);
+    return this._tree.slice(this._size, this._size + this._length);
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `clone` function returns a tree with the same values and monoid.
+   * @returns {LazySegmentTree} A new LazySegmentTree.
+   */
+  clone(): LazySegmentTree {
+    return new LazySegmentTree(this.toArray(), { monoid: this._monoid });
+  }
+
+  /**
+   * The function applies a range update: tags the nodes that exactly cover the range, then
+   * recomputes their ancestors.
+   * @param {number} start - The first index.
+   * @param {number} end - The last index.
+   * @param {boolean} isAssign - Whether to assign `value` rather than add it.
+   * @param {number} value - The value to assign or add.
+   */
+  protected _update(start: number, end: number, isAssign: boolean, value: number): void {
+    this._checkRange(start, end);
+    let l = start + this._size,
+      r = end + 1 + this._size;
+    if (l === r) return;
+    this._pushBoundaries(l, r);
+
+    const l0 = l,
+      r0 = r;
+    while (l < r) {
+      if (l & 1) this._apply(l++, isAssign, value);
+      if (r & 1) this._apply(--r, isAssign, value);
+      l >>= 1;
+      r >>= 1;
+    }
+
+    for (let i = 1; i <= this._log; i++) {
+      if ((l0 >> i) << i !== l0) this._pull(l0 >> i);
+      if ((r0 >> i) << i !== r0) this._pull((r0 - 1) >> i);
+    }
+  }
+
+  /**
+   * The function pushes the tags of the ancestors of the boundary leaves of a half-open slot range,
+   * so the nodes inside the range are up to date.
+   * @param {number} l - The first leaf slot.
+   * @param {number} r - The slot after the last leaf.
+   */
+  protected _pushBoundaries(l: number, r: number): void {
+    for (let i = this._log; i >= 1; i--) {
+      if ((l >> i) << i !== l) this._push(l >> i);
+      if ((r >> i) << i !== r) this._push((r - 1) >> i);
+    }
+  }
+
+  /**
+   * The function applies an update to a node whose whole range is covered, and composes it with the
+   * node's tag unless the node is a leaf.
+   * @param {number} k - The node.
+   * @param {boolean} isAssign - Whether to assign `value` rather than add it.
+   * @param {number} value - The value to assign or add.
+   */
+  protected _apply(k: number, isAssign: boolean, value: number): void {
+    const length = this._size >> (31 - Math.clz32(k));
+    if (isAssign) {
+      this._tree[k] = this._monoid.assign!(value, length);
+      if (k < this._size) {
+        this._isAssigned[k] = 1;
+        this._assignTags[k] = value;
+        this._addTags[k] = 0;
+      }
+    } else {
+      this._tree[k] = this._monoid.add!(this._tree[k], value, length);
+      if (k < this._size) {
+        if (this._isAssigned[k]) this._assignTags[k] += value;
+        else this._addTags[k] += value;
+      }
+    }
+  }
+
+  /**
+   * The function moves the tag of an internal node to its children.
+   * @param {number} k - The node.
+   */
+  protected _push(k: number): void {
+    if (this._isAssigned[k]) {
+      const value = this._assignTags[k];
+      this._apply(2 * k, true, value);
+      this._apply(2 * k + 1, true, value);
+      this._isAssigned[k] = 0;
+    }
+    const delta = this._addTags[k];
+    if (delta !== 0) {
+      this._apply(2 * k, false, delta);
+      this._apply(2 * k + 1, false, delta);
+      this._addTags[k] = 0;
+    }
+  }
+
+  /**
+   * The function recomputes the aggregate of an internal node from its children.
+   * @param {number} k - The node.
+   */
+  protected _pull(k: number): void {
+    this._tree[k] = this._monoid.op(this._tree[2 * k], this._tree[2 * k + 1]);
+  }
+
+  protected _checkIndex(index: number): void {
+    if (!(index >= 0 && index < this._length)) throw new RangeError(`Index ${index} is out of bounds.`);
+  }
+
+  protected _checkRange(start: number, end: number): void {
+    if (!(start >= 0 && end < this._length && start <= end + 1)) {
+      throw new RangeError(`Range [${start}, ${end}] is out of bounds.`);
+    }
+  }
+}
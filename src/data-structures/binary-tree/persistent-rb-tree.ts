@@ -0,0 +1,410 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { Comparator, EntryCallback, PersistentRBTreeOptions } from '../../types';
+import { RBTNColor } from '../../types';
+import { IterableEntryBase } from '../base';
+
+export class PersistentRBTreeNode<K = any, V = any> {
+  key: K;
+  value: V | undefined;
+  left: PersistentRBTreeNode<K, V> | undefined = undefined;
+  right: PersistentRBTreeNode<K, V> | undefined = undefined;
+  color: RBTNColor;
+  // The tree handle allowed to change this node in place, see PersistentRBTree._own
+  owner: object;
+
+  constructor(key: K, value: V | undefined, color: RBTNColor, owner: object) {
+    this.key = key;
+    this.value = value;
+    this.color = color;
+    this.owner = owner;
+  }
+}
+
+/**
+ * A left-leaning Red-Black Tree whose versions share structure.
+ * 1. `snapshot` (and `clone`) is O(1): the copy shares every node with the original.
+ * 2. An update copies only the nodes on its search path, O(log n) of them, so earlier snapshots never change.
+ * 3. Nodes created since the last snapshot belong to the tree and are changed in place, so a run of updates between
+ *    snapshots allocates no more than an ordinary tree.
+ * 4. Keys are ordered by `comparator`, numbers and strings naturally by default.
+ */
+export class PersistentRBTree<K = any, V = any> extends IterableEntryBase<K, V | undefined> {
+  /**
+   * The constructor function initializes a PersistentRBTree with an optional collection of entries.
+   * @param entries - An iterable of `[key, value]` pairs to add to the tree.
+   * @param [options] - The `options` parameter may contain a `comparator` that orders the keys.
+   */
+  constructor(entries: Iterable<[K, V | undefined]> = [], options?: PersistentRBTreeOptions<K>) {
+    super();
+    if (options) {
+      const { comparator } = options;
+      if (comparator) this._comparator = comparator;
+    }
+    if (entries) {
+      for (const [key, value] of entries) this.set(key, value);
+    }
+  }
+
+  protected _comparator: Comparator<K> = (a: K, b: K) => (a < b ? -1 : a > b ? 1 : 0);
+
+  /**
+   * The function returns the comparator that orders the keys.
+   * @returns The `_comparator` property.
+   */
+  get comparator(): Comparator<K> {
+    return this._comparator;
+  }
+
+  protected _root: PersistentRBTreeNode<K, V> | undefined = undefined;
+
+  /**
+   * The function returns the root node, which may be shared with other snapshots and must not be changed.
+   * @returns The root node, or undefined if the tree is empty.
+   */
+  get root(): PersistentRBTreeNode<K, V> | undefined {
+    return this._root;
+  }
+
+  protected _size: number = 0;
+
+  /**
+   * The function returns the number of keys in the tree.
+   * @returns The size of the tree.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  protected _owner: object = {};
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `snapshot` function returns a tree that shares every node with this one. From then on neither tree may
+   * change the shared nodes, so updates on either side copy their path and the other side keeps its contents.
+   * @returns A new PersistentRBTree with the same entries.
+   */
+  snapshot(): PersistentRBTree<K, V> {
+    const tree = new PersistentRBTree<K, V>([], { comparator: this._comparator });
+    tree._root = this._root;
+    tree._size = this._size;
+    this._owner = {};
+    return tree;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function checks whether the tree is empty.
+   * @returns True if the tree has no keys.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function removes every key. Snapshots taken earlier keep theirs.
+   */
+  clear(): void {
+    this._root = undefined;
+    this._size = 0;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function finds the node holding a key.
+   * @param {K} key - The key to look for.
+   * @returns The node, or undefined if the key is absent.
+   */
+  getNode(key: K): PersistentRBTreeNode<K, V> | undefined {
+    let node = this._root;
+    while (node) {
+      const cmp = this._comparator(key, node.key);
+      if (cmp === 0) return node;
+      node = cmp < 0 ? node.left : node.right;
+    }
+    return undefined;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function returns the value stored under a key.
+   * @param {K} key - The key to look for.
+   * @returns The value, or undefined if the key is absent.
+   */
+  override get(key: K): V | undefined {
+    return this.getNode(key)?.value;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function checks whether a key is in the tree.
+   * @param {K} key - The key to look for.
+   * @returns True if the key is present.
+   */
+  override has(key: K): boolean {
+    return this.getNode(key) !== undefined;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(log n)
+   *
+   * The `set` function adds a key or replaces its value. Nodes shared with a snapshot are copied along the
+   * search path, the others are changed in place.
+   * @param {K} key - The key to add.
+   * @param {V} [value] - The value to store under the key.
+   * @returns True, like the other trees.
+   */
+  set(key: K, value?: V): boolean {
+    this._root = this._put(this._root, key, value);
+    this._root.color = RBTNColor.BLACK;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(log n)
+   *
+   * The `delete` function removes a key, copying the shared nodes it has to restructure.
+   * @param {K} key - The key to remove.
+   * @returns True if the key was present.
+   */
+  delete(key: K): boolean {
+    if (!this.has(key)) return false;
+    const root = this._own(this._root!);
+    if (!this._isRed(root.left) && !this._isRed(root.right)) root.color = RBTNColor.RED;
+    // Every node _delete returns is owned by this tree, so the root can be recolored in place
+    this._root = this._delete(root, key);
+    if (this._root) this._root.color = RBTNColor.BLACK;
+    this._size--;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function returns the smallest key.
+   * @returns The smallest key, or undefined if the tree is empty.
+   */
+  firstKey(): K | undefined {
+    let node = this._root;
+    if (!node) return undefined;
+    while (node.left) node = node.left;
+    return node.key;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function returns the largest key.
+   * @returns The largest key, or undefined if the tree is empty.
+   */
+  lastKey(): K | undefined {
+    let node = this._root;
+    if (!node) return undefined;
+    while (node.right) node = node.right;
+    return node.key;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The clone function is the same as `snapshot`: the copy shares the nodes and costs O(1).
+   * @returns A new PersistentRBTree with the same entries.
+   */
+  clone(): PersistentRBTree<K, V> {
+    return this.snapshot();
+  }
+
+  /**
+   * Time Complexity: O(n log n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function creates a new tree with the entries that pass a predicate.
+   * @param predicate - Called with `(value, key, index, tree)`.
+   * @param {any} [thisArg] - The value to use as `this` inside the predicate.
+   * @returns A new PersistentRBTree.
+   */
+  filter(predicate: EntryCallback<K, V | undefined, boolean>, thisArg?: any): PersistentRBTree<K, V> {
+    const tree = new PersistentRBTree<K, V>([], { comparator: this._comparator });
+    let index = 0;
+    for (const [key, value] of this) {
+      if (predicate.call(thisArg, value, key, index++, this)) tree.set(key, value);
+    }
+    return tree;
+  }
+
+  /**
+   * Time Complexity: O(n log n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function creates a new tree with the same keys and mapped values.
+   * @param callback - Called with `(value, key, index, tree)`.
+   * @param {any} [thisArg] - The value to use as `this` inside the callback.
+   * @returns A new PersistentRBTree.
+   */
+  map<NV>(callback: EntryCallback<K, V | undefined, NV>, thisArg?: any): PersistentRBTree<K, NV> {
+    const tree = new PersistentRBTree<K, NV>([], { comparator: this._comparator });
+    let index = 0;
+    for (const [key, value] of this) tree.set(key, callback.call(thisArg, value, key, index++, this));
+    return tree;
+  }
+
+  /**
+   * The function yields the entries in key order with an explicit stack.
+   */
+  protected* _getIterator(): IterableIterator<[K, V | undefined]> {
+    const stack: PersistentRBTreeNode<K, V>[] = [];
+    let node = this._root;
+    while (node || stack.length > 0) {
+      while (node) {
+        stack.push(node);
+        node = node.left;
+      }
+      node = stack.pop()!;
+      yield [node.key, node.value];
+      node = node.right;
+    }
+  }
+
+  /**
+   * The function returns a node this tree may change: the node itself if the tree created it since the last
+   * snapshot, otherwise a copy.
+   * @param node - The node to take ownership of.
+   * @returns A node owned by this tree.
+   */
+  protected _own(node: PersistentRBTreeNode<K, V>): PersistentRBTreeNode<K, V> {
+    if (node.owner === this._owner) return node;
+    const copy = new PersistentRBTreeNode<K, V>(node.key, node.value, node.color, this._owner);
+    copy.left = node.left;
+    copy.right = node.right;
+    return copy;
+  }
+
+  protected _isRed(node: PersistentRBTreeNode<K, V> | undefined): boolean {
+    return node !== undefined && node.color === RBTNColor.RED;
+  }
+
+  protected _put(
+    node: PersistentRBTreeNode<K, V> | undefined,
+    key: K,
+    value: V | undefined
+  ): PersistentRBTreeNode<K, V> {
+    if (!node) {
+      this._size++;
+      return new PersistentRBTreeNode<K, V>(key, value, RBTNColor.RED, this._owner);
+    }
+    const cmp = this._comparator(key, node.key);
+    let h = this._own(node);
+    if (cmp < 0) h.left = this._put(h.left, key, value);
+    else if (cmp > 0) h.right = this._put(h.right, key, value);
+    else h.value = value;
+
+    if (this._isRed(h.right) && !this._isRed(h.left)) h = this._rotateLeft(h);
+    if (this._isRed(h.left) && this._isRed(h.left!.left)) h = this._rotateRight(h);
+    if (this._isRed(h.left) && this._isRed(h.right)) this._flipColors(h);
+    return h;
+  }
+
+  // `h` is owned by the caller in this and every helper below
+  protected _delete(h: PersistentRBTreeNode<K, V>, key: K): PersistentRBTreeNode<K, V> | undefined {
+    if (this._comparator(key, h.key) < 0) {
+      if (!this._isRed(h.left) && !this._isRed(h.left!.left)) h = this._moveRedLeft(h);
+      h.left = this._delete(this._own(h.left!), key);
+    } else {
+      if (this._isRed(h.left)) h = this._rotateRight(h);
+      if (this._comparator(key, h.key) === 0 && !h.right) return undefined;
+      if (!this._isRed(h.right) && !this._isRed(h.right!.left)) h = this._moveRedRight(h);
+      if (this._comparator(key, h.key) === 0) {
+        let min = h.right!;
+        while (min.left) min = min.left;
+        h.key = min.key;
+        h.value = min.value;
+        h.right = this._deleteMin(this._own(h.right!));
+      } else {
+        h.right = this._delete(this._own(h.right!), key);
+      }
+    }
+    return this._balance(h);
+  }
+
+  protected _deleteMin(h: PersistentRBTreeNode<K, V>): PersistentRBTreeNode<K, V> | undefined {
+    if (!h.left) return undefined;
+    if (!this._isRed(h.left) && !this._isRed(h.left.left)) h = this._moveRedLeft(h);
+    h.left = this._deleteMin(this._own(h.left!));
+    return this._balance(h);
+  }
+
+  protected _rotateLeft(h: PersistentRBTreeNode<K, V>): PersistentRBTreeNode<K, V> {
+    const x = this._own(h.right!);
+    h.right = x.left;
+    x.left = h;
+    x.color = h.color;
+    h.color = RBTNColor.RED;
+    return x;
+  }
+
+  protected _rotateRight(h: PersistentRBTreeNode<K, V>): PersistentRBTreeNode<K, V> {
+    const x = this._own(h.left!);
+    h.left = x.right;
+    x.right = h;
+    x.color = h.color;
+    h.color = RBTNColor.RED;
+    return x;
+  }
+
+  protected _flipColors(h: PersistentRBTreeNode<K, V>): void {
+    const left = (h.left = this._own(h.left!));
+    const right = (h.right = this._own(h.right!));
+    h.color = h.color === RBTNColor.RED ? RBTNColor.BLACK : RBTNColor.RED;
+    left.color = left.color === RBTNColor.RED ? RBTNColor.BLACK : RBTNColor.RED;
+    right.color = right.color === RBTNColor.RED ? RBTNColor.BLACK : RBTNColor.RED;
+  }
+
+  protected _moveRedLeft(h: PersistentRBTreeNode<K, V>): PersistentRBTreeNode<K, V> {
+    this._flipColors(h);
+    if (this._isRed(h.right!.left)) {
+      h.right = this._rotateRight(h.right!);
+      h = this._rotateLeft(h);
+      this._flipColors(h);
+    }
+    return h;
+  }
+
+  protected _moveRedRight(h: PersistentRBTreeNode<K, V>): PersistentRBTreeNode<K, V> {
+    this._flipColors(h);
+    if (this._isRed(h.left!.left)) {
+      h = this._rotateRight(h);
+      this._flipColors(h);
+    }
+    return h;
+  }
+
+  protected _balance(h: PersistentRBTreeNode<K, V>): PersistentRBTreeNode<K, V> {
+    if (this._isRed(h.right) && !this._isRed(h.left)) h = this._rotateLeft(h);
+    if (this._isRed(h.left) && this._isRed(h.left!.left)) h = this._rotateRight(h);
+    if (this._isRed(h.left) && this._isRed(h.right)) this._flipColors(h);
+    return h;
+  }
+}
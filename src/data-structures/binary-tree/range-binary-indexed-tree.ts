@@ -0,0 +1,160 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+
+/**
+ * 1. Range Update, Range Query: A RangeBinaryIndexedTree adds a delta to every value of a range and sums a range, both in O(log n), with two Fenwick trees over the differences of the values.
+ * 2. Prefix Sums: With d the difference array, the sum of the first i values is `i * sum(d[1..i]) - sum((j - 1) * d[j])`; one tree holds d and the other `(j - 1) * d[j]`.
+ * 3. Storage: Both trees are Float64Arrays of n + 1 slots, slot 0 unused. Ranges are inclusive and indexes 0-based.
+ */
+export class RangeBinaryIndexedTree {
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The constructor creates a tree of `size` values, all 0, or of the given initial values.
+   * @param {number | ArrayLike<number>} sizeOrValues - The number of values, or the initial values.
+   */
+  constructor(sizeOrValues: number | ArrayLike<number>) {
+    const isSize = typeof sizeOrValues === 'number';
+    const n = isSize ? sizeOrValues : sizeOrValues.length;
+    this._size = n;
+    this._deltas = new Float64Array(n + 1);
+    this._weighted = new Float64Array(n + 1);
+    if (isSize) return;
+
+    const deltas = this._deltas,
+      weighted = this._weighted;
+    let previous = 0;
+    for (let i = 1; i <= n; i++) {
+      const value = sizeOrValues[i - 1];
+      deltas[i] += value - previous;
+      weighted[i] += (value - previous) * (i - 1);
+      previous = value;
+      const parent = i + (i & -i);
+      if (parent <= n) {
+        deltas[parent] += deltas[i];
+        weighted[parent] += weighted[i];
+      }
+    }
+  }
+
+  protected _size: number;
+
+  /**
+   * The function returns the number of values.
+   * @returns The `_size` property is being returned.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  protected _deltas: Float64Array;
+
+  protected _weighted: Float64Array;
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `addRange` function adds a delta to every value from `start` to `end`, both inclusive.
+   * @param {number} start - The first index.
+   * @param {number} end - The last index.
+   * @param {number} delta - The amount to add.
+   */
+  addRange(start: number, end: number, delta: number): void {
+    this._checkRange(start, end);
+    this._add(start + 1, delta);
+    this._add(end + 2, -delta);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `add` function adds a delta to one value.
+   * @param {number} index - The index.
+   * @param {number} delta - The amount to add.
+   */
+  add(index: number, delta: number): void {
+    this.addRange(index, index, delta);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `query` function sums the values from `start` to `end`, both inclusive.
+   * @param {number} start - The first index.
+   * @param {number} end - The last index; `start - 1` for an empty range.
+   * @returns The sum.
+   */
+  query(start: number, end: number): number {
+    if (!(start >= 0 && end < this._size && start <= end + 1)) {
+      throw new Error('Index out of range: Range must be within [0, this.size).');
+    }
+    return this._prefixSum(end + 1) - this._prefixSum(start);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `get` function returns one value.
+   * @param {number} index - The index.
+   * @returns The value.
+   */
+  get(index: number): number {
+    this._checkRange(index, index);
+    let i = index + 1,
+      value = 0;
+    while (i > 0) {
+      value += this._deltas[i];
+      i -= i & -i;
+    }
+    return value;
+  }
+
+  /**
+   * The function returns the sum of the first `count` values.
+   * @param {number} count - A count from 0 to `size`.
+   * @returns The sum.
+   */
+  protected _prefixSum(count: number): number {
+    let i = count,
+      deltas = 0,
+      weighted = 0;
+    while (i > 0) {
+      deltas += this._deltas[i];
+      weighted += this._weighted[i];
+      i -= i & -i;
+    }
+    return deltas * count - weighted;
+  }
+
+  /**
+   * The function adds a delta to the difference at a 1-based position.
+   * @param {number} position - A position from 1 to `size + 1`; `size + 1` is ignored.
+   * @param {number} delta - The change of the difference.
+   */
+  protected _add(position: number, delta: number): void {
+    const weightedDelta = delta * (position - 1);
+    for (let i = position; i <= this._size; i += i & -i) {
+      this._deltas[i] += delta;
+      this._weighted[i] += weightedDelta;
+    }
+  }
+
+  protected _checkRange(start: number, end: number): void {
+    if (!Number.isInteger(start) || !Number.isInteger(end)) {
+      throw new Error('Invalid index: Index must be an integer.');
+    }
+    if (start < 0 || end >= this._size || start > end) {
+      throw new Error('Index out of range: Range must be within [0, this.size).');
+    }
+  }
+}
@@ -10,6 +10,7 @@ import {
   BinaryTreeDeleteResult,
   BSTNKeyOrNode,
   BTNCallback,
+  InstrumentedMethods,
   KeyOrNodeOrEntry,
   RBTNColor,
   RBTreeOptions,
@@ -88,6 +89,7 @@ export class RedBlackTree<
   constructor(keysOrNodesOrEntries: Iterable<KeyOrNodeOrEntry<K, V, NODE>> = [], options?: RBTreeOptions<K>) {
     super([], options);
 
+    this._Sentinel.subtreeSize = 0;
     this._root = this._Sentinel;
     if (keysOrNodesOrEntries) super.addMany(keysOrNodesOrEntries);
   }
@@ -148,6 +150,8 @@ export class RedBlackTree<
   override createTree(options?: RBTreeOptions<K>): TREE {
     return new RedBlackTree<K, V, NODE, TREE>([], {
       iterationType: this.iterationType,
+      comparator: this.comparator,
+      isOrderStatistic: this.isOrderStatistic,
       ...options
     }) as TREE;
   }
@@ -234,9 +238,10 @@ export class RedBlackTree<
     while (x !== this._Sentinel) {
       y = x;
       if (x) {
-        if (newNode.key < x.key) {
+        const compared = this._compareKeys(newNode.key, x.key);
+        if (compared < 0) {
           x = x.left;
-        } else if (newNode.key > x.key) {
+        } else if (compared > 0) {
           x = x?.right;
         } else {
           if (newNode !== x) {
@@ -250,11 +255,12 @@ export class RedBlackTree<
     newNode.parent = y;
     if (y === undefined) {
       this._setRoot(newNode);
-    } else if (newNode.key < y.key) {
+    } else if (this._compareKeys(newNode.key, y.key) < 0) {
       y.left = newNode;
     } else {
       y.right = newNode;
     }
+    this._updateSubtreeSizesToRoot(newNode);
 
     if (newNode.parent === undefined) {
       newNode.color = RBTNColor.BLACK;
@@ -298,10 +304,19 @@ export class RedBlackTree<
   ): BinaryTreeDeleteResult<NODE>[] {
     const ans: BinaryTreeDeleteResult<NODE>[] = [];
     if (identifier === null) return ans;
+    const isKeySearch = callback === this._defaultOneParamCallback;
     const helper = (node: NODE | undefined): void => {
       let z: NODE = this._Sentinel;
       let x: NODE | undefined, y: NODE;
       while (node !== this._Sentinel) {
+        if (node && isKeySearch) {
+          // Searching by key walks a single path guided by the comparator
+          const compared = this._compareKeys(node.key, identifier as K);
+          if (compared === 0) z = node;
+          node = compared <= 0 ? node.right : node.left;
+          continue;
+        }
+
         if (node && callback(node) === identifier) {
           z = node;
         }
@@ -313,13 +328,12 @@ export class RedBlackTree<
         }
       }
 
-      if (z === this._Sentinel) {
-        this._size--;
-        return;
-      }
+      if (z === this._Sentinel) return;
 
       y = z;
       let yOriginalColor: number = y.color;
+      // The lowest node whose subtree loses a node
+      let sizeFrom: NODE | undefined = z.parent;
       if (z.left === this._Sentinel) {
         x = z.right;
         this._rbTransplant(z, z.right!);
@@ -330,6 +344,7 @@ export class RedBlackTree<
         y = this.getLeftMost(z.right)!;
         yOriginalColor = y.color;
         x = y.right;
+        sizeFrom = y.parent === z ? y : y.parent;
         if (y.parent === z) {
           x!.parent = y;
         } else {
@@ -343,6 +358,7 @@ export class RedBlackTree<
         y.left!.parent = y;
         y.color = z.color;
       }
+      this._updateSubtreeSizesToRoot(sizeFrom);
       if (yOriginalColor === RBTNColor.BLACK) {
         this._fixDelete(x!);
       }
@@ -434,6 +450,216 @@ export class RedBlackTree<
     return y!;
   }
 
+  /**
+   * The function gives a node linked by `_buildBalanced` Sentinel leaves and its color. Every level
+   * above the deepest one is full, so coloring the deepest level red and the rest black gives every
+   * path the same black height.
+   * @param {NODE} node - The node that was linked.
+   * @param {number} depth - The depth of the node, 0 for the root.
+   * @param {number} maxDepth - The depth of the deepest level of the tree.
+   */
+  protected override _onBuiltNode(node: NODE, depth: number, maxDepth: number): void {
+    if (!node.left) node.left = this._Sentinel;
+    if (!node.right) node.right = this._Sentinel;
+    node.color = depth === maxDepth && depth > 0 ? RBTNColor.RED : RBTNColor.BLACK;
+  }
+
+  /**
+   * Time Complexity: O(|bh(left) - bh(right)| + 1)
+   * Space Complexity: O(|bh(left) - bh(right)| + 1)
+   *
+   * The function joins two detached subtrees through a middle node, ranked by black height. Red roots
+   * are blackened first. With equal black heights the middle node becomes a red root; otherwise it is
+   * linked as a red node on the spine of the taller subtree, and red-red violations are rotated away on
+   * the way back up, as in the join-based Red-Black algorithm.
+   * @param {NODE | undefined} left - The root of the lesser subtree.
+   * @param {number} leftRank - The black height of `left`.
+   * @param {NODE} mid - The detached middle node.
+   * @param {NODE | undefined} right - The root of the greater subtree.
+   * @param {number} rightRank - The black height of `right`.
+   * @returns The root of the joined subtree and its black height.
+   */
+  protected override _joinNodes(
+    left: NODE | undefined,
+    leftRank: number,
+    mid: NODE,
+    right: NODE | undefined,
+    rightRank: number
+  ): [NODE, number] {
+    if (this._isRed(left)) {
+      left!.color = RBTNColor.BLACK;
+      leftRank++;
+    }
+    if (this._isRed(right)) {
+      right!.color = RBTNColor.BLACK;
+      rightRank++;
+    }
+    if (leftRank === rightRank) {
+      mid.color = RBTNColor.RED;
+      this._linkChildren(mid, left, right);
+      return [mid, leftRank];
+    }
+
+    const rank = Math.max(leftRank, rightRank);
+    const root =
+      leftRank > rightRank
+        ? this._joinRight(left!, leftRank, mid, right, rightRank)
+        : this._joinLeft(left, leftRank, mid, right!, rightRank);
+    if (root.color === RBTNColor.RED && (this._isRed(root.left) || this._isRed(root.right))) {
+      root.color = RBTNColor.BLACK;
+      return [root, rank + 1];
+    }
+    return [root, rank];
+  }
+
+  /**
+   * The function walks down the right spine of `node` to the first black subtree of the black height of
+   * `right`, and links `mid` there as a red node over the two.
+   * @param {NODE | undefined} node - The root of a subtree on the right spine of the lesser tree.
+   * @param {number} rank - The black height of `node`.
+   * @param {NODE} mid - The detached middle node.
+   * @param {NODE | undefined} right - The root of the greater subtree, which is black.
+   * @param {number} rightRank - The black height of `right`.
+   * @returns The root of the joined subtree.
+   */
+  protected _joinRight(
+    node: NODE | undefined,
+    rank: number,
+    mid: NODE,
+    right: NODE | undefined,
+    rightRank: number
+  ): NODE {
+    if (!node || (node.color === RBTNColor.BLACK && rank === rightRank)) {
+      mid.color = RBTNColor.RED;
+      this._linkChildren(mid, node, right);
+      return mid;
+    }
+    const spine = this.isRealNode(node.right) ? node.right : undefined;
+    const isBlack = node.color === RBTNColor.BLACK;
+    const joined = this._joinRight(spine, isBlack ? rank - 1 : rank, mid, right, rightRank);
+    node.right = joined;
+    this._refreshNode(node);
+    if (isBlack && joined.color === RBTNColor.RED && this._isRed(joined.right)) {
+      joined.right!.color = RBTNColor.BLACK;
+      return this._rotateSubtreeLeft(node);
+    }
+    return node;
+  }
+
+  /**
+   * The function walks down the left spine of `node` to the first black subtree of the black height of
+   * `left`, and links `mid` there as a red node over the two.
+   * @param {NODE | undefined} left - The root of the lesser subtree, which is black.
+   * @param {number} leftRank - The black height of `left`.
+   * @param {NODE} mid - The detached middle node.
+   * @param {NODE | undefined} node - The root of a subtree on the left spine of the greater tree.
+   * @param {number} rank - The black height of `node`.
+   * @returns The root of the joined subtree.
+   */
+  protected _joinLeft(
+    left: NODE | undefined,
+    leftRank: number,
+    mid: NODE,
+    node: NODE | undefined,
+    rank: number
+  ): NODE {
+    if (!node || (node.color === RBTNColor.BLACK && rank === leftRank)) {
+      mid.color = RBTNColor.RED;
+      this._linkChildren(mid, left, node);
+      return mid;
+    }
+    const spine = this.isRealNode(node.left) ? node.left : undefined;
+    const isBlack = node.color === RBTNColor.BLACK;
+    const joined = this._joinLeft(left, leftRank, mid, spine, isBlack ? rank - 1 : rank);
+    node.left = joined;
+    this._refreshNode(node);
+    if (isBlack && joined.color === RBTNColor.RED && this._isRed(joined.left)) {
+      joined.left!.color = RBTNColor.BLACK;
+      return this._rotateSubtreeRight(node);
+    }
+    return node;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function counts the black nodes on the leftmost path of a subtree. The set operations only call
+   * it once per tree and derive every other black height from it.
+   * @param {NODE | undefined} node - The root of a subtree.
+   * @returns The black height, 0 for an empty subtree.
+   */
+  protected override _rankOf(node: NODE | undefined): number {
+    let rank = 0;
+    for (let cur = node; this.isRealNode(cur); cur = cur.left) {
+      if (cur.color === RBTNColor.BLACK) rank++;
+    }
+    return rank;
+  }
+
+  /**
+   * The function derives the black height of a child from that of its parent.
+   * @param {NODE} parent - The parent node.
+   * @param {number} parentRank - The black height of the subtree rooted at `parent`.
+   * @returns The black height of the child subtree.
+   */
+  protected override _childRank(parent: NODE, parentRank: number): number {
+    return parent.color === RBTNColor.BLACK ? parentRank - 1 : parentRank;
+  }
+
+  /**
+   * The function links the children of a node, using the Sentinel for empty ones.
+   * @param {NODE} node - The node.
+   * @param {NODE | undefined} left - The new left subtree.
+   * @param {NODE | undefined} right - The new right subtree.
+   */
+  protected override _linkChildren(node: NODE, left: NODE | undefined, right: NODE | undefined): void {
+    super._linkChildren(node, left ?? this._Sentinel, right ?? this._Sentinel);
+  }
+
+  /**
+   * The function installs a joined subtree as the root, blackening it.
+   * @param {NODE | undefined} root - The new root.
+   * @param {number} size - The number of nodes under it.
+   */
+  protected override _setJoinedRoot(root: NODE | undefined, size: number): void {
+    if (root) root.color = RBTNColor.BLACK;
+    this._setRoot(root ?? this._Sentinel);
+    this._size = size;
+  }
+
+  /**
+   * Time Complexity: O(m) the first time, O(1) for trees that already share the Sentinel
+   * Space Complexity: O(log m)
+   *
+   * The function relinks the leaves of another tree to the Sentinel of this tree and makes the other
+   * tree use it too, so their nodes can move between them. Trees made by `split` share it from the start.
+   * @param {TREE} tree - The tree whose nodes will be moved.
+   */
+  protected override _shareLeaves(tree: TREE): void {
+    const sentinel = tree._Sentinel;
+    if (sentinel === this._Sentinel) return;
+    const stack: NODE[] = tree._root && tree._root !== sentinel ? [tree._root] : [];
+    while (stack.length > 0) {
+      const node = stack.pop()!;
+      if (node.left === sentinel) node.left = this._Sentinel;
+      else if (node.left) stack.push(node.left);
+      if (node.right === sentinel) node.right = this._Sentinel;
+      else if (node.right) stack.push(node.right);
+    }
+    tree._Sentinel = this._Sentinel;
+    if (tree._root === sentinel) tree._root = this._Sentinel;
+  }
+
+  /**
+   * The function tells whether a node is a real red node.
+   * @param {NODE | undefined} node - The node.
+   * @returns True if the node is red.
+   */
+  protected _isRed(node: NODE | undefined): boolean {
+    return this.isRealNode(node) && node.color === RBTNColor.RED;
+  }
+
   /**
    * The function sets the root node of a tree structure and updates the parent property of the new
    * root node.
@@ -476,6 +702,8 @@ export class RedBlackTree<
       }
       y.left = x;
       x.parent = y;
+      this._updateSubtreeSize(x);
+      this._updateSubtreeSize(y);
     }
   }
 
@@ -509,6 +737,8 @@ export class RedBlackTree<
       }
       y.right = x;
       x.parent = y;
+      this._updateSubtreeSize(x);
+      this._updateSubtreeSize(y);
     }
   }
 
@@ -584,58 +814,60 @@ export class RedBlackTree<
    * @param {RedBlackTreeNode} x - The parameter `x` represents a node in a Red-Black Tree (RBT).
    */
   protected _fixDelete(x: NODE): void {
-    let s: NODE | undefined;
+    let s: NODE;
     while (x !== this.root && x.color === RBTNColor.BLACK) {
-      if (x.parent && x === x.parent.left) {
-        s = x.parent.right!;
-        if (s.color === 1) {
+      // x may be the Sentinel, whose parent is re-pointed by the rotations below, so read it once
+      const parent = x.parent!;
+      if (x === parent.left) {
+        s = parent.right!;
+        if (s.color === RBTNColor.RED) {
           s.color = RBTNColor.BLACK;
-          x.parent.color = RBTNColor.RED;
-          this._leftRotate(x.parent);
-          s = x.parent.right!;
+          parent.color = RBTNColor.RED;
+          this._leftRotate(parent);
+          s = parent.right!;
         }
 
-        if (s.left !== undefined && s.left.color === RBTNColor.BLACK && s.right && s.right.color === RBTNColor.BLACK) {
+        if (s.left!.color === RBTNColor.BLACK && s.right!.color === RBTNColor.BLACK) {
           s.color = RBTNColor.RED;
-          x = x.parent;
+          x = parent;
         } else {
-          if (s.right && s.right.color === RBTNColor.BLACK) {
-            if (s.left) s.left.color = RBTNColor.BLACK;
+          if (s.right!.color === RBTNColor.BLACK) {
+            s.left!.color = RBTNColor.BLACK;
             s.color = RBTNColor.RED;
             this._rightRotate(s);
-            s = x.parent.right;
+            s = parent.right!;
           }
 
-          if (s) s.color = x.parent.color;
-          x.parent.color = RBTNColor.BLACK;
-          if (s && s.right) s.right.color = RBTNColor.BLACK;
-          this._leftRotate(x.parent);
+          s.color = parent.color;
+          parent.color = RBTNColor.BLACK;
+          s.right!.color = RBTNColor.BLACK;
+          this._leftRotate(parent);
           x = this.root;
         }
       } else {
-        s = x.parent!.left!;
-        if (s.color === 1) {
+        s = parent.left!;
+        if (s.color === RBTNColor.RED) {
           s.color = RBTNColor.BLACK;
-          x.parent!.color = RBTNColor.RED;
-          this._rightRotate(x.parent!);
-          s = x.parent!.left;
+          parent.color = RBTNColor.RED;
+          this._rightRotate(parent);
+          s = parent.left!;
         }
 
-        if (s && s.right && s.right.color === RBTNColor.BLACK && s.right.color === RBTNColor.BLACK) {
+        if (s.left!.color === RBTNColor.BLACK && s.right!.color === RBTNColor.BLACK) {
           s.color = RBTNColor.RED;
-          x = x.parent!;
+          x = parent;
         } else {
-          if (s && s.left && s.left.color === RBTNColor.BLACK) {
-            if (s.right) s.right.color = RBTNColor.BLACK;
+          if (s.left!.color === RBTNColor.BLACK) {
+            s.right!.color = RBTNColor.BLACK;
             s.color = RBTNColor.RED;
             this._leftRotate(s);
-            s = x.parent!.left;
+            s = parent.left!;
           }
 
-          if (s) s.color = x.parent!.color;
-          x.parent!.color = RBTNColor.BLACK;
-          if (s && s.left) s.left.color = RBTNColor.BLACK;
-          this._rightRotate(x.parent!);
+          s.color = parent.color;
+          parent.color = RBTNColor.BLACK;
+          s.left!.color = RBTNColor.BLACK;
+          this._rightRotate(parent);
           x = this.root;
         }
       }
@@ -681,4 +913,20 @@ export class RedBlackTree<
 
     return super._replaceNode(oldNode, newNode);
   }
+
+  /**
+   * The function adds the rotations and the insert and delete fix-ups to the comparisons of the BST.
+   * @returns The methods `enableStats` wraps.
+   */
+  protected override _instrumentedMethods(): InstrumentedMethods {
+    return {
+      ...super._instrumentedMethods(),
+      _leftRotate: 'rotations',
+      _rightRotate: 'rotations',
+      _rotateSubtreeLeft: 'rotations',
+      _rotateSubtreeRight: 'rotations',
+      _fixInsert: 'insertFixups',
+      _fixDelete: 'deleteFixups'
+    };
+  }
 }
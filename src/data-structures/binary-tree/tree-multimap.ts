@@ -6,7 +6,10 @@
  * @license MIT License
  */
 import type {
+  BinarySnapshotOptions,
+  BinarySource,
   BinaryTreeDeleteResult,
+  BSTMergeValues,
   BSTNKeyOrNode,
   BTNCallback,
   KeyOrNodeOrEntry,
@@ -14,9 +17,18 @@ import type {
   TreeMultimapNodeNested,
   TreeMultimapOptions
 } from '../../types';
-import { FamilyPosition, IterationType } from '../../types';
+import { BinarySnapshotKind, FamilyPosition } from '../../types';
 import { IBinaryTree } from '../../interfaces';
+import {
+  BinaryReader,
+  binaryCodecs,
+  BinaryWriter,
+  readSnapshotHeader,
+  toBinaryReader,
+  writeSnapshotHeader
+} from '../../utils';
 import { AVLTree, AVLTreeNode } from './avl-tree';
+import { BST } from './bst';
 
 export class TreeMultimapNode<
   K = any,
@@ -114,6 +126,8 @@ export class TreeMultimap<
     return new TreeMultimap<K, V, NODE, TREE>([], {
       iterationType: this.iterationType,
       variant: this.variant,
+      comparator: this.comparator,
+      isOrderStatistic: this.isOrderStatistic,
       ...options
     }) as TREE;
   }
@@ -298,57 +312,67 @@ export class TreeMultimap<
   }
 
   /**
-   * Time Complexity: O(n log n)
+   * Time Complexity: O(log n + k), where k is the number of moved keys
    * Space Complexity: O(log n)
    */
 
   /**
-   * Time Complexity: O(n log n)
+   * Time Complexity: O(log n + k), where k is the number of moved keys
    * Space Complexity: O(log n)
    *
-   * The `perfectlyBalance` function takes a sorted array of nodes and builds a balanced binary search
-   * tree using either a recursive or iterative approach.
-   * @param iterationType - The `iterationType` parameter is an optional parameter that specifies the
-   * type of iteration to use when building the balanced binary search tree. It can have two possible
-   * values:
-   * @returns a boolean value.
-   */
-  override perfectlyBalance(iterationType = this.iterationType): boolean {
-    const sorted = this.dfs(node => node, 'in'),
-      n = sorted.length;
-    if (sorted.length < 1) return false;
-
-    this.clear();
-
-    if (iterationType === IterationType.RECURSIVE) {
-      const buildBalanceBST = (l: number, r: number) => {
-        if (l > r) return;
-        const m = l + Math.floor((r - l) / 2);
-        const midNode = sorted[m];
-        this.add(midNode.key, midNode.value, midNode.count);
-        buildBalanceBST(l, m - 1);
-        buildBalanceBST(m + 1, r);
-      };
-
-      buildBalanceBST(0, n - 1);
-      return true;
-    } else {
-      const stack: [[number, number]] = [[0, n - 1]];
-      while (stack.length > 0) {
-        const popped = stack.pop();
-        if (popped) {
-          const [l, r] = popped;
-          if (l <= r) {
-            const m = l + Math.floor((r - l) / 2);
-            const midNode = sorted[m];
-            this.add(midNode.key, midNode.value, midNode.count);
-            stack.push([m + 1, r]);
-            stack.push([l, m - 1]);
-          }
-        }
-      }
-      return true;
-    }
+   * The `split` function moves the keys greater than or equal to `key` into a new multimap, as the `split`
+   * of the BST does, and moves the counts of those keys with them.
+   * @param {K} key - The key to split at.
+   * @returns A new multimap with the keys from `key` on.
+   */
+  override split(key: K): TREE {
+    const tree = super.split(key);
+    const moved = this._sumCounts(tree.root);
+    tree._count = moved;
+    this._count -= moved;
+    return tree;
+  }
+
+  /**
+   * Time Complexity: O(log n + log m)
+   * Space Complexity: O(log n)
+   */
+
+  /**
+   * Time Complexity: O(log n + log m)
+   * Space Complexity: O(log n)
+   *
+   * The `join` function moves every node of `right`, whose keys must all be greater than the keys of this
+   * multimap, to the end of this multimap together with its count, and empties `right`.
+   * @param {TREE} right - A multimap with greater keys.
+   * @returns The number of nodes in the tree.
+   */
+  override join(right: TREE): number {
+    const moved = (right as unknown) === this ? 0 : right.count;
+    const size = super.join(right);
+    this._count += moved;
+    return size;
+  }
+
+  /**
+   * Time Complexity: O(m log(n / m + 1)), where m is the size of the smaller tree
+   * Space Complexity: O(log n + log m)
+   */
+
+  /**
+   * Time Complexity: O(m log(n / m + 1)), where m is the size of the smaller tree
+   * Space Complexity: O(log n + log m)
+   *
+   * The `intersection` function keeps only the keys of this multimap that are also in `other`, with the
+   * counts they have in this multimap.
+   * @param other - A tree ordered by the same comparator.
+   * @param [merge] - Gives the value of a kept key. By default the value of this multimap is kept.
+   * @returns The number of nodes in the tree.
+   */
+  override intersection(other: BST<K, V, any, any>, merge?: BSTMergeValues<K, V>): number {
+    const size = super.intersection(other, merge);
+    this._count = this._sumCounts(this.root);
+    return size;
   }
 
   /**
@@ -369,6 +393,58 @@ export class TreeMultimap<
     return cloned;
   }
 
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   */
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `writeBinary` function writes a binary snapshot of the multimap: a header, the number of
+   * nodes, then each key, value and count in ascending order. The counts are kept, unlike the snapshot
+   * of a plain BST, which a multimap refuses to load.
+   * @param {BinaryWriter} writer - The writer to append to.
+   * @param [options] - `keyCodec` and `valueCodec`, `binaryCodecs.any` by default.
+   */
+  override writeBinary(writer: BinaryWriter, options?: BinarySnapshotOptions<K, V | undefined>): void {
+    const keyCodec = options?.keyCodec ?? binaryCodecs.any;
+    const valueCodec = options?.valueCodec ?? binaryCodecs.any;
+    writeSnapshotHeader(writer, BinarySnapshotKind.TreeMultimap);
+    writer.writeVarUint(this.size);
+    for (const node of this.dfs(node => node, 'in')) {
+      keyCodec.write(writer, node.key);
+      valueCodec.write(writer, node.value);
+      writer.writeVarUint(node.count);
+    }
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `loadBinary` function replaces the contents of the multimap with a snapshot written by
+   * `writeBinary`. The nodes are created with their counts and linked in one pass by `buildFromSorted`.
+   * @param source - The snapshot bytes, an iterable of chunks, or a reader positioned at a snapshot.
+   * @param [options] - The codecs the snapshot was written with.
+   * @returns The number of nodes in the tree.
+   */
+  override loadBinary(source: BinarySource | BinaryReader, options?: BinarySnapshotOptions<K, V | undefined>): number {
+    const keyCodec = options?.keyCodec ?? binaryCodecs.any;
+    const valueCodec = options?.valueCodec ?? binaryCodecs.any;
+    const reader = toBinaryReader(source);
+    readSnapshotHeader(reader, BinarySnapshotKind.TreeMultimap);
+    const size = reader.readVarUint();
+    const nodes: NODE[] = new Array(size);
+    for (let i = 0; i < size; i++) {
+      const key = keyCodec.read(reader);
+      const value = valueCodec.read(reader);
+      nodes[i] = this.createNode(key, value, reader.readVarUint());
+    }
+    return this.buildFromSorted(nodes);
+  }
+
   /**
    * The `_swapProperties` function swaps the key, value, count, and height properties between two nodes.
    * @param {K | NODE | undefined} srcNode - The `srcNode` parameter represents the source node from
@@ -406,6 +482,77 @@ export class TreeMultimap<
     return undefined;
   }
 
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(log n)
+   *
+   * The function links the sorted nodes into a balanced tree and sets the total count to the sum of
+   * their counts.
+   * @param {NODE[]} nodes - The nodes in ascending tree order.
+   */
+  protected override _buildBalanced(nodes: NODE[]): void {
+    super._buildBalanced(nodes);
+    let count = 0;
+    for (const node of nodes) count += node.count;
+    this._count = count;
+  }
+
+  /**
+   * The function copies a node of another tree together with its count, so that `union` adds up the
+   * counts of a key in both trees, as if every occurrence had been added with `add`. The nodes of a
+   * plain tree count once each.
+   * @param {NODE} source - The node of the other tree.
+   * @returns A new node of this tree.
+   */
+  protected override _copyNode(source: NODE): NODE {
+    const count = source.count ?? 1;
+    this._count += count;
+    return this.createNode(source.key, source.value, count);
+  }
+
+  /**
+   * The function merges the node of another tree into the node of this tree with the same key, adding
+   * up their counts.
+   * @param {NODE} target - The node of this tree.
+   * @param {NODE} source - The node of the other tree.
+   * @param [merge] - Gives the merged value; the value of `source` by default.
+   */
+  protected override _mergeNodes(target: NODE, source: NODE, merge?: BSTMergeValues<K, V>): void {
+    super._mergeNodes(target, source, merge);
+    const count = source.count ?? 1;
+    target.count += count;
+    this._count += count;
+  }
+
+  /**
+   * The function takes the count of a node `difference` removes off the total count.
+   * @param {NODE} node - The removed node.
+   */
+  protected override _discardNode(node: NODE): void {
+    this._count -= node.count;
+  }
+
+  /**
+   * Time Complexity: O(k), where k is the number of nodes in the subtree
+   * Space Complexity: O(log k)
+   *
+   * The function adds up the counts of a subtree.
+   * @param {NODE | undefined} node - The root of the subtree.
+   * @returns The sum of the counts.
+   */
+  protected _sumCounts(node: NODE | undefined): number {
+    if (!this.isRealNode(node)) return 0;
+    let count = 0;
+    const stack: NODE[] = [node];
+    while (stack.length > 0) {
+      const cur = stack.pop()!;
+      count += cur.count;
+      if (this.isRealNode(cur.left)) stack.push(cur.left);
+      if (this.isRealNode(cur.right)) stack.push(cur.right);
+    }
+    return count;
+  }
+
   /**
    * The function replaces an old node with a new node and updates the count property of the new node.
    * @param {NODE} oldNode - The `oldNode` parameter is of type `NODE` and represents the node that
@@ -5,12 +5,32 @@
  * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
  * @license MIT License
  */
-import type { DijkstraResult, EntryCallback, VertexKey } from '../../types';
-import { uuidV4 } from '../../utils';
+import type {
+  BinaryGraphSnapshotOptions,
+  BinarySource,
+  BinaryWriterOptions,
+  DijkstraResult,
+  EntryCallback,
+  InstrumentedMethods,
+  JohnsonResult,
+  ShortestPathResult,
+  VertexKey
+} from '../../types';
+import { BinarySnapshotKind } from '../../types';
+import {
+  BinaryReader,
+  binaryCodecs,
+  BinaryWriter,
+  readSnapshotHeader,
+  toBinaryReader,
+  uuidV4,
+  writeSnapshotHeader
+} from '../../utils';
 import { IterableEntryBase } from '../base';
 import { IGraph } from '../../interfaces';
-import { Heap } from '../heap';
+import { Heap, IndexedHeap } from '../heap';
 import { Queue } from '../queue';
+import { CSRGraph } from './csr-graph';
 
 export abstract class AbstractVertex<V = any> {
   key: VertexKey;
@@ -80,6 +100,18 @@ export abstract class AbstractGraph<
 
   set vertexMap(v: Map<VertexKey, VO>) {
     this._vertexMap = v;
+    this._frozen = undefined;
+  }
+
+  protected _frozen?: CSRGraph;
+
+  /**
+   * The function returns the CSR snapshot taken by `freeze`, or `undefined` if the graph has not been
+   * frozen or has changed since.
+   * @returns The `_frozen` property is being returned.
+   */
+  get frozen(): CSRGraph | undefined {
+    return this._frozen;
   }
 
   /**
@@ -273,12 +305,123 @@ export abstract class AbstractGraph<
     const edge = this.getEdge(srcOrKey, destOrKey);
     if (edge) {
       edge.weight = weight;
+      this._frozen = undefined;
       return true;
     } else {
       return false;
     }
   }
 
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V + E)
+   */
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V + E)
+   *
+   * The `freeze` function takes a compressed sparse row snapshot of the graph. While the snapshot is
+   * kept, `dijkstra`, `bellmanFord` and, on directed graphs, `topologicalSort` and `tarjan` run on its
+   * typed arrays instead of the vertex and edge maps. Adding or deleting vertices or edges, or
+   * `setEdgeWeight`, discards it; changing an edge object directly does not, so call `freeze` again
+   * after that.
+   * Vertices are numbered in insertion order. Every parallel edge becomes an arc with its own weight,
+   * and an undirected edge becomes two arcs.
+   * @returns The `CSRGraph` snapshot, shared until the graph changes.
+   */
+  freeze(): CSRGraph {
+    if (!this._frozen) this._frozen = this._toCSR();
+    return this._frozen;
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V + E)
+   *
+   * The `writeBinary` function writes a binary snapshot of the graph: a header, whether it is directed,
+   * the vertices in insertion order with their values, then every edge as the indices of its ends, its
+   * weight and its value.
+   * @param {BinaryWriter} writer - The writer to append to.
+   * @param [options] - `keyCodec`, `vertexValueCodec` and `edgeValueCodec`, `binaryCodecs.any` by default.
+   */
+  writeBinary(writer: BinaryWriter, options?: BinaryGraphSnapshotOptions<V, E>): void {
+    const keyCodec = options?.keyCodec ?? binaryCodecs.any;
+    const vertexValueCodec = options?.vertexValueCodec ?? binaryCodecs.any;
+    const edgeValueCodec = options?.edgeValueCodec ?? binaryCodecs.any;
+    writeSnapshotHeader(writer, BinarySnapshotKind.Graph);
+    writer.writeUint8(this._isDirected() ? 1 : 0);
+
+    const indexMap = new Map<VO, number>();
+    writer.writeVarUint(this._vertexMap.size);
+    for (const vertex of this._vertexMap.values()) {
+      indexMap.set(vertex, indexMap.size);
+      keyCodec.write(writer, vertex.key);
+      vertexValueCodec.write(writer, vertex.value);
+    }
+
+    const edges = this.edgeSet();
+    writer.writeVarUint(edges.length);
+    for (const edge of edges) {
+      const ends = this.getEndsOfEdge(edge)!;
+      writer.writeVarUint(indexMap.get(ends[0])!);
+      writer.writeVarUint(indexMap.get(ends[1])!);
+      writer.writeFloat64(edge.weight);
+      edgeValueCodec.write(writer, edge.value);
+    }
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V + E)
+   *
+   * The `toBinary` function returns the snapshot `writeBinary` writes.
+   * @param [options] - The codecs, plus `BinaryWriter` options; with `onChunk` the snapshot is streamed
+   * and an empty array is returned.
+   * @returns The snapshot bytes.
+   */
+  toBinary(options?: BinaryGraphSnapshotOptions<V, E> & BinaryWriterOptions): Uint8Array {
+    const writer = new BinaryWriter(options);
+    this.writeBinary(writer, options);
+    return writer.finish();
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V + E)
+   *
+   * The `loadBinary` function replaces the vertices and edges of the graph with a snapshot.
+   * @param source - The snapshot bytes, an iterable of chunks, or a reader positioned at a snapshot.
+   * @param [options] - The codecs the snapshot was written with.
+   * @returns The number of vertices in the graph.
+   */
+  loadBinary(source: BinarySource | BinaryReader, options?: BinaryGraphSnapshotOptions<V, E>): number {
+    const keyCodec = options?.keyCodec ?? binaryCodecs.any;
+    const vertexValueCodec = options?.vertexValueCodec ?? binaryCodecs.any;
+    const edgeValueCodec = options?.edgeValueCodec ?? binaryCodecs.any;
+    const reader = toBinaryReader(source);
+    readSnapshotHeader(reader, BinarySnapshotKind.Graph);
+    if ((reader.readUint8() === 1) !== this._isDirected()) {
+      throw new Error('The graph snapshot and the graph differ in direction');
+    }
+
+    for (const key of [...this._vertexMap.keys()]) this.deleteVertex(key);
+    const vertexCount = reader.readVarUint();
+    const keys: VertexKey[] = new Array(vertexCount);
+    for (let i = 0; i < vertexCount; i++) {
+      keys[i] = keyCodec.read(reader);
+      this.addVertex(keys[i], vertexValueCodec.read(reader));
+    }
+    const edgeCount = reader.readVarUint();
+    for (let i = 0; i < edgeCount; i++) {
+      const src = keys[reader.readVarUint()];
+      const dest = keys[reader.readVarUint()];
+      const weight = reader.readFloat64();
+      this.addEdge(src, dest, weight, edgeValueCodec.read(reader));
+    }
+    return this._vertexMap.size;
+  }
+
   /**
    * Time Complexity: O(P), where P is the number of paths found (in the worst case, exploring all paths).
    * Space Complexity: O(P) - Linear space, where P is the number of paths found.
@@ -289,6 +432,7 @@ export abstract class AbstractGraph<
    * Space Complexity: O(P) - Linear space, where P is the number of paths found.
    *
    * The function `getAllPathsBetween` finds all paths between two vertexMap in a graph using depth-first search.
+   * It collects the first `limit` paths of `pathsIterator`.
    * @param {VO | VertexKey} v1 - The parameter `v1` represents either a vertex object (`VO`) or a vertex ID (`VertexKey`).
    * It is the starting vertex for finding paths.
    * @param {VO | VertexKey} v2 - The parameter `v2` represents either a vertex object (`VO`) or a vertex ID (`VertexKey`).
@@ -297,33 +441,75 @@ export abstract class AbstractGraph<
    */
   getAllPathsBetween(v1: VO | VertexKey, v2: VO | VertexKey, limit = 1000): VO[][] {
     const paths: VO[][] = [];
-    const vertex1 = this._getVertex(v1);
-    const vertex2 = this._getVertex(v2);
-
-    if (!(vertex1 && vertex2)) {
-      return [];
+    if (limit <= 0) return paths;
+    for (const path of this.pathsIterator(v1, v2)) {
+      paths.push(path);
+      if (paths.length >= limit) break;
     }
+    return paths;
+  }
 
-    const stack: { vertex: VO; path: VO[] }[] = [];
-    stack.push({ vertex: vertex1, path: [vertex1] });
-
-    while (stack.length > 0) {
-      const { vertex, path } = stack.pop()!;
+  /**
+   * Time Complexity: O(V + E) per path in the worst case
+   * Space Complexity: O(V + E)
+   */
 
-      if (vertex === vertex2) {
-        paths.push(path);
-        if (paths.length >= limit) return paths;
+  /**
+   * Time Complexity: O(V + E) per path in the worst case
+   * Space Complexity: O(V + E)
+   *
+   * The `pathsIterator` function lazily yields the simple paths between two vertices, in the same order as
+   * `getAllPathsBetween`. The search keeps one path on an explicit stack over vertex indices, so it does not recurse
+   * and allocates only the paths it yields; stop iterating to stop the search.
+   * @param {VO | VertexKey} v1 - The starting vertex or its key.
+   * @param {VO | VertexKey} v2 - The ending vertex or its key.
+   * @returns An iterator of paths, each an array of vertices from `v1` to `v2`.
+   */
+  *pathsIterator(v1: VO | VertexKey, v2: VO | VertexKey): IterableIterator<VO[]> {
+    const vertex1 = this._getVertex(v1);
+    const vertex2 = this._getVertex(v2);
+    if (!(vertex1 && vertex2)) return;
+
+    const csr = this._frozen ?? this._toCSR();
+    const offsets = csr.offsets,
+      targets = csr.targets;
+    const vertices = [...this._vertexMap.values()];
+    const n = vertices.length;
+    const src = csr.indexOf(vertex1.key),
+      dest = csr.indexOf(vertex2.key);
+    const path = new Int32Array(n);
+    // Arcs are tried from last to first, the order the paths have always been returned in
+    const cursor = new Int32Array(n);
+    const onPath = new Uint8Array(n);
+
+    let depth = 1;
+    path[0] = src;
+    onPath[src] = 1;
+    cursor[src] = offsets[src + 1];
+    if (src === dest) {
+      yield [vertex1];
+      return;
+    }
+    while (depth > 0) {
+      const v = path[depth - 1];
+      if (cursor[v] === offsets[v]) {
+        onPath[v] = 0;
+        depth--;
+        continue;
       }
-
-      const neighbors = this.getNeighbors(vertex);
-      for (const neighbor of neighbors) {
-        if (!path.includes(neighbor)) {
-          const newPath = [...path, neighbor];
-          stack.push({ vertex: neighbor, path: newPath });
-        }
+      const w = targets[--cursor[v]];
+      if (onPath[w]) continue;
+      if (w === dest) {
+        const found: VO[] = new Array(depth + 1);
+        for (let i = 0; i < depth; i++) found[i] = vertices[path[i]];
+        found[depth] = vertices[w];
+        yield found;
+        continue;
       }
+      path[depth++] = w;
+      onPath[w] = 1;
+      cursor[w] = offsets[w + 1];
     }
-    return paths;
   }
 
   /**
@@ -348,13 +534,13 @@ export abstract class AbstractGraph<
   }
 
   /**
-   * Time Complexity: O(V + E) - Depends on the implementation (Dijkstra's algorithm).
-   * Space Complexity: O(V + E) - Depends on the implementation (Dijkstra's algorithm).
+   * Time Complexity: O((V + E) * log(V)) - Bidirectional Dijkstra's algorithm, or O(V + E) breadth-first search.
+   * Space Complexity: O(V) - The vertices reached by the search.
    */
 
   /**
-   * Time Complexity: O(V + E) - Depends on the implementation (Dijkstra's algorithm).
-   * Space Complexity: O(V + E) - Depends on the implementation (Dijkstra's algorithm).
+   * Time Complexity: O((V + E) * log(V)) - Bidirectional Dijkstra's algorithm, or O(V + E) breadth-first search.
+   * Space Complexity: O(V) - The vertices reached by the search.
    *
    * The function `getMinCostBetween` calculates the minimum cost between two vertexMap in a graph, either based on edge
    * weights or using a breadth-first search algorithm.
@@ -364,21 +550,26 @@ export abstract class AbstractGraph<
    * @param {boolean} [isWeight] - isWeight is an optional parameter that indicates whether the graph edgeMap have weights.
    * If isWeight is set to true, the function will calculate the minimum cost between v1 and v2 based on the weights of
    * the edgeMap. If isWeight is set to false or not provided, the function will calculate the
+   * @param isDFS - If set to true, the weighted cost is the minimum over the paths found by getAllPathsBetween, which
+   * may take exponential time and gives up after 1000 paths. By default it comes from bidirectionalDijkstra.
    * @returns The function `getMinCostBetween` returns a number representing the minimum cost between two vertexMap (`v1`
-   * and `v2`). If the `isWeight` parameter is `true`, it calculates the minimum weight among all paths between the
-   * vertexMap. If `isWeight` is `false` or not provided, it uses a breadth-first search (BFS) algorithm to calculate the
+   * and `v2`). If the `isWeight` parameter is `true`, it calculates the minimum weight of a path between the
+   * vertexMap, or Infinity if there is none. If `isWeight` is `false` or not provided, it uses a breadth-first search (BFS) algorithm to calculate the
    * minimum number of
    */
-  getMinCostBetween(v1: VO | VertexKey, v2: VO | VertexKey, isWeight?: boolean): number | undefined {
+  getMinCostBetween(v1: VO | VertexKey, v2: VO | VertexKey, isWeight?: boolean, isDFS = false): number | undefined {
     if (isWeight === undefined) isWeight = false;
 
     if (isWeight) {
-      const allPaths = this.getAllPathsBetween(v1, v2);
-      let min = Infinity;
-      for (const path of allPaths) {
-        min = Math.min(this.getPathSumWeight(path), min);
+      if (isDFS) {
+        const allPaths = this.getAllPathsBetween(v1, v2);
+        let min = Infinity;
+        for (const path of allPaths) {
+          min = Math.min(this.getPathSumWeight(path), min);
+        }
+        return min;
       }
-      return min;
+      return this.bidirectionalDijkstra(v1, v2)?.distance ?? Infinity;
     } else {
       // BFS
       const vertex2 = this._getVertex(v2);
@@ -434,7 +625,7 @@ export abstract class AbstractGraph<
    * to false, the function will use breadth-first search (BFS) to find the minimum path.
    * @param isDFS - If set to true, it enforces the use of getAllPathsBetween to first obtain all possible paths,
    * followed by iterative computation of the shortest path. This approach may result in exponential time complexity,
-   * so the default method is to use the Dijkstra algorithm to obtain the shortest weighted path.
+   * so the default method is to use bidirectionalDijkstra to obtain the shortest weighted path.
    * @returns The function `getMinPathBetween` returns an array of vertexMap (`VO[]`) representing the minimum path between
    * two vertexMap (`v1` and `v2`). If there is no path between the vertexMap, it returns `undefined`.
    */
@@ -457,7 +648,7 @@ export abstract class AbstractGraph<
         }
         return allPaths[minIndex] || undefined;
       } else {
-        return this.dijkstra(v1, v2, true, true)?.minPath ?? [];
+        return this.bidirectionalDijkstra(v1, v2)?.path ?? [];
       }
     } else {
       // DFS
@@ -638,17 +829,18 @@ export abstract class AbstractGraph<
    * /
 
    /**
-   * Time Complexity: O((V + E) * log(V)) - Depends on the implementation (using a binary heap).
-   * Space Complexity: O(V + E) - Depends on the implementation (using a binary heap).
+   * Time Complexity: O((V + E) * log(V)) - Each vertex is in the indexed heap at most once.
+   * Space Complexity: O(V) - The heap keeps one slot per vertex.
    */
 
   /**
-   * Time Complexity: O((V + E) * log(V)) - Depends on the implementation (using a binary heap).
-   * Space Complexity: O(V + E) - Depends on the implementation (using a binary heap).
+   * Time Complexity: O((V + E) * log(V)) - Each vertex is in the indexed heap at most once.
+   * Space Complexity: O(V) - The heap keeps one slot per vertex.
    *
    * Dijkstra's algorithm is used to find the shortest paths from a source node to all other nodes in a graph. Its basic idea is to repeatedly choose the node closest to the source node and update the distances of other nodes using this node as an intermediary. Dijkstra's algorithm requires that the edge weights in the graph are non-negative.
    * The `dijkstra` function implements Dijkstra's algorithm to find the shortest path between a source vertex and an
    * optional destination vertex, and optionally returns the minimum distance, the paths, and other information.
+   * After `freeze`, the search runs on the CSR snapshot, where parallel edges keep their own weights.
    * @param {VO | VertexKey} src - The `src` parameter represents the source vertex from which the Dijkstra algorithm will
    * start. It can be either a vertex object or a vertex ID.
    * @param {VO | VertexKey | undefined} [dest] - The `dest` parameter is the destination vertex or vertex ID. It specifies the
@@ -682,14 +874,18 @@ export abstract class AbstractGraph<
 
     if (!srcVertex) return undefined;
 
+    // Vertices are numbered so the heap can hold each of them once and lower its distance in place
+    const vertices: VO[] = [];
+    const vertexIndex: Map<VO, number> = new Map();
     for (const vertex of vertexMap) {
       const vertexOrKey = vertex[1];
-      if (vertexOrKey instanceof AbstractVertex) distMap.set(vertexOrKey, Infinity);
+      if (vertexOrKey instanceof AbstractVertex) {
+        distMap.set(vertexOrKey, Infinity);
+        vertexIndex.set(vertexOrKey, vertices.length);
+        vertices.push(vertexOrKey);
+      }
     }
 
-    const heap = new Heap<{ key: number; value: VO }>([], { comparator: (a, b) => a.key - b.key });
-    heap.add({ key: 0, value: srcVertex });
-
     distMap.set(srcVertex, 0);
     preMap.set(srcVertex, undefined);
 
@@ -715,35 +911,56 @@ export abstract class AbstractGraph<
       }
     };
 
-    while (heap.size > 0) {
-      const curHeapNode = heap.poll();
-      const dist = curHeapNode?.key;
-      const cur = curHeapNode?.value;
-      if (dist !== undefined) {
-        if (cur) {
-          seen.add(cur);
-          if (destVertex && destVertex === cur) {
-            if (getMinDist) {
-              minDist = distMap.get(destVertex) || Infinity;
-            }
-            if (genPaths) {
-              getPaths(destVertex);
-            }
-            return { distMap, preMap, seen, paths, minDist, minPath };
+    const frozen = this._frozen;
+    if (frozen) {
+      // The snapshot numbers the vertices in the same order as `vertices`
+      const { dist, prev, order } = frozen.dijkstra(
+        vertexIndex.get(srcVertex)!,
+        destVertex ? vertexIndex.get(destVertex)! : -1
+      );
+      for (let i = 0; i < order.length; i++) seen.add(vertices[order[i]]);
+      for (let i = 0; i < vertices.length; i++) {
+        distMap.set(vertices[i], dist[i]);
+        if (prev[i] !== -1) preMap.set(vertices[i], vertices[prev[i]]);
+      }
+      if (destVertex && seen.has(destVertex)) {
+        if (getMinDist) {
+          minDist = distMap.get(destVertex) || Infinity;
+        }
+        if (genPaths) {
+          getPaths(destVertex);
+        }
+        return { distMap, preMap, seen, paths, minDist, minPath };
+      }
+    } else {
+      const heap = new IndexedHeap([], { capacity: vertices.length, arity: 4 });
+      heap.add(vertexIndex.get(srcVertex)!, 0);
+      const instrumentation = this._instrumentation;
+
+      while (heap.size > 0) {
+        const dist = heap.peekPriority()!;
+        const cur = vertices[heap.poll()!];
+        seen.add(cur);
+        if (destVertex && destVertex === cur) {
+          if (getMinDist) {
+            minDist = distMap.get(destVertex) || Infinity;
           }
-          const neighbors = this.getNeighbors(cur);
-          for (const neighbor of neighbors) {
-            if (!seen.has(neighbor)) {
-              const weight = this.getEdge(cur, neighbor)?.weight;
-              if (typeof weight === 'number') {
-                const distSrcToNeighbor = distMap.get(neighbor);
-                if (distSrcToNeighbor) {
-                  if (dist + weight < distSrcToNeighbor) {
-                    heap.add({ key: dist + weight, value: neighbor });
-                    preMap.set(neighbor, cur);
-                    distMap.set(neighbor, dist + weight);
-                  }
-                }
+          if (genPaths) {
+            getPaths(destVertex);
+          }
+          return { distMap, preMap, seen, paths, minDist, minPath };
+        }
+        const neighbors = this.getNeighbors(cur);
+        for (const neighbor of neighbors) {
+          if (!seen.has(neighbor)) {
+            const weight = this.getEdge(cur, neighbor)?.weight;
+            if (typeof weight === 'number') {
+              const distSrcToNeighbor = distMap.get(neighbor);
+              if (distSrcToNeighbor !== undefined && dist + weight < distSrcToNeighbor) {
+                heap.update(vertexIndex.get(neighbor)!, dist + weight);
+                preMap.set(neighbor, cur);
+                distMap.set(neighbor, dist + weight);
+                if (instrumentation) instrumentation.count('relaxations');
               }
             }
           }
@@ -769,6 +986,145 @@ export abstract class AbstractGraph<
     return { distMap, preMap, seen, paths, minDist, minPath };
   }
 
+  /**
+   * Time Complexity: O((V + E) * log(V)) in the worst case, usually far less for nearby vertices.
+   * Space Complexity: O(V) - Proportional to the vertices reached from both ends.
+   */
+
+  /**
+   * Time Complexity: O((V + E) * log(V)) in the worst case, usually far less for nearby vertices.
+   * Space Complexity: O(V) - Proportional to the vertices reached from both ends.
+   *
+   * The `bidirectionalDijkstra` function finds a shortest path between two vertices by running Dijkstra's algorithm
+   * forward from the source and backward from the destination at the same time, always growing the smaller frontier.
+   * It stops once the two frontiers together cannot beat the best meeting point, so it usually reaches far fewer
+   * vertices than a one-sided search, and it never numbers the whole graph. Edge weights must be non-negative.
+   * @param {VO | VertexKey} src - The source vertex or its key.
+   * @param {VO | VertexKey} dest - The destination vertex or its key.
+   * @returns `distance` (Infinity if `dest` cannot be reached) and `path`, the vertices from `src` to `dest`, or
+   * `undefined` if either vertex is not in the graph.
+   */
+  bidirectionalDijkstra(src: VO | VertexKey, dest: VO | VertexKey): ShortestPathResult<VO> {
+    const srcVertex = this._getVertex(src);
+    const destVertex = this._getVertex(dest);
+    if (!srcVertex || !destVertex) return undefined;
+    if (srcVertex === destVertex) return { distance: 0, path: [srcVertex] };
+
+    const vertexMap = this._vertexMap;
+    const comparator = (a: [number, VO], b: [number, VO]) => a[0] - b[0];
+    // Index 0 is the forward search from `src`, index 1 the backward search from `dest`
+    const distMaps = [new Map<VO, number>([[srcVertex, 0]]), new Map<VO, number>([[destVertex, 0]])];
+    const preMaps = [new Map<VO, VO>(), new Map<VO, VO>()];
+    const settled = [new Set<VO>(), new Set<VO>()];
+    const heaps = [
+      new Heap<[number, VO]>([[0, srcVertex]], { comparator }),
+      new Heap<[number, VO]>([[0, destVertex]], { comparator })
+    ];
+    let best = Infinity;
+    let meeting: VO | undefined;
+    const instrumentation = this._instrumentation;
+
+    while (heaps[0].size > 0 && heaps[1].size > 0) {
+      if (heaps[0].peek()![0] + heaps[1].peek()![0] >= best) break;
+      const side = heaps[0].size <= heaps[1].size ? 0 : 1;
+      const [dist, cur] = heaps[side].poll()!;
+      // The heap keeps outdated entries instead of decreasing keys
+      if (settled[side].has(cur)) continue;
+      settled[side].add(cur);
+
+      const distMap = distMaps[side],
+        otherDistMap = distMaps[1 - side];
+      const relax = (key: VertexKey, weight: number) => {
+        const next = vertexMap.get(key);
+        if (!next || settled[side].has(next)) return;
+        const candidate = dist + weight;
+        const known = distMap.get(next);
+        if (known === undefined || candidate < known) {
+          distMap.set(next, candidate);
+          preMaps[side].set(next, cur);
+          heaps[side].add([candidate, next]);
+          if (instrumentation) instrumentation.count('relaxations');
+        }
+        const rest = otherDistMap.get(next);
+        if (rest !== undefined && candidate + rest < best) {
+          best = candidate + rest;
+          meeting = next;
+        }
+      };
+      if (side === 0) this._forEachArc(cur, relax);
+      else this._forEachReverseArc(cur, relax);
+    }
+
+    if (!meeting) return { distance: Infinity, path: [] };
+    const path: VO[] = [];
+    for (let v: VO | undefined = meeting; v; v = preMaps[0].get(v)) path.push(v);
+    path.reverse();
+    for (let v = preMaps[1].get(meeting); v; v = preMaps[1].get(v)) path.push(v);
+    return { distance: best, path };
+  }
+
+  /**
+   * Time Complexity: O((V + E) * log(V)) in the worst case, depending on how well the heuristic guides the search.
+   * Space Complexity: O(V) - Proportional to the vertices reached.
+   */
+
+  /**
+   * Time Complexity: O((V + E) * log(V)) in the worst case, depending on how well the heuristic guides the search.
+   * Space Complexity: O(V) - Proportional to the vertices reached.
+   *
+   * The `aStar` function finds a shortest path between two vertices with the A* algorithm, which visits vertices in
+   * order of their distance from `src` plus the heuristic estimate of their distance to `dest`. Edge weights must be
+   * non-negative. The path is shortest as long as the heuristic never overestimates; with the default heuristic, which
+   * is always 0, the search is Dijkstra's algorithm stopping at `dest`.
+   * @param {VO | VertexKey} src - The source vertex or its key.
+   * @param {VO | VertexKey} dest - The destination vertex or its key.
+   * @param heuristic - A function called with a vertex and the destination that estimates the distance between them,
+   * such as the straight-line distance on a map.
+   * @returns `distance` (Infinity if `dest` cannot be reached) and `path`, the vertices from `src` to `dest`, or
+   * `undefined` if either vertex is not in the graph.
+   */
+  aStar(
+    src: VO | VertexKey,
+    dest: VO | VertexKey,
+    heuristic: (vertex: VO, dest: VO) => number = () => 0
+  ): ShortestPathResult<VO> {
+    const srcVertex = this._getVertex(src);
+    const destVertex = this._getVertex(dest);
+    if (!srcVertex || !destVertex) return undefined;
+
+    const vertexMap = this._vertexMap;
+    const distMap = new Map<VO, number>([[srcVertex, 0]]);
+    const preMap = new Map<VO, VO>();
+    // Entries are [estimated total, distance from src, vertex]
+    const heap = new Heap<[number, number, VO]>([[heuristic(srcVertex, destVertex), 0, srcVertex]], {
+      comparator: (a, b) => a[0] - b[0]
+    });
+
+    while (heap.size > 0) {
+      const [, dist, cur] = heap.poll()!;
+      // An outdated entry: the vertex was reached more cheaply after it was added
+      if (dist > distMap.get(cur)!) continue;
+      if (cur === destVertex) {
+        const path: VO[] = [];
+        for (let v: VO | undefined = cur; v; v = preMap.get(v)) path.push(v);
+        return { distance: dist, path: path.reverse() };
+      }
+
+      this._forEachArc(cur, (key, weight) => {
+        const next = vertexMap.get(key);
+        if (!next) return;
+        const candidate = dist + weight;
+        const known = distMap.get(next);
+        if (known === undefined || candidate < known) {
+          distMap.set(next, candidate);
+          preMap.set(next, cur);
+          heap.add([candidate + heuristic(next, destVertex), candidate, next]);
+        }
+      });
+    }
+    return { distance: Infinity, path: [] };
+  }
+
   /**
    * Time Complexity: O(V * E) - Quadratic time in the worst case (Bellman-Ford algorithm).
    * Space Complexity: O(V + E) - Depends on the implementation (Bellman-Ford algorithm).
@@ -783,6 +1139,7 @@ export abstract class AbstractGraph<
    * The Bellman-Ford algorithm is also used to find the shortest paths from a source node to all other nodes in a graph. Unlike Dijkstra's algorithm, it can handle edge weights that are negative. Its basic idea involves iterative relaxation of all edgeMap for several rounds to gradually approximate the shortest paths. Due to its ability to handle negative-weight edgeMap, the Bellman-Ford algorithm is more flexible in some scenarios.
    * The `bellmanFord` function implements the Bellman-Ford algorithm to find the shortest path from a source vertex to
    * all other vertexMap in a graph, and optionally detects negative cycles and generates the minimum path.
+   * After `freeze`, a directed graph is relaxed on the CSR snapshot.
    * @param {VO | VertexKey} src - The `src` parameter is the source vertex from which the Bellman-Ford algorithm will
    * start calculating the shortest paths. It can be either a vertex object or a vertex ID.
    * @param {boolean} [scanNegativeCycle] - A boolean flag indicating whether to scan for negative cycles in the graph.
@@ -809,28 +1166,61 @@ export abstract class AbstractGraph<
     if (!srcVertex) return { hasNegativeCycle, distMap, preMap, paths, min, minPath };
 
     const vertexMap = this._vertexMap;
-    const numOfVertices = vertexMap.size;
-    const edgeMap = this.edgeSet();
-    const numOfEdges = edgeMap.length;
+    const frozen = this._frozen;
+    if (frozen && frozen.isDirected) {
+      // The snapshot numbers the vertices in the same order as the vertex map
+      const vertices = [...vertexMap.values()];
+      const result = frozen.bellmanFord(frozen.indexOf(srcVertex.key));
+      for (let i = 0; i < vertices.length; i++) {
+        distMap.set(vertices[i], result.dist[i]);
+        if (genPath && result.prev[i] !== -1) preMap.set(vertices[i], vertices[result.prev[i]]);
+      }
+      if (scanNegativeCycle) hasNegativeCycle = result.hasNegativeCycle;
+    } else {
+      const numOfVertices = vertexMap.size;
+      const edgeMap = this.edgeSet();
+      const numOfEdges = edgeMap.length;
 
-    this._vertexMap.forEach(vertex => {
-      distMap.set(vertex, Infinity);
-    });
+      this._vertexMap.forEach(vertex => {
+        distMap.set(vertex, Infinity);
+      });
 
-    distMap.set(srcVertex, 0);
+      distMap.set(srcVertex, 0);
+      const instrumentation = this._instrumentation;
+
+      for (let i = 1; i < numOfVertices; ++i) {
+        // A round that relaxes nothing leaves every later round with nothing to do as well
+        let relaxed = false;
+        for (let j = 0; j < numOfEdges; ++j) {
+          const ends = this.getEndsOfEdge(edgeMap[j]);
+          if (ends) {
+            const [s, d] = ends;
+            const weight = edgeMap[j].weight;
+            const sWeight = distMap.get(s);
+            const dWeight = distMap.get(d);
+            if (sWeight !== undefined && dWeight !== undefined) {
+              if (distMap.get(s) !== Infinity && sWeight + weight < dWeight) {
+                distMap.set(d, sWeight + weight);
+                genPath && preMap.set(d, s);
+                relaxed = true;
+                if (instrumentation) instrumentation.count('relaxations');
+              }
+            }
+          }
+        }
+        if (!relaxed) break;
+      }
 
-    for (let i = 1; i < numOfVertices; ++i) {
-      for (let j = 0; j < numOfEdges; ++j) {
-        const ends = this.getEndsOfEdge(edgeMap[j]);
-        if (ends) {
-          const [s, d] = ends;
-          const weight = edgeMap[j].weight;
-          const sWeight = distMap.get(s);
-          const dWeight = distMap.get(d);
-          if (sWeight !== undefined && dWeight !== undefined) {
-            if (distMap.get(s) !== Infinity && sWeight + weight < dWeight) {
-              distMap.set(d, sWeight + weight);
-              genPath && preMap.set(d, s);
+      // An edge that can still be relaxed after V - 1 rounds lies on or behind a negative cycle
+      if (scanNegativeCycle) {
+        for (let j = 0; j < numOfEdges; ++j) {
+          const ends = this.getEndsOfEdge(edgeMap[j]);
+          if (ends) {
+            const [s, d] = ends;
+            const sWeight = distMap.get(s);
+            const dWeight = distMap.get(d);
+            if (sWeight !== undefined && dWeight !== undefined && sWeight !== Infinity) {
+              if (sWeight + edgeMap[j].weight < dWeight) hasNegativeCycle = true;
             }
           }
         }
@@ -866,19 +1256,60 @@ export abstract class AbstractGraph<
       }
     }
 
-    for (let j = 0; j < numOfEdges; ++j) {
-      const ends = this.getEndsOfEdge(edgeMap[j]);
-      if (ends) {
-        const [s] = ends;
-        const weight = edgeMap[j].weight;
-        const sWeight = distMap.get(s);
-        if (sWeight) {
-          if (sWeight !== Infinity && sWeight + weight < sWeight) hasNegativeCycle = true;
-        }
+    return { hasNegativeCycle, distMap, preMap, paths, min, minPath };
+  }
+
+  /**
+   * Time Complexity: O(V * E * log(V)) - One Bellman-Ford pass, then Dijkstra's algorithm from every vertex.
+   * Space Complexity: O(V + E) working space, plus the distances of every reachable pair.
+   */
+
+  /**
+   * Time Complexity: O(V * E * log(V)) - One Bellman-Ford pass, then Dijkstra's algorithm from every vertex.
+   * Space Complexity: O(V + E) working space, plus the distances of every reachable pair.
+   *
+   * all pairs
+   * Johnson's algorithm finds the shortest paths between all pairs of vertices of a sparse graph, where it is much
+   * faster than Floyd-Warshall and allows negative weights. Bellman-Ford from a virtual source gives every vertex a
+   * potential that makes all weights non-negative, and then Dijkstra's algorithm runs from each vertex on a CSR
+   * snapshot of the reweighted graph.
+   * The function `johnson` runs Johnson's algorithm. Only reachable pairs are stored, so the result stays small for
+   * sparse, poorly connected graphs.
+   * @returns `distMap`, which maps each source to the distances of the vertices it reaches, and `preMap`, which maps
+   * each source to the predecessors of those vertices on shortest paths, or `undefined` if there is a negative cycle.
+   */
+  johnson(): JohnsonResult<VO> {
+    const csr = this._frozen ?? this._toCSR();
+    const potentials = csr.potentials();
+    if (!potentials) return undefined;
+
+    const n = csr.vertexCount;
+    const { offsets, targets } = csr;
+    const weights = new Float64Array(csr.arcCount);
+    for (let u = 0; u < n; u++) {
+      for (let e = offsets[u]; e < offsets[u + 1]; e++) {
+        weights[e] = csr.weights[e] + potentials[u] - potentials[targets[e]];
       }
     }
-
-    return { hasNegativeCycle, distMap, preMap, paths, min, minPath };
+    const reweighted = new CSRGraph(csr.keys, offsets, targets, weights, csr.isDirected);
+
+    // The snapshot numbers the vertices in the same order as the vertex map
+    const vertices = [...this._vertexMap.values()];
+    const distMap: Map<VO, Map<VO, number>> = new Map();
+    const preMap: Map<VO, Map<VO, VO | undefined>> = new Map();
+    for (let s = 0; s < n; s++) {
+      const { dist, prev, order } = reweighted.dijkstra(s);
+      const dists: Map<VO, number> = new Map();
+      const pres: Map<VO, VO | undefined> = new Map();
+      for (let i = 0; i < order.length; i++) {
+        const t = order[i];
+        dists.set(vertices[t], dist[t] - potentials[s] + potentials[t]);
+        pres.set(vertices[t], prev[t] === -1 ? undefined : vertices[prev[t]]);
+      }
+      distMap.set(vertices[s], dists);
+      preMap.set(vertices[s], pres);
+    }
+    return { distMap, preMap };
   }
 
   /**
@@ -914,6 +1345,7 @@ export abstract class AbstractGraph<
    * The Floyd-Warshall algorithm is used to find the shortest paths between all pairs of nodes in a graph. It employs dynamic programming to compute the shortest paths from any node to any other node. The Floyd-Warshall algorithm's advantage lies in its ability to handle graphs with negative-weight edgeMap, and it can simultaneously compute shortest paths between any two nodes.
    * The function implements the Floyd-Warshall algorithm to find the shortest path between all pairs of vertexMap in a
    * graph.
+   * It keeps two V x V matrices, so prefer `johnson` for large sparse graphs.
    * @returns The function `floydWarshall()` returns an object with two properties: `costs` and `predecessor`. The `costs`
    * property is a 2D array of numbers representing the shortest path costs between vertexMap in a graph. The
    * `predecessor` property is a 2D array of vertexMap (or `undefined`) representing the predecessor vertexMap in the shortest
@@ -955,53 +1387,124 @@ export abstract class AbstractGraph<
   }
 
   /**
-   * O(V+E+C)
-   * O(V+C)
+   * Time Complexity: O((V + E) * (C + 1)), where C is the number of cycles
+   * Space Complexity: O(V + E + C)
+   */
+
+  /**
+   * Time Complexity: O((V + E) * (C + 1)), where C is the number of cycles
+   * Space Complexity: O(V + E + C)
+   *
+   * The function `getCycles` finds the simple cycles of the graph. Cycles on the same set of vertices count once.
+   * @param [isInclude2Cycle=false] - Whether to include cycles of two vertices, such as an edge and its way back.
+   * @returns The cycles, each an array of vertex keys starting from its earliest added vertex.
    */
   getCycles(isInclude2Cycle: boolean = false): VertexKey[][] {
-    const cycles: VertexKey[][] = [];
-    const visited: Set<VO> = new Set();
-
-    const dfs = (vertex: VO, currentPath: VertexKey[], visited: Set<VO>) => {
-      if (visited.has(vertex)) {
-        if (
-          ((!isInclude2Cycle && currentPath.length > 2) || (isInclude2Cycle && currentPath.length >= 2)) &&
-          currentPath[0] === vertex.key
-        ) {
-          cycles.push([...currentPath]);
-        }
-        return;
-      }
+    return [...this.cyclesIterator(isInclude2Cycle)];
+  }
 
-      visited.add(vertex);
-      currentPath.push(vertex.key);
+  /**
+   * Time Complexity: O(V + E) per cycle
+   * Space Complexity: O(V + E + C)
+   */
 
-      for (const neighbor of this.getNeighbors(vertex)) {
-        neighbor && dfs(neighbor, currentPath, visited);
+  /**
+   * Time Complexity: O(V + E) per cycle
+   * Space Complexity: O(V + E + C)
+   *
+   * The `cyclesIterator` function lazily yields the cycles of `getCycles`, in the same order. It runs Johnson's
+   * algorithm iteratively over vertex indices: every cycle is searched for from its earliest added vertex within its
+   * strongly connected component, and vertices that cannot lead back to it stay blocked, so the time between two
+   * cycles is at most linear. Stop iterating to stop the search.
+   * @param [isInclude2Cycle=false] - Whether to include cycles of two vertices, such as an edge and its way back.
+   * @returns An iterator of cycles, each an array of vertex keys.
+   */
+  *cyclesIterator(isInclude2Cycle: boolean = false): IterableIterator<VertexKey[]> {
+    const csr = this._frozen ?? this._toCSR();
+    const offsets = csr.offsets,
+      targets = csr.targets;
+    const keys = csr.keys;
+    const n = csr.vertexCount;
+    const minLength = isInclude2Cycle ? 2 : 3;
+
+    const path = new Int32Array(n);
+    const cursor = new Int32Array(n);
+    const blocked = new Uint8Array(n);
+    // Whether a cycle was closed below the vertex, so it has to be unblocked when the search leaves it
+    const closed = new Uint8Array(n);
+    // The vertices to unblock together with each vertex
+    const blockedBy: number[][] = [];
+    for (let i = 0; i < n; i++) blockedBy.push([]);
+    const unblocking: number[] = [];
+    // Cycles on the same set of vertices count once
+    const seen = new Set<string>();
+
+    for (let from = 0; from < n; ) {
+      // The next start is the earliest vertex in a strongly connected component of the vertices from `from` on
+      const { sccOf, sccCount, sccOrder, sccOffsets } = csr.tarjan(from);
+      let s = n;
+      for (let c = 0; c < sccCount; c++) {
+        if (sccOffsets[c + 1] - sccOffsets[c] < 2) continue;
+        for (let j = sccOffsets[c]; j < sccOffsets[c + 1]; j++) if (sccOrder[j] < s) s = sccOrder[j];
+      }
+      if (s === n) return;
+      const component = sccOf[s];
+      for (let j = sccOffsets[component]; j < sccOffsets[component + 1]; j++) {
+        const v = sccOrder[j];
+        blocked[v] = 0;
+        closed[v] = 0;
+        blockedBy[v].length = 0;
       }
 
-      visited.delete(vertex);
-      currentPath.pop();
-    };
-
-    for (const vertex of this.vertexMap.values()) {
-      dfs(vertex, [], visited);
-    }
-
-    // Use a set to eliminate duplicate cycles
-    const uniqueCycles = new Map<string, VertexKey[]>();
-
-    for (const cycle of cycles) {
-      const sorted = [...cycle].sort().toString();
+      let depth = 1;
+      path[0] = s;
+      blocked[s] = 1;
+      cursor[s] = offsets[s];
+      while (depth > 0) {
+        const v = path[depth - 1];
+        if (cursor[v] < offsets[v + 1]) {
+          const w = targets[cursor[v]++];
+          // Cycles through an earlier vertex were found from that vertex, and other components cannot lead back
+          if (sccOf[w] !== component) continue;
+          if (w === s) {
+            closed[v] = 1;
+            if (depth < minLength) continue;
+            const key = Array.from(path.subarray(0, depth))
+              .sort((a, b) => a - b)
+              .join();
+            if (seen.has(key)) continue;
+            seen.add(key);
+            const cycle: VertexKey[] = new Array(depth);
+            for (let i = 0; i < depth; i++) cycle[i] = keys[path[i]];
+            yield cycle;
+          } else if (!blocked[w]) {
+            path[depth++] = w;
+            blocked[w] = 1;
+            closed[w] = 0;
+            cursor[w] = offsets[w];
+          }
+          continue;
+        }
 
-      if (uniqueCycles.has(sorted)) continue;
-      else {
-        uniqueCycles.set(sorted, cycle);
+        depth--;
+        if (closed[v]) {
+          unblocking.push(v);
+          while (unblocking.length > 0) {
+            const u = unblocking.pop()!;
+            blocked[u] = 0;
+            for (const x of blockedBy[u]) if (blocked[x]) unblocking.push(x);
+            blockedBy[u].length = 0;
+          }
+          if (depth > 0) closed[path[depth - 1]] = 1;
+        } else {
+          for (let e = offsets[v]; e < offsets[v + 1]; e++) {
+            const w = targets[e];
+            if (sccOf[w] === component && !blockedBy[w].includes(v)) blockedBy[w].push(v);
+          }
+        }
       }
+      from = s + 1;
     }
-
-    // Convert the unique cycles back to an array
-    return [...uniqueCycles].map(cycleString => cycleString[1]);
   }
 
   /**
@@ -1079,9 +1582,104 @@ export abstract class AbstractGraph<
       // throw (new Error('Duplicated vertex key is not allowed'));
     }
     this._vertexMap.set(newVertex.key, newVertex);
+    this._frozen = undefined;
     return true;
   }
 
+  /**
+   * The function calls `callback` with the target key and weight of every arc leaving a vertex, in
+   * the order the edges were added. `freeze` builds its snapshot from it, so subclasses override it to
+   * read their edge maps directly.
+   * @param {VO} vertex - The vertex whose arcs are visited.
+   * @param callback - A function called with the target vertex key and the weight of each arc.
+   */
+  protected _forEachArc(vertex: VO, callback: (target: VertexKey, weight: number) => void): void {
+    for (const neighbor of this.getNeighbors(vertex)) {
+      const edge = this.getEdge(vertex, neighbor);
+      if (edge) callback(neighbor.key, edge.weight);
+    }
+  }
+
+  /**
+   * The function calls `callback` with the source key and weight of every arc entering a vertex, for searches that
+   * run backward from a destination. Undirected graphs reuse `_forEachArc`; the fallback for directed graphs scans
+   * every arc, so subclasses that keep incoming edges override it.
+   * @param {VO} vertex - The vertex whose incoming arcs are visited.
+   * @param callback - A function called with the source vertex key and the weight of each arc.
+   */
+  protected _forEachReverseArc(vertex: VO, callback: (source: VertexKey, weight: number) => void): void {
+    if (!this._isDirected()) return this._forEachArc(vertex, callback);
+    for (const [key, other] of this._vertexMap) {
+      this._forEachArc(other, (target, weight) => {
+        if (target === vertex.key) callback(key, weight);
+      });
+    }
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V + E)
+   *
+   * The function builds a CSR snapshot of the graph in two passes over `_forEachArc`, one to count
+   * the arcs of each vertex and one to fill them in, without caching it.
+   * @returns a new `CSRGraph`.
+   */
+  protected _toCSR(): CSRGraph {
+    const vertexMap = this._vertexMap;
+    const keys: VertexKey[] = [];
+    const indexMap = new Map<VertexKey, number>();
+    for (const key of vertexMap.keys()) {
+      indexMap.set(key, keys.length);
+      keys.push(key);
+    }
+
+    const n = keys.length;
+    const offsets = new Int32Array(n + 1);
+    let arcCount = 0;
+    for (let i = 0; i < n; i++) {
+      this._forEachArc(vertexMap.get(keys[i])!, target => {
+        if (indexMap.has(target)) arcCount++;
+      });
+      offsets[i + 1] = arcCount;
+    }
+
+    const targets = new Int32Array(arcCount);
+    const weights = new Float64Array(arcCount);
+    let slot = 0;
+    for (let i = 0; i < n; i++) {
+      this._forEachArc(vertexMap.get(keys[i])!, (target, weight) => {
+        const index = indexMap.get(target);
+        if (index === undefined) return;
+        targets[slot] = index;
+        weights[slot++] = weight;
+      });
+    }
+
+    return new CSRGraph(keys, offsets, targets, weights, this._isDirected());
+  }
+
+  /**
+   * The function tells whether the arcs given by `_forEachArc` go one way only.
+   * @returns `true`; undirected graphs override it.
+   */
+  protected _isDirected(): boolean {
+    return true;
+  }
+
+  /**
+   * The function counts the runs of the shortest-path searches, which also time them when timing is on. The
+   * searches count their edge relaxations inline, except for the ones a frozen snapshot answers.
+   * @returns The methods `enableStats` wraps.
+   */
+  protected override _instrumentedMethods(): InstrumentedMethods {
+    return {
+      ...super._instrumentedMethods(),
+      dijkstra: 'dijkstraRuns',
+      bidirectionalDijkstra: 'bidirectionalDijkstraRuns',
+      bellmanFord: 'bellmanFordRuns'
+    };
+  }
+
   protected _getVertex(vertexOrKey: VertexKey | VO): VO | undefined {
     const vertexKey = this._getVertexKey(vertexOrKey);
     return this._vertexMap.get(vertexKey) || undefined;
@@ -0,0 +1,614 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type {
+  BinaryCodec,
+  BinarySource,
+  BinaryWriterOptions,
+  CSRBellmanFordResult,
+  CSRShortestPaths,
+  CSRTarjanResult,
+  VertexKey
+} from '../../types';
+import { BinarySnapshotKind } from '../../types';
+import { IndexedHeap } from '../heap';
+import {
+  BinaryReader,
+  binaryCodecs,
+  BinaryWriter,
+  readSnapshotHeader,
+  toBinaryReader,
+  writeSnapshotHeader
+} from '../../utils';
+
+/**
+ * 1. Compressed Sparse Row: A CSRGraph is an immutable snapshot of a graph. Vertices are numbered 0..n-1, and the arcs leaving vertex `i` are the slots `offsets[i]` to `offsets[i + 1] - 1` of the `targets` and `weights` typed arrays.
+ * 2. Memory: An arc costs 12 bytes (an Int32 target and a Float64 weight) and a vertex 4 bytes plus its key, instead of an edge object and Map entries per edge, so large graphs fit and neighbor scans read memory in order.
+ * 3. Undirected Graphs: Every undirected edge is stored as two arcs, one in each direction.
+ * 4. Algorithms: `dijkstra`, `bellmanFord`, `topologicalSort` and `tarjan` work on vertex indices and return typed arrays. `keyOf` and `indexOf` translate between indices and vertex keys.
+ */
+export class CSRGraph {
+  /**
+   * The constructor wraps arrays that are already in CSR form. `freeze()` on a graph and
+   * `CSRGraph.fromEdgeList` build them.
+   * @param {VertexKey[]} keys - The key of each vertex, by index.
+   * @param {Int32Array} offsets - `keys.length + 1` ascending offsets into `targets` and `weights`.
+   * @param {Int32Array} targets - The target vertex index of each arc.
+   * @param {Float64Array} weights - The weight of each arc.
+   * @param [isDirected=true] - Whether the arcs come from a directed graph.
+   */
+  constructor(keys: VertexKey[], offsets: Int32Array, targets: Int32Array, weights: Float64Array, isDirected = true) {
+    if (offsets.length !== keys.length + 1 || targets.length !== weights.length) {
+      throw new Error('CSRGraph arrays have inconsistent lengths');
+    }
+    this._keys = keys;
+    this._offsets = offsets;
+    this._targets = targets;
+    this._weights = weights;
+    this._isDirected = isDirected;
+    this._indexMap = new Map<VertexKey, number>();
+    for (let i = 0; i < keys.length; i++) this._indexMap.set(keys[i], i);
+  }
+
+  protected _keys: VertexKey[];
+
+  /**
+   * The function returns the vertex keys, by index.
+   * @returns The `keys` property is being returned.
+   */
+  get keys(): VertexKey[] {
+    return this._keys;
+  }
+
+  protected _offsets: Int32Array;
+
+  /**
+   * The function returns the offsets of the arcs of each vertex.
+   * @returns The `offsets` property is being returned.
+   */
+  get offsets(): Int32Array {
+    return this._offsets;
+  }
+
+  protected _targets: Int32Array;
+
+  /**
+   * The function returns the target vertex index of each arc.
+   * @returns The `targets` property is being returned.
+   */
+  get targets(): Int32Array {
+    return this._targets;
+  }
+
+  protected _weights: Float64Array;
+
+  /**
+   * The function returns the weight of each arc.
+   * @returns The `weights` property is being returned.
+   */
+  get weights(): Float64Array {
+    return this._weights;
+  }
+
+  protected _isDirected: boolean;
+
+  /**
+   * The function returns whether the snapshot was taken from a directed graph.
+   * @returns The `isDirected` property is being returned.
+   */
+  get isDirected(): boolean {
+    return this._isDirected;
+  }
+
+  protected _indexMap: Map<VertexKey, number>;
+
+  /**
+   * The function returns the number of vertices.
+   * @returns The number of vertices.
+   */
+  get vertexCount(): number {
+    return this._keys.length;
+  }
+
+  /**
+   * The function returns the number of arcs. An undirected edge counts twice.
+   * @returns The number of arcs.
+   */
+  get arcCount(): number {
+    return this._targets.length;
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V + E)
+   *
+   * The `fromEdgeList` function builds a snapshot straight from arcs given as vertex indices, without
+   * creating vertex or edge objects. The arcs of each vertex keep their input order.
+   * @param {VertexKey[]} keys - The key of each vertex, by index.
+   * @param {ArrayLike<number>} sources - The source vertex index of each edge.
+   * @param {ArrayLike<number>} targets - The target vertex index of each edge.
+   * @param {ArrayLike<number>} [weights] - The weight of each edge, 1 by default.
+   * @param [isDirected=true] - With `false`, each edge is stored in both directions.
+   * @returns a new `CSRGraph`.
+   */
+  static fromEdgeList(
+    keys: VertexKey[],
+    sources: ArrayLike<number>,
+    targets: ArrayLike<number>,
+    weights?: ArrayLike<number>,
+    isDirected = true
+  ): CSRGraph {
+    const n = keys.length;
+    const m = sources.length;
+    if (targets.length !== m || (weights && weights.length !== m)) {
+      throw new Error('CSRGraph.fromEdgeList requires one target and weight per source');
+    }
+    const arcCount = isDirected ? m : m * 2;
+    const offsets = new Int32Array(n + 1);
+    for (let i = 0; i < m; i++) {
+      const s = sources[i],
+        t = targets[i];
+      if (!(s >= 0 && s < n && t >= 0 && t < n)) throw new Error(`CSRGraph edge ${i} refers to a missing vertex`);
+      offsets[s + 1]++;
+      if (!isDirected) offsets[t + 1]++;
+    }
+    for (let i = 0; i < n; i++) offsets[i + 1] += offsets[i];
+
+    const cursor = offsets.slice(0, n);
+    const arcTargets = new Int32Array(arcCount);
+    const arcWeights = new Float64Array(arcCount);
+    for (let i = 0; i < m; i++) {
+      const s = sources[i],
+        t = targets[i];
+      const w = weights ? weights[i] : 1;
+      let slot = cursor[s]++;
+      arcTargets[slot] = t;
+      arcWeights[slot] = w;
+      if (!isDirected) {
+        slot = cursor[t]++;
+        arcTargets[slot] = s;
+        arcWeights[slot] = w;
+      }
+    }
+    return new CSRGraph(keys, offsets, arcTargets, arcWeights, isDirected);
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(1)
+   *
+   * The `writeBinary` function writes the snapshot `fromBinary` maps: a header, the vertex and arc
+   * counts, the keys through the codec, then the weights, offsets and targets as they are in memory,
+   * starting on an 8-byte boundary.
+   * @param {BinaryWriter} writer - The writer to append to.
+   * @param [keyCodec] - The codec of the vertex keys, `binaryCodecs.any` by default.
+   */
+  writeBinary(writer: BinaryWriter, keyCodec: BinaryCodec<VertexKey> = binaryCodecs.any): void {
+    writeSnapshotHeader(writer, BinarySnapshotKind.CSRGraph);
+    writer.writeUint32(this._keys.length);
+    writer.writeUint32(this._targets.length);
+    writer.writeUint8(this._isDirected ? 1 : 0);
+    for (const key of this._keys) keyCodec.write(writer, key);
+    writer.align(8);
+    writer.writeTypedArray(this._weights);
+    writer.writeTypedArray(this._offsets);
+    writer.writeTypedArray(this._targets);
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V + E)
+   *
+   * The `toBinary` function returns the snapshot `writeBinary` writes.
+   * @param [keyCodec] - The codec of the vertex keys, `binaryCodecs.any` by default.
+   * @param [options] - `BinaryWriter` options; with `onChunk` the snapshot is streamed and an empty array
+   * is returned.
+   * @returns The snapshot bytes.
+   */
+  toBinary(keyCodec: BinaryCodec<VertexKey> = binaryCodecs.any, options?: BinaryWriterOptions): Uint8Array {
+    const writer = new BinaryWriter(options);
+    this.writeBinary(writer, keyCodec);
+    return writer.finish();
+  }
+
+  /**
+   * Time Complexity: O(V)
+   * Space Complexity: O(V)
+   *
+   * The `fromBinary` function opens a snapshot written by `toBinary`. When the bytes are one buffer that
+   * starts on an 8-byte boundary, as a freshly allocated or memory-mapped buffer does, the offsets,
+   * targets and weights are views on it rather than copies, so only the keys are decoded.
+   * @param source - The snapshot bytes, an iterable of chunks, or a reader positioned at a snapshot.
+   * @param [keyCodec] - The codec the keys were written with.
+   * @returns a new `CSRGraph`.
+   */
+  static fromBinary(
+    source: BinarySource | BinaryReader,
+    keyCodec: BinaryCodec<VertexKey> = binaryCodecs.any
+  ): CSRGraph {
+    const reader = toBinaryReader(source);
+    readSnapshotHeader(reader, BinarySnapshotKind.CSRGraph);
+    const n = reader.readUint32();
+    const m = reader.readUint32();
+    const isDirected = reader.readUint8() === 1;
+    const keys: VertexKey[] = new Array(n);
+    for (let i = 0; i < n; i++) keys[i] = keyCodec.read(reader);
+    reader.align(8);
+    const weights = reader.readFloat64Array(m);
+    const offsets = reader.readInt32Array(n + 1);
+    const targets = reader.readInt32Array(m);
+    return new CSRGraph(keys, offsets, targets, weights, isDirected);
+  }
+
+  /**
+   * The function tells whether the typed arrays live on `SharedArrayBuffer`s, so workers can read them without copies.
+   * @returns `true` if the offsets, targets and weights are all shared.
+   */
+  get isShared(): boolean {
+    return (
+      typeof SharedArrayBuffer !== 'undefined' &&
+      this._offsets.buffer instanceof SharedArrayBuffer &&
+      this._targets.buffer instanceof SharedArrayBuffer &&
+      this._weights.buffer instanceof SharedArrayBuffer
+    );
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V + E)
+   *
+   * The `share` function copies the snapshot onto `SharedArrayBuffer`s. Posting the typed arrays of the copy to a
+   * worker shares their memory instead of cloning it.
+   * @returns this snapshot if it is already shared, otherwise a shared copy.
+   */
+  share(): CSRGraph {
+    if (this.isShared) return this;
+    const copy = <T extends Int32Array | Float64Array>(array: T, create: (buffer: SharedArrayBuffer) => T): T => {
+      const shared = create(new SharedArrayBuffer(array.byteLength));
+      shared.set(array);
+      return shared;
+    };
+    return new CSRGraph(
+      this._keys,
+      copy(this._offsets, buffer => new Int32Array(buffer)),
+      copy(this._targets, buffer => new Int32Array(buffer)),
+      copy(this._weights, buffer => new Float64Array(buffer)),
+      this._isDirected
+    );
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V + E)
+   *
+   * The `transpose` function builds the snapshot with every arc reversed, so the arcs of vertex `i` are the arcs that
+   * enter `i` in this snapshot, in the order of their sources.
+   * @returns a new `CSRGraph`, shared if this snapshot is shared.
+   */
+  transpose(): CSRGraph {
+    const n = this.vertexCount;
+    const m = this.arcCount;
+    const offsets = this._offsets,
+      targets = this._targets,
+      weights = this._weights;
+    const shared = this.isShared;
+    const reversedOffsets = new Int32Array(shared ? new SharedArrayBuffer((n + 1) * 4) : new ArrayBuffer((n + 1) * 4));
+    const reversedTargets = new Int32Array(shared ? new SharedArrayBuffer(m * 4) : new ArrayBuffer(m * 4));
+    const reversedWeights = new Float64Array(shared ? new SharedArrayBuffer(m * 8) : new ArrayBuffer(m * 8));
+
+    for (let e = 0; e < m; e++) reversedOffsets[targets[e] + 1]++;
+    for (let i = 0; i < n; i++) reversedOffsets[i + 1] += reversedOffsets[i];
+    const cursor = reversedOffsets.slice(0, n);
+    for (let u = 0; u < n; u++) {
+      for (let e = offsets[u], end = offsets[u + 1]; e < end; e++) {
+        const slot = cursor[targets[e]]++;
+        reversedTargets[slot] = u;
+        reversedWeights[slot] = weights[e];
+      }
+    }
+    return new CSRGraph(this._keys, reversedOffsets, reversedTargets, reversedWeights, this._isDirected);
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function returns the index of a vertex key.
+   * @param {VertexKey} key - The vertex key.
+   * @returns The index of the vertex, or -1 if it is not in the snapshot.
+   */
+  indexOf(key: VertexKey): number {
+    const index = this._indexMap.get(key);
+    return index === undefined ? -1 : index;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function returns the key of a vertex index.
+   * @param {number} index - The vertex index.
+   * @returns The key of the vertex, or `undefined` if the index is out of range.
+   */
+  keyOf(index: number): VertexKey | undefined {
+    return this._keys[index];
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function returns the number of arcs leaving a vertex.
+   * @param {number} index - The vertex index.
+   * @returns The out-degree of the vertex.
+   */
+  degreeOf(index: number): number {
+    return this._offsets[index + 1] - this._offsets[index];
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function returns the targets of the arcs leaving a vertex as a view into `targets`, without
+   * copying.
+   * @param {number} index - The vertex index.
+   * @returns An `Int32Array` view of the neighbor indices.
+   */
+  neighborsOf(index: number): Int32Array {
+    return this._targets.subarray(this._offsets[index], this._offsets[index + 1]);
+  }
+
+  /**
+   * Time Complexity: O((V + E) log V)
+   * Space Complexity: O(V)
+   *
+   * The `dijkstra` function computes shortest distances from a source vertex over non-negative
+   * weights with a 4-ary indexed heap, stopping early once `dest` is settled.
+   * @param {number} src - The source vertex index.
+   * @param [dest=-1] - A vertex index to stop at, or -1 to reach every vertex.
+   * @returns `dist` (Infinity where unreachable), `prev` (the predecessor on a shortest path, or -1)
+   * and `order`, the settled vertices in the order they were settled.
+   */
+  dijkstra(src: number, dest = -1): CSRShortestPaths {
+    const n = this.vertexCount;
+    const offsets = this._offsets,
+      targets = this._targets,
+      weights = this._weights;
+    const dist = new Float64Array(n).fill(Infinity);
+    const prev = new Int32Array(n).fill(-1);
+    const order = new Int32Array(n);
+    const settled = new Uint8Array(n);
+    let count = 0;
+
+    const heap = new IndexedHeap([], { capacity: n, arity: 4 });
+    dist[src] = 0;
+    heap.add(src, 0);
+    while (heap.size > 0) {
+      const d = heap.peekPriority()!;
+      const v = heap.poll()!;
+      settled[v] = 1;
+      order[count++] = v;
+      if (v === dest) break;
+      for (let e = offsets[v], end = offsets[v + 1]; e < end; e++) {
+        const w = targets[e];
+        if (settled[w]) continue;
+        const candidate = d + weights[e];
+        if (candidate < dist[w]) {
+          dist[w] = candidate;
+          prev[w] = v;
+          heap.update(w, candidate);
+        }
+      }
+    }
+    return { dist, prev, order: order.subarray(0, count) };
+  }
+
+  /**
+   * Time Complexity: O(V * E), usually far less because it stops after a round without changes
+   * Space Complexity: O(V)
+   *
+   * The `bellmanFord` function computes shortest distances from a source vertex and allows negative
+   * weights.
+   * @param {number} src - The source vertex index.
+   * @returns `dist`, `prev` and `hasNegativeCycle`, which tells whether a negative cycle is reachable
+   * from the source, in which case the distances are not final.
+   */
+  bellmanFord(src: number): CSRBellmanFordResult {
+    const n = this.vertexCount;
+    const offsets = this._offsets,
+      targets = this._targets,
+      weights = this._weights;
+    const dist = new Float64Array(n).fill(Infinity);
+    const prev = new Int32Array(n).fill(-1);
+    dist[src] = 0;
+
+    // With `update` unset the pass only reports whether some arc could still be relaxed
+    const relaxAll = (update: boolean): boolean => {
+      let relaxed = false;
+      for (let u = 0; u < n; u++) {
+        const du = dist[u];
+        if (du === Infinity) continue;
+        for (let e = offsets[u], end = offsets[u + 1]; e < end; e++) {
+          const t = targets[e];
+          const candidate = du + weights[e];
+          if (candidate < dist[t]) {
+            if (!update) return true;
+            dist[t] = candidate;
+            prev[t] = u;
+            relaxed = true;
+          }
+        }
+      }
+      return relaxed;
+    };
+
+    let settled = false;
+    for (let round = 1; round < n && !settled; round++) settled = !relaxAll(true);
+    const hasNegativeCycle = !settled && relaxAll(false);
+    return { dist, prev, hasNegativeCycle };
+  }
+
+  /**
+   * Time Complexity: O(V * E), usually far less because it stops after a round without changes
+   * Space Complexity: O(V)
+   *
+   * The `potentials` function runs Bellman-Ford from a virtual source joined to every vertex by a zero
+   * weight arc. Adding `potentials[u] - potentials[v]` to the weight of each arc `u -> v` makes every
+   * weight non-negative without changing which paths are shortest, which is the first step of
+   * Johnson's algorithm.
+   * @returns The potential of each vertex, or `undefined` if the graph has a negative cycle.
+   */
+  potentials(): Float64Array | undefined {
+    const n = this.vertexCount;
+    const offsets = this._offsets,
+      targets = this._targets,
+      weights = this._weights;
+    const potentials = new Float64Array(n);
+
+    // With the virtual source there are n + 1 vertices, so a pass that still relaxes after n passes means a cycle
+    for (let round = 0; round <= n; round++) {
+      let relaxed = false;
+      for (let u = 0; u < n; u++) {
+        const pu = potentials[u];
+        for (let e = offsets[u], end = offsets[u + 1]; e < end; e++) {
+          const candidate = pu + weights[e];
+          if (candidate < potentials[targets[e]]) {
+            potentials[targets[e]] = candidate;
+            relaxed = true;
+          }
+        }
+      }
+      if (!relaxed) return potentials;
+    }
+    return undefined;
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V)
+   *
+   * The `topologicalSort` function orders the vertices so that every arc goes forward, by reversing a
+   * depth-first post-order. The search starts from the vertices in index order and follows arcs in
+   * storage order, so it gives the same order as `DirectedGraph.topologicalSort`.
+   * @returns The vertex indices in topological order, or `undefined` if there is a cycle.
+   */
+  topologicalSort(): Int32Array | undefined {
+    const n = this.vertexCount;
+    const offsets = this._offsets,
+      targets = this._targets;
+    // 0 means unknown, 1 means visiting, 2 means visited
+    const status = new Uint8Array(n);
+    const cursor = new Int32Array(n);
+    const stack = new Int32Array(n);
+    const sorted = new Int32Array(n);
+    let count = n;
+    let hasCycle = false;
+
+    for (let root = 0; root < n; root++) {
+      if (status[root] !== 0) continue;
+      let depth = 0;
+      stack[depth++] = root;
+      status[root] = 1;
+      cursor[root] = offsets[root];
+      while (depth > 0) {
+        const v = stack[depth - 1];
+        if (cursor[v] < offsets[v + 1]) {
+          const w = targets[cursor[v]++];
+          if (status[w] === 0) {
+            status[w] = 1;
+            cursor[w] = offsets[w];
+            stack[depth++] = w;
+          } else if (status[w] === 1) {
+            hasCycle = true;
+          }
+        } else {
+          status[v] = 2;
+          sorted[--count] = v;
+          depth--;
+        }
+      }
+    }
+    return hasCycle ? undefined : sorted;
+  }
+
+  /**
+   * Time Complexity: O(V + E)
+   * Space Complexity: O(V)
+   *
+   * The `tarjan` function finds the strongly connected components with an iterative version of
+   * Tarjan's algorithm, visiting vertices in the same order as `DirectedGraph.tarjan`.
+   * @param [from=0] - Only the vertices from this index on, and the arcs between them, are searched.
+   * The vertices before it get a `dfn` and `sccOf` of -1.
+   * @returns `dfn` and `low` by vertex, `sccOf`, the component of each vertex, and the components
+   * themselves: component `c` is `sccOrder[sccOffsets[c]]` to `sccOrder[sccOffsets[c + 1] - 1]`, in
+   * the order the vertices left the stack.
+   */
+  tarjan(from = 0): CSRTarjanResult {
+    const n = this.vertexCount;
+    const offsets = this._offsets,
+      targets = this._targets;
+    const dfn = new Int32Array(n).fill(-1);
+    const low = new Int32Array(n);
+    const sccOf = new Int32Array(n).fill(-1, 0, from);
+    const sccOrder = new Int32Array(n);
+    const sccOffsets = new Int32Array(n + 1);
+    const cursor = new Int32Array(n);
+    const callStack = new Int32Array(n);
+    const stack = new Int32Array(n);
+    const onStack = new Uint8Array(n);
+    let time = 0,
+      top = 0,
+      sccCount = 0,
+      popped = 0;
+
+    for (let root = from; root < n; root++) {
+      if (dfn[root] !== -1) continue;
+      let depth = 0;
+      dfn[root] = low[root] = time++;
+      stack[top++] = root;
+      onStack[root] = 1;
+      cursor[root] = offsets[root];
+      callStack[depth++] = root;
+
+      while (depth > 0) {
+        const v = callStack[depth - 1];
+        if (cursor[v] < offsets[v + 1]) {
+          const w = targets[cursor[v]++];
+          if (w < from) continue;
+          if (dfn[w] === -1) {
+            dfn[w] = low[w] = time++;
+            stack[top++] = w;
+            onStack[w] = 1;
+            cursor[w] = offsets[w];
+            callStack[depth++] = w;
+          } else if (onStack[w] && dfn[w] < low[v]) {
+            low[v] = dfn[w];
+          }
+          continue;
+        }
+
+        depth--;
+        if (dfn[v] === low[v]) {
+          let w: number;
+          do {
+            w = stack[--top];
+            onStack[w] = 0;
+            sccOf[w] = sccCount;
+            sccOrder[popped++] = w;
+          } while (w !== v);
+          sccOffsets[++sccCount] = popped;
+        }
+        if (depth > 0) {
+          const parent = callStack[depth - 1];
+          if (low[v] < low[parent]) low[parent] = low[v];
+        }
+      }
+    }
+    return { dfn, low, sccOf, sccCount, sccOrder, sccOffsets: sccOffsets.subarray(0, sccCount + 1) };
+  }
+}
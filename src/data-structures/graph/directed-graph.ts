@@ -68,6 +68,7 @@ export class DirectedGraph<
 
   set outEdgeMap(v: Map<VO, EO[]>) {
     this._outEdgeMap = v;
+    this._frozen = undefined;
   }
 
   protected _inEdgeMap: Map<VO, EO[]> = new Map<VO, EO[]>();
@@ -78,6 +79,7 @@ export class DirectedGraph<
 
   set inEdgeMap(v: Map<VO, EO[]>) {
     this._inEdgeMap = v;
+    this._frozen = undefined;
   }
 
   /**
@@ -173,6 +175,7 @@ export class DirectedGraph<
       return undefined;
     }
 
+    this._frozen = undefined;
     const srcOutEdges = this._outEdgeMap.get(src);
     if (srcOutEdges) {
       arrayRemove<EO>(srcOutEdges, (edge: EO) => edge.dest === dest.key);
@@ -219,6 +222,7 @@ export class DirectedGraph<
     }
 
     if (src && dest) {
+      this._frozen = undefined;
       const srcOutEdges = this._outEdgeMap.get(src);
       if (srcOutEdges && srcOutEdges.length > 0) {
         arrayRemove(srcOutEdges, (edge: EO) => edge.src === src!.key && edge.dest === dest?.key);
@@ -259,13 +263,19 @@ export class DirectedGraph<
     }
 
     if (vertex) {
-      const neighbors = this.getNeighbors(vertex);
-      for (const neighbor of neighbors) {
-        this._inEdgeMap.delete(neighbor);
+      // Drop the edges of the vertex from the other ends too, so backward searches over in-edges stay consistent
+      for (const edge of this._outEdgeMap.get(vertex) ?? []) {
+        const destInEdges = this._inEdgeMap.get(this._getVertex(edge.dest)!);
+        if (destInEdges) arrayRemove<EO>(destInEdges, (e: EO) => e.src === vertexKey);
+      }
+      for (const edge of this._inEdgeMap.get(vertex) ?? []) {
+        const srcOutEdges = this._outEdgeMap.get(this._getVertex(edge.src)!);
+        if (srcOutEdges) arrayRemove<EO>(srcOutEdges, (e: EO) => e.dest === vertexKey);
       }
       this._outEdgeMap.delete(vertex);
       this._inEdgeMap.delete(vertex);
     }
+    this._frozen = undefined;
 
     return this._vertexMap.delete(vertexKey);
   }
@@ -489,10 +499,23 @@ export class DirectedGraph<
    * @param {'vertex' | 'key'} [propertyName] - The `propertyName` parameter is an optional parameter that specifies the
    * property to use for sorting the vertexMap. It can have two possible values: 'vertex' or 'key'. If 'vertex' is
    * specified, the vertexMap themselves will be used for sorting. If 'key' is specified, the ids of
+   * After `freeze`, the search runs on the CSR snapshot and gives the same order.
    * @returns an array of vertexMap or vertex IDs in topological order. If there is a cycle in the graph, it returns undefined.
    */
   topologicalSort(propertyName?: 'vertex' | 'key'): Array<VO | VertexKey> | undefined {
     propertyName = propertyName ?? 'key';
+    if (this._frozen) {
+      const order = this._frozen.topologicalSort();
+      if (!order) return undefined;
+      const vertices = [...this._vertexMap.values()];
+      const result: Array<VO | VertexKey> = [];
+      for (let i = 0; i < order.length; i++) {
+        const vertex = vertices[order[i]];
+        result.push(propertyName === 'key' ? vertex.key : vertex);
+      }
+      return result;
+    }
+
     // When judging whether there is a cycle in the undirected graph, all nodes with degree of **<= 1** are enqueued
     // When judging whether there is a cycle in the directed graph, all nodes with **in degree = 0** are enqueued
     const statusMap: Map<VO | VertexKey, TopologicalStatus> = new Map<VO | VertexKey, TopologicalStatus>();
@@ -542,9 +565,9 @@ export class DirectedGraph<
    * @returns The `edgeSet()` method returns an array of edgeMap (`EO[]`).
    */
   edgeSet(): EO[] {
-    let edgeMap: EO[] = [];
+    const edgeMap: EO[] = [];
     this._outEdgeMap.forEach(outEdges => {
-      edgeMap = [...edgeMap, ...outEdges];
+      for (const edge of outEdges) edgeMap.push(edge);
     });
     return edgeMap;
   }
@@ -631,6 +654,7 @@ export class DirectedGraph<
     this._vertexMap = new Map<VertexKey, VO>();
     this._inEdgeMap = new Map<VO, EO[]>();
     this._outEdgeMap = new Map<VO, EO[]>();
+    this._frozen = undefined;
   }
 
   /**
@@ -661,6 +685,8 @@ export class DirectedGraph<
    *
    * The function `tarjan` implements the Tarjan's algorithm to find strongly connected components in a
    * graph.
+   * It runs iteratively on the CSR snapshot (`freeze` keeps one, otherwise one is built for the call), so deep graphs
+   * do not overflow the call stack.
    * @returns The function `tarjan()` returns an object with three properties: `dfnMap`, `lowMap`, and
    * `SCCs`.
    */
@@ -669,49 +695,20 @@ export class DirectedGraph<
     const lowMap = new Map<VO, number>();
     const SCCs = new Map<number, VO[]>();
 
-    let time = 0;
-
-    const stack: VO[] = [];
-    const inStack: Set<VO> = new Set();
-
-    const dfs = (vertex: VO) => {
-      dfnMap.set(vertex, time);
-      lowMap.set(vertex, time);
-      time++;
-
-      stack.push(vertex);
-      inStack.add(vertex);
-
-      const neighbors = this.getNeighbors(vertex);
-      for (const neighbor of neighbors) {
-        if (!dfnMap.has(neighbor)) {
-          dfs(neighbor);
-          lowMap.set(vertex, Math.min(lowMap.get(vertex)!, lowMap.get(neighbor)!));
-        } else if (inStack.has(neighbor)) {
-          lowMap.set(vertex, Math.min(lowMap.get(vertex)!, dfnMap.get(neighbor)!));
-        }
-      }
-
-      if (dfnMap.get(vertex) === lowMap.get(vertex)) {
-        const SCC: VO[] = [];
-        let poppedVertex: VO | undefined;
-
-        do {
-          poppedVertex = stack.pop();
-          inStack.delete(poppedVertex!);
-          SCC.push(poppedVertex!);
-        } while (poppedVertex !== vertex);
-
-        SCCs.set(SCCs.size, SCC);
-      }
-    };
-
-    for (const vertex of this.vertexMap.values()) {
-      if (!dfnMap.has(vertex)) {
-        dfs(vertex);
-      }
+    const { dfn, low, sccCount, sccOrder, sccOffsets } = (this._frozen ?? this._toCSR()).tarjan();
+    const vertices = [...this._vertexMap.values()];
+    // Fill the maps in discovery order, as a recursive search would
+    const byDfn = new Int32Array(vertices.length);
+    for (let i = 0; i < vertices.length; i++) byDfn[dfn[i]] = i;
+    for (let t = 0; t < byDfn.length; t++) {
+      dfnMap.set(vertices[byDfn[t]], t);
+      lowMap.set(vertices[byDfn[t]], low[byDfn[t]]);
+    }
+    for (let c = 0; c < sccCount; c++) {
+      const SCC: VO[] = [];
+      for (let j = sccOffsets[c]; j < sccOffsets[c + 1]; j++) SCC.push(vertices[sccOrder[j]]);
+      SCCs.set(c, SCC);
     }
-
     return { dfnMap, lowMap, SCCs };
   }
 
@@ -789,9 +786,30 @@ export class DirectedGraph<
       } else {
         this._inEdgeMap.set(destVertex, [edge]);
       }
+      this._frozen = undefined;
       return true;
     } else {
       return false;
     }
   }
+
+  /**
+   * The function visits the arcs of a vertex straight from its out-edges.
+   * @param {VO} vertex - The vertex whose arcs are visited.
+   * @param callback - A function called with the destination key and the weight of each out-edge.
+   */
+  protected _forEachArc(vertex: VO, callback: (target: VertexKey, weight: number) => void): void {
+    const outEdges = this._outEdgeMap.get(vertex);
+    if (outEdges) for (const edge of outEdges) callback(edge.dest, edge.weight);
+  }
+
+  /**
+   * The function visits the incoming arcs of a vertex straight from its in-edges.
+   * @param {VO} vertex - The vertex whose incoming arcs are visited.
+   * @param callback - A function called with the source key and the weight of each in-edge.
+   */
+  protected _forEachReverseArc(vertex: VO, callback: (source: VertexKey, weight: number) => void): void {
+    const inEdges = this._inEdgeMap.get(vertex);
+    if (inEdges) for (const edge of inEdges) callback(edge.src, edge.weight);
+  }
 }
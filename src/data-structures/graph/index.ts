@@ -2,3 +2,5 @@ export * from './abstract-graph';
 export * from './directed-graph';
 export * from './undirected-graph';
 export * from './map-graph';
+export * from './csr-graph';
+export * from './parallel-graph';
@@ -0,0 +1,636 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { GraphWorkerLike, PageRankOptions, ParallelBFSResult, ParallelGraphOptions } from '../../types';
+import { CSRGraph } from './csr-graph';
+
+/**
+ * The expression the worker source passes to `graphWorkerMain` as its message port: `parentPort` in a Node.js worker,
+ * the global scope in a browser worker. It is kept as text, so bundlers never see a `require` of `worker_threads` and
+ * browser builds stay free of Node.js built-ins.
+ */
+const WORKER_PORT_SOURCE =
+  "typeof process !== 'undefined' && process.versions && process.versions.node " +
+  "? require('worker_threads').parentPort : self";
+
+/**
+ * The script every worker runs. It is turned into source text with `toString`, so it must not refer to anything
+ * outside itself. A worker receives the shared CSR arrays once, then runs one kernel per message over a slice of
+ * vertices or of a frontier, and replies with a number that the main thread sums up.
+ * @param scope - The port the worker talks through, given by `WORKER_PORT_SOURCE`.
+ */
+/* istanbul ignore next */
+function graphWorkerMain(scope: any) {
+  let offsets: Int32Array, targets: Int32Array, weights: Float64Array, inOffsets: Int32Array, inTargets: Int32Array;
+
+  // Non-negative doubles compare in the same order as their bit patterns, which Atomics can swap
+  const scratchFloat = new Float64Array(1);
+  const scratchBits = new BigInt64Array(scratchFloat.buffer);
+  const loadFloat = (bits: BigInt64Array, i: number) => {
+    scratchBits[0] = Atomics.load(bits, i);
+    return scratchFloat[0];
+  };
+  const atomicMinFloat = (bits: BigInt64Array, i: number, value: number) => {
+    for (;;) {
+      const old = Atomics.load(bits, i);
+      scratchBits[0] = old;
+      if (value >= scratchFloat[0]) return false;
+      scratchFloat[0] = value;
+      if (Atomics.compareExchange(bits, i, old, scratchBits[0]) === old) return true;
+    }
+  };
+  const atomicMin = (array: Int32Array, i: number, value: number) => {
+    for (;;) {
+      const old = Atomics.load(array, i);
+      if (value >= old) return false;
+      if (Atomics.compareExchange(array, i, old, value) === old) return true;
+    }
+  };
+  const atomicMax = (array: Int32Array, i: number, value: number) => {
+    for (;;) {
+      const old = Atomics.load(array, i);
+      if (value <= old) return false;
+      if (Atomics.compareExchange(array, i, old, value) === old) return true;
+    }
+  };
+
+  const kernels: { [name: string]: (job: any) => number } = {
+    bfs(job) {
+      const { from, to, level, prev, frontier, next, nextSize, depth } = job;
+      for (let i = from; i < to; i++) {
+        const v = frontier[i];
+        for (let e = offsets[v], end = offsets[v + 1]; e < end; e++) {
+          const w = targets[e];
+          if (Atomics.load(level, w) === -1 && Atomics.compareExchange(level, w, -1, depth + 1) === -1) {
+            prev[w] = v;
+            next[Atomics.add(nextSize, 0, 1)] = w;
+          }
+        }
+      }
+      return 0;
+    },
+    sssp(job) {
+      const { from, to, bits, queued, frontier, next, nextSize, later, laterSize, bound } = job;
+      for (let i = from; i < to; i++) {
+        const v = frontier[i];
+        // Clear the flag before reading the distance, so a later improvement queues the vertex again
+        Atomics.store(queued, v, 0);
+        const d = loadFloat(bits, v);
+        for (let e = offsets[v], end = offsets[v + 1]; e < end; e++) {
+          const w = targets[e];
+          const candidate = d + weights[e];
+          if (atomicMinFloat(bits, w, candidate) && Atomics.exchange(queued, w, 1) === 0) {
+            if (candidate < bound) next[Atomics.add(nextSize, 0, 1)] = w;
+            else later[Atomics.add(laterSize, 0, 1)] = w;
+          }
+        }
+      }
+      return 0;
+    },
+    cc(job) {
+      const { from, to, label } = job;
+      let changed = 0;
+      for (let v = from; v < to; v++) {
+        for (let e = offsets[v], end = offsets[v + 1]; e < end; e++) {
+          const w = targets[e];
+          const lv = Atomics.load(label, v),
+            lw = Atomics.load(label, w);
+          if (lw < lv) {
+            if (atomicMin(label, v, lw)) changed = 1;
+          } else if (lv < lw) {
+            if (atomicMin(label, w, lv)) changed = 1;
+          }
+        }
+      }
+      return changed;
+    },
+    ccJump(job) {
+      const { from, to, label } = job;
+      let changed = 0;
+      for (let v = from; v < to; v++) {
+        const root = Atomics.load(label, Atomics.load(label, v));
+        if (atomicMin(label, v, root)) changed = 1;
+      }
+      return changed;
+    },
+    sccReset(job) {
+      const { from, to, color, sccOf } = job;
+      let remaining = 0;
+      for (let v = from; v < to; v++) {
+        if (Atomics.load(sccOf, v) !== -1) continue;
+        Atomics.store(color, v, v);
+        remaining++;
+      }
+      return remaining;
+    },
+    sccTrim(job) {
+      const { from, to, sccOf } = job;
+      let trimmed = 0;
+      for (let v = from; v < to; v++) {
+        if (Atomics.load(sccOf, v) !== -1) continue;
+        let hasOut = false,
+          hasIn = false;
+        for (let e = offsets[v], end = offsets[v + 1]; e < end && !hasOut; e++) {
+          const w = targets[e];
+          hasOut = w !== v && Atomics.load(sccOf, w) === -1;
+        }
+        for (let e = inOffsets[v], end = inOffsets[v + 1]; e < end && !hasIn; e++) {
+          const u = inTargets[e];
+          hasIn = u !== v && Atomics.load(sccOf, u) === -1;
+        }
+        if ((!hasOut || !hasIn) && Atomics.compareExchange(sccOf, v, -1, v) === -1) trimmed++;
+      }
+      return trimmed;
+    },
+    sccColor(job) {
+      const { from, to, color, sccOf } = job;
+      let changed = 0;
+      for (let v = from; v < to; v++) {
+        if (Atomics.load(sccOf, v) !== -1) continue;
+        const c = Atomics.load(color, v);
+        for (let e = offsets[v], end = offsets[v + 1]; e < end; e++) {
+          const w = targets[e];
+          if (Atomics.load(sccOf, w) === -1 && atomicMax(color, w, c)) changed = 1;
+        }
+      }
+      return changed;
+    },
+    sccRoots(job) {
+      const { from, to, color, sccOf, next, nextSize } = job;
+      for (let v = from; v < to; v++) {
+        if (Atomics.load(sccOf, v) === -1 && Atomics.load(color, v) === v) {
+          Atomics.store(sccOf, v, v);
+          next[Atomics.add(nextSize, 0, 1)] = v;
+        }
+      }
+      return 0;
+    },
+    sccBackward(job) {
+      const { from, to, color, sccOf, frontier, next, nextSize } = job;
+      for (let i = from; i < to; i++) {
+        const v = frontier[i];
+        const c = Atomics.load(sccOf, v);
+        for (let e = inOffsets[v], end = inOffsets[v + 1]; e < end; e++) {
+          const u = inTargets[e];
+          if (Atomics.load(color, u) === c && Atomics.compareExchange(sccOf, u, -1, c) === -1) {
+            next[Atomics.add(nextSize, 0, 1)] = u;
+          }
+        }
+      }
+      return 0;
+    },
+    prContrib(job) {
+      const { from, to, rank, contrib } = job;
+      let dangling = 0;
+      for (let v = from; v < to; v++) {
+        const degree = offsets[v + 1] - offsets[v];
+        if (degree > 0) {
+          contrib[v] = rank[v] / degree;
+        } else {
+          contrib[v] = 0;
+          dangling += rank[v];
+        }
+      }
+      return dangling;
+    },
+    prUpdate(job) {
+      const { from, to, rank, contrib, base, damping } = job;
+      let diff = 0;
+      for (let v = from; v < to; v++) {
+        let sum = 0;
+        for (let e = inOffsets[v], end = inOffsets[v + 1]; e < end; e++) sum += contrib[inTargets[e]];
+        const value = base + damping * sum;
+        diff += Math.abs(value - rank[v]);
+        rank[v] = value;
+      }
+      return diff;
+    }
+  };
+
+  const handle = (message: any) => {
+    if (message.type === 'init') {
+      offsets = message.offsets;
+      targets = message.targets;
+      weights = message.weights;
+      inOffsets = message.inOffsets;
+      inTargets = message.inTargets;
+      return;
+    }
+    try {
+      scope.postMessage({ id: message.id, result: kernels[message.kernel](message) });
+    } catch (error: any) {
+      scope.postMessage({ id: message.id, error: String((error && error.stack) || error) });
+    }
+  };
+  if (typeof scope.on === 'function') scope.on('message', handle);
+  else scope.onmessage = (event: any) => handle(event.data);
+}
+
+/**
+ * 1. Shared Memory: A ParallelGraph copies a CSR snapshot (see `freeze` and `CSRGraph`) and its transpose onto `SharedArrayBuffer`s once. Its workers read the arcs and write their results in place, so no graph data is cloned per message.
+ * 2. Supersteps: Each algorithm is a series of steps. In a step every worker runs the same kernel over its own slice of vertices (balanced by arcs) or of the current frontier, then the main thread checks whether to go on. The main thread is never blocked, and every method returns a promise.
+ * 3. Workers: The library never imports `worker_threads` itself, so bundles for browsers stay free of it; the worker source looks up its port at run time. `createWorker` receives the worker script as source text; in Node.js, pass `source => new Worker(source, { eval: true })`.
+ * 4. One Job at a Time: Calls are queued and run one after another on the same workers. Call `close` to terminate them.
+ * 5. Results: Vertices are the indices of the snapshot; `graph.keyOf(i)` turns them back into keys.
+ */
+export class ParallelGraph {
+  /**
+   * The constructor shares the snapshot and starts the workers.
+   * @param {CSRGraph} graph - The snapshot to run on. It is copied onto shared memory if it is not shared already.
+   * @param {ParallelGraphOptions} options - `createWorker` creates a worker from source text, and `concurrency` is the
+   * number of workers, 4 by default.
+   */
+  constructor(graph: CSRGraph, options: ParallelGraphOptions) {
+    if (typeof SharedArrayBuffer === 'undefined') throw new Error('ParallelGraph requires SharedArrayBuffer');
+    const { createWorker, concurrency = 4 } = options;
+    if (!(Number.isInteger(concurrency) && concurrency >= 1)) {
+      throw new Error('ParallelGraph concurrency must be a positive integer');
+    }
+
+    this._graph = graph.share();
+    this._transposed = this._graph.transpose();
+    this._vertexRanges = this._balance(concurrency);
+
+    const source = `(${graphWorkerMain.toString()})(${WORKER_PORT_SOURCE});`;
+    const init = {
+      type: 'init',
+      offsets: this._graph.offsets,
+      targets: this._graph.targets,
+      weights: this._graph.weights,
+      inOffsets: this._transposed.offsets,
+      inTargets: this._transposed.targets
+    };
+    for (let i = 0; i < concurrency; i++) {
+      const worker = createWorker(source);
+      worker.on('message', message => this._settle(message));
+      worker.on('error', error => this._fail(error));
+      worker.postMessage(init);
+      this._workers.push(worker);
+    }
+  }
+
+  protected _graph: CSRGraph;
+
+  /**
+   * The function returns the shared snapshot the workers run on.
+   * @returns The `_graph` property is being returned.
+   */
+  get graph(): CSRGraph {
+    return this._graph;
+  }
+
+  protected _transposed: CSRGraph;
+
+  protected _workers: GraphWorkerLike[] = [];
+
+  /**
+   * The function returns the number of workers.
+   * @returns The number of workers.
+   */
+  get concurrency(): number {
+    return this._workers.length;
+  }
+
+  protected _vertexRanges: [number, number][];
+
+  protected _pending: Map<number, { resolve: (result: number) => void; reject: (error: Error) => void }> = new Map();
+
+  protected _nextId = 0;
+
+  protected _queue: Promise<unknown> = Promise.resolve();
+
+  protected _closed = false;
+
+  protected _failure: Error | undefined = undefined;
+
+  /**
+   * Time Complexity: O((V + E) / P) per level, with one round trip to the workers per level
+   * Space Complexity: O(V)
+   *
+   * The `bfs` function runs a level-synchronous breadth-first search: each step the workers expand their part of the
+   * frontier, claiming unvisited vertices with a compare-and-swap.
+   * @param {number} src - The source vertex index.
+   * @returns A promise of `dist`, the number of arcs from the source (-1 where unreachable), and `prev`, the parent of
+   * each vertex in a breadth-first tree (-1 for none).
+   */
+  bfs(src: number): Promise<ParallelBFSResult> {
+    return this._run(async () => {
+      const n = this._checkVertex(src);
+      const level = this._sharedInt32(n).fill(-1);
+      const prev = this._sharedInt32(n).fill(-1);
+      let frontier = this._sharedInt32(n),
+        next = this._sharedInt32(n);
+      const nextSize = this._sharedInt32(1);
+
+      level[src] = 0;
+      frontier[0] = src;
+      let size = 1;
+      for (let depth = 0; size > 0; depth++) {
+        nextSize[0] = 0;
+        await this._step('bfs', { level, prev, frontier, next, nextSize, depth }, this._split(size));
+        size = nextSize[0];
+        [frontier, next] = [next, frontier];
+      }
+      return { dist: level, prev };
+    });
+  }
+
+  /**
+   * Time Complexity: O((V + E) / P) per step; the number of steps depends on `delta` and the weights
+   * Space Complexity: O(V)
+   *
+   * The `deltaStepping` function computes shortest distances over non-negative weights with delta-stepping. Vertices
+   * are settled in buckets of width `delta`: within a bucket the workers relax the arcs of every improved vertex in
+   * parallel, updating distances with an atomic minimum, and vertices that land in later buckets wait. A small `delta`
+   * does less redundant work and a large one needs fewer steps; `Infinity` gives parallel Bellman-Ford.
+   * @param {number} src - The source vertex index.
+   * @param {number} [delta] - The width of a bucket, the mean arc weight by default.
+   * @returns A promise of the distance of each vertex, Infinity where unreachable.
+   */
+  deltaStepping(src: number, delta?: number): Promise<Float64Array> {
+    return this._run(async () => {
+      const n = this._checkVertex(src);
+      const weights = this._graph.weights;
+      let total = 0;
+      for (let e = 0; e < weights.length; e++) {
+        if (weights[e] < 0) throw new Error('deltaStepping requires non-negative weights');
+        total += weights[e];
+      }
+      if (delta === undefined) delta = total > 0 ? total / weights.length : Infinity;
+      if (!(delta > 0)) throw new Error('deltaStepping requires a positive delta');
+
+      const dist = new Float64Array(new SharedArrayBuffer(n * 8)).fill(Infinity);
+      const bits = new BigInt64Array(dist.buffer);
+      const queued = this._sharedInt32(n);
+      let frontier = this._sharedInt32(n),
+        next = this._sharedInt32(n);
+      const later = this._sharedInt32(n);
+      const nextSize = this._sharedInt32(1),
+        laterSize = this._sharedInt32(1);
+
+      dist[src] = 0;
+      queued[src] = 1;
+      frontier[0] = src;
+      let size = 1;
+      let bound = delta;
+      let deferred: number[] = [];
+      for (;;) {
+        while (size > 0) {
+          nextSize[0] = 0;
+          laterSize[0] = 0;
+          await this._step(
+            'sssp',
+            { bits, queued, frontier, next, nextSize, later, laterSize, bound },
+            this._split(size)
+          );
+          for (let i = 0; i < laterSize[0]; i++) deferred.push(later[i]);
+          size = nextSize[0];
+          [frontier, next] = [next, frontier];
+        }
+        if (deferred.length === 0) break;
+
+        // Move on to the first bucket that is not empty
+        let min = Infinity;
+        for (const v of deferred) if (dist[v] < min) min = dist[v];
+        bound = (Math.floor(min / delta) + 1) * delta;
+        const rest: number[] = [];
+        for (const v of deferred) {
+          if (dist[v] < bound) frontier[size++] = v;
+          else rest.push(v);
+        }
+        deferred = rest;
+      }
+      return dist;
+    });
+  }
+
+  /**
+   * Time Complexity: O((V + E) / P) per step, with O(log V) steps on typical graphs
+   * Space Complexity: O(V)
+   *
+   * The `connectedComponents` function labels the connected components, following arcs both ways, so on a
+   * directed snapshot it finds the weakly connected components. The workers propagate the least label across every
+   * arc with an atomic minimum and shorten label chains by pointer jumping until nothing changes.
+   * @returns A promise of the component label of each vertex, which is the least vertex index in its component.
+   */
+  connectedComponents(): Promise<Int32Array> {
+    return this._run(async () => {
+      const n = this._graph.vertexCount;
+      const label = this._sharedInt32(n);
+      for (let i = 0; i < n; i++) label[i] = i;
+      for (;;) {
+        const changed = this._sum(await this._step('cc', { label }, this._vertexRanges));
+        const jumped = this._sum(await this._step('ccJump', { label }, this._vertexRanges));
+        if (changed === 0 && jumped === 0) break;
+      }
+      return label;
+    });
+  }
+
+  /**
+   * Time Complexity: O((V + E) / P) per step; the number of rounds grows with the depth of the component graph
+   * Space Complexity: O(V)
+   *
+   * The `stronglyConnectedComponents` function finds the strongly connected components by coloring. Each round the
+   * workers first trim vertices without remaining in- or out-arcs, which are components on their own. Then they
+   * spread the greatest vertex index forward as a color, and search backward from every vertex that kept its own color
+   * over the arcs of the same color. The vertices found form the component of that root, and the next round continues
+   * with the rest. For graphs whose components form long chains, `CSRGraph.tarjan` is faster.
+   * @returns A promise of the component of each vertex, named by one of its vertex indices.
+   */
+  stronglyConnectedComponents(): Promise<Int32Array> {
+    return this._run(async () => {
+      const n = this._graph.vertexCount;
+      const color = this._sharedInt32(n);
+      const sccOf = this._sharedInt32(n).fill(-1);
+      let frontier = this._sharedInt32(n),
+        next = this._sharedInt32(n);
+      const nextSize = this._sharedInt32(1);
+      const ranges = this._vertexRanges;
+
+      for (;;) {
+        while (this._sum(await this._step('sccTrim', { sccOf }, ranges)) > 0);
+        if (this._sum(await this._step('sccReset', { color, sccOf }, ranges)) === 0) break;
+        while (this._sum(await this._step('sccColor', { color, sccOf }, ranges)) > 0);
+
+        nextSize[0] = 0;
+        await this._step('sccRoots', { color, sccOf, next, nextSize }, ranges);
+        let size = nextSize[0];
+        [frontier, next] = [next, frontier];
+        while (size > 0) {
+          nextSize[0] = 0;
+          await this._step('sccBackward', { color, sccOf, frontier, next, nextSize }, this._split(size));
+          size = nextSize[0];
+          [frontier, next] = [next, frontier];
+        }
+      }
+      return sccOf;
+    });
+  }
+
+  /**
+   * Time Complexity: O((V + E) / P) per iteration
+   * Space Complexity: O(V)
+   *
+   * The `pageRank` function computes PageRank by power iteration. Each iteration the workers pull the rank shares of
+   * the in-neighbors of their own vertices, so no two workers write the same slot. Vertices without out-arcs share
+   * their rank with every vertex. Parallel arcs count once each; weights are ignored.
+   * @param {PageRankOptions} [options] - `damping`, 0.85 by default; `tolerance`, the L1 change between iterations at
+   * which to stop, 1e-6 by default; and `maxIterations`, 100 by default.
+   * @returns A promise of the rank of each vertex; the ranks add up to 1.
+   */
+  pageRank(options?: PageRankOptions): Promise<Float64Array> {
+    return this._run(async () => {
+      const { damping = 0.85, tolerance = 1e-6, maxIterations = 100 } = options ?? {};
+      const n = this._graph.vertexCount;
+      const rank = new Float64Array(new SharedArrayBuffer(n * 8)).fill(1 / n);
+      const contrib = new Float64Array(new SharedArrayBuffer(n * 8));
+      const ranges = this._vertexRanges;
+      for (let iteration = 0; iteration < maxIterations && n > 0; iteration++) {
+        const dangling = this._sum(await this._step('prContrib', { rank, contrib }, ranges));
+        const base = (1 - damping) / n + (damping * dangling) / n;
+        const diff = this._sum(await this._step('prUpdate', { rank, contrib, base, damping }, ranges));
+        if (diff < tolerance) break;
+      }
+      return rank;
+    });
+  }
+
+  /**
+   * The `close` function terminates the workers once the queued jobs finish. Later calls are rejected.
+   * @returns A promise that resolves when the workers are told to stop.
+   */
+  close(): Promise<void> {
+    // A broken pool is closed too, so its workers are still terminated
+    const closing = this._queue.then(async () => {
+      if (this._closed) throw new Error('ParallelGraph is closed');
+      this._closed = true;
+      for (const worker of this._workers) await worker.terminate();
+    });
+    this._queue = closing.catch(() => undefined);
+    return closing;
+  }
+
+  /**
+   * The function queues a job behind the running one, so the steps of two jobs never interleave.
+   * @param job - A function that runs the job.
+   * @returns A promise of the result of the job.
+   */
+  protected _run<T>(job: () => Promise<T>): Promise<T> {
+    const result = this._queue.then(() => {
+      if (this._closed) throw new Error('ParallelGraph is closed');
+      if (this._failure) throw this._failure;
+      return job();
+    });
+    this._queue = result.catch(() => undefined);
+    return result;
+  }
+
+  /**
+   * The function runs a kernel on every worker that has a non-empty range.
+   * @param {string} kernel - The name of the kernel.
+   * @param args - The shared arrays and values the kernel reads.
+   * @param {[number, number][]} ranges - The `[from, to)` range of each worker.
+   * @returns A promise of the number each worker returned.
+   */
+  protected _step(kernel: string, args: object, ranges: [number, number][]): Promise<number[]> {
+    if (this._failure) return Promise.reject(this._failure);
+    const results: Promise<number>[] = [];
+    for (let i = 0; i < ranges.length; i++) {
+      const [from, to] = ranges[i];
+      if (from >= to) continue;
+      const id = this._nextId++;
+      results.push(new Promise((resolve, reject) => this._pending.set(id, { resolve, reject })));
+      this._workers[i].postMessage({ ...args, id, kernel, from, to });
+    }
+    return Promise.all(results);
+  }
+
+  /**
+   * The function resolves or rejects the step a worker replied to.
+   * @param message - The reply, with `id` and either `result` or `error`.
+   */
+  protected _settle(message: { id: number; result?: number; error?: string }): void {
+    const pending = this._pending.get(message.id);
+    if (!pending) return;
+    this._pending.delete(message.id);
+    if (message.error !== undefined) pending.reject(new Error(message.error));
+    else pending.resolve(message.result!);
+  }
+
+  /**
+   * The function marks the pool as broken when a worker fails and rejects every step in flight. Later jobs are
+   * rejected with the same error instead of waiting on a worker that will never answer.
+   * @param {Error} error - The error of the worker.
+   */
+  protected _fail(error: Error): void {
+    if (!this._failure) this._failure = error;
+    for (const { reject } of this._pending.values()) reject(error);
+    this._pending.clear();
+  }
+
+  /**
+   * The function splits the vertices into one range per worker with about the same number of vertices plus arcs.
+   * @param {number} parts - The number of ranges.
+   * @returns The `[from, to)` ranges.
+   */
+  protected _balance(parts: number): [number, number][] {
+    const n = this._graph.vertexCount;
+    const offsets = this._graph.offsets;
+    const work = n + this._graph.arcCount;
+    const ranges: [number, number][] = [];
+    let from = 0;
+    for (let i = 1; i <= parts; i++) {
+      // The first vertex at which the work done so far, offsets[v] + v, reaches the share of this range
+      const share = (work * i) / parts;
+      let lo = from,
+        hi = n;
+      while (lo < hi) {
+        const mid = (lo + hi) >>> 1;
+        if (offsets[mid] + mid < share) lo = mid + 1;
+        else hi = mid;
+      }
+      const to = i === parts ? n : lo;
+      ranges.push([from, to]);
+      from = to;
+    }
+    return ranges;
+  }
+
+  /**
+   * The function splits a frontier of the given size evenly between the workers.
+   * @param {number} size - The size of the frontier.
+   * @returns The `[from, to)` ranges.
+   */
+  protected _split(size: number): [number, number][] {
+    const parts = this._workers.length;
+    const ranges: [number, number][] = [];
+    for (let i = 0; i < parts; i++) ranges.push([Math.floor((size * i) / parts), Math.floor((size * (i + 1)) / parts)]);
+    return ranges;
+  }
+
+  protected _sum(results: number[]): number {
+    let sum = 0;
+    for (const result of results) sum += result;
+    return sum;
+  }
+
+  protected _sharedInt32(length: number): Int32Array {
+    return new Int32Array(new SharedArrayBuffer(length * 4));
+  }
+
+  /**
+   * The function checks that a vertex index is in the snapshot.
+   * @param {number} index - The vertex index.
+   * @returns The number of vertices.
+   */
+  protected _checkVertex(index: number): number {
+    const n = this._graph.vertexCount;
+    if (!(Number.isInteger(index) && index >= 0 && index < n)) throw new Error(`Vertex index ${index} is out of range`);
+    return n;
+  }
+}
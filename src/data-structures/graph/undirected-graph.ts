@@ -66,6 +66,7 @@ export class UndirectedGraph<
 
   set edgeMap(v: Map<VO, EO[]>) {
     this._edgeMap = v;
+    this._frozen = undefined;
   }
 
   /**
@@ -149,6 +150,7 @@ export class UndirectedGraph<
       return undefined;
     }
 
+    this._frozen = undefined;
     const v1Edges = this._edgeMap.get(vertex1);
     let removed: EO | undefined = undefined;
     if (v1Edges) {
@@ -239,6 +241,7 @@ export class UndirectedGraph<
       });
       this._edgeMap.delete(vertex);
     }
+    this._frozen = undefined;
 
     return this._vertexMap.delete(vertexKey);
   }
@@ -391,6 +394,7 @@ export class UndirectedGraph<
   clear() {
     this._vertexMap = new Map<VertexKey, VO>();
     this._edgeMap = new Map<VO, EO[]>();
+    this._frozen = undefined;
   }
 
   /**
@@ -421,7 +425,8 @@ export class UndirectedGraph<
    *  1. Tarjan can find the articulation points and bridges(critical edgeMap) of undirected graphs in linear time
    *
    * The function `tarjan` implements the Tarjan's algorithm to find bridges and cut vertices in a
-   * graph.
+   * graph. It runs iteratively over the vertex indices of the CSR snapshot (`freeze` keeps one, otherwise one is
+   * built for the call), so deep graphs do not overflow the call stack.
    * @returns The function `tarjan()` returns an object with the following properties:
    */
   tarjan(): { dfnMap: Map<VO, number>; lowMap: Map<VO, number>; bridges: EO[]; cutVertices: VO[] } {
@@ -430,49 +435,70 @@ export class UndirectedGraph<
     const bridges: EO[] = [];
     const cutVertices: VO[] = [];
 
+    const csr = this._frozen ?? this._toCSR();
+    const offsets = csr.offsets,
+      targets = csr.targets;
+    const vertices = [...this._vertexMap.values()];
+    const n = vertices.length;
+    const dfn = new Int32Array(n).fill(-1);
+    const low = new Int32Array(n);
+    const parent = new Int32Array(n);
+    const cursor = new Int32Array(n);
+    const childCount = new Int32Array(n);
+    // The vertices of the current search path, in place of the recursion
+    const stack = new Int32Array(n);
     let time = 0;
 
-    const dfs = (vertex: VO, parent: VO | undefined) => {
-      dfnMap.set(vertex, time);
-      lowMap.set(vertex, time);
-      time++;
-
-      const neighbors = this.getNeighbors(vertex);
-      let childCount = 0;
-
-      for (const neighbor of neighbors) {
-        if (!dfnMap.has(neighbor)) {
-          childCount++;
-          dfs(neighbor, vertex);
-          lowMap.set(vertex, Math.min(lowMap.get(vertex)!, lowMap.get(neighbor)!));
-
-          if (lowMap.get(neighbor)! > dfnMap.get(vertex)!) {
-            // Found a bridge
-            const edge = this.getEdge(vertex, neighbor);
-            if (edge) {
-              bridges.push(edge);
-            }
+    for (let root = 0; root < n; root++) {
+      if (dfn[root] !== -1) continue;
+      let top = 0;
+      stack[top++] = root;
+      parent[root] = -1;
+      dfn[root] = low[root] = time++;
+      cursor[root] = offsets[root];
+
+      while (top > 0) {
+        const v = stack[top - 1];
+        if (cursor[v] < offsets[v + 1]) {
+          const w = targets[cursor[v]++];
+          if (dfn[w] === -1) {
+            childCount[v]++;
+            parent[w] = v;
+            dfn[w] = low[w] = time++;
+            cursor[w] = offsets[w];
+            stack[top++] = w;
+          } else if (w !== parent[v]) {
+            low[v] = Math.min(low[v], dfn[w]);
           }
-
-          if (parent !== undefined && lowMap.get(neighbor)! >= dfnMap.get(vertex)!) {
-            // Found an articulation point
-            cutVertices.push(vertex);
-          }
-        } else if (neighbor !== parent) {
-          lowMap.set(vertex, Math.min(lowMap.get(vertex)!, dfnMap.get(neighbor)!));
+          continue;
         }
-      }
 
-      if (parent === undefined && childCount > 1) {
-        // Special case for root in DFS tree
-        cutVertices.push(vertex);
+        top--;
+        const p = parent[v];
+        if (p === -1) {
+          // Special case for root in DFS tree
+          if (childCount[v] > 1) cutVertices.push(vertices[v]);
+          continue;
+        }
+        low[p] = Math.min(low[p], low[v]);
+        if (low[v] > dfn[p]) {
+          // Found a bridge
+          const edge = this.getEdge(vertices[p], vertices[v]);
+          if (edge) bridges.push(edge);
+        }
+        if (parent[p] !== -1 && low[v] >= dfn[p]) {
+          // Found an articulation point
+          cutVertices.push(vertices[p]);
+        }
       }
-    };
+    }
 
-    for (const vertex of this.vertexMap.values()) {
-      if (!dfnMap.has(vertex)) {
-        dfs(vertex, undefined);
-      }
+    // Fill the maps in discovery order, as a recursive search would
+    const byDfn = new Int32Array(n);
+    for (let i = 0; i < n; i++) byDfn[dfn[i]] = i;
+    for (let t = 0; t < n; t++) {
+      dfnMap.set(vertices[byDfn[t]], t);
+      lowMap.set(vertices[byDfn[t]], low[byDfn[t]]);
     }
 
     return {
@@ -543,6 +569,31 @@ export class UndirectedGraph<
         }
       }
     }
+    this._frozen = undefined;
     return true;
   }
+
+  /**
+   * The function visits the arcs of a vertex from its incident edges, one arc per edge towards the
+   * other endpoint. Self-loops are skipped, as in `getNeighbors`.
+   * @param {VO} vertex - The vertex whose arcs are visited.
+   * @param callback - A function called with the other endpoint key and the weight of each edge.
+   */
+  protected _forEachArc(vertex: VO, callback: (target: VertexKey, weight: number) => void): void {
+    const edges = this._edgeMap.get(vertex);
+    if (!edges) return;
+    for (const edge of edges) {
+      const [v1, v2] = edge.endpoints;
+      const other = v1 === vertex.key ? v2 : v1;
+      if (other !== vertex.key) callback(other, edge.weight);
+    }
+  }
+
+  /**
+   * The function tells `freeze` that every edge goes both ways.
+   * @returns `false`.
+   */
+  protected _isDirected(): boolean {
+    return false;
+  }
 }
@@ -6,20 +6,40 @@
  * @license MIT License
  */
 import type {
+  BinarySnapshotOptions,
+  BinarySource,
+  BinaryWriterOptions,
   EntryCallback,
   HashMapLinkedNode,
   HashMapOptions,
   HashMapStoreItem,
+  InstrumentedMethods,
   LinkedHashMapOptions
 } from '../../types';
 import { IterableEntryBase } from '../base';
-import { isWeakKey, rangeCheck } from '../../utils';
+import { BinarySnapshotKind } from '../../types';
+import {
+  BinaryReader,
+  binaryCodecs,
+  BinaryWriter,
+  getSizeHint,
+  hashNumber,
+  hashString,
+  isWeakKey,
+  rangeCheck,
+  readSnapshotHeader,
+  toBinaryReader,
+  writeSnapshotHeader
+} from '../../utils';
+
+const defaultHashFn = (key: unknown): string => String(key);
 
 /**
  * 1. Key-Value Pair Storage: HashMap stores key-value pairs. Each key maps to a value.
  * 2. Fast Lookup: It's used when you need to quickly find, insert, or delete entries based on a key.
  * 3. Unique Keys: Keys are unique. If you try to insert another entry with the same key, the old entry will be replaced by the new one.
  * 4. Unordered Collection: HashMap does not guarantee the order of entries, and the order may change over time.
+ * 5. Number and string keys live in an open-addressing table with Robin Hood probing, hashed by value without string conversion. Object keys are kept in a Map by reference.
  */
 export class HashMap<K = any, V = any, R = [K, V]> extends IterableEntryBase<K, V> {
   /**
@@ -27,43 +47,69 @@ export class HashMap<K = any, V = any, R = [K, V]> extends IterableEntryBase<K,
    * options.
    * @param rawCollection - The `rawCollection` parameter is an iterable collection of elements of type
    * `T`. It is an optional parameter and its default value is an empty array `[]`.
-   * @param [options] - The `options` parameter is an optional object that can contain two properties:
+   * @param [options] - The `options` parameter is an optional object that can contain `hashFn`,
+   * `toEntryFn` and `initialCapacity`, the number of entries to reserve room for.
    */
   constructor(rawCollection: Iterable<R | [K, V]> = [], options?: HashMapOptions<K, V, R>) {
     super();
     if (options) {
-      const { hashFn, toEntryFn } = options;
+      const { hashFn, toEntryFn, initialCapacity } = options;
       if (hashFn) {
         this._hashFn = hashFn;
       }
       if (toEntryFn) {
         this._toEntryFn = toEntryFn;
       }
+      if (initialCapacity !== undefined) {
+        this.reserve(initialCapacity);
+      }
     }
     if (rawCollection) {
-      this.setMany(rawCollection);
+      this.bulkLoad(rawCollection);
     }
   }
 
-  protected _store: { [key: string]: HashMapStoreItem<K, V> } = {};
+  protected readonly _minCapacity = 8;
+
+  protected readonly _maxLoadFactor = 0.75;
+
+  // Open-addressing index over dense entry arrays. Bucket `b` occupies `_buckets[2b]`, the entry index + 1
+  // (0 means empty), and `_buckets[2b + 1]`, the hash of that entry, so a probe reads one cache line and
+  // rarely touches the entries themselves.
+  protected _buckets: Int32Array = new Int32Array(this._minCapacity * 2);
+
+  // Entries in insertion order; a deleted entry leaves a hole whose hash key is `undefined`
+  protected _keys: K[] = [];
+  protected _values: V[] = [];
+  protected _hashKeys: (string | number | undefined)[] = [];
+  protected _hashes: number[] = [];
+
+  protected _primitiveSize = 0;
 
   /**
-   * The function returns the store object, which is a dictionary of HashMapStoreItem objects.
-   * @returns The store property is being returned. It is a dictionary-like object with string keys and
-   * values of type HashMapStoreItem<K, V>.
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The function returns a snapshot of the non-object entries keyed by their string form.
+   * @returns a dictionary-like object with string keys and values of type HashMapStoreItem<K, V>.
    */
   get store(): { [p: string]: HashMapStoreItem<K, V> } {
-    return this._store;
+    const store: { [p: string]: HashMapStoreItem<K, V> } = {};
+    for (let i = 0; i < this._hashKeys.length; i++) {
+      const hashKey = this._hashKeys[i];
+      if (hashKey !== undefined) store[String(hashKey)] = { key: this._keys[i], value: this._values[i] };
+    }
+    return store;
   }
 
-  protected _objMap: Map<object, V> = new Map();
+  protected _objMap: Map<object | symbol, V> = new Map();
 
   /**
-   * The function returns the object map.
+   * The function returns the object map, which holds the object, function and symbol keys by identity.
    * @returns The `objMap` property is being returned, which is a `Map` object with keys of type
-   * `object` and values of type `V`.
+   * `object` or `symbol` and values of type `V`.
    */
-  get objMap(): Map<object, V> {
+  get objMap(): Map<object | symbol, V> {
     return this._objMap;
   }
 
@@ -131,17 +177,30 @@ export class HashMap<K = any, V = any, R = [K, V]> extends IterableEntryBase<K,
    * size.
    */
   clear() {
-    this._store = {};
+    this._buckets = new Int32Array(this._minCapacity * 2);
+    this._keys = [];
+    this._values = [];
+    this._hashKeys = [];
+    this._hashes = [];
+    this._primitiveSize = 0;
     this._objMap.clear();
     this._size = 0;
   }
 
   /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
    * The `set` function adds a key-value pair to a map-like data structure, incrementing the size if
    * the key is not already present.
    * @param {K} key - The key parameter is the key used to identify the value in the data structure. It
    * can be of any type, but if it is an object, it will be stored in a Map, otherwise it will be
-   * stored in a regular JavaScript object.
+   * stored in the open-addressing table.
    * @param {V} value - The value parameter represents the value that you want to associate with the
    * key in the data structure.
    */
@@ -152,11 +211,27 @@ export class HashMap<K = any, V = any, R = [K, V]> extends IterableEntryBase<K,
       }
       this.objMap.set(key, value);
     } else {
-      const strKey = this._getNoObjKey(key);
-      if (this.store[strKey] === undefined) {
-        this._size++;
+      const hashKey = this._getHashKey(key);
+      const hash = this._hash(hashKey);
+      const bucket = this._findBucket(hashKey, hash);
+      if (bucket !== -1) {
+        this._values[this._buckets[bucket << 1] - 1] = value;
+        return true;
+      }
+
+      if (this._keys.length + 1 > (this._buckets.length >> 1) * this._maxLoadFactor) {
+        // Leave headroom for half as many entries again, so a map that churns at a steady size
+        // gathers enough holes between compactions to keep set amortized O(1)
+        this._rehash(this._primitiveSize + (this._primitiveSize >> 1) + 1);
       }
-      this._store[strKey] = { key, value };
+      const index = this._keys.length;
+      this._keys.push(key);
+      this._values.push(value);
+      this._hashKeys.push(hashKey);
+      this._hashes.push(hash);
+      this._insertBucket(index, hash);
+      this._primitiveSize++;
+      this._size++;
     }
     return true;
   }
@@ -186,24 +261,142 @@ export class HashMap<K = any, V = any, R = [K, V]> extends IterableEntryBase<K,
   }
 
   /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The `bulkLoad` function sets every entry of a collection without collecting per-entry results.
+   * When the collection is an array or exposes a numeric `size`, the table is grown once up front
+   * instead of rehashing repeatedly while it fills.
+   * @param rawCollection - An iterable of `[key, value]` entries, or raw elements converted with
+   * `toEntryFn`.
+   */
+  bulkLoad(rawCollection: Iterable<R | [K, V]>): void {
+    const sizeHint = getSizeHint(rawCollection);
+    if (sizeHint > 0) this.reserve(this._primitiveSize + sizeHint);
+    for (const rawEle of rawCollection) {
+      if (this.isEntry(rawEle)) {
+        this.set(rawEle[0], rawEle[1]);
+      } else {
+        const [key, value] = this.toEntryFn(rawEle);
+        this.set(key, value);
+      }
+    }
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `reserve` function grows the table so that it can hold `capacity` number or string keys
+   * without rehashing. It never shrinks the table.
+   * @param {number} capacity - The number of entries to make room for.
+   */
+  reserve(capacity: number): void {
+    if (capacity > (this._buckets.length >> 1) * this._maxLoadFactor) this._rehash(capacity);
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The `writeBinary` function writes a binary snapshot of the map: a header, the number of entries,
+   * then each key and value through the codecs.
+   * @param {BinaryWriter} writer - The writer to append to.
+   * @param [options] - `keyCodec` and `valueCodec`, `binaryCodecs.any` by default. Object keys need a
+   * codec that recreates them, and come back as new objects.
+   */
+  writeBinary(writer: BinaryWriter, options?: BinarySnapshotOptions<K, V>): void {
+    const keyCodec = options?.keyCodec ?? binaryCodecs.any;
+    const valueCodec = options?.valueCodec ?? binaryCodecs.any;
+    writeSnapshotHeader(writer, BinarySnapshotKind.HashMap);
+    writer.writeVarUint(this.size);
+    for (const [key, value] of this) {
+      keyCodec.write(writer, key);
+      valueCodec.write(writer, value);
+    }
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `toBinary` function returns the snapshot `writeBinary` writes.
+   * @param [options] - The codecs, plus `BinaryWriter` options; with `onChunk` the snapshot is streamed
+   * and an empty array is returned.
+   * @returns The snapshot bytes.
+   */
+  toBinary(options?: BinarySnapshotOptions<K, V> & BinaryWriterOptions): Uint8Array {
+    const writer = new BinaryWriter(options);
+    this.writeBinary(writer, options);
+    return writer.finish();
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `loadBinary` function replaces the contents of the map with a snapshot. The table is sized for
+   * the entry count first, so loading never rehashes.
+   * @param source - The snapshot bytes, an iterable of chunks, or a reader positioned at a snapshot.
+   * @param [options] - The codecs the snapshot was written with.
+   * @returns The number of entries in the map.
+   */
+  loadBinary(source: BinarySource | BinaryReader, options?: BinarySnapshotOptions<K, V>): number {
+    const keyCodec = options?.keyCodec ?? binaryCodecs.any;
+    const valueCodec = options?.valueCodec ?? binaryCodecs.any;
+    const reader = toBinaryReader(source);
+    readSnapshotHeader(reader, BinarySnapshotKind.HashMap);
+    const count = reader.readVarUint();
+    this.clear();
+    this.reserve(count);
+    for (let i = 0; i < count; i++) {
+      const key = keyCodec.read(reader);
+      this.set(key, valueCodec.read(reader));
+    }
+    return this.size;
+  }
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
    * The `get` function retrieves a value from a map based on a given key, either from an object map or
-   * a string map.
+   * the open-addressing table.
    * @param {K} key - The `key` parameter is the key used to retrieve a value from the map. It can be
    * of any type, but it should be compatible with the key type used when the map was created.
    * @returns The method `get(key: K)` returns a value of type `V` if the key exists in the `_objMap`
-   * or `_store`, otherwise it returns `undefined`.
+   * or the table, otherwise it returns `undefined`.
    */
   override get(key: K): V | undefined {
     if (this._isObjKey(key)) {
       return this.objMap.get(key);
     } else {
-      const strKey = this._getNoObjKey(key);
-      return this._store[strKey]?.value;
+      const hashKey = this._getHashKey(key);
+      const bucket = this._findBucket(hashKey, this._hash(hashKey));
+      return bucket === -1 ? undefined : this._values[this._buckets[bucket << 1] - 1];
     }
   }
 
   /**
-   * The `has` function checks if a given key exists in the `_objMap` or `_store` based on whether it
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
+   * The `has` function checks if a given key exists in the `_objMap` or the table based on whether it
    * is an object key or not.
    * @param {K} key - The parameter "key" is of type K, which means it can be any type.
    * @returns The `has` method is returning a boolean value.
@@ -212,12 +405,20 @@ export class HashMap<K = any, V = any, R = [K, V]> extends IterableEntryBase<K,
     if (this._isObjKey(key)) {
       return this.objMap.has(key);
     } else {
-      const strKey = this._getNoObjKey(key);
-      return strKey in this.store;
+      const hashKey = this._getHashKey(key);
+      return this._findBucket(hashKey, this._hash(hashKey)) !== -1;
     }
   }
 
   /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
    * The `delete` function removes an element from a map-like data structure based on the provided key.
    * @param {K} key - The `key` parameter is the key of the element that you want to delete from the
    * data structure.
@@ -232,13 +433,19 @@ export class HashMap<K = any, V = any, R = [K, V]> extends IterableEntryBase<K,
 
       return this.objMap.delete(key);
     } else {
-      const strKey = this._getNoObjKey(key);
-      if (strKey in this.store) {
-        delete this.store[strKey];
-        this._size--;
-        return true;
-      }
-      return false;
+      const hashKey = this._getHashKey(key);
+      const bucket = this._findBucket(hashKey, this._hash(hashKey));
+      if (bucket === -1) return false;
+
+      const index = this._buckets[bucket << 1] - 1;
+      this._deleteBucket(bucket);
+      // Leave a hole so iteration order is kept; holes are dropped on the next rehash
+      this._keys[index] = undefined as K;
+      this._values[index] = undefined as V;
+      this._hashKeys[index] = undefined;
+      this._primitiveSize--;
+      this._size--;
+      return true;
     }
   }
 
@@ -326,12 +533,12 @@ export class HashMap<K = any, V = any, R = [K, V]> extends IterableEntryBase<K,
   }
 
   /**
-   * The function returns an iterator that yields key-value pairs from both an object store and an
-   * object map.
+   * The function returns an iterator that yields key-value pairs from both the table, in insertion
+   * order, and the object map.
    */
   protected* _getIterator(): IterableIterator<[K, V]> {
-    for (const node of Object.values(this.store)) {
-      yield [node.key, node.value] as [K, V];
+    for (let i = 0; i < this._hashKeys.length; i++) {
+      if (this._hashKeys[i] !== undefined) yield [this._keys[i], this._values[i]];
     }
     for (const node of this.objMap) {
       yield node as [K, V];
@@ -339,37 +546,168 @@ export class HashMap<K = any, V = any, R = [K, V]> extends IterableEntryBase<K,
   }
 
   /**
-   * The function checks if a given key is an object or a function.
+   * The function checks if a given key is an object, a function or a symbol. These keys are held by
+   * identity in `objMap`, so two symbols with the same description stay apart.
    * @param {any} key - The parameter "key" can be of any type.
    * @returns a boolean value.
    */
-  protected _isObjKey(key: any): key is object | ((...args: any[]) => any) {
+  protected _isObjKey(key: any): key is object | symbol | ((...args: any[]) => any) {
     const keyType = typeof key;
-    return (keyType === 'object' || keyType === 'function') && key !== null;
+    return (keyType === 'object' || keyType === 'function' || keyType === 'symbol') && key !== null;
   }
 
   /**
-   * The function `_getNoObjKey` takes a key and returns a string representation of the key, handling
-   * different types of keys.
+   * The function `_getHashKey` returns the value a non-object key is looked up by. Numbers and strings
+   * are used as they are; any other primitive except a symbol goes through `hashFn`.
    * @param {K} key - The `key` parameter is of type `K`, which represents the type of the key being
-   * passed to the `_getNoObjKey` function.
-   * @returns a string value.
+   * passed to the `_getHashKey` function.
+   * @returns a number or a string.
    */
-  protected _getNoObjKey(key: K): string {
+  protected _getHashKey(key: K): string | number {
     const keyType = typeof key;
+    if (keyType === 'number' || keyType === 'string') return key as string | number;
+    return this.hashFn(key);
+  }
 
-    let strKey: string;
-    if (keyType !== 'string' && keyType !== 'number' && keyType !== 'symbol') {
-      strKey = this.hashFn(key);
-    } else {
-      if (keyType === 'number') {
-        // TODO numeric key should has its own hash
-        strKey = <string>key;
-      } else {
-        strKey = <string>key;
+  /**
+   * The function hashes a lookup key without allocating.
+   * @param {string | number} hashKey - The key returned by `_getHashKey`.
+   * @returns a 32-bit integer hash.
+   */
+  protected _hash(hashKey: string | number): number {
+    return typeof hashKey === 'number' ? hashNumber(hashKey) : hashString(hashKey);
+  }
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
+   * The function probes the table for a key. Probing stops early once it reaches a bucket whose
+   * occupant is closer to its home bucket than the key would be (the Robin Hood invariant).
+   * @param {string | number} hashKey - The key returned by `_getHashKey`.
+   * @param {number} hash - The hash of `hashKey`.
+   * @returns the bucket holding the key, or -1 if the key is absent.
+   */
+  protected _findBucket(hashKey: string | number, hash: number): number {
+    const buckets = this._buckets;
+    const mask = (buckets.length >> 1) - 1;
+    let bucket = hash & mask;
+    for (let distance = 0; ; distance++) {
+      const entry = buckets[bucket << 1];
+      if (entry === 0) return -1;
+      const entryHash = buckets[(bucket << 1) + 1];
+      if (entryHash === hash) {
+        const entryKey = this._hashKeys[entry - 1];
+        // NaN is the only value not equal to itself, and NaN keys must still be found
+        if (entryKey === hashKey || (entryKey !== entryKey && hashKey !== hashKey)) return bucket;
+      }
+      if (((bucket - (entryHash & mask)) & mask) < distance) return -1;
+      bucket = (bucket + 1) & mask;
+    }
+  }
+
+  /**
+   * The function places an entry index in the table, displacing entries that are closer to their home
+   * bucket (Robin Hood hashing), which keeps probe sequences short.
+   * @param {number} index - The index of the entry.
+   * @param {number} hash - The hash of the entry.
+   */
+  protected _insertBucket(index: number, hash: number): void {
+    const buckets = this._buckets;
+    const mask = (buckets.length >> 1) - 1;
+    let entry = index + 1;
+    let bucket = hash & mask;
+    for (let distance = 0; ; distance++) {
+      const slot = bucket << 1;
+      const occupant = buckets[slot];
+      if (occupant === 0) {
+        buckets[slot] = entry;
+        buckets[slot + 1] = hash;
+        return;
       }
+      const occupantHash = buckets[slot + 1];
+      const occupantDistance = (bucket - (occupantHash & mask)) & mask;
+      if (occupantDistance < distance) {
+        buckets[slot] = entry;
+        buckets[slot + 1] = hash;
+        entry = occupant;
+        hash = occupantHash;
+        distance = occupantDistance;
+      }
+      bucket = (bucket + 1) & mask;
+    }
+  }
+
+  /**
+   * The function empties a bucket and shifts the following entries of the probe run back by one, so
+   * the table never needs tombstones.
+   * @param {number} bucket - The bucket to empty.
+   */
+  protected _deleteBucket(bucket: number): void {
+    const buckets = this._buckets;
+    const mask = (buckets.length >> 1) - 1;
+    let next = (bucket + 1) & mask;
+    while (buckets[next << 1] !== 0 && ((next - (buckets[(next << 1) + 1] & mask)) & mask) !== 0) {
+      buckets[bucket << 1] = buckets[next << 1];
+      buckets[(bucket << 1) + 1] = buckets[(next << 1) + 1];
+      bucket = next;
+      next = (next + 1) & mask;
     }
-    return strKey;
+    buckets[bucket << 1] = 0;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The function compacts the entry arrays, dropping the holes left by deletions, and rebuilds the
+   * table with room for at least `minSize` entries.
+   * @param {number} minSize - The number of entries the new table must hold under the load factor.
+   */
+  protected _rehash(minSize: number): void {
+    let capacity = this._minCapacity;
+    while (minSize > capacity * this._maxLoadFactor) capacity *= 2;
+
+    let live = 0;
+    for (let i = 0; i < this._hashKeys.length; i++) {
+      if (this._hashKeys[i] === undefined) continue;
+      this._keys[live] = this._keys[i];
+      this._values[live] = this._values[i];
+      this._hashKeys[live] = this._hashKeys[i];
+      this._hashes[live] = this._hashes[i];
+      live++;
+    }
+    this._keys.length = live;
+    this._values.length = live;
+    this._hashKeys.length = live;
+    this._hashes.length = live;
+
+    this._buckets = new Int32Array(capacity * 2);
+    for (let i = 0; i < live; i++) this._insertBucket(i, this._hashes[i]);
+  }
+
+  /**
+   * The function counts the table lookups, with the buckets each hit probed and the misses, the bucket inserts
+   * and the rehashes.
+   * @returns The methods `enableStats` wraps.
+   */
+  protected override _instrumentedMethods(): InstrumentedMethods {
+    return {
+      ...super._instrumentedMethods(),
+      _findBucket: {
+        counter: 'lookups',
+        after: (instrumentation, [, hash]: [string | number, number], bucket: number, map: HashMap<K, V, R>) => {
+          if (bucket < 0) {
+            instrumentation.count('misses');
+            return;
+          }
+          const mask = (map._buckets.length >> 1) - 1;
+          instrumentation.count('probes', ((bucket - (hash & mask)) & mask) + 1);
+        }
+      },
+      _insertBucket: 'bucketInserts',
+      _rehash: 'rehashes'
+    };
   }
 }
 
@@ -396,24 +734,23 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
     this._sentinel.prev = this._sentinel.next = this._head = this._tail = this._sentinel;
 
     if (options) {
-      const { hashFn, objHashFn, toEntryFn } = options;
+      const { hashFn, objHashFn, toEntryFn, initialCapacity } = options;
       if (hashFn) this._hashFn = hashFn;
       if (objHashFn) this._objHashFn = objHashFn;
 
       if (toEntryFn) {
         this._toEntryFn = toEntryFn;
       }
+
+      if (initialCapacity !== undefined) this._noObjMap.reserve(initialCapacity);
     }
 
     if (rawCollection) {
-      for (const el of rawCollection) {
-        const [key, value] = this.toEntryFn(el);
-        this.set(key, value);
-      }
+      this.bulkLoad(rawCollection);
     }
   }
 
-  protected _hashFn: (key: K) => string = (key: K) => String(key);
+  protected _hashFn: (key: K) => string = defaultHashFn;
 
   /**
    * The function returns the hash function used for generating a hash value for a given key.
@@ -433,15 +770,14 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
     return this._objHashFn;
   }
 
-  protected _noObjMap: Record<string, HashMapLinkedNode<K, V | undefined>> = {};
+  protected _noObjMap = new HashMap<unknown, HashMapLinkedNode<K, V | undefined>>();
 
   /**
-   * The function returns a record of HashMapLinkedNode objects with string keys.
-   * @returns The method is returning a Record object, which is a TypeScript type that represents an
-   * object with string keys and values that are HashMapLinkedNode objects with keys of type K and
-   * values of type V or undefined.
+   * The function returns the HashMap that indexes the nodes of non-object keys. With the default
+   * `hashFn` it is keyed by the keys themselves, otherwise by the result of `hashFn`.
+   * @returns The `noObjMap` property is being returned.
    */
-  get noObjMap(): Record<string, HashMapLinkedNode<K, V | undefined>> {
+  get noObjMap(): HashMap<unknown, HashMapLinkedNode<K, V | undefined>> {
     return this._noObjMap;
   }
 
@@ -583,45 +919,43 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
    */
   set(key: K, value?: V): boolean {
     let node;
-    const isNewKey = !this.has(key); // Check if the key is new
 
     if (isWeakKey(key)) {
       const hash = this.objHashFn(key);
       node = this.objMap.get(hash);
 
-      if (!node && isNewKey) {
-        // Create new node
-        node = { key: <K>hash, value, prev: this.tail, next: this._sentinel };
-        this.objMap.set(hash, node);
-      } else if (node) {
+      if (node) {
         // Update the value of an existing node
         node.value = value;
+        return true;
       }
+      // Create new node
+      node = this._createNode(<K>hash, value);
+      this.objMap.set(hash, node);
     } else {
-      const hash = this.hashFn(key);
-      node = this.noObjMap[hash];
+      const hash = this._getNoObjKey(key);
+      node = this.noObjMap.get(hash);
 
-      if (!node && isNewKey) {
-        this.noObjMap[hash] = node = { key, value, prev: this.tail, next: this._sentinel };
-      } else if (node) {
+      if (node) {
         // Update the value of an existing node
         node.value = value;
+        return true;
       }
+      node = this._createNode(key, value);
+      this.noObjMap.set(hash, node);
     }
 
-    if (node && isNewKey) {
-      // Update the head and tail of the linked list
-      if (this._size === 0) {
-        this._head = node;
-        this._sentinel.next = node;
-      } else {
-        this.tail.next = node;
-        node.prev = this.tail; // Make sure that the prev of the new node points to the current tail node
-      }
-      this._tail = node;
-      this._sentinel.prev = node;
-      this._size++;
+    // Update the head and tail of the linked list
+    if (this._size === 0) {
+      this._head = node;
+      this._sentinel.next = node;
+    } else {
+      this.tail.next = node;
+      node.prev = this.tail; // Make sure that the prev of the new node points to the current tail node
     }
+    this._tail = node;
+    this._sentinel.prev = node;
+    this._size++;
 
     return true;
   }
@@ -643,6 +977,41 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
     return results;
   }
 
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   */
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `bulkLoad` function sets every element of a collection without collecting per-element
+   * results. When the collection is an array or exposes a numeric `size`, the key index is grown once
+   * up front instead of rehashing repeatedly while it fills.
+   * @param rawCollection - An iterable of raw elements converted with `toEntryFn`.
+   */
+  bulkLoad(rawCollection: Iterable<R>): void {
+    const sizeHint = getSizeHint(rawCollection);
+    if (sizeHint > 0) this.reserve(this._noObjMap.size + sizeHint);
+    for (const rawEle of rawCollection) {
+      const [key, value] = this.toEntryFn(rawEle);
+      this.set(key, value);
+    }
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `reserve` function grows the key index so that it can hold `capacity` non-object keys without
+   * rehashing.
+   * @param {number} capacity - The number of entries to make room for.
+   */
+  reserve(capacity: number): void {
+    this._noObjMap.reserve(capacity);
+  }
+
   /**
    * The function checks if a given key exists in a map, using different logic depending on whether the
    * key is a weak key or not.
@@ -654,8 +1023,7 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
       const hash = this.objHashFn(key);
       return this.objMap.has(hash);
     } else {
-      const hash = this.hashFn(key);
-      return hash in this.noObjMap;
+      return this.noObjMap.has(this._getNoObjKey(key));
     }
   }
 
@@ -683,8 +1051,7 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
       const node = this.objMap.get(hash);
       return node ? node.value : undefined;
     } else {
-      const hash = this.hashFn(key);
-      const node = this.noObjMap[hash];
+      const node = this.noObjMap.get(this._getNoObjKey(key));
       return node ? node.value : undefined;
     }
   }
@@ -744,16 +1111,16 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
       // Remove nodes from WeakMap
       this.objMap.delete(hash);
     } else {
-      const hash = this.hashFn(key);
+      const hash = this._getNoObjKey(key);
       // Get nodes from noObjMap
-      node = this.noObjMap[hash];
+      node = this.noObjMap.get(hash);
 
       if (!node) {
         return false; // If the node does not exist, return false
       }
 
-      // Remove nodes from orgMap
-      delete this.noObjMap[hash];
+      // Remove nodes from noObjMap
+      this.noObjMap.delete(hash);
     }
 
     // Remove node from doubly linked list
@@ -781,7 +1148,7 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
     while (index--) {
       node = node.next;
     }
-    return this._deleteNode(node);
+    return this.delete(node.key);
   }
 
   /**
@@ -823,7 +1190,8 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
    * The `clear` function clears all the entries in a data structure and resets its properties.
    */
   clear(): void {
-    this._noObjMap = {};
+    this._noObjMap.clear();
+    this._objMap = new WeakMap<object, HashMapLinkedNode<K, V | undefined>>();
     this._size = 0;
     this._head = this._tail = this._sentinel.prev = this._sentinel.next = this._sentinel;
   }
@@ -843,7 +1211,11 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
    * of the original `LinkedHashMap` object.
    */
   clone(): LinkedHashMap<K, V> {
-    const cloned = new LinkedHashMap<K, V>([], { hashFn: this.hashFn, objHashFn: this.objHashFn });
+    const cloned = new LinkedHashMap<K, V>([], {
+      hashFn: this.hashFn,
+      objHashFn: this.objHashFn,
+      initialCapacity: this._noObjMap.size
+    });
     for (const entry of this) {
       const [key, value] = entry;
       cloned.set(key, value);
@@ -957,6 +1329,67 @@ export class LinkedHashMap<K = any, V = any, R = [K, V]> extends IterableEntryBa
     }
   }
 
+  /**
+   * The function looks up the node of a key with a single index lookup.
+   * @param {K} key - The key to look up.
+   * @returns the node holding the key, or `undefined` if the key is absent.
+   */
+  protected _getNode(key: K): HashMapLinkedNode<K, V | undefined> | undefined {
+    if (isWeakKey(key)) return this.objMap.get(this.objHashFn(key));
+    return this.noObjMap.get(this._getNoObjKey(key));
+  }
+
+  /**
+   * The function creates the node of a new entry, linked after the current tail. Subclasses override
+   * it to give nodes extra fields up front, which keeps every node the same shape.
+   * @param {K} key - The key of the entry.
+   * @param {V} [value] - The value of the entry.
+   * @returns a new node.
+   */
+  protected _createNode(key: K, value?: V): HashMapLinkedNode<K, V | undefined> {
+    return { key, value, prev: this.tail, next: this._sentinel };
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function moves a node to the tail of the list, making it the most recently inserted entry.
+   * @param node - The node to move.
+   */
+  protected _moveToTail(node: HashMapLinkedNode<K, V | undefined>): void {
+    if (node === this._tail) return;
+    const { prev, next } = node;
+    prev.next = next;
+    next.prev = prev;
+    if (node === this._head) this._head = next;
+
+    node.prev = this._tail;
+    node.next = this._sentinel;
+    this._tail.next = node;
+    this._sentinel.prev = node;
+    this._tail = node;
+  }
+
+  /**
+   * The function returns the key a non-object key is indexed by in `noObjMap`: the key itself with the
+   * default `hashFn`, so numbers and strings avoid string conversion, or the result of a custom
+   * `hashFn`.
+   * @param {K} key - The non-object key.
+   * @returns the index key.
+   */
+  protected _getNoObjKey(key: K): unknown {
+    return this._hashFn === defaultHashFn ? key : this._hashFn(key);
+  }
+
+  /**
+   * The function counts the lookups of non-object keys, each of which costs a key hash.
+   * @returns The methods `enableStats` wraps.
+   */
+  protected override _instrumentedMethods(): InstrumentedMethods {
+    return { ...super._instrumentedMethods(), _getNoObjKey: 'keyHashes' };
+  }
+
   /**
    * Time Complexity: O(1)
    * Space Complexity: O(1)
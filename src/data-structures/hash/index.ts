@@ -1 +1,4 @@
 export * from './hash-map';
+export * from './lru-cache';
+export * from './lfu-cache';
+export * from './persistent-hash-map';
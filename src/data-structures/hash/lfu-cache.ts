@@ -0,0 +1,454 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type {
+  CacheEvictCallback,
+  CacheEvictionReason,
+  EntryCallback,
+  LFUCacheBucket,
+  LFUCacheNode,
+  LFUCacheOptions
+} from '../../types';
+import { IterableEntryBase } from '../base';
+import { HashMap } from './hash-map';
+
+/**
+ * 1. Bounded Map: An LFUCache holds at most `maxSize` entries and evicts the least frequently used entry when it is full. Ties go to the least recently used entry.
+ * 2. Frequency Buckets: Entries with the same access count share a bucket, and buckets are linked in ascending frequency, so a hit and an eviction are O(1) pointer updates after a single key lookup.
+ * 3. Lazy Expiry: With a `ttl`, an expired entry is removed when it is next accessed, or by `prune`.
+ * 4. Iteration Order: Entries are iterated from the least to the most frequently used.
+ */
+export class LFUCache<K = any, V = any, R = [K, V]> extends IterableEntryBase<K, V | undefined> {
+  /**
+   * The constructor initializes an LFUCache with an optional raw collection and options.
+   * @param rawCollection - An iterable of raw elements added in order, converted with `toEntryFn`.
+   * @param [options] - `hashFn` and `toEntryFn` as for HashMap, `maxSize` bounds the cache, `ttl`
+   * gives entries a lifetime in milliseconds and `onEvict` is called for every evicted or expired entry.
+   */
+  constructor(rawCollection: Iterable<R> = [], options?: LFUCacheOptions<K, V, R>) {
+    super();
+    this._sentinel = <LFUCacheBucket<K, V | undefined>>{ frequency: 0, head: undefined, tail: undefined };
+    this._sentinel.prev = this._sentinel.next = this._sentinel;
+
+    if (options) {
+      const { hashFn, toEntryFn, maxSize, ttl, onEvict } = options;
+      if (hashFn) this._nodes = new HashMap<K, LFUCacheNode<K, V | undefined>>([], { hashFn });
+      if (toEntryFn) this._toEntryFn = toEntryFn;
+      if (maxSize !== undefined) this._maxSize = maxSize;
+      if (ttl !== undefined) this._ttl = ttl;
+      if (onEvict) this._onEvict = onEvict;
+    }
+
+    if (rawCollection) {
+      for (const rawEle of rawCollection) {
+        const [key, value] = this.toEntryFn(rawEle);
+        this.set(key, value);
+      }
+    }
+  }
+
+  // Head of the circular bucket list; `_sentinel.next` is the least frequent bucket
+  protected readonly _sentinel: LFUCacheBucket<K, V | undefined>;
+
+  protected _nodes = new HashMap<K, LFUCacheNode<K, V | undefined>>();
+
+  protected _toEntryFn: (rawElement: R) => [K, V] = (rawElement: R) => {
+    if (Array.isArray(rawElement) && rawElement.length === 2) return <[K, V]>(<unknown>rawElement);
+    throw new Error(
+      "If the provided rawCollection does not adhere to the [key, value] type format, the toEntryFn in the constructor's options parameter needs to specified."
+    );
+  };
+
+  /**
+   * The function returns the value of the _toEntryFn property.
+   * @returns The function being returned is `this._toEntryFn`.
+   */
+  get toEntryFn() {
+    return this._toEntryFn;
+  }
+
+  /**
+   * The function returns the number of entries in the cache, including expired entries that have not
+   * been accessed since they expired.
+   * @returns The size of the cache.
+   */
+  get size(): number {
+    return this._nodes.size;
+  }
+
+  protected _maxSize = Infinity;
+
+  /**
+   * The function returns the maximum number of entries the cache holds.
+   * @returns The `maxSize` property is being returned.
+   */
+  get maxSize(): number {
+    return this._maxSize;
+  }
+
+  protected _ttl = Infinity;
+
+  /**
+   * The function returns the default lifetime of an entry in milliseconds.
+   * @returns The `ttl` property is being returned.
+   */
+  get ttl(): number {
+    return this._ttl;
+  }
+
+  protected _onEvict: CacheEvictCallback<K, V> | undefined = undefined;
+
+  /**
+   * The function returns the callback invoked for evicted and expired entries.
+   * @returns The `onEvict` property is being returned.
+   */
+  get onEvict(): CacheEvictCallback<K, V> | undefined {
+    return this._onEvict;
+  }
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
+   * The `set` function adds or updates an entry. Updating counts as a use of the entry and restarts its
+   * lifetime. Adding to a full cache first evicts the least frequently used entry.
+   * @param {K} key - The key of the entry.
+   * @param {V} [value] - The value of the entry.
+   * @param {number} [ttl] - The lifetime of this entry in milliseconds, overriding the `ttl` option.
+   * @returns a boolean value, always `true`.
+   */
+  set(key: K, value?: V, ttl: number = this._ttl): boolean {
+    const expiresAt = ttl === Infinity ? Infinity : Date.now() + ttl;
+    const node = this._nodes.get(key);
+
+    if (node) {
+      node.value = value;
+      node.expiresAt = expiresAt;
+      this._touch(node);
+      return true;
+    }
+
+    if (this._maxSize <= 0) return true;
+    if (this._nodes.size >= this._maxSize) {
+      this._remove(this._sentinel.next.head!, 'evicted');
+    }
+
+    let bucket = this._sentinel.next;
+    if (bucket.frequency !== 1) bucket = this._insertBucket(this._sentinel, 1);
+    const added: LFUCacheNode<K, V | undefined> = {
+      key,
+      value,
+      expiresAt,
+      bucket,
+      prev: undefined,
+      next: undefined
+    };
+    this._append(bucket, added);
+    this._nodes.set(key, added);
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
+   * The `get` function returns the value of an entry and counts the access. An expired entry is
+   * removed instead.
+   * @param {K} key - The key to look up.
+   * @returns the value of the entry, or `undefined` if it is absent or expired.
+   */
+  override get(key: K): V | undefined {
+    const node = this._getLiveNode(key);
+    if (!node) return;
+    this._touch(node);
+    return node.value;
+  }
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
+   * The `peek` function returns the value of an entry without counting the access.
+   * @param {K} key - The key to look up.
+   * @returns the value of the entry, or `undefined` if it is absent or expired.
+   */
+  peek(key: K): V | undefined {
+    const node = this._getLiveNode(key);
+    return node ? node.value : undefined;
+  }
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
+   * The function checks if an unexpired entry exists for a key, without counting the access.
+   * @param {K} key - The key to look up.
+   * @returns a boolean value.
+   */
+  override has(key: K): boolean {
+    return this._getLiveNode(key) !== undefined;
+  }
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
+   * The `frequency` function returns how many times an entry has been used since it was added.
+   * @param {K} key - The key to look up.
+   * @returns the access count of the entry, or 0 if it is absent or expired.
+   */
+  frequency(key: K): number {
+    const node = this._getLiveNode(key);
+    return node ? node.bucket.frequency : 0;
+  }
+
+  /**
+   * Time Complexity: O(1) average
+   * Space Complexity: O(1)
+   *
+   * The `delete` function removes an entry without calling `onEvict`.
+   * @param {K} key - The key to remove.
+   * @returns `true` if the key was found and removed, `false` otherwise.
+   */
+  delete(key: K): boolean {
+    const node = this._nodes.get(key);
+    if (!node) return false;
+    this._nodes.delete(key);
+    this._unlink(node);
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The `prune` function removes every expired entry and reports it to `onEvict`.
+   * @returns the number of entries removed.
+   */
+  prune(): number {
+    const now = Date.now();
+    let removed = 0;
+    let bucket = this._sentinel.next;
+    while (bucket !== this._sentinel) {
+      const nextBucket = bucket.next;
+      let node = bucket.head;
+      while (node) {
+        const next = node.next;
+        if (node.expiresAt <= now) {
+          this._remove(node, 'expired');
+          removed++;
+        }
+        node = next;
+      }
+      bucket = nextBucket;
+    }
+    return removed;
+  }
+
+  /**
+   * The function checks if the cache is empty.
+   * @returns a boolean value.
+   */
+  isEmpty(): boolean {
+    return this._nodes.size === 0;
+  }
+
+  /**
+   * The `clear` function removes all entries without calling `onEvict`.
+   */
+  clear(): void {
+    this._nodes.clear();
+    this._sentinel.prev = this._sentinel.next = this._sentinel;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `clone` function creates a cache with the same options, entries and access counts.
+   * @returns a new `LFUCache`.
+   */
+  clone(): LFUCache<K, V, R> {
+    const cloned = this._createLike<V>();
+    let bucket = this._sentinel.next;
+    while (bucket !== this._sentinel) {
+      const copy = cloned._insertBucket(cloned._sentinel.prev, bucket.frequency);
+      for (let node = bucket.head; node; node = node.next) {
+        const added: LFUCacheNode<K, V | undefined> = {
+          key: node.key,
+          value: node.value,
+          expiresAt: node.expiresAt,
+          bucket: copy,
+          prev: undefined,
+          next: undefined
+        };
+        cloned._append(copy, added);
+        cloned._nodes.set(node.key, added);
+      }
+      bucket = bucket.next;
+    }
+    return cloned;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function creates a cache with the same options holding the entries that satisfy the
+   * predicate. Access counts start over.
+   * @param predicate - A function called with `value`, `key`, `index` and the cache.
+   * @param {any} [thisArg] - The value of `this` within the predicate.
+   * @returns a new `LFUCache`.
+   */
+  filter(predicate: EntryCallback<K, V | undefined, boolean>, thisArg?: any): LFUCache<K, V, R> {
+    const filtered = this._createLike<V>();
+    let index = 0;
+    for (const [key, value] of this) {
+      if (predicate.call(thisArg, value, key, index++, this)) filtered.set(key, value);
+    }
+    return filtered;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function creates a cache with the same options whose values are produced by the
+   * callback. Access counts start over.
+   * @param callback - A function called with `value`, `key`, `index` and the cache.
+   * @param {any} [thisArg] - The value of `this` within the callback.
+   * @returns a new `LFUCache`.
+   */
+  map<NV>(callback: EntryCallback<K, V | undefined, NV>, thisArg?: any): LFUCache<K, NV, [K, NV]> {
+    const mapped = this._createLike<NV>();
+    let index = 0;
+    for (const [key, value] of this) {
+      mapped.set(key, callback.call(thisArg, value, key, index++, this));
+    }
+    return mapped;
+  }
+
+  /**
+   * The function iterates over the entries from the least to the most frequently used, and within
+   * one frequency from the least to the most recently used.
+   */
+  protected* _getIterator(): IterableIterator<[K, V | undefined]> {
+    for (let bucket = this._sentinel.next; bucket !== this._sentinel; bucket = bucket.next) {
+      for (let node = bucket.head; node; node = node.next) {
+        yield [node.key, node.value];
+      }
+    }
+  }
+
+  /**
+   * The function creates an empty cache with the same options.
+   * @returns a new, empty `LFUCache`.
+   */
+  protected _createLike<NV>(): LFUCache<K, NV, any> {
+    return new LFUCache<K, NV, any>([], {
+      hashFn: this._nodes.hashFn,
+      maxSize: this._maxSize,
+      ttl: this._ttl,
+      onEvict: <CacheEvictCallback<K, NV> | undefined>(<unknown>this._onEvict)
+    });
+  }
+
+  /**
+   * The function looks up the node of a key, removing it first if it has expired.
+   * @param {K} key - The key to look up.
+   * @returns the node, or `undefined` if the key is absent or expired.
+   */
+  protected _getLiveNode(key: K): LFUCacheNode<K, V | undefined> | undefined {
+    const node = this._nodes.get(key);
+    if (!node) return;
+    if (node.expiresAt !== Infinity && node.expiresAt <= Date.now()) {
+      this._remove(node, 'expired');
+      return;
+    }
+    return node;
+  }
+
+  /**
+   * The function moves a node to the bucket of the next frequency, creating that bucket if needed.
+   * @param node - The node that was used.
+   */
+  protected _touch(node: LFUCacheNode<K, V | undefined>): void {
+    const bucket = node.bucket;
+    const frequency = bucket.frequency + 1;
+    let target = bucket.next;
+    if (target.frequency !== frequency) target = this._insertBucket(bucket, frequency);
+    this._unlink(node);
+    node.bucket = target;
+    this._append(target, node);
+  }
+
+  /**
+   * The function links a new, empty bucket after another bucket.
+   * @param after - The bucket to insert after.
+   * @param {number} frequency - The frequency of the new bucket.
+   * @returns the new bucket.
+   */
+  protected _insertBucket(after: LFUCacheBucket<K, V | undefined>, frequency: number): LFUCacheBucket<K, V | undefined> {
+    const bucket: LFUCacheBucket<K, V | undefined> = {
+      frequency,
+      head: undefined,
+      tail: undefined,
+      prev: after,
+      next: after.next
+    };
+    after.next.prev = bucket;
+    after.next = bucket;
+    return bucket;
+  }
+
+  /**
+   * The function appends a node to the tail of a bucket.
+   * @param bucket - The bucket to append to.
+   * @param node - The node to append.
+   */
+  protected _append(bucket: LFUCacheBucket<K, V | undefined>, node: LFUCacheNode<K, V | undefined>): void {
+    node.prev = bucket.tail;
+    node.next = undefined;
+    if (bucket.tail) bucket.tail.next = node;
+    else bucket.head = node;
+    bucket.tail = node;
+  }
+
+  /**
+   * The function unlinks a node from its bucket and drops the bucket once it is empty.
+   * @param node - The node to unlink.
+   */
+  protected _unlink(node: LFUCacheNode<K, V | undefined>): void {
+    const { bucket, prev, next } = node;
+    if (prev) prev.next = next;
+    else bucket.head = next;
+    if (next) next.prev = prev;
+    else bucket.tail = prev;
+
+    if (!bucket.head) {
+      bucket.prev.next = bucket.next;
+      bucket.next.prev = bucket.prev;
+    }
+  }
+
+  /**
+   * The function removes a node and reports it to `onEvict`.
+   * @param node - The node to remove.
+   * @param {CacheEvictionReason} reason - Why the node is removed.
+   */
+  protected _remove(node: LFUCacheNode<K, V | undefined>, reason: CacheEvictionReason): void {
+    const { key, value } = node;
+    this._nodes.delete(key);
+    this._unlink(node);
+    if (this._onEvict) this._onEvict(key, value, reason);
+  }
+}
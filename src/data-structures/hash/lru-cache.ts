@@ -0,0 +1,309 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { CacheEvictCallback, CacheEvictionReason, HashMapLinkedNode, LRUCacheNode, LRUCacheOptions } from '../../types';
+import { LinkedHashMap } from './hash-map';
+
+/**
+ * 1. Bounded Map: An LRUCache is a LinkedHashMap that holds at most `maxSize` entries, or entries whose total weight is at most `maxWeight`.
+ * 2. Recency Order: Entries are kept from least to most recently used. `get` and `set` move the entry to the tail by relinking its node, without touching the key index.
+ * 3. Eviction: When a bound is exceeded, the least recently used entries are removed from the head and reported to `onEvict`.
+ * 4. Lazy Expiry: With a `ttl`, an expired entry is removed when it is next accessed, or by `prune`.
+ */
+export class LRUCache<K = any, V = any, R = [K, V]> extends LinkedHashMap<K, V, R> {
+  /**
+   * The constructor initializes an LRUCache with an optional raw collection and options.
+   * @param rawCollection - An iterable of raw elements added in order, converted with `toEntryFn`.
+   * @param [options] - Besides the LinkedHashMap options, `maxSize` and `maxWeight` bound the cache,
+   * `weightFn` weighs each entry (1 by default), `ttl` gives entries a lifetime in milliseconds and
+   * `onEvict` is called for every evicted or expired entry.
+   */
+  constructor(rawCollection: Iterable<R> = [], options?: LRUCacheOptions<K, V, R>) {
+    super([], options);
+
+    if (options) {
+      const { maxSize, maxWeight, weightFn, ttl, onEvict } = options;
+      if (maxSize !== undefined) this._maxSize = maxSize;
+      if (maxWeight !== undefined) this._maxWeight = maxWeight;
+      if (weightFn) this._weightFn = weightFn;
+      if (ttl !== undefined) this._ttl = ttl;
+      if (onEvict) this._onEvict = onEvict;
+    }
+
+    if (rawCollection) {
+      this.bulkLoad(rawCollection);
+    }
+  }
+
+  protected _maxSize = Infinity;
+
+  /**
+   * The function returns the maximum number of entries the cache holds.
+   * @returns The `maxSize` property is being returned.
+   */
+  get maxSize(): number {
+    return this._maxSize;
+  }
+
+  protected _maxWeight = Infinity;
+
+  /**
+   * The function returns the maximum total weight of the entries the cache holds.
+   * @returns The `maxWeight` property is being returned.
+   */
+  get maxWeight(): number {
+    return this._maxWeight;
+  }
+
+  protected _weightFn: (value: V | undefined, key: K) => number = () => 1;
+
+  /**
+   * The function returns the function that weighs an entry.
+   * @returns The `weightFn` property is being returned.
+   */
+  get weightFn(): (value: V | undefined, key: K) => number {
+    return this._weightFn;
+  }
+
+  protected _ttl = Infinity;
+
+  /**
+   * The function returns the default lifetime of an entry in milliseconds.
+   * @returns The `ttl` property is being returned.
+   */
+  get ttl(): number {
+    return this._ttl;
+  }
+
+  protected _onEvict: CacheEvictCallback<K, V> | undefined = undefined;
+
+  /**
+   * The function returns the callback invoked for evicted and expired entries.
+   * @returns The `onEvict` property is being returned.
+   */
+  get onEvict(): CacheEvictCallback<K, V> | undefined {
+    return this._onEvict;
+  }
+
+  protected _weight = 0;
+
+  /**
+   * The function returns the total weight of the entries in the cache.
+   * @returns The `weight` property is being returned.
+   */
+  get weight(): number {
+    return this._weight;
+  }
+
+  /**
+   * Time Complexity: O(1) amortized
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1) amortized
+   * Space Complexity: O(1)
+   *
+   * The `set` function adds or updates an entry, marks it as the most recently used and then evicts
+   * least recently used entries until the cache is within its bounds. Updating an entry restarts its
+   * lifetime.
+   * @param {K} key - The key of the entry.
+   * @param {V} [value] - The value of the entry.
+   * @param {number} [ttl] - The lifetime of this entry in milliseconds, overriding the `ttl` option.
+   * @returns a boolean value, always `true`.
+   */
+  override set(key: K, value?: V, ttl: number = this._ttl): boolean {
+    const weight = this._weightFn(value, key);
+    let node = this._getNode(key) as LRUCacheNode<K, V | undefined> | undefined;
+
+    if (node) {
+      node.value = value;
+      this._weight += weight - node.weight;
+      this._moveToTail(node);
+    } else {
+      super.set(key, value);
+      node = this.tail as LRUCacheNode<K, V | undefined>;
+      this._weight += weight;
+    }
+    node.weight = weight;
+    node.expiresAt = ttl === Infinity ? Infinity : Date.now() + ttl;
+
+    this._evict();
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `get` function returns the value of an entry and marks it as the most recently used. An
+   * expired entry is removed instead.
+   * @param {K} key - The key to look up.
+   * @returns the value of the entry, or `undefined` if it is absent or expired.
+   */
+  override get(key: K): V | undefined {
+    const node = this._getLiveNode(key);
+    if (!node) return;
+    this._moveToTail(node);
+    return node.value;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `peek` function returns the value of an entry without changing its recency.
+   * @param {K} key - The key to look up.
+   * @returns the value of the entry, or `undefined` if it is absent or expired.
+   */
+  peek(key: K): V | undefined {
+    const node = this._getLiveNode(key);
+    return node ? node.value : undefined;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function checks if an unexpired entry exists for a key, without changing its recency.
+   * @param {K} key - The key to look up.
+   * @returns a boolean value.
+   */
+  override has(key: K): boolean {
+    return this._getLiveNode(key) !== undefined;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `delete` function removes an entry without calling `onEvict`.
+   * @param {K} key - The key to remove.
+   * @returns `true` if the key was found and removed, `false` otherwise.
+   */
+  override delete(key: K): boolean {
+    const node = this._getNode(key) as LRUCacheNode<K, V | undefined> | undefined;
+    if (!node) return false;
+    this._weight -= node.weight;
+    return super.delete(key);
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The `prune` function removes every expired entry and reports it to `onEvict`.
+   * @returns the number of entries removed.
+   */
+  prune(): number {
+    const now = Date.now();
+    let removed = 0;
+    let node = this.head as LRUCacheNode<K, V | undefined>;
+    while (node !== this._sentinel) {
+      const next = node.next as LRUCacheNode<K, V | undefined>;
+      if (node.expiresAt <= now) {
+        this._remove(node, 'expired');
+        removed++;
+      }
+      node = next;
+    }
+    return removed;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `clear` function removes all entries without calling `onEvict`.
+   */
+  override clear(): void {
+    super.clear();
+    this._weight = 0;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `clone` function creates a cache with the same options and entries, in the same recency order.
+   * @returns a new `LRUCache`.
+   */
+  override clone(): LRUCache<K, V, R> {
+    const cloned = new LRUCache<K, V, R>([], {
+      hashFn: this.hashFn,
+      objHashFn: this.objHashFn,
+      initialCapacity: this.noObjMap.size,
+      maxSize: this._maxSize,
+      maxWeight: this._maxWeight,
+      weightFn: this._weightFn,
+      ttl: this._ttl,
+      onEvict: this._onEvict
+    });
+    let node = this.head as LRUCacheNode<K, V | undefined>;
+    while (node !== this._sentinel) {
+      cloned.set(node.key, node.value);
+      (cloned.tail as LRUCacheNode<K, V | undefined>).expiresAt = node.expiresAt;
+      node = node.next as LRUCacheNode<K, V | undefined>;
+    }
+    return cloned;
+  }
+
+  /**
+   * The function creates a node with its weight and expiry fields in place.
+   * @param {K} key - The key of the entry.
+   * @param {V} [value] - The value of the entry.
+   * @returns a new node.
+   */
+  protected override _createNode(key: K, value?: V): HashMapLinkedNode<K, V | undefined> {
+    const node: LRUCacheNode<K, V | undefined> = {
+      key,
+      value,
+      prev: this.tail,
+      next: this._sentinel,
+      weight: 0,
+      expiresAt: Infinity
+    };
+    return node;
+  }
+
+  /**
+   * The function looks up the node of a key, removing it first if it has expired.
+   * @param {K} key - The key to look up.
+   * @returns the node, or `undefined` if the key is absent or expired.
+   */
+  protected _getLiveNode(key: K): LRUCacheNode<K, V | undefined> | undefined {
+    const node = this._getNode(key) as LRUCacheNode<K, V | undefined> | undefined;
+    if (!node) return;
+    if (node.expiresAt !== Infinity && node.expiresAt <= Date.now()) {
+      this._remove(node, 'expired');
+      return;
+    }
+    return node;
+  }
+
+  /**
+   * The function evicts least recently used entries until the cache is within `maxSize` and
+   * `maxWeight`.
+   */
+  protected _evict(): void {
+    while (this._size > 0 && (this._size > this._maxSize || this._weight > this._maxWeight)) {
+      this._remove(this.head as LRUCacheNode<K, V | undefined>, 'evicted');
+    }
+  }
+
+  /**
+   * The function removes a node and reports it to `onEvict`.
+   * @param node - The node to remove.
+   * @param {CacheEvictionReason} reason - Why the node is removed.
+   */
+  protected _remove(node: LRUCacheNode<K, V | undefined>, reason: CacheEvictionReason): void {
+    const { key, value } = node;
+    this._weight -= node.weight;
+    super.delete(key);
+    if (this._onEvict) this._onEvict(key, value, reason);
+  }
+}
@@ -0,0 +1,440 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { EntryCallback } from '../../types';
+import { IterableEntryBase } from '../base';
+import { hashNumber, hashString, isWeakKey } from '../../utils';
+
+export class PersistentHashMapLeaf<K = any, V = any> {
+  // Leaves are never changed once created, so they can always be shared
+  readonly hash: number;
+  readonly key: K;
+  readonly value: V;
+
+  constructor(hash: number, key: K, value: V) {
+    this.hash = hash;
+    this.key = key;
+    this.value = value;
+  }
+}
+
+export class PersistentHashMapBranch<K = any, V = any> {
+  // Bit i is set when the 5-bit hash chunk i has a child; children are stored in bit order
+  bitmap: number;
+  children: PersistentHashMapChild<K, V>[];
+  owner: object;
+
+  constructor(bitmap: number, children: PersistentHashMapChild<K, V>[], owner: object) {
+    this.bitmap = bitmap;
+    this.children = children;
+    this.owner = owner;
+  }
+}
+
+export class PersistentHashMapCollision<K = any, V = any> {
+  // Leaves whose keys differ but whose 32-bit hashes are equal
+  hash: number;
+  leaves: PersistentHashMapLeaf<K, V>[];
+  owner: object;
+
+  constructor(hash: number, leaves: PersistentHashMapLeaf<K, V>[], owner: object) {
+    this.hash = hash;
+    this.leaves = leaves;
+    this.owner = owner;
+  }
+}
+
+export type PersistentHashMapChild<K, V> =
+  | PersistentHashMapLeaf<K, V>
+  | PersistentHashMapBranch<K, V>
+  | PersistentHashMapCollision<K, V>;
+
+const objectIds = new WeakMap<object, number>();
+let nextObjectId = 0;
+
+// Smi-safe population count of a 32-bit word
+const popCount = (x: number): number => {
+  x = x - ((x >>> 1) & 0x55555555);
+  x = (x & 0x33333333) + ((x >>> 2) & 0x33333333);
+  x = (x + (x >>> 4)) & 0x0f0f0f0f;
+  return Math.imul(x, 0x01010101) >>> 24;
+};
+
+/**
+ * A hash array mapped trie (HAMT) whose versions share structure.
+ * 1. Keys are compared like `Map` does (SameValueZero). Numbers and strings are hashed by value, objects by identity.
+ * 2. Each level consumes 5 bits of the hash, so a branch has up to 32 children packed by a bitmap.
+ * 3. `snapshot` (and `clone`) is O(1); an update copies only the branches on its path, at most 7 of them.
+ * 4. Branches created since the last snapshot belong to the map and are changed in place.
+ */
+export class PersistentHashMap<K = any, V = any> extends IterableEntryBase<K, V> {
+  /**
+   * The constructor function initializes a PersistentHashMap with an optional collection of entries.
+   * @param entries - An iterable of `[key, value]` pairs to add to the map.
+   */
+  constructor(entries: Iterable<[K, V]> = []) {
+    super();
+    if (entries) {
+      for (const [key, value] of entries) this.set(key, value);
+    }
+  }
+
+  protected _owner: object = {};
+
+  protected _root: PersistentHashMapBranch<K, V> = new PersistentHashMapBranch<K, V>(0, [], this._owner);
+
+  /**
+   * The function returns the root branch, which may be shared with other snapshots and must not be changed.
+   * @returns The root branch.
+   */
+  get root(): PersistentHashMapBranch<K, V> {
+    return this._root;
+  }
+
+  protected _size: number = 0;
+
+  /**
+   * The function returns the number of entries in the map.
+   * @returns The size of the map.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `snapshot` function returns a map that shares every branch with this one. Later updates on either side
+   * copy their path, so the other side keeps its contents.
+   * @returns A new PersistentHashMap with the same entries.
+   */
+  snapshot(): PersistentHashMap<K, V> {
+    const map = this._createInstance();
+    map._root = this._root;
+    map._size = this._size;
+    this._owner = {};
+    return map;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function checks whether the map is empty.
+   * @returns True if the map has no entries.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function removes every entry. Snapshots taken earlier keep theirs.
+   */
+  clear(): void {
+    this._root = new PersistentHashMapBranch<K, V>(0, [], this._owner);
+    this._size = 0;
+  }
+
+  /**
+   * Time Complexity: O(1) average, at most 7 levels
+   * Space Complexity: O(1)
+   *
+   * The function returns the value stored under a key.
+   * @param {K} key - The key to look for.
+   * @returns The value, or undefined if the key is absent.
+   */
+  override get(key: K): V | undefined {
+    return this._getLeaf(key)?.value;
+  }
+
+  /**
+   * Time Complexity: O(1) average, at most 7 levels
+   * Space Complexity: O(1)
+   *
+   * The function checks whether a key is in the map.
+   * @param {K} key - The key to look for.
+   * @returns True if the key is present.
+   */
+  override has(key: K): boolean {
+    return this._getLeaf(key) !== undefined;
+  }
+
+  /**
+   * Time Complexity: O(1) average, at most 7 levels
+   * Space Complexity: O(1) average
+   *
+   * The `set` function adds a key or replaces its value, copying the shared branches on the way down.
+   * @param {K} key - The key to add.
+   * @param {V} value - The value to store under the key.
+   * @returns True, like HashMap.
+   */
+  set(key: K, value: V): boolean {
+    const hash = this._hash(key);
+    this._root = this._setIn(this._root, 0, new PersistentHashMapLeaf(hash, key, value)) as PersistentHashMapBranch<
+      K,
+      V
+    >;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1) average, at most 7 levels
+   * Space Complexity: O(1) average
+   *
+   * The `delete` function removes a key. Branches left with a single leaf are folded into their parent, so the
+   * shape only depends on the keys in the map.
+   * @param {K} key - The key to remove.
+   * @returns True if the key was present.
+   */
+  delete(key: K): boolean {
+    const size = this._size;
+    const root = this._deleteIn(this._root, 0, this._hash(key), key);
+    this._root = (root as PersistentHashMapBranch<K, V>) ?? new PersistentHashMapBranch<K, V>(0, [], this._owner);
+    return this._size < size;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The clone function is the same as `snapshot`: the copy shares the branches and costs O(1).
+   * @returns A new PersistentHashMap with the same entries.
+   */
+  clone(): PersistentHashMap<K, V> {
+    return this.snapshot();
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function creates a new map with the entries that pass a predicate.
+   * @param predicate - Called with `(value, key, index, map)`.
+   * @param {any} [thisArg] - The value to use as `this` inside the predicate.
+   * @returns A new PersistentHashMap.
+   */
+  filter(predicate: EntryCallback<K, V, boolean>, thisArg?: any): PersistentHashMap<K, V> {
+    const map = this._createInstance();
+    let index = 0;
+    for (const [key, value] of this) {
+      if (predicate.call(thisArg, value, key, index++, this)) map.set(key, value);
+    }
+    return map;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function creates a new map with the same keys and mapped values.
+   * @param callbackfn - Called with `(value, key, index, map)`.
+   * @param {any} [thisArg] - The value to use as `this` inside the callback.
+   * @returns A new PersistentHashMap.
+   */
+  map<NV>(callbackfn: EntryCallback<K, V, NV>, thisArg?: any): PersistentHashMap<K, NV> {
+    const map = new PersistentHashMap<K, NV>();
+    let index = 0;
+    for (const [key, value] of this) map.set(key, callbackfn.call(thisArg, value, key, index++, this));
+    return map;
+  }
+
+  /**
+   * The function yields the entries in hash order.
+   */
+  protected* _getIterator(): IterableIterator<[K, V]> {
+    const stack: PersistentHashMapChild<K, V>[] = [this._root];
+    while (stack.length > 0) {
+      const node = stack.pop()!;
+      if (node instanceof PersistentHashMapLeaf) {
+        yield [node.key, node.value];
+      } else if (node instanceof PersistentHashMapBranch) {
+        for (let i = node.children.length - 1; i >= 0; i--) stack.push(node.children[i]);
+      } else {
+        for (const leaf of node.leaves) yield [leaf.key, leaf.value];
+      }
+    }
+  }
+
+  // Keeps the subclass, and with it an overridden _hash, in snapshots
+  protected _createInstance(): PersistentHashMap<K, V> {
+    return new (this.constructor as new () => PersistentHashMap<K, V>)();
+  }
+
+  /**
+   * The function hashes a key to 32 bits. Objects get a sequential id the first time they are seen.
+   * @param {K} key - The key to hash.
+   * @returns a 32-bit integer hash.
+   */
+  protected _hash(key: K): number {
+    if (typeof key === 'number') return hashNumber(key);
+    if (typeof key === 'string') return hashString(key);
+    if (isWeakKey(key)) {
+      let id = objectIds.get(key);
+      if (id === undefined) objectIds.set(key, (id = nextObjectId++));
+      return hashNumber(id);
+    }
+    return hashString(typeof key + ':' + String(key));
+  }
+
+  protected _isSameKey(a: K, b: K): boolean {
+    return a === b || (a !== a && b !== b);
+  }
+
+  protected _getLeaf(key: K): PersistentHashMapLeaf<K, V> | undefined {
+    const hash = this._hash(key);
+    let node: PersistentHashMapChild<K, V> = this._root;
+    for (let shift = 0; ; shift += 5) {
+      if (node instanceof PersistentHashMapBranch) {
+        const bit = 1 << ((hash >>> shift) & 31);
+        if ((node.bitmap & bit) === 0) return undefined;
+        node = node.children[popCount(node.bitmap & (bit - 1))];
+      } else if (node instanceof PersistentHashMapLeaf) {
+        return node.hash === hash && this._isSameKey(node.key, key) ? node : undefined;
+      } else {
+        if (node.hash !== hash) return undefined;
+        for (const leaf of node.leaves) if (this._isSameKey(leaf.key, key)) return leaf;
+        return undefined;
+      }
+    }
+  }
+
+  protected _ownBranch(branch: PersistentHashMapBranch<K, V>): PersistentHashMapBranch<K, V> {
+    if (branch.owner === this._owner) return branch;
+    return new PersistentHashMapBranch<K, V>(branch.bitmap, branch.children.slice(), this._owner);
+  }
+
+  protected _setIn(
+    node: PersistentHashMapChild<K, V>,
+    shift: number,
+    leaf: PersistentHashMapLeaf<K, V>
+  ): PersistentHashMapChild<K, V> {
+    if (node instanceof PersistentHashMapBranch) {
+      const bit = 1 << ((leaf.hash >>> shift) & 31);
+      const index = popCount(node.bitmap & (bit - 1));
+      if ((node.bitmap & bit) === 0) {
+        const branch = this._ownBranch(node);
+        branch.children.splice(index, 0, leaf);
+        branch.bitmap |= bit;
+        this._size++;
+        return branch;
+      }
+      const child = node.children[index];
+      const next = this._setIn(child, shift + 5, leaf);
+      if (next === child) return node;
+      const branch = this._ownBranch(node);
+      branch.children[index] = next;
+      return branch;
+    }
+
+    if (node instanceof PersistentHashMapLeaf) {
+      if (node.hash === leaf.hash && this._isSameKey(node.key, leaf.key)) {
+        return node.value === leaf.value ? node : leaf;
+      }
+      this._size++;
+      if (node.hash === leaf.hash) return new PersistentHashMapCollision<K, V>(leaf.hash, [node, leaf], this._owner);
+      return this._pair(shift, node, node.hash, leaf);
+    }
+
+    if (node.hash !== leaf.hash) {
+      this._size++;
+      return this._pair(shift, node, node.hash, leaf);
+    }
+    const leaves = node.leaves;
+    for (let i = 0; i < leaves.length; i++) {
+      if (this._isSameKey(leaves[i].key, leaf.key)) {
+        if (leaves[i].value === leaf.value) return node;
+        const collision = this._ownCollision(node);
+        collision.leaves[i] = leaf;
+        return collision;
+      }
+    }
+    const collision = this._ownCollision(node);
+    collision.leaves.push(leaf);
+    this._size++;
+    return collision;
+  }
+
+  protected _ownCollision(collision: PersistentHashMapCollision<K, V>): PersistentHashMapCollision<K, V> {
+    if (collision.owner === this._owner) return collision;
+    return new PersistentHashMapCollision<K, V>(collision.hash, collision.leaves.slice(), this._owner);
+  }
+
+  // Builds the branches that separate an existing node from a leaf with a different hash
+  protected _pair(
+    shift: number,
+    node: PersistentHashMapChild<K, V>,
+    nodeHash: number,
+    leaf: PersistentHashMapLeaf<K, V>
+  ): PersistentHashMapBranch<K, V> {
+    const a = (nodeHash >>> shift) & 31;
+    const b = (leaf.hash >>> shift) & 31;
+    if (a === b) {
+      return new PersistentHashMapBranch<K, V>(1 << a, [this._pair(shift + 5, node, nodeHash, leaf)], this._owner);
+    }
+    return new PersistentHashMapBranch<K, V>(
+      (1 << a) | (1 << b),
+      a < b ? [node, leaf] : [leaf, node],
+      this._owner
+    );
+  }
+
+  // Returns the node unchanged when the key is absent and undefined when the node becomes empty. Like _setIn it
+  // keeps _size up to date, because an owned node is changed in place and cannot signal the removal by identity
+  protected _deleteIn(
+    node: PersistentHashMapChild<K, V>,
+    shift: number,
+    hash: number,
+    key: K
+  ): PersistentHashMapChild<K, V> | undefined {
+    if (node instanceof PersistentHashMapBranch) {
+      const bit = 1 << ((hash >>> shift) & 31);
+      if ((node.bitmap & bit) === 0) return node;
+      const index = popCount(node.bitmap & (bit - 1));
+      const child = node.children[index];
+      const next = this._deleteIn(child, shift + 5, hash, key);
+      if (next === child) return node;
+      if (next === undefined) {
+        if (node.children.length === 1) return undefined;
+        if (shift > 0 && node.children.length === 2) {
+          const other = node.children[index ^ 1];
+          if (!(other instanceof PersistentHashMapBranch)) return other;
+        }
+        const branch = this._ownBranch(node);
+        branch.children.splice(index, 1);
+        branch.bitmap ^= bit;
+        return branch;
+      }
+      if (shift > 0 && node.children.length === 1 && !(next instanceof PersistentHashMapBranch)) return next;
+      const branch = this._ownBranch(node);
+      branch.children[index] = next;
+      return branch;
+    }
+
+    if (node instanceof PersistentHashMapLeaf) {
+      if (node.hash !== hash || !this._isSameKey(node.key, key)) return node;
+      this._size--;
+      return undefined;
+    }
+
+    if (node.hash !== hash) return node;
+    const leaves = node.leaves;
+    for (let i = 0; i < leaves.length; i++) {
+      if (this._isSameKey(leaves[i].key, key)) {
+        this._size--;
+        if (leaves.length === 2) return leaves[i ^ 1];
+        const collision = this._ownCollision(node);
+        collision.leaves.splice(i, 1);
+        return collision;
+      }
+    }
+    return node;
+  }
+}
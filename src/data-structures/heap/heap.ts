@@ -5,8 +5,26 @@
  * @license MIT License
  */
 
-import type { Comparator, DFSOrderPattern, ElementCallback, HeapOptions } from '../../types';
+import type {
+  BinaryElementSnapshotOptions,
+  BinarySource,
+  BinaryWriterOptions,
+  Comparator,
+  DFSOrderPattern,
+  ElementCallback,
+  HeapOptions,
+  InstrumentedMethods
+} from '../../types';
+import { BinarySnapshotKind } from '../../types';
 import { IterableElementBase } from '../base';
+import {
+  BinaryReader,
+  binaryCodecs,
+  BinaryWriter,
+  readSnapshotHeader,
+  toBinaryReader,
+  writeSnapshotHeader
+} from '../../utils';
 
 /**
  * 1. Complete Binary Tree: Heaps are typically complete binary trees, meaning every level is fully filled except possibly for the last level, which has nodes as far left as possible.
@@ -187,6 +205,59 @@ export class Heap<E = any> extends IterableElementBase<E> {
     return this.fix();
   }
 
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The `writeBinary` function writes a binary snapshot of the heap: a header, the number of elements,
+   * then each element through the codec in array order, which is already a valid heap order.
+   * @param {BinaryWriter} writer - The writer to append to.
+   * @param [options] - `elementCodec`, `binaryCodecs.any` by default.
+   */
+  writeBinary(writer: BinaryWriter, options?: BinaryElementSnapshotOptions<E>): void {
+    const codec = options?.elementCodec ?? binaryCodecs.any;
+    const elements = this._elements;
+    writeSnapshotHeader(writer, BinarySnapshotKind.Heap);
+    writer.writeVarUint(elements.length);
+    for (let i = 0; i < elements.length; i++) codec.write(writer, elements[i]);
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `toBinary` function returns the snapshot `writeBinary` writes.
+   * @param [options] - The codec, plus `BinaryWriter` options; with `onChunk` the snapshot is streamed
+   * and an empty array is returned.
+   * @returns The snapshot bytes.
+   */
+  toBinary(options?: BinaryElementSnapshotOptions<E> & BinaryWriterOptions): Uint8Array {
+    const writer = new BinaryWriter(options);
+    this.writeBinary(writer, options);
+    return writer.finish();
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `loadBinary` function replaces the elements of the heap with a snapshot. A snapshot written with
+   * the same comparator is already in heap order, so `refill` checks it without moving any element.
+   * @param source - The snapshot bytes, an iterable of chunks, or a reader positioned at a snapshot.
+   * @param [options] - The codec the snapshot was written with.
+   * @returns The number of elements in the heap.
+   */
+  loadBinary(source: BinarySource | BinaryReader, options?: BinaryElementSnapshotOptions<E>): number {
+    const codec = options?.elementCodec ?? binaryCodecs.any;
+    const reader = toBinaryReader(source);
+    readSnapshotHeader(reader, BinarySnapshotKind.Heap);
+    const count = reader.readVarUint();
+    const elements: E[] = new Array(count);
+    for (let i = 0; i < count; i++) elements[i] = codec.read(reader);
+    this.refill(elements);
+    return this.size;
+  }
+
   /**
    * Time Complexity: O(n)
    * Space Complexity: O(1)
@@ -484,6 +555,14 @@ export class Heap<E = any> extends IterableElementBase<E> {
     this.elements[index] = element;
     return true;
   }
+
+  /**
+   * The function counts the sift-ups of `add` and the sift-downs of `poll`, `delete` and heapify.
+   * @returns The methods `enableStats` wraps.
+   */
+  protected override _instrumentedMethods(): InstrumentedMethods {
+    return { ...super._instrumentedMethods(), _bubbleUp: 'siftUps', _sinkDown: 'siftDowns' };
+  }
 }
 
 export class FibonacciHeapNode<E> {
@@ -891,7 +970,8 @@ export class FibonacciHeap<E> {
    * @protected
    */
   protected _consolidate(): void {
-    const A: (FibonacciHeapNode<E> | undefined)[] = new Array(this.size);
+    // Indexed by degree, so it only grows to the maximum degree, O(log n), instead of the heap size
+    const A: (FibonacciHeapNode<E> | undefined)[] = [];
     const elements = this.consumeLinkedList(this.root);
     let x: FibonacciHeapNode<E> | undefined,
       y: FibonacciHeapNode<E> | undefined,
@@ -919,7 +999,7 @@ export class FibonacciHeap<E> {
       A[d] = x;
     }
 
-    for (let i = 0; i < this.size; i++) {
+    for (let i = 0; i < A.length; i++) {
       if (A[i] && this.comparator(A[i]!.element, this.min!.element) <= 0) {
         this._min = A[i]!;
       }
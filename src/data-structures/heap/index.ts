@@ -1,3 +1,6 @@
 export * from './max-heap';
 export * from './min-heap';
 export * from './heap';
+export * from './indexed-heap';
+export * from './pairing-heap';
+export * from './radix-heap';
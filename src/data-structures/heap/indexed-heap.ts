@@ -0,0 +1,444 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { EntryCallback, IndexedHeapOptions } from '../../types';
+import { IterableEntryBase } from '../base';
+
+/**
+ * 1. Indexed Priority Queue: An IndexedHeap orders integer handles (0, 1, 2, ...) by numeric priorities, so the priority of a handle already in the heap can be changed or removed in O(log n).
+ * 2. Typed Arrays: Priorities live in a `Float64Array` indexed by handle, and the heap order and the position of each handle live in `Int32Array`s, so the heap allocates nothing per element and compares numbers directly instead of calling a comparator.
+ * 3. d-ary Layout: With `arity` 4 the tree is half as deep as a binary heap and the children of a slot sit next to each other in memory, which suits workloads with many `decreaseKey` calls such as Dijkstra's algorithm.
+ * 4. Handles: A handle is usually the index of an item in an array kept by the caller, e.g. the index of a vertex.
+ */
+export class IndexedHeap extends IterableEntryBase<number, number> {
+  /**
+   * The constructor initializes an IndexedHeap with optional `[handle, priority]` entries and options.
+   * @param entries - Initial entries, heapified in linear time. A repeated handle keeps its last
+   * priority.
+   * @param [options] - `capacity` sizes the typed arrays up front (they grow when a larger handle is
+   * added), `arity` is the number of children per slot (2 by default) and `isMax` puts the greatest
+   * priority on top.
+   */
+  constructor(entries: Iterable<[number, number]> = [], options?: IndexedHeapOptions) {
+    super();
+    let capacity = 16;
+    if (options) {
+      const { capacity: initialCapacity, arity, isMax } = options;
+      if (initialCapacity !== undefined && initialCapacity > 0) capacity = Math.ceil(initialCapacity);
+      if (arity !== undefined) {
+        if (!Number.isInteger(arity) || arity < 2) throw new Error('IndexedHeap arity must be an integer of at least 2');
+        this._arity = arity;
+      }
+      if (isMax) this._sign = -1;
+    }
+    this._priorities = new Float64Array(capacity);
+    this._heap = new Int32Array(capacity);
+    this._positions = new Int32Array(capacity).fill(-1);
+
+    if (entries) {
+      for (const [handle, priority] of entries) {
+        this._checkHandle(handle);
+        const position = this._positions[handle];
+        if (position < 0) {
+          this._heap[this._size] = handle;
+          this._positions[handle] = this._size++;
+        }
+        this._priorities[handle] = priority * this._sign;
+      }
+      for (let i = this._parentOf(this._size - 1); i >= 0; i--) this._sinkDown(i);
+    }
+  }
+
+  protected _arity = 2;
+
+  /**
+   * The function returns the number of children of each slot.
+   * @returns The `arity` property is being returned.
+   */
+  get arity(): number {
+    return this._arity;
+  }
+
+  protected _sign = 1;
+
+  /**
+   * The function returns whether the greatest priority is on top.
+   * @returns `true` for a max heap, `false` for a min heap.
+   */
+  get isMax(): boolean {
+    return this._sign === -1;
+  }
+
+  protected _size = 0;
+
+  /**
+   * The function returns the number of handles in the heap.
+   * @returns The `size` property is being returned.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  /**
+   * The function returns the number of handles the typed arrays hold before they grow.
+   * @returns The length of the typed arrays.
+   */
+  get capacity(): number {
+    return this._positions.length;
+  }
+
+  protected _priorities: Float64Array;
+
+  protected _heap: Int32Array;
+
+  protected _positions: Int32Array;
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n), amortized when the typed arrays grow
+   * Space Complexity: O(1)
+   *
+   * The `add` function inserts a handle with a priority. If the handle is already in the heap, its
+   * priority is changed instead, as with `update`.
+   * @param {number} handle - A non-negative integer.
+   * @param {number} priority - The priority of the handle.
+   * @returns a boolean value, always `true`.
+   */
+  add(handle: number, priority: number): boolean {
+    this._checkHandle(handle);
+    if (this._positions[handle] >= 0) return this.update(handle, priority);
+    const position = this._size++;
+    this._heap[position] = handle;
+    this._positions[handle] = position;
+    this._priorities[handle] = priority * this._sign;
+    this._bubbleUp(position);
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function returns the handle on top of the heap without removing it.
+   * @returns The top handle, or `undefined` if the heap is empty.
+   */
+  peek(): number | undefined {
+    return this._size > 0 ? this._heap[0] : undefined;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function returns the priority of the handle on top of the heap.
+   * @returns The top priority, or `undefined` if the heap is empty.
+   */
+  peekPriority(): number | undefined {
+    return this._size > 0 ? this._priorities[this._heap[0]] * this._sign : undefined;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `poll` function removes and returns the handle on top of the heap.
+   * @returns The top handle, or `undefined` if the heap is empty.
+   */
+  poll(): number | undefined {
+    if (this._size === 0) return;
+    const top = this._heap[0];
+    this._positions[top] = -1;
+    const last = this._heap[--this._size];
+    if (this._size > 0) {
+      this._heap[0] = last;
+      this._positions[last] = 0;
+      this._sinkDown(0);
+    }
+    return top;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function checks if a handle is in the heap.
+   * @param {number} handle - The handle to look up.
+   * @returns a boolean value.
+   */
+  has(handle: number): boolean {
+    return handle >= 0 && handle < this._positions.length && this._positions[handle] >= 0;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function returns the priority of a handle.
+   * @param {number} handle - The handle to look up.
+   * @returns The priority, or `undefined` if the handle is not in the heap.
+   */
+  getPriority(handle: number): number | undefined {
+    return this.has(handle) ? this._priorities[handle] * this._sign : undefined;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `decreaseKey` function moves a handle towards the top by giving it a better priority: a lower
+   * one in a min heap, a higher one with `isMax`.
+   * @param {number} handle - A handle in the heap.
+   * @param {number} priority - The new priority.
+   * @returns `true` if the priority was changed, `false` if the handle is not in the heap or the new
+   * priority is worse than the current one.
+   */
+  decreaseKey(handle: number, priority: number): boolean {
+    if (!this.has(handle)) return false;
+    const key = priority * this._sign;
+    if (key > this._priorities[handle]) return false;
+    this._priorities[handle] = key;
+    this._bubbleUp(this._positions[handle]);
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `update` function sets the priority of a handle in either direction, inserting the handle if
+   * it is not in the heap yet.
+   * @param {number} handle - A non-negative integer.
+   * @param {number} priority - The new priority.
+   * @returns a boolean value, always `true`.
+   */
+  update(handle: number, priority: number): boolean {
+    if (!this.has(handle)) return this.add(handle, priority);
+    const key = priority * this._sign;
+    const old = this._priorities[handle];
+    this._priorities[handle] = key;
+    const position = this._positions[handle];
+    if (key < old) this._bubbleUp(position);
+    else if (key > old) this._sinkDown(position);
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The `remove` function takes a handle out of the heap wherever it is.
+   * @param {number} handle - The handle to remove.
+   * @returns `true` if the handle was in the heap, `false` otherwise.
+   */
+  remove(handle: number): boolean {
+    if (!this.has(handle)) return false;
+    const position = this._positions[handle];
+    this._positions[handle] = -1;
+    const last = this._heap[--this._size];
+    if (position < this._size) {
+      this._heap[position] = last;
+      this._positions[last] = position;
+      if (this._priorities[last] < this._priorities[handle]) this._bubbleUp(position);
+      else this._sinkDown(position);
+    }
+    return true;
+  }
+
+  /**
+   * The function checks if the heap is empty.
+   * @returns a boolean value.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Time Complexity: O(capacity)
+   * Space Complexity: O(1)
+   *
+   * The `clear` function removes every handle and keeps the typed arrays for reuse.
+   */
+  clear(): void {
+    this._size = 0;
+    this._positions.fill(-1);
+  }
+
+  /**
+   * Time Complexity: O(capacity)
+   * Space Complexity: O(capacity)
+   *
+   * The `clone` function creates a heap with the same options, handles and priorities.
+   * @returns a new `IndexedHeap`.
+   */
+  clone(): IndexedHeap {
+    const cloned = this._createLike();
+    cloned._priorities = this._priorities.slice();
+    cloned._heap = this._heap.slice();
+    cloned._positions = this._positions.slice();
+    cloned._size = this._size;
+    return cloned;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function creates a heap with the same options holding the handles that satisfy the
+   * predicate.
+   * @param predicate - A function called with `priority`, `handle`, `index` and the heap.
+   * @param {any} [thisArg] - The value of `this` within the predicate.
+   * @returns a new `IndexedHeap`.
+   */
+  filter(predicate: EntryCallback<number, number, boolean>, thisArg?: any): IndexedHeap {
+    const filtered = this._createLike();
+    let index = 0;
+    for (const [handle, priority] of this) {
+      if (predicate.call(thisArg, priority, handle, index++, this)) filtered.add(handle, priority);
+    }
+    return filtered;
+  }
+
+  /**
+   * Time Complexity: O(n log n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function creates a heap with the same options where each handle gets the priority
+   * returned by the callback.
+   * @param callback - A function called with `priority`, `handle`, `index` and the heap.
+   * @param {any} [thisArg] - The value of `this` within the callback.
+   * @returns a new `IndexedHeap`.
+   */
+  map(callback: EntryCallback<number, number, number>, thisArg?: any): IndexedHeap {
+    const mapped = this._createLike();
+    let index = 0;
+    for (const [handle, priority] of this) {
+      mapped.add(handle, callback.call(thisArg, priority, handle, index++, this));
+    }
+    return mapped;
+  }
+
+  /**
+   * The function iterates over the `[handle, priority]` entries in heap order, which is not sorted.
+   */
+  protected* _getIterator(): IterableIterator<[number, number]> {
+    for (let i = 0; i < this._size; i++) {
+      const handle = this._heap[i];
+      yield [handle, this._priorities[handle] * this._sign];
+    }
+  }
+
+  /**
+   * The function creates an empty heap with the same options and capacity.
+   * @returns a new `IndexedHeap`.
+   */
+  protected _createLike(): IndexedHeap {
+    return new IndexedHeap([], { capacity: this.capacity, arity: this._arity, isMax: this.isMax });
+  }
+
+  /**
+   * The function checks that a handle is a non-negative integer and grows the typed arrays to hold it.
+   * @param {number} handle - The handle to check.
+   */
+  protected _checkHandle(handle: number): void {
+    if (handle >>> 0 !== handle) throw new Error('IndexedHeap handles must be non-negative integers');
+    if (handle >= this._positions.length) this._grow(handle + 1);
+  }
+
+  /**
+   * The function reallocates the typed arrays, at least doubling their length.
+   * @param {number} minCapacity - The length the typed arrays need.
+   */
+  protected _grow(minCapacity: number): void {
+    const capacity = Math.max(minCapacity, this._positions.length * 2);
+    const priorities = new Float64Array(capacity);
+    priorities.set(this._priorities);
+    const heap = new Int32Array(capacity);
+    heap.set(this._heap);
+    const positions = new Int32Array(capacity).fill(-1);
+    positions.set(this._positions);
+    this._priorities = priorities;
+    this._heap = heap;
+    this._positions = positions;
+  }
+
+  /**
+   * The function returns the slot of the parent of a slot.
+   * @param {number} position - A slot other than the root.
+   * @returns The slot of the parent.
+   */
+  protected _parentOf(position: number): number {
+    return Math.floor((position - 1) / this._arity);
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function moves the handle in a slot up while its priority is better than its parent's.
+   * @param {number} position - The slot to start from.
+   */
+  protected _bubbleUp(position: number): void {
+    const heap = this._heap,
+      positions = this._positions,
+      priorities = this._priorities,
+      arity = this._arity;
+    const handle = heap[position];
+    const key = priorities[handle];
+    while (position > 0) {
+      const parent = ((position - 1) / arity) | 0;
+      const parentHandle = heap[parent];
+      if (priorities[parentHandle] <= key) break;
+      heap[position] = parentHandle;
+      positions[parentHandle] = position;
+      position = parent;
+    }
+    heap[position] = handle;
+    positions[handle] = position;
+  }
+
+  /**
+   * Time Complexity: O(d log n / log d), where d is the arity
+   * Space Complexity: O(1)
+   *
+   * The function moves the handle in a slot down while a child has a better priority.
+   * @param {number} position - The slot to start from.
+   */
+  protected _sinkDown(position: number): void {
+    const heap = this._heap,
+      positions = this._positions,
+      priorities = this._priorities,
+      arity = this._arity,
+      size = this._size;
+    const handle = heap[position];
+    const key = priorities[handle];
+    while (true) {
+      const first = position * arity + 1;
+      if (first >= size) break;
+      const end = Math.min(first + arity, size);
+      let best = first;
+      let bestKey = priorities[heap[first]];
+      for (let child = first + 1; child < end; child++) {
+        const childKey = priorities[heap[child]];
+        if (childKey < bestKey) {
+          best = child;
+          bestKey = childKey;
+        }
+      }
+      if (bestKey >= key) break;
+      const bestHandle = heap[best];
+      heap[position] = bestHandle;
+      positions[bestHandle] = position;
+      position = best;
+    }
+    heap[position] = handle;
+    positions[handle] = position;
+  }
+}
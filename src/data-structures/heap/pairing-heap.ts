@@ -0,0 +1,378 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { Comparator, ElementCallback, HeapOptions } from '../../types';
+import { IterableElementBase } from '../base';
+
+export class PairingHeapNode<E> {
+  element: E;
+  child?: PairingHeapNode<E>;
+  next?: PairingHeapNode<E>;
+  prev?: PairingHeapNode<E>;
+
+  /**
+   * The constructor function initializes a node holding an element. `child` is the first child,
+   * `next` the next sibling, and `prev` the previous sibling, or the parent for a first child.
+   * @param {E} element - The element stored in the node.
+   */
+  constructor(element: E) {
+    this.element = element;
+  }
+}
+
+/**
+ * 1. Pairing Heap: A heap-ordered multiway tree where every node keeps only its first child and its siblings, so a node is three pointers and an element.
+ * 2. Cheap Operations: `add`, `merge` and `decreaseKey` link two trees with one comparison in O(1); `poll` pairs up the children of the root in two passes in O(log n) amortized.
+ * 3. Handles: `addNode` returns the node of an element, which `decreaseKey` and `deleteNode` take to change or remove it later.
+ * 4. In Practice: In JavaScript it is usually faster than a Fibonacci heap, which spends its time on the root list and the consolidation pass.
+ */
+export class PairingHeap<E = any> extends IterableElementBase<E> {
+  /**
+   * The constructor initializes a pairing heap with optional elements and options.
+   * @param elements - The elements to add initially.
+   * @param [options] - `comparator` orders the elements; the least element is on top. Numbers are
+   * compared ascending by default.
+   */
+  constructor(elements: Iterable<E> = [], options?: HeapOptions<E>) {
+    super();
+
+    if (options) {
+      const { comparator } = options;
+      if (comparator) this._comparator = comparator;
+    }
+
+    if (elements) {
+      for (const el of elements) {
+        this.add(el);
+      }
+    }
+  }
+
+  protected _comparator: Comparator<E> = (a: E, b: E) => {
+    if (!(typeof a === 'number' && typeof b === 'number')) {
+      throw new Error('The a, b params of compare function must be number');
+    } else {
+      return a - b;
+    }
+  };
+
+  /**
+   * The function returns the comparator used for comparing elements.
+   * @returns The `_comparator` property is being returned.
+   */
+  get comparator(): Comparator<E> {
+    return this._comparator;
+  }
+
+  protected _root?: PairingHeapNode<E>;
+
+  /**
+   * The function returns the root node, which holds the top element.
+   * @returns The `_root` property is being returned.
+   */
+  get root(): PairingHeapNode<E> | undefined {
+    return this._root;
+  }
+
+  protected _size = 0;
+
+  /**
+   * The function returns the number of elements in the heap.
+   * @returns The `_size` property is being returned.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * Insert an element into the heap.
+   * @param element - The element to be inserted.
+   * @returns a boolean value, always `true`.
+   */
+  add(element: E): boolean {
+    this.addNode(element);
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * Insert an element into the heap and return its node, to be passed to `decreaseKey` or
+   * `deleteNode` later.
+   * @param element - The element to be inserted.
+   * @returns The node holding the element.
+   */
+  addNode(element: E): PairingHeapNode<E> {
+    const node = new PairingHeapNode<E>(element);
+    this._root = this._root ? this._meld(this._root, node) : node;
+    this._size++;
+    return node;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * Peek at the top element of the heap without removing it.
+   * @returns The top element or undefined if the heap is empty.
+   */
+  peek(): E | undefined {
+    return this._root?.element;
+  }
+
+  /**
+   * Time Complexity: O(log n) amortized
+   * Space Complexity: O(1)
+   *
+   * Remove and return the top element from the heap.
+   * @returns The top element or undefined if the heap is empty.
+   */
+  poll(): E | undefined {
+    const root = this._root;
+    if (!root) return;
+    this._root = this._combineChildren(root);
+    root.child = undefined;
+    this._size--;
+    return root.element;
+  }
+
+  /**
+   * Time Complexity: O(log n) amortized in theory, close to O(1) in practice
+   * Space Complexity: O(1)
+   *
+   * The `decreaseKey` function gives a node an element that is ordered before or with its current
+   * element, and moves the node up by cutting its subtree off and linking it with the root.
+   * @param {PairingHeapNode<E>} node - A node of this heap returned by `addNode`.
+   * @param {E} element - The new element.
+   * @returns `true` if the element was changed, `false` if it would be ordered after the current
+   * element.
+   */
+  decreaseKey(node: PairingHeapNode<E>, element: E): boolean {
+    if (this._comparator(element, node.element) > 0) return false;
+    node.element = element;
+    if (node !== this._root) {
+      this._cut(node);
+      this._root = this._meld(this._root!, node);
+    }
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(log n) amortized
+   * Space Complexity: O(1)
+   *
+   * The `deleteNode` function removes a node of this heap wherever it is.
+   * @param {PairingHeapNode<E>} node - A node of this heap returned by `addNode`.
+   * @returns a boolean value, always `true`.
+   */
+  deleteNode(node: PairingHeapNode<E>): boolean {
+    if (node === this._root) {
+      this.poll();
+      return true;
+    }
+    this._cut(node);
+    const children = this._combineChildren(node);
+    node.child = undefined;
+    if (children) this._root = this._meld(this._root!, children);
+    this._size--;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * merge two heaps. The heap that is merged will be cleared. The heap that is merged into will remain.
+   * @param {PairingHeap<E>} heapToMerge - A heap with a compatible comparator.
+   */
+  merge(heapToMerge: PairingHeap<E>): void {
+    if (heapToMerge === this || !heapToMerge._root) return;
+    this._root = this._root ? this._meld(this._root, heapToMerge._root) : heapToMerge._root;
+    this._size += heapToMerge._size;
+    heapToMerge.clear();
+  }
+
+  /**
+   * Check if the heap is empty.
+   * @returns True if the heap is empty, otherwise false.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Reset the heap. Make the heap empty.
+   */
+  clear(): void {
+    this._root = undefined;
+    this._size = 0;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * Clone the heap, creating a new heap with the same elements.
+   * @returns A new PairingHeap instance containing the same elements.
+   */
+  clone(): PairingHeap<E> {
+    return new PairingHeap<E>(this, { comparator: this._comparator });
+  }
+
+  /**
+   * Time Complexity: O(n log n)
+   * Space Complexity: O(n)
+   *
+   * Sort the elements in the heap and return them as an array.
+   * @returns An array containing the elements in heap order.
+   */
+  sort(): E[] {
+    const cloned = this.clone();
+    const sorted: E[] = [];
+    while (cloned.size > 0) sorted.push(cloned.poll()!);
+    return sorted;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function creates a new PairingHeap containing the elements that pass a given
+   * callback function.
+   * @param callback - A function called with the element, its index and the heap.
+   * @param {any} [thisArg] - The value of `this` within the callback.
+   * @returns a new `PairingHeap` with the same comparator.
+   */
+  filter(callback: ElementCallback<E, boolean>, thisArg?: any): PairingHeap<E> {
+    const filtered = new PairingHeap<E>([], { comparator: this._comparator });
+    let index = 0;
+    for (const current of this) {
+      if (callback.call(thisArg, current, index, this)) filtered.add(current);
+      index++;
+    }
+    return filtered;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function creates a new PairingHeap by applying a callback function to each element.
+   * @param callback - A function called with the element, its index and the heap.
+   * @param comparator - The comparator of the new heap.
+   * @param {any} [thisArg] - The value of `this` within the callback.
+   * @returns a new `PairingHeap` of the mapped elements.
+   */
+  map<T>(callback: ElementCallback<E, T>, comparator: Comparator<T>, thisArg?: any): PairingHeap<T> {
+    const mapped = new PairingHeap<T>([], { comparator });
+    let index = 0;
+    for (const el of this) {
+      mapped.add(callback.call(thisArg, el, index, this));
+      index++;
+    }
+    return mapped;
+  }
+
+  /**
+   * The function `_getIterator` yields the elements in pre-order of the tree, which is not sorted.
+   */
+  protected* _getIterator(): IterableIterator<E> {
+    if (!this._root) return;
+    const stack: PairingHeapNode<E>[] = [this._root];
+    while (stack.length > 0) {
+      const node = stack.pop()!;
+      yield node.element;
+      if (node.next) stack.push(node.next);
+      if (node.child) stack.push(node.child);
+    }
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function links two roots by making the one ordered after the other its first child.
+   * @param {PairingHeapNode<E>} a - A root with no siblings.
+   * @param {PairingHeapNode<E>} b - Another root with no siblings.
+   * @returns The root of the linked tree.
+   */
+  protected _meld(a: PairingHeapNode<E>, b: PairingHeapNode<E>): PairingHeapNode<E> {
+    if (this._comparator(b.element, a.element) < 0) {
+      const t = a;
+      a = b;
+      b = t;
+    }
+    b.prev = a;
+    b.next = a.child;
+    if (a.child) a.child.prev = b;
+    a.child = b;
+    a.next = undefined;
+    a.prev = undefined;
+    return a;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function detaches a node and its subtree from its parent and siblings.
+   * @param {PairingHeapNode<E>} node - A node other than the root.
+   */
+  protected _cut(node: PairingHeapNode<E>): void {
+    const prev = node.prev!;
+    if (prev.child === node) prev.child = node.next;
+    else prev.next = node.next;
+    if (node.next) node.next.prev = prev;
+    node.next = undefined;
+    node.prev = undefined;
+  }
+
+  /**
+   * Time Complexity: O(log n) amortized
+   * Space Complexity: O(1)
+   *
+   * The function links the children of a node into one tree: the first pass links them in pairs from
+   * left to right, and the second pass links the pairs from right to left. The pairs are chained
+   * through `prev`, so no array is needed.
+   * @param {PairingHeapNode<E>} node - The node whose children are combined.
+   * @returns The root of the combined tree, or `undefined` if the node has no children.
+   */
+  protected _combineChildren(node: PairingHeapNode<E>): PairingHeapNode<E> | undefined {
+    let first = node.child;
+    if (!first) return;
+
+    let pairs: PairingHeapNode<E> | undefined;
+    while (first) {
+      const second = first.next;
+      const rest = second?.next;
+      const pair = second ? this._meld(first, second) : first;
+      pair.next = undefined;
+      pair.prev = pairs;
+      pairs = pair;
+      first = rest;
+    }
+
+    let tree = pairs!;
+    pairs = tree.prev;
+    tree.prev = undefined;
+    while (pairs) {
+      const prev = pairs.prev;
+      tree = this._meld(pairs, tree);
+      pairs = prev;
+    }
+    return tree;
+  }
+}
@@ -0,0 +1,247 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { EntryCallback } from '../../types';
+import { IterableEntryBase } from '../base';
+
+/**
+ * 1. Monotone Priority Queue: A RadixHeap holds elements with unsigned 32-bit integer priorities, where no priority added is less than the last priority polled. Event schedulers with timestamps and Dijkstra's algorithm with integer weights work this way.
+ * 2. Buckets: An element goes to the bucket of the highest bit in which its priority differs from the last polled priority, so there are only 33 buckets and no comparisons between elements.
+ * 3. Amortized Cost: When the lowest bucket runs empty, the next bucket is redistributed below the new minimum. Each element moves down at most 32 times, so `poll` is O(log C) amortized for priorities below C, and `add` is O(1).
+ * 4. Ties: Elements with the same priority are polled in no particular order.
+ */
+export class RadixHeap<E = number> extends IterableEntryBase<number, E> {
+  /**
+   * The constructor initializes a radix heap with optional `[priority, element]` entries.
+   * @param entries - The entries to add initially, in any order.
+   */
+  constructor(entries: Iterable<[number, E]> = []) {
+    super();
+    for (let i = 0; i <= 32; i++) {
+      this._priorities.push([]);
+      this._elements.push([]);
+    }
+
+    if (entries) {
+      for (const [priority, element] of entries) {
+        this.add(priority, element);
+      }
+    }
+  }
+
+  protected _priorities: number[][] = [];
+
+  protected _elements: E[][] = [];
+
+  protected _size = 0;
+
+  /**
+   * The function returns the number of elements in the heap.
+   * @returns The `_size` property is being returned.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  protected _last = 0;
+
+  /**
+   * The function returns the last priority polled, which is the least priority `add` accepts.
+   * @returns The `_last` property is being returned.
+   */
+  get last(): number {
+    return this._last;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * Insert an element with a priority.
+   * @param {number} priority - An unsigned 32-bit integer that is not less than `last`.
+   * @param [element] - The element; it is the priority itself by default.
+   * @returns a boolean value, always `true`.
+   */
+  add(priority: number, element: E = priority as unknown as E): boolean {
+    if (priority >>> 0 !== priority) throw new Error('RadixHeap priorities must be unsigned 32-bit integers');
+    if (priority < this._last) throw new Error('RadixHeap priorities must not be less than the last polled priority');
+    const bucket = this._bucketOf(priority);
+    this._priorities[bucket].push(priority);
+    this._elements[bucket].push(element);
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(log C) amortized
+   * Space Complexity: O(1)
+   *
+   * Peek at the element with the least priority without removing it.
+   * @returns The element or undefined if the heap is empty.
+   */
+  peek(): E | undefined {
+    if (this._size === 0) return;
+    this._pull();
+    const elements = this._elements[0];
+    return elements[elements.length - 1];
+  }
+
+  /**
+   * Time Complexity: O(log C) amortized
+   * Space Complexity: O(1)
+   *
+   * The function returns the least priority in the heap.
+   * @returns The priority or undefined if the heap is empty.
+   */
+  peekPriority(): number | undefined {
+    if (this._size === 0) return;
+    this._pull();
+    return this._last;
+  }
+
+  /**
+   * Time Complexity: O(log C) amortized
+   * Space Complexity: O(1)
+   *
+   * Remove and return the element with the least priority. Its priority becomes `last`.
+   * @returns The element or undefined if the heap is empty.
+   */
+  poll(): E | undefined {
+    if (this._size === 0) return;
+    this._pull();
+    this._size--;
+    this._priorities[0].pop();
+    return this._elements[0].pop();
+  }
+
+  /**
+   * Check if the heap is empty.
+   * @returns True if the heap is empty, otherwise false.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Reset the heap. Make the heap empty and accept any priority again.
+   */
+  clear(): void {
+    for (let i = 0; i <= 32; i++) {
+      this._priorities[i].length = 0;
+      this._elements[i].length = 0;
+    }
+    this._size = 0;
+    this._last = 0;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * Clone the heap, keeping `last`.
+   * @returns A new RadixHeap instance containing the same entries.
+   */
+  clone(): RadixHeap<E> {
+    const cloned = new RadixHeap<E>();
+    cloned._last = this._last;
+    for (let i = 0; i <= 32; i++) {
+      cloned._priorities[i] = this._priorities[i].slice();
+      cloned._elements[i] = this._elements[i].slice();
+    }
+    cloned._size = this._size;
+    return cloned;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function creates a heap, keeping `last`, with the entries that pass the predicate.
+   * @param predicate - A function called with `element`, `priority`, `index` and the heap.
+   * @param {any} [thisArg] - The value of `this` within the predicate.
+   * @returns a new `RadixHeap`.
+   */
+  filter(predicate: EntryCallback<number, E, boolean>, thisArg?: any): RadixHeap<E> {
+    const filtered = new RadixHeap<E>();
+    filtered._last = this._last;
+    let index = 0;
+    for (const [priority, element] of this) {
+      if (predicate.call(thisArg, element, priority, index++, this)) filtered.add(priority, element);
+    }
+    return filtered;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function creates a heap, keeping `last` and the priorities, whose elements are produced
+   * by the callback.
+   * @param callback - A function called with `element`, `priority`, `index` and the heap.
+   * @param {any} [thisArg] - The value of `this` within the callback.
+   * @returns a new `RadixHeap`.
+   */
+  map<T>(callback: EntryCallback<number, E, T>, thisArg?: any): RadixHeap<T> {
+    const mapped = new RadixHeap<T>();
+    mapped._last = this._last;
+    let index = 0;
+    for (const [priority, element] of this) {
+      mapped.add(priority, callback.call(thisArg, element, priority, index++, this));
+    }
+    return mapped;
+  }
+
+  /**
+   * The function iterates over the `[priority, element]` entries bucket by bucket, which is not
+   * sorted.
+   */
+  protected* _getIterator(): IterableIterator<[number, E]> {
+    for (let i = 0; i <= 32; i++) {
+      const priorities = this._priorities[i],
+        elements = this._elements[i];
+      for (let j = 0; j < priorities.length; j++) yield [priorities[j], elements[j]];
+    }
+  }
+
+  /**
+   * The function returns the bucket of a priority: 0 for a priority equal to `last`, otherwise one
+   * plus the index of the highest bit in which it differs from `last`.
+   * @param {number} priority - A priority not less than `last`.
+   * @returns The index of the bucket.
+   */
+  protected _bucketOf(priority: number): number {
+    return priority === this._last ? 0 : 32 - Math.clz32(priority ^ this._last);
+  }
+
+  /**
+   * Time Complexity: O(log C) amortized
+   * Space Complexity: O(1)
+   *
+   * The function makes sure the lowest bucket is not empty. It finds the first non-empty bucket,
+   * makes its least priority the new `last` and redistributes the bucket, whose elements all land in
+   * lower buckets.
+   */
+  protected _pull(): void {
+    if (this._priorities[0].length > 0) return;
+    let bucket = 1;
+    while (this._priorities[bucket].length === 0) bucket++;
+
+    const priorities = this._priorities[bucket],
+      elements = this._elements[bucket];
+    let min = priorities[0];
+    for (let i = 1; i < priorities.length; i++) if (priorities[i] < min) min = priorities[i];
+    this._last = min;
+
+    for (let i = 0; i < priorities.length; i++) {
+      const target = this._bucketOf(priorities[i]);
+      this._priorities[target].push(priorities[i]);
+      this._elements[target].push(elements[i]);
+    }
+    priorities.length = 0;
+    elements.length = 0;
+  }
+}
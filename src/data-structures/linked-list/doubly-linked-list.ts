@@ -5,7 +5,7 @@
  * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
  * @license MIT License
  */
-import type { ElementCallback } from '../../types';
+import type { DoublyLinkedListOptions, ElementCallback } from '../../types';
 import { IterableElementBase } from '../base';
 
 export class DoublyLinkedListNode<E = any> {
@@ -86,6 +86,7 @@ export class DoublyLinkedListNode<E = any> {
  * 2. Bidirectional Traversal: Unlike singly linked lists, doubly linked lists can be easily traversed forwards or backwards. This makes insertions and deletions in the list more flexible and efficient.
  * 3. No Centralized Index: Unlike arrays, elements in a linked list are not stored contiguously, so there is no centralized index. Accessing elements in a linked list typically requires traversing from the head or tail node.
  * 4. High Efficiency in Insertion and Deletion: Adding or removing elements in a linked list does not require moving other elements, making these operations more efficient than in arrays.
+ * 5. Node Pooling: With `nodePoolSize`, removed nodes are kept on a free list of up to that many nodes and reused by the next insertions, so a list that churns at a steady size stops allocating. A removed node is then reset and reused, so node handles must not be kept past their removal.
  */
 export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
   /**
@@ -93,12 +94,17 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
    * @param elements - The `elements` parameter is an optional iterable object that contains the
    * initial elements to be added to the data structure. It defaults to an empty array if no elements
    * are provided.
+   * @param [options] - `nodePoolSize`, the number of removed nodes to keep for reuse, 0 (no pooling) by default.
    */
-  constructor(elements: Iterable<E> = []) {
+  constructor(elements: Iterable<E> = [], options?: DoublyLinkedListOptions) {
     super();
     this._head = undefined;
     this._tail = undefined;
     this._size = 0;
+    if (options) {
+      const { nodePoolSize } = options;
+      if (nodePoolSize !== undefined && nodePoolSize > 0) this._nodePoolSize = Math.floor(nodePoolSize);
+    }
     if (elements) {
       for (const el of elements) {
         this.push(el);
@@ -137,6 +143,26 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
     return this._size;
   }
 
+  protected _nodePoolSize: number = 0;
+
+  /**
+   * The function returns the most removed nodes the list keeps for reuse.
+   * @returns The `nodePoolSize` option, 0 when pooling is off.
+   */
+  get nodePoolSize(): number {
+    return this._nodePoolSize;
+  }
+
+  protected _nodePool: DoublyLinkedListNode<E>[] = [];
+
+  /**
+   * The function returns the number of removed nodes waiting to be reused.
+   * @returns The length of the free list.
+   */
+  get pooledNodeCount(): number {
+    return this._nodePool.length;
+  }
+
   /**
    * Time Complexity: O(1)
    * Space Complexity: O(1)
@@ -201,7 +227,7 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
    * @param {E} value - The value to be added to the linked list.
    */
   push(value: E): boolean {
-    const newNode = new DoublyLinkedListNode(value);
+    const newNode = this._createNode(value);
     if (!this.head) {
       this._head = newNode;
       this._tail = newNode;
@@ -238,7 +264,9 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
       this.tail!.next = undefined;
     }
     this._size--;
-    return removedNode.value;
+    const value = removedNode.value;
+    this._releaseNode(removedNode);
+    return value;
   }
 
   /**
@@ -265,7 +293,9 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
       this.head!.prev = undefined;
     }
     this._size--;
-    return removedNode.value;
+    const value = removedNode.value;
+    this._releaseNode(removedNode);
+    return value;
   }
 
   /**
@@ -282,7 +312,7 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
    * doubly linked list.
    */
   unshift(value: E): boolean {
-    const newNode = new DoublyLinkedListNode(value);
+    const newNode = this._createNode(value);
     if (!this.head) {
       this._head = newNode;
       this._tail = newNode;
@@ -400,7 +430,7 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
       return true;
     }
 
-    const newNode = new DoublyLinkedListNode(value);
+    const newNode = this._createNode(value);
     const prevNode = this.getNodeAt(index - 1);
     const nextNode = prevNode!.next;
     newNode.prev = prevNode;
@@ -440,7 +470,7 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
     }
 
     if (existingNode) {
-      const newNode = new DoublyLinkedListNode(newValue);
+      const newNode = this._createNode(newValue);
       newNode.prev = existingNode.prev;
       if (existingNode.prev) {
         existingNode.prev.next = newNode;
@@ -484,7 +514,7 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
     }
 
     if (existingNode) {
-      const newNode = new DoublyLinkedListNode(newValue);
+      const newNode = this._createNode(newValue);
       newNode.next = existingNode.next;
       if (existingNode.next) {
         existingNode.next.prev = newNode;
@@ -528,6 +558,7 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
     prevNode!.next = nextNode;
     nextNode!.prev = prevNode;
     this._size--;
+    this._releaseNode(removedNode!);
     return true;
   }
 
@@ -566,12 +597,62 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
         prevNode!.next = nextNode;
         nextNode!.prev = prevNode;
         this._size--;
+        this._releaseNode(node);
       }
       return true;
     }
     return false;
   }
 
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `moveToFront` function relinks a node of this list at the head, without allocating, as an
+   * LRU cache does on every hit.
+   * @param {DoublyLinkedListNode<E>} node - A node of this list.
+   * @returns The node.
+   */
+  moveToFront(node: DoublyLinkedListNode<E>): DoublyLinkedListNode<E> {
+    if (node === this._head) return node;
+    this._unlink(node);
+    node.prev = undefined;
+    node.next = this._head;
+    if (this._head) this._head.prev = node;
+    else this._tail = node;
+    this._head = node;
+    return node;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `moveToBack` function relinks a node of this list at the tail, without allocating.
+   * @param {DoublyLinkedListNode<E>} node - A node of this list.
+   * @returns The node.
+   */
+  moveToBack(node: DoublyLinkedListNode<E>): DoublyLinkedListNode<E> {
+    if (node === this._tail) return node;
+    this._unlink(node);
+    node.next = undefined;
+    node.prev = this._tail;
+    if (this._tail) this._tail.next = node;
+    else this._head = node;
+    this._tail = node;
+    return node;
+  }
+
   /**
    * Time Complexity: O(1)
    * Space Complexity: O(1)
@@ -741,7 +822,7 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
    * is a copy of the original list.
    */
   clone(): DoublyLinkedList<E> {
-    return new DoublyLinkedList(this.values());
+    return new DoublyLinkedList(this.values(), { nodePoolSize: this._nodePoolSize });
   }
 
   /**
@@ -878,6 +959,43 @@ export class DoublyLinkedList<E = any> extends IterableElementBase<E> {
     this.unshift(value);
   }
 
+  /**
+   * The function takes a node from the free list, or creates one when the list is empty.
+   * @param {E} value - The value of the node.
+   * @returns A node holding `value` with no neighbors.
+   */
+  protected _createNode(value: E): DoublyLinkedListNode<E> {
+    const node = this._nodePool.pop();
+    if (node === undefined) return new DoublyLinkedListNode(value);
+    node.value = value;
+    return node;
+  }
+
+  /**
+   * The function puts a removed node on the free list if there is room, dropping its value and links so
+   * that the pool does not keep them alive.
+   * @param node - A node no longer linked into the list.
+   */
+  protected _releaseNode(node: DoublyLinkedListNode<E>): void {
+    if (this._nodePool.length >= this._nodePoolSize) return;
+    node.value = undefined as E;
+    node.prev = undefined;
+    node.next = undefined;
+    this._nodePool.push(node);
+  }
+
+  /**
+   * The function detaches a node from its neighbors and the head or tail, leaving its own links as they are.
+   * @param node - A node of this list.
+   */
+  protected _unlink(node: DoublyLinkedListNode<E>): void {
+    const { prev, next } = node;
+    if (prev) prev.next = next;
+    else this._head = next;
+    if (next) next.prev = prev;
+    else this._tail = prev;
+  }
+
   /**
    * The function returns an iterator that iterates over the values of a linked list.
    */
@@ -0,0 +1,313 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { ElementCallback, IntrusiveLinkedListNode } from '../../types';
+import { IterableElementBase } from '../base';
+
+/**
+ * 1. Intrusive Links: The list links the caller's own objects through their `prev` and `next` slots instead of
+ *    wrapping them in nodes, so adding, removing and moving elements never allocates.
+ * 2. Handles: An element is its own handle, so `remove`, `moveToFront`, `moveToBack`, `addBefore` and `addAfter`
+ *    are O(1) without a search, as an LRU cache or an order book needs.
+ * 3. Ownership: An element can be in one intrusive list at a time. Removed elements get `prev` and `next` reset to
+ *    `undefined` and may be added again, to this list or another.
+ */
+export class IntrusiveLinkedList<N extends IntrusiveLinkedListNode<N>> extends IterableElementBase<N, N[]> {
+  /**
+   * The constructor links the given elements in order.
+   * @param elements - Elements that are in no intrusive list.
+   */
+  constructor(elements: Iterable<N> = []) {
+    super();
+    if (elements) {
+      for (const element of elements) this.push(element);
+    }
+  }
+
+  protected _head: N | undefined = undefined;
+
+  /**
+   * The function returns the first element.
+   * @returns The first element, or undefined if the list is empty.
+   */
+  get head(): N | undefined {
+    return this._head;
+  }
+
+  protected _tail: N | undefined = undefined;
+
+  /**
+   * The function returns the last element.
+   * @returns The last element, or undefined if the list is empty.
+   */
+  get tail(): N | undefined {
+    return this._tail;
+  }
+
+  protected _size: number = 0;
+
+  /**
+   * The function returns the number of elements in the list.
+   * @returns The size.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `push` function links an element at the end of the list.
+   * @param {N} node - An element that is in no intrusive list.
+   * @returns True, like DoublyLinkedList.
+   */
+  push(node: N): boolean {
+    node.prev = this._tail;
+    node.next = undefined;
+    if (this._tail) this._tail.next = node;
+    else this._head = node;
+    this._tail = node;
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `unshift` function links an element at the front of the list.
+   * @param {N} node - An element that is in no intrusive list.
+   * @returns True, like DoublyLinkedList.
+   */
+  unshift(node: N): boolean {
+    node.next = this._head;
+    node.prev = undefined;
+    if (this._head) this._head.prev = node;
+    else this._tail = node;
+    this._head = node;
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `pop` function unlinks and returns the last element.
+   * @returns The last element, or undefined if the list is empty.
+   */
+  pop(): N | undefined {
+    const node = this._tail;
+    if (node) this.remove(node);
+    return node;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `shift` function unlinks and returns the first element.
+   * @returns The first element, or undefined if the list is empty.
+   */
+  shift(): N | undefined {
+    const node = this._head;
+    if (node) this.remove(node);
+    return node;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `remove` function unlinks an element of this list and resets its slots.
+   * @param {N} node - An element of this list.
+   * @returns The element.
+   */
+  remove(node: N): N {
+    this._unlink(node);
+    node.prev = undefined;
+    node.next = undefined;
+    this._size--;
+    return node;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `moveToFront` function relinks an element of this list at the front.
+   * @param {N} node - An element of this list.
+   * @returns The element.
+   */
+  moveToFront(node: N): N {
+    if (node === this._head) return node;
+    this._unlink(node);
+    this._size--;
+    this.unshift(node);
+    return node;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `moveToBack` function relinks an element of this list at the end.
+   * @param {N} node - An element of this list.
+   * @returns The element.
+   */
+  moveToBack(node: N): N {
+    if (node === this._tail) return node;
+    this._unlink(node);
+    this._size--;
+    this.push(node);
+    return node;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `addBefore` function links an element just before an element of this list.
+   * @param {N} existing - An element of this list.
+   * @param {N} node - An element that is in no intrusive list.
+   * @returns True, like DoublyLinkedList.
+   */
+  addBefore(existing: N, node: N): boolean {
+    if (existing === this._head) return this.unshift(node);
+    const prev = existing.prev!;
+    node.prev = prev;
+    node.next = existing;
+    prev.next = node;
+    existing.prev = node;
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `addAfter` function links an element just after an element of this list.
+   * @param {N} existing - An element of this list.
+   * @param {N} node - An element that is in no intrusive list.
+   * @returns True, like DoublyLinkedList.
+   */
+  addAfter(existing: N, node: N): boolean {
+    if (existing === this._tail) return this.push(node);
+    const next = existing.next!;
+    node.prev = existing;
+    node.next = next;
+    existing.next = node;
+    next.prev = node;
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function checks whether an element is linked into this list, assuming it is in no other one.
+   * @param {N} node - The element to check.
+   * @returns True if the element is in the list.
+   */
+  has(node: N): boolean {
+    return node.prev !== undefined || node.next !== undefined || node === this._head;
+  }
+
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The `clear` function unlinks every element and resets its slots, so each one can be added again.
+   */
+  clear(): void {
+    let node = this._head;
+    while (node) {
+      const next = node.next;
+      node.prev = undefined;
+      node.next = undefined;
+      node = next;
+    }
+    this._head = undefined;
+    this._tail = undefined;
+    this._size = 0;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `clone` function returns the elements in order in an array, since an element cannot be linked into a
+   * second list.
+   * @returns An array of the elements.
+   */
+  clone(): N[] {
+    return [...this];
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function returns the elements that pass a predicate in an array, since an element cannot be
+   * linked into a second list.
+   * @param predicate - Called with `(element, index, list)`.
+   * @param {any} [thisArg] - The value to use as `this` inside the predicate.
+   * @returns An array of the matching elements.
+   */
+  filter(predicate: ElementCallback<N, boolean>, thisArg?: any): N[] {
+    const result: N[] = [];
+    let index = 0;
+    for (const node of this) {
+      if (predicate.call(thisArg, node, index++, this)) result.push(node);
+    }
+    return result;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function returns the mapped elements in an array.
+   * @param callback - Called with `(element, index, list)`.
+   * @param {any} [thisArg] - The value to use as `this` inside the callback.
+   * @returns An array of the results.
+   */
+  map<T>(callback: ElementCallback<N, T>, thisArg?: any): T[] {
+    const result: T[] = [];
+    let index = 0;
+    for (const node of this) result.push(callback.call(thisArg, node, index++, this));
+    return result;
+  }
+
+  /**
+   * The function yields the elements from first to last. The next element is read before each one is
+   * yielded, so the current one may be removed during iteration.
+   */
+  protected* _getIterator(): IterableIterator<N> {
+    let node = this._head;
+    while (node) {
+      const next = node.next;
+      yield node;
+      node = next;
+    }
+  }
+
+  protected _unlink(node: N): void {
+    const { prev, next } = node;
+    if (prev) prev.next = next;
+    else this._head = next;
+    if (next) next.prev = prev;
+    else this._tail = prev;
+  }
+}
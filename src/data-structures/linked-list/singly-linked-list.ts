@@ -5,7 +5,7 @@
  * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
  * @license MIT License
  */
-import type { ElementCallback } from '../../types';
+import type { ElementCallback, SinglyLinkedListOptions } from '../../types';
 import { IterableElementBase } from '../base';
 
 export class SinglyLinkedListNode<E = any> {
@@ -59,15 +59,25 @@ export class SinglyLinkedListNode<E = any> {
   }
 }
 
+/**
+ * 1. Node Pooling: With `nodePoolSize`, nodes removed by `pop`, `shift`, `delete` and `deleteAt` are kept on a free
+ *    list of up to that many nodes and reused by the next insertions, so a list that churns at a steady size stops
+ *    allocating. A removed node is then reset and reused, so node handles must not be kept past their removal.
+ */
 export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
   /**
    * The constructor initializes a new instance of a class with an optional iterable of elements.
    * @param elements - The `elements` parameter is an optional iterable object that contains the
    * initial elements to be added to the instance of the class. If no `elements` are provided, an empty
    * array will be used as the default value.
+   * @param [options] - `nodePoolSize`, the number of removed nodes to keep for reuse, 0 (no pooling) by default.
    */
-  constructor(elements: Iterable<E> = []) {
+  constructor(elements: Iterable<E> = [], options?: SinglyLinkedListOptions) {
     super();
+    if (options) {
+      const { nodePoolSize } = options;
+      if (nodePoolSize !== undefined && nodePoolSize > 0) this._nodePoolSize = Math.floor(nodePoolSize);
+    }
     if (elements) {
       for (const el of elements) this.push(el);
     }
@@ -103,6 +113,26 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
     return this._size;
   }
 
+  protected _nodePoolSize: number = 0;
+
+  /**
+   * The function returns the most removed nodes the list keeps for reuse.
+   * @returns The `nodePoolSize` option, 0 when pooling is off.
+   */
+  get nodePoolSize(): number {
+    return this._nodePoolSize;
+  }
+
+  protected _nodePool: SinglyLinkedListNode<E>[] = [];
+
+  /**
+   * The function returns the number of removed nodes waiting to be reused.
+   * @returns The length of the free list.
+   */
+  get pooledNodeCount(): number {
+    return this._nodePool.length;
+  }
+
   /**
    * Time Complexity: O(n)
    * Space Complexity: O(n)
@@ -143,7 +173,7 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
    * any type (E) as specified in the generic type declaration of the class or function.
    */
   push(value: E): boolean {
-    const newNode = new SinglyLinkedListNode(value);
+    const newNode = this._createNode(value);
     if (!this.head) {
       this._head = newNode;
       this._tail = newNode;
@@ -190,10 +220,12 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
   pop(): E | undefined {
     if (!this.head) return undefined;
     if (this.head === this.tail) {
-      const value = this.head.value;
+      const removedNode = this.head;
+      const value = removedNode.value;
       this._head = undefined;
       this._tail = undefined;
       this._size--;
+      this._releaseNode(removedNode);
       return value;
     }
 
@@ -201,10 +233,12 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
     while (current.next !== this.tail) {
       current = current.next!;
     }
-    const value = this.tail!.value;
+    const removedNode = this.tail!;
+    const value = removedNode.value;
     current.next = undefined;
     this._tail = current;
     this._size--;
+    this._releaseNode(removedNode);
     return value;
   }
 
@@ -241,9 +275,12 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
   shift(): E | undefined {
     if (!this.head) return undefined;
     const removedNode = this.head;
-    this._head = this.head.next;
+    const value = removedNode.value;
+    this._head = removedNode.next;
+    if (!this._head) this._tail = undefined;
     this._size--;
-    return removedNode.value;
+    this._releaseNode(removedNode);
+    return value;
   }
 
   /**
@@ -276,7 +313,7 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
    * linked list.
    */
   unshift(value: E): boolean {
-    const newNode = new SinglyLinkedListNode(value);
+    const newNode = this._createNode(value);
     if (!this.head) {
       this._head = newNode;
       this._tail = newNode;
@@ -383,6 +420,7 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
     const removedNode = prevNode!.next;
     prevNode!.next = removedNode!.next;
     this._size--;
+    this._releaseNode(removedNode!);
     return true;
   }
 
@@ -426,6 +464,7 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
           }
         }
         this._size--;
+        this._releaseNode(current);
         return true;
       }
       prev = current;
@@ -463,7 +502,7 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
       return true;
     }
 
-    const newNode = new SinglyLinkedListNode(value);
+    const newNode = this._createNode(value);
     const prevNode = this.getNodeAt(index - 1);
     newNode.next = prevNode!.next;
     prevNode!.next = newNode;
@@ -633,7 +672,7 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
     let current = this.head;
     while (current.next) {
       if (current.next.value === existingValue) {
-        const newNode = new SinglyLinkedListNode(newValue);
+        const newNode = this._createNode(newValue);
         newNode.next = current.next;
         current.next = newNode;
         this._size++;
@@ -671,7 +710,7 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
     }
 
     if (existingNode) {
-      const newNode = new SinglyLinkedListNode(newValue);
+      const newNode = this._createNode(newValue);
       newNode.next = existingNode.next;
       existingNode.next = newNode;
       if (existingNode === this.tail) {
@@ -726,7 +765,7 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
    * is a clone of the original list.
    */
   clone(): SinglyLinkedList<E> {
-    return new SinglyLinkedList<E>(this.values());
+    return new SinglyLinkedList<E>(this.values(), { nodePoolSize: this._nodePoolSize });
   }
 
   /**
@@ -792,6 +831,30 @@ export class SinglyLinkedList<E = any> extends IterableElementBase<E> {
     return mappedList;
   }
 
+  /**
+   * The function takes a node from the free list, or creates one when the list is empty.
+   * @param {E} value - The value of the node.
+   * @returns A node holding `value` with no `next`.
+   */
+  protected _createNode(value: E): SinglyLinkedListNode<E> {
+    const node = this._nodePool.pop();
+    if (node === undefined) return new SinglyLinkedListNode(value);
+    node.value = value;
+    return node;
+  }
+
+  /**
+   * The function puts a removed node on the free list if there is room, dropping its value so that the
+   * pool does not keep it alive.
+   * @param node - A node no longer linked into the list.
+   */
+  protected _releaseNode(node: SinglyLinkedListNode<E>): void {
+    if (this._nodePool.length >= this._nodePoolSize) return;
+    node.value = undefined as E;
+    node.next = undefined;
+    this._nodePool.push(node);
+  }
+
   /**
    * The function `_getIterator` returns an iterable iterator that yields the values of a linked list.
    */
@@ -26,21 +26,29 @@ export class SkipList<K, V> {
    * is used to initialize the SkipLinkedList with the given key-value pairs. If no elements are
    * provided, the SkipLinkedList will be empty.
    * @param {SkipLinkedListOptions} [options] - The `options` parameter is an optional object that can
-   * contain two properties:
+   * contain `maxLevel`, `probability` and a `seed` that makes the node levels reproducible.
    */
   constructor(elements: Iterable<[K, V]> = [], options?: SkipLinkedListOptions) {
+    let seed: number | undefined;
     if (options) {
       const { maxLevel, probability } = options;
       if (typeof maxLevel === 'number') this._maxLevel = maxLevel;
       if (typeof probability === 'number') this._probability = probability;
+      seed = options.seed;
     }
+    this._head = new SkipListNode<K, V>(undefined as any, undefined as any, this._maxLevel);
+    this._update = new Array(this._maxLevel).fill(this._head);
+    this._seed = typeof seed === 'number' ? seed >>> 0 || 1 : ((Math.random() * 0x100000000) >>> 0) || 1;
+    this._random = this._seed;
+    const shift = -Math.log2(this._probability);
+    this._levelShift = Number.isInteger(shift) && shift > 0 ? shift : 0;
 
     if (elements) {
       for (const [key, value] of elements) this.add(key, value);
     }
   }
 
-  protected _head: SkipListNode<K, V> = new SkipListNode<K, V>(undefined as any, undefined as any, this.maxLevel);
+  protected _head: SkipListNode<K, V>;
 
   /**
    * The function returns the head node of a SkipList.
@@ -80,6 +88,35 @@ export class SkipList<K, V> {
     return this._probability;
   }
 
+  protected _seed: number;
+
+  /**
+   * The function returns the seed the level generator started from.
+   * @returns The seed, so a list built with the same seed and operations has the same shape.
+   */
+  get seed(): number {
+    return this._seed;
+  }
+
+  protected _size: number = 0;
+
+  /**
+   * The function returns the number of nodes in the Skip List.
+   * @returns The size of the Skip List.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  // Predecessor buffer shared by add and delete, so neither allocates per call.
+  protected _update: SkipListNode<K, V>[];
+
+  // The xorshift32 state behind _randomLevel.
+  protected _random: number;
+
+  // log2(1 / probability) when that is a whole number, otherwise 0.
+  protected _levelShift: number;
+
   /**
    * Time Complexity: O(log n)
    * Space Complexity: O(1)
@@ -128,31 +165,79 @@ export class SkipList<K, V> {
    * Time Complexity: O(log n)
    * Space Complexity: O(1)
    *
-   * The add function adds a new node with a given key and value to a Skip List data structure.
+   * The add function adds a new node with a given key and value to a Skip List data structure. A key that is
+   * already present is added again after the existing ones, so equal keys come out in insertion order.
    * @param {K} key - The key parameter represents the key of the node that needs to be added to the skip list.
    * @param {V} value - The "value" parameter represents the value associated with the key that is being added to the Skip
    * List.
    */
   add(key: K, value: V): void {
-    const newNode = new SkipListNode(key, value, this._randomLevel());
-    const update: SkipListNode<K, V>[] = new Array(this.maxLevel).fill(this.head);
+    const level = this._randomLevel();
+    const newNode = new SkipListNode(key, value, level);
+    const update = this._update;
     let current = this.head;
 
     for (let i = this.level - 1; i >= 0; i--) {
-      while (current.forward[i] && current.forward[i].key < key) {
-        current = current.forward[i];
+      let next = current.forward[i];
+      while (next && next.key <= key) {
+        current = next;
+        next = current.forward[i];
       }
       update[i] = current;
     }
+    for (let i = this.level; i < level; i++) update[i] = this.head;
 
-    for (let i = 0; i < newNode.forward.length; i++) {
+    for (let i = 0; i < level; i++) {
       newNode.forward[i] = update[i].forward[i];
       update[i].forward[i] = newNode;
     }
 
-    if (!newNode.forward[0]) {
-      this._level = Math.max(this.level, newNode.forward.length);
+    if (level > this._level) this._level = level;
+    this._size++;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(maxLevel)
+   */
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(maxLevel)
+   *
+   * The `addSorted` function appends entries whose keys are in ascending order in a single pass. It keeps the last
+   * node of every level and links each new node behind them, so no search is needed per entry.
+   * @param entries - Key-value pairs sorted by key, with the first key not less than the current last key.
+   * @returns The number of entries added.
+   */
+  addSorted(entries: Iterable<[K, V]>): number {
+    const tails = this._update;
+    let current = this.head;
+    for (let i = this.level - 1; i >= 0; i--) {
+      while (current.forward[i]) current = current.forward[i];
+      tails[i] = current;
     }
+    for (let i = this.level; i < this.maxLevel; i++) tails[i] = this.head;
+
+    let lastKey = current === this.head ? undefined : current.key;
+    let count = 0;
+    for (const [key, value] of entries) {
+      if (lastKey !== undefined && key < lastKey) {
+        this._size += count;
+        throw new Error('addSorted requires keys in ascending order, starting at or after the last key');
+      }
+      const level = this._randomLevel();
+      const node = new SkipListNode(key, value, level);
+      for (let i = 0; i < level; i++) {
+        tails[i].forward[i] = node;
+        tails[i] = node;
+      }
+      if (level > this._level) this._level = level;
+      lastKey = key;
+      count++;
+    }
+    this._size += count;
+    return count;
   }
 
   /**
@@ -172,8 +257,10 @@ export class SkipList<K, V> {
   get(key: K): V | undefined {
     let current = this.head;
     for (let i = this.level - 1; i >= 0; i--) {
-      while (current.forward[i] && current.forward[i].key < key) {
-        current = current.forward[i];
+      let next = current.forward[i];
+      while (next && next.key < key) {
+        current = next;
+        next = current.forward[i];
       }
     }
 
@@ -216,12 +303,14 @@ export class SkipList<K, V> {
    * skip list, and `false` if the key was not found in the skip list.
    */
   delete(key: K): boolean {
-    const update: SkipListNode<K, V>[] = new Array(this.maxLevel).fill(this.head);
+    const update = this._update;
     let current = this.head;
 
     for (let i = this.level - 1; i >= 0; i--) {
-      while (current.forward[i] && current.forward[i].key < key) {
-        current = current.forward[i];
+      let next = current.forward[i];
+      while (next && next.key < key) {
+        current = next;
+        next = current.forward[i];
       }
       update[i] = current;
     }
@@ -238,12 +327,143 @@ export class SkipList<K, V> {
       while (this.level > 0 && !this.head.forward[this.level - 1]) {
         this._level--;
       }
+      this._size--;
       return true;
     }
 
     return false;
   }
 
+  /**
+   * Time Complexity: O(1) on average
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1) on average
+   * Space Complexity: O(1)
+   *
+   * The `pollFirst` function removes the node with the smallest key. The head is the only predecessor of the first
+   * node on every level it occupies, so no search is needed.
+   * @returns The removed `[key, value]` pair, or undefined if the Skip List is empty.
+   */
+  pollFirst(): [K, V] | undefined {
+    const node = this.head.forward[0];
+    if (!node) return undefined;
+    for (let i = 0; i < node.forward.length; i++) {
+      this.head.forward[i] = node.forward[i];
+    }
+    while (this.level > 0 && !this.head.forward[this.level - 1]) {
+      this._level--;
+    }
+    this._size--;
+    return [node.key, node.value];
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function returns the first `[key, value]` pair without removing it.
+   * @returns The pair with the smallest key, or undefined if the Skip List is empty.
+   */
+  firstEntry(): [K, V] | undefined {
+    const node = this.head.forward[0];
+    return node ? [node.key, node.value] : undefined;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function returns the last `[key, value]` pair without removing it.
+   * @returns The pair with the largest key, or undefined if the Skip List is empty.
+   */
+  lastEntry(): [K, V] | undefined {
+    let current = this.head;
+    for (let i = this.level - 1; i >= 0; i--) {
+      while (current.forward[i]) current = current.forward[i];
+    }
+    return current === this.head ? undefined : [current.key, current.value];
+  }
+
+  /**
+   * Time Complexity: O(log n + k)
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(log n + k), where k is the number of pairs yielded
+   * Space Complexity: O(1)
+   *
+   * The `range` function yields the `[key, value]` pairs with `lo <= key <= hi` in ascending order. Removed nodes keep
+   * their forward pointers, so an iteration that is in progress while nodes are added or deleted keeps walking the
+   * list instead of stopping early.
+   * @param {K} lo - The lower bound, inclusive.
+   * @param {K} hi - The upper bound, inclusive.
+   */
+  *range(lo: K, hi: K): IterableIterator<[K, V]> {
+    let current = this.head;
+    for (let i = this.level - 1; i >= 0; i--) {
+      while (current.forward[i] && current.forward[i].key < lo) {
+        current = current.forward[i];
+      }
+    }
+    let node = current.forward[0];
+    while (node && node.key <= hi) {
+      yield [node.key, node.value];
+      node = node.forward[0];
+    }
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(1)
+   *
+   * The function iterates over all `[key, value]` pairs in ascending key order.
+   */
+  *[Symbol.iterator](): IterableIterator<[K, V]> {
+    let node = this.head.forward[0];
+    while (node) {
+      yield [node.key, node.value];
+      node = node.forward[0];
+    }
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function checks whether the Skip List has no nodes.
+   * @returns True if the Skip List is empty.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Time Complexity: O(maxLevel)
+   * Space Complexity: O(1)
+   *
+   * The function removes every node and restarts the level generator from the seed.
+   */
+  clear(): void {
+    this.head.forward.fill(undefined as any);
+    this._level = 0;
+    this._size = 0;
+    this._random = this._seed;
+  }
+
   /**
    * Time Complexity: O(log n)
    * Space Complexity: O(1)
@@ -260,8 +480,10 @@ export class SkipList<K, V> {
   higher(key: K): V | undefined {
     let current = this.head;
     for (let i = this.level - 1; i >= 0; i--) {
-      while (current.forward[i] && current.forward[i].key <= key) {
-        current = current.forward[i];
+      let next = current.forward[i];
+      while (next && next.key <= key) {
+        current = next;
+        next = current.forward[i];
       }
     }
     const nextNode = current.forward[0];
@@ -286,8 +508,10 @@ export class SkipList<K, V> {
     let lastLess = undefined;
 
     for (let i = this.level - 1; i >= 0; i--) {
-      while (current.forward[i] && current.forward[i].key < key) {
-        current = current.forward[i];
+      let next = current.forward[i];
+      while (next && next.key < key) {
+        current = next;
+        next = current.forward[i];
       }
       if (current.key < key) {
         lastLess = current;
@@ -307,14 +531,36 @@ export class SkipList<K, V> {
    * Time Complexity: O(maxLevel)
    * Space Complexity: O(1)
    *
-   * The function "_randomLevel" generates a random level based on a given probability and maximum level.
+   * The function "_randomLevel" generates a random level based on a given probability and maximum level. When the
+   * probability is a power of two, one random word decides the level: each trailing zero bit is a coin flip, so
+   * `1 + ctz(word) / log2(1 / probability)` has the same distribution as flipping coins one by one.
    * @returns the level, which is a number.
    */
   protected _randomLevel(): number {
+    const shift = this._levelShift;
+    if (shift > 0) {
+      const word = this._nextRandom();
+      const zeros = word === 0 ? 32 : 31 - Math.clz32(word & -word);
+      const level = 1 + Math.floor(zeros / shift);
+      return level < this.maxLevel ? level : this.maxLevel;
+    }
     let level = 1;
-    while (Math.random() < this.probability && level < this.maxLevel) {
+    while (this._nextRandom() / 0x100000000 < this.probability && level < this.maxLevel) {
       level++;
     }
     return level;
   }
+
+  /**
+   * The function advances the xorshift32 generator.
+   * @returns An unsigned 32-bit random word.
+   */
+  protected _nextRandom(): number {
+    let x = this._random;
+    x ^= x << 13;
+    x ^= x >>> 17;
+    x ^= x << 5;
+    this._random = x >>> 0;
+    return this._random;
+  }
 }
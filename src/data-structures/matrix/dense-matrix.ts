@@ -0,0 +1,591 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+
+/**
+ * 1. Storage: A DenseMatrix keeps its elements in one row-major Float64Array, element (i, j) at `i * cols + j`, instead of an array per row. Operations are plain loops over the array with no callbacks, so they suit numeric work; `Matrix` with `addFn`/`multiplyFn` remains for custom semirings.
+ * 2. Multiplication: `multiply` transposes the right operand once so both operands are read along rows, then works in 64 x 64 tiles that stay in cache, computing four results at a time with one read of the left row.
+ * 3. In Place: `addInPlace`, `subtractInPlace` and `scaleInPlace` change the matrix without allocating.
+ * 4. LU Decomposition: `lu()` factorizes a square matrix once with partial pivoting and keeps the result until the matrix changes through its methods, so `inverse`, `solve` and `determinant` reuse it.
+ */
+export class DenseMatrix {
+  /**
+   * The constructor wraps a row-major array, or creates a zero matrix.
+   * @param {number} rows - The number of rows.
+   * @param {number} cols - The number of columns.
+   * @param {Float64Array} [data] - `rows * cols` elements in row-major order. It is used as is, not
+   * copied.
+   */
+  constructor(rows: number, cols: number, data?: Float64Array) {
+    if (!Number.isInteger(rows) || !Number.isInteger(cols) || rows < 0 || cols < 0) {
+      throw new Error('DenseMatrix dimensions must be non-negative integers.');
+    }
+    if (data && data.length !== rows * cols) {
+      throw new Error('DenseMatrix data length must equal rows * cols.');
+    }
+    this._rows = rows;
+    this._cols = cols;
+    this._data = data ?? new Float64Array(rows * cols);
+  }
+
+  /**
+   * Time Complexity: O(rows * cols)
+   * Space Complexity: O(rows * cols)
+   *
+   * The function copies a two-dimensional array into a DenseMatrix.
+   * @param {number[][]} data - The rows, all of the same length.
+   * @returns {DenseMatrix} A new DenseMatrix.
+   */
+  static from(data: number[][]): DenseMatrix {
+    const rows = data.length;
+    const cols = data[0]?.length ?? 0;
+    const matrix = new DenseMatrix(rows, cols);
+    for (let i = 0; i < rows; i++) {
+      if (data[i].length !== cols) throw new Error('Matrix must be rectangular.');
+      matrix._data.set(data[i], i * cols);
+    }
+    return matrix;
+  }
+
+  /**
+   * Time Complexity: O(n^2)
+   * Space Complexity: O(n^2)
+   *
+   * The function creates an identity matrix.
+   * @param {number} n - The number of rows and columns.
+   * @returns {DenseMatrix} A new DenseMatrix.
+   */
+  static identity(n: number): DenseMatrix {
+    const matrix = new DenseMatrix(n, n);
+    for (let i = 0; i < n; i++) matrix._data[i * n + i] = 1;
+    return matrix;
+  }
+
+  protected _rows: number;
+
+  /**
+   * The function returns the number of rows.
+   * @returns The number of rows.
+   */
+  get rows(): number {
+    return this._rows;
+  }
+
+  protected _cols: number;
+
+  /**
+   * The function returns the number of columns.
+   * @returns The number of columns.
+   */
+  get cols(): number {
+    return this._cols;
+  }
+
+  protected _data: Float64Array;
+
+  /**
+   * The function returns the row-major storage. Writing to it directly does not discard a cached LU
+   * decomposition; use `set` for that.
+   * @returns The `_data` array.
+   */
+  get data(): Float64Array {
+    return this._data;
+  }
+
+  protected _lu?: LUDecomposition;
+
+  /**
+   * The `get` function returns the element at a row and column if the index is valid.
+   * @param {number} row - The row index.
+   * @param {number} col - The column index.
+   * @returns The element, or `undefined` if the index is out of range.
+   */
+  get(row: number, col: number): number | undefined {
+    if (this.isValidIndex(row, col)) return this._data[row * this._cols + col];
+  }
+
+  /**
+   * The `set` function changes the element at a row and column if the index is valid.
+   * @param {number} row - The row index.
+   * @param {number} col - The column index.
+   * @param {number} value - The new element.
+   * @returns True if the index is valid and the element was set.
+   */
+  set(row: number, col: number, value: number): boolean {
+    if (!this.isValidIndex(row, col)) return false;
+    this._data[row * this._cols + col] = value;
+    this._lu = undefined;
+    return true;
+  }
+
+  /**
+   * The function checks if a row and column index is inside the matrix.
+   * @param {number} row - The row index.
+   * @param {number} col - The column index.
+   * @returns A boolean value.
+   */
+  isValidIndex(row: number, col: number): boolean {
+    return row >= 0 && row < this._rows && col >= 0 && col < this._cols;
+  }
+
+  /**
+   * The function checks if the dimensions of another matrix match this one.
+   * @param {DenseMatrix} matrix - The other matrix.
+   * @returns A boolean value.
+   */
+  isMatchForCalculate(matrix: DenseMatrix): boolean {
+    return this._rows === matrix.rows && this._cols === matrix.cols;
+  }
+
+  /**
+   * Time Complexity: O(rows * cols)
+   * Space Complexity: O(rows * cols)
+   *
+   * The `add` function adds two matrices element by element.
+   * @param {DenseMatrix} matrix - A matrix of the same dimensions.
+   * @returns {DenseMatrix} A new DenseMatrix.
+   */
+  add(matrix: DenseMatrix): DenseMatrix {
+    return this.clone().addInPlace(matrix);
+  }
+
+  /**
+   * Time Complexity: O(rows * cols)
+   * Space Complexity: O(1)
+   *
+   * The `addInPlace` function adds another matrix to this one element by element.
+   * @param {DenseMatrix} matrix - A matrix of the same dimensions.
+   * @returns {DenseMatrix} This matrix.
+   */
+  addInPlace(matrix: DenseMatrix): DenseMatrix {
+    if (!this.isMatchForCalculate(matrix)) {
+      throw new Error('Matrix dimensions must match for addition.');
+    }
+    const a = this._data,
+      b = matrix.data;
+    for (let i = 0; i < a.length; i++) a[i] += b[i];
+    this._lu = undefined;
+    return this;
+  }
+
+  /**
+   * Time Complexity: O(rows * cols)
+   * Space Complexity: O(rows * cols)
+   *
+   * The `subtract` function subtracts another matrix element by element.
+   * @param {DenseMatrix} matrix - A matrix of the same dimensions.
+   * @returns {DenseMatrix} A new DenseMatrix.
+   */
+  subtract(matrix: DenseMatrix): DenseMatrix {
+    return this.clone().subtractInPlace(matrix);
+  }
+
+  /**
+   * Time Complexity: O(rows * cols)
+   * Space Complexity: O(1)
+   *
+   * The `subtractInPlace` function subtracts another matrix from this one element by element.
+   * @param {DenseMatrix} matrix - A matrix of the same dimensions.
+   * @returns {DenseMatrix} This matrix.
+   */
+  subtractInPlace(matrix: DenseMatrix): DenseMatrix {
+    if (!this.isMatchForCalculate(matrix)) {
+      throw new Error('Matrix dimensions must match for subtraction.');
+    }
+    const a = this._data,
+      b = matrix.data;
+    for (let i = 0; i < a.length; i++) a[i] -= b[i];
+    this._lu = undefined;
+    return this;
+  }
+
+  /**
+   * Time Complexity: O(rows * cols)
+   * Space Complexity: O(rows * cols)
+   *
+   * The `scale` function multiplies every element by a scalar.
+   * @param {number} scalar - The factor.
+   * @returns {DenseMatrix} A new DenseMatrix.
+   */
+  scale(scalar: number): DenseMatrix {
+    return this.clone().scaleInPlace(scalar);
+  }
+
+  /**
+   * Time Complexity: O(rows * cols)
+   * Space Complexity: O(1)
+   *
+   * The `scaleInPlace` function multiplies every element of this matrix by a scalar.
+   * @param {number} scalar - The factor.
+   * @returns {DenseMatrix} This matrix.
+   */
+  scaleInPlace(scalar: number): DenseMatrix {
+    const a = this._data;
+    for (let i = 0; i < a.length; i++) a[i] *= scalar;
+    this._lu = undefined;
+    return this;
+  }
+
+  /**
+   * Time Complexity: O(rows * cols * matrix.cols)
+   * Space Complexity: O(cols * matrix.cols) - The transposed copy of the right operand.
+   *
+   * The `multiply` function computes the matrix product. Every result element sums its products in
+   * ascending order of the inner index, like the textbook loop, so the blocking does not change
+   * rounding.
+   * @param {DenseMatrix} matrix - A matrix with as many rows as this one has columns.
+   * @returns {DenseMatrix} A new DenseMatrix with `rows` rows and `matrix.cols` columns.
+   */
+  multiply(matrix: DenseMatrix): DenseMatrix {
+    if (this._cols !== matrix.rows) {
+      throw new Error('Matrix dimensions must be compatible for multiplication (A.cols = B.rows).');
+    }
+    const rows = this._rows,
+      inner = this._cols,
+      cols = matrix.cols;
+    const a = this._data,
+      bt = matrix.transpose().data,
+      c = new Float64Array(rows * cols);
+    const tile = DenseMatrix.TILE;
+
+    for (let ii = 0; ii < rows; ii += tile) {
+      const iEnd = Math.min(ii + tile, rows);
+      for (let jj = 0; jj < cols; jj += tile) {
+        const jEnd = Math.min(jj + tile, cols);
+        for (let kk = 0; kk < inner; kk += tile) {
+          const kEnd = Math.min(kk + tile, inner);
+          for (let i = ii; i < iEnd; i++) {
+            const aRow = i * inner,
+              cRow = i * cols;
+            let j = jj;
+            for (; j + 3 < jEnd; j += 4) {
+              const b0 = j * inner,
+                b1 = b0 + inner,
+                b2 = b1 + inner,
+                b3 = b2 + inner;
+              let s0 = c[cRow + j],
+                s1 = c[cRow + j + 1],
+                s2 = c[cRow + j + 2],
+                s3 = c[cRow + j + 3];
+              for (let k = kk; k < kEnd; k++) {
+                const x = a[aRow + k];
+                s0 += x * bt[b0 + k];
+                s1 += x * bt[b1 + k];
+                s2 += x * bt[b2 + k];
+                s3 += x * bt[b3 + k];
+              }
+              c[cRow + j] = s0;
+              c[cRow + j + 1] = s1;
+              c[cRow + j + 2] = s2;
+              c[cRow + j + 3] = s3;
+            }
+            for (; j < jEnd; j++) {
+              const b0 = j * inner;
+              let s0 = c[cRow + j];
+              for (let k = kk; k < kEnd; k++) s0 += a[aRow + k] * bt[b0 + k];
+              c[cRow + j] = s0;
+            }
+          }
+        }
+      }
+    }
+
+    return new DenseMatrix(rows, cols, c);
+  }
+
+  /**
+   * Time Complexity: O(rows * cols)
+   * Space Complexity: O(rows * cols)
+   *
+   * The transpose function returns a new matrix with rows and columns swapped, copied in tiles so
+   * that neither side is read with a large stride for long.
+   * @returns {DenseMatrix} A new DenseMatrix with `cols` rows and `rows` columns.
+   */
+  transpose(): DenseMatrix {
+    const rows = this._rows,
+      cols = this._cols;
+    const a = this._data,
+      t = new Float64Array(rows * cols);
+    const tile = DenseMatrix.TILE;
+    for (let ii = 0; ii < rows; ii += tile) {
+      const iEnd = Math.min(ii + tile, rows);
+      for (let jj = 0; jj < cols; jj += tile) {
+        const jEnd = Math.min(jj + tile, cols);
+        for (let i = ii; i < iEnd; i++) {
+          for (let j = jj; j < jEnd; j++) t[j * rows + i] = a[i * cols + j];
+        }
+      }
+    }
+    return new DenseMatrix(cols, rows, t);
+  }
+
+  /**
+   * Time Complexity: O(n^3) the first time, O(1) until the matrix changes.
+   * Space Complexity: O(n^2)
+   *
+   * The `lu` function returns the LU decomposition with partial pivoting of a square matrix.
+   * @returns {LUDecomposition} The decomposition, cached on the matrix.
+   */
+  lu(): LUDecomposition {
+    if (this._rows !== this._cols) {
+      throw new Error('Matrix must be square for LU decomposition.');
+    }
+    if (!this._lu) this._lu = new LUDecomposition(this);
+    return this._lu;
+  }
+
+  /**
+   * Time Complexity: O(n^3)
+   * Space Complexity: O(n^2)
+   *
+   * The `inverse` function calculates the inverse of a square matrix from its LU decomposition.
+   * @returns {DenseMatrix} A new DenseMatrix.
+   */
+  inverse(): DenseMatrix {
+    if (this._rows !== this._cols) {
+      throw new Error('Matrix must be square for inversion.');
+    }
+    return this.lu().inverse();
+  }
+
+  /**
+   * Time Complexity: O(n^2) once the LU decomposition is known.
+   * Space Complexity: O(n)
+   *
+   * The `solve` function solves `A x = b` for a square matrix `A`.
+   * @param b - The right-hand side, of length `rows`.
+   * @returns {Float64Array} The solution `x`.
+   */
+  solve(b: ArrayLike<number>): Float64Array {
+    return this.lu().solve(b);
+  }
+
+  /**
+   * Time Complexity: O(1) once the LU decomposition is known.
+   * Space Complexity: O(1)
+   *
+   * The `determinant` function returns the determinant of a square matrix.
+   * @returns The determinant.
+   */
+  determinant(): number {
+    return this.lu().determinant;
+  }
+
+  /**
+   * Time Complexity: O(rows * cols)
+   * Space Complexity: O(rows * cols)
+   *
+   * The function copies the matrix into a two-dimensional array, for example to build a `Matrix`.
+   * @returns The rows as arrays of numbers.
+   */
+  toArray(): number[][] {
+    const result: number[][] = [];
+    for (let i = 0; i < this._rows; i++) {
+      result.push(Array.from(this._data.subarray(i * this._cols, (i + 1) * this._cols)));
+    }
+    return result;
+  }
+
+  /**
+   * Time Complexity: O(rows * cols)
+   * Space Complexity: O(rows * cols)
+   *
+   * The `clone` function returns a copy of the matrix, without the cached decomposition.
+   * @returns {DenseMatrix} A new DenseMatrix.
+   */
+  clone(): DenseMatrix {
+    return new DenseMatrix(this._rows, this._cols, this._data.slice());
+  }
+
+  /**
+   * The side of the square tiles `multiply` and `transpose` work in. 64 x 64 doubles are 32 KiB, so
+   * a tile of each operand fits in a typical L2 cache.
+   */
+  static TILE = 64;
+}
+
+/**
+ * 1. Factorization: An LUDecomposition holds `P A = L U` for a square matrix `A`, with `L` unit lower triangular and `U` upper triangular stored together in one row-major Float64Array, and the row permutation `P` as an index array.
+ * 2. Pivoting: Each column takes the row with the largest absolute value as the pivot, which keeps the elimination stable. A zero pivot marks the matrix as singular.
+ * 3. Reuse: Solving for a right-hand side is a forward and a backward substitution, O(n^2), so an inverse costs one factorization plus n solves.
+ */
+export class LUDecomposition {
+  /**
+   * The constructor factorizes a copy of a square matrix. `DenseMatrix.prototype.lu` calls it and
+   * caches the result.
+   * @param {DenseMatrix} matrix - The square matrix.
+   */
+  constructor(matrix: DenseMatrix) {
+    const n = matrix.rows;
+    const lu = matrix.data.slice();
+    const pivots = new Int32Array(n);
+    for (let i = 0; i < n; i++) pivots[i] = i;
+    let sign = 1;
+    let isSingular = false;
+
+    for (let k = 0; k < n; k++) {
+      let pivot = k;
+      let max = Math.abs(lu[k * n + k]);
+      for (let i = k + 1; i < n; i++) {
+        const value = Math.abs(lu[i * n + k]);
+        if (value > max) {
+          max = value;
+          pivot = i;
+        }
+      }
+      if (max === 0) {
+        isSingular = true;
+        continue;
+      }
+      if (pivot !== k) {
+        for (let j = 0; j < n; j++) {
+          const temp = lu[k * n + j];
+          lu[k * n + j] = lu[pivot * n + j];
+          lu[pivot * n + j] = temp;
+        }
+        const temp = pivots[k];
+        pivots[k] = pivots[pivot];
+        pivots[pivot] = temp;
+        sign = -sign;
+      }
+
+      const diagonal = lu[k * n + k];
+      for (let i = k + 1; i < n; i++) {
+        const row = i * n;
+        const factor = (lu[row + k] /= diagonal);
+        if (factor === 0) continue;
+        for (let j = k + 1; j < n; j++) lu[row + j] -= factor * lu[k * n + j];
+      }
+    }
+
+    this._size = n;
+    this._lu = lu;
+    this._pivots = pivots;
+    this._sign = sign;
+    this._isSingular = isSingular;
+  }
+
+  protected _size: number;
+
+  /**
+   * The function returns the number of rows and columns of the factorized matrix.
+   * @returns The `_size` property is being returned.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  protected _lu: Float64Array;
+
+  /**
+   * The function returns `L` below the diagonal and `U` on and above it, row-major.
+   * @returns The `_lu` array.
+   */
+  get lu(): Float64Array {
+    return this._lu;
+  }
+
+  protected _pivots: Int32Array;
+
+  /**
+   * The function returns the permutation: row `i` of `L U` is row `pivots[i]` of the matrix.
+   * @returns The `_pivots` array.
+   */
+  get pivots(): Int32Array {
+    return this._pivots;
+  }
+
+  protected _sign: number;
+
+  protected _isSingular: boolean;
+
+  /**
+   * The function returns whether the matrix is singular, in which case it has no inverse.
+   * @returns The `_isSingular` property is being returned.
+   */
+  get isSingular(): boolean {
+    return this._isSingular;
+  }
+
+  /**
+   * The function returns the determinant, the product of the pivots with the sign of the permutation.
+   * @returns The determinant, 0 for a singular matrix.
+   */
+  get determinant(): number {
+    if (this._isSingular) return 0;
+    const n = this._size;
+    let determinant = this._sign;
+    for (let i = 0; i < n; i++) determinant *= this._lu[i * n + i];
+    return determinant;
+  }
+
+  /**
+   * Time Complexity: O(n^2)
+   * Space Complexity: O(n)
+   *
+   * The `solve` function solves `A x = b` by forward and backward substitution.
+   * @param b - The right-hand side, of length n.
+   * @returns {Float64Array} The solution `x`.
+   */
+  solve(b: ArrayLike<number>): Float64Array {
+    if (b.length !== this._size) throw new Error('Right-hand side length must equal the matrix size.');
+    const x = new Float64Array(this._size);
+    for (let i = 0; i < this._size; i++) x[i] = b[this._pivots[i]];
+    this._substitute(x, 1);
+    return x;
+  }
+
+  /**
+   * Time Complexity: O(n^3)
+   * Space Complexity: O(n^2)
+   *
+   * The `inverse` function solves for all columns of the identity matrix at once.
+   * @returns {DenseMatrix} A new DenseMatrix.
+   */
+  inverse(): DenseMatrix {
+    const n = this._size;
+    const inverse = new Float64Array(n * n);
+    for (let i = 0; i < n; i++) inverse[i * n + this._pivots[i]] = 1;
+    this._substitute(inverse, n);
+    return new DenseMatrix(n, n, inverse);
+  }
+
+  /**
+   * The function runs the forward substitution with `L` and the backward substitution with `U` in
+   * place on an n x m row-major right-hand side. It subtracts whole rows, so every pass reads memory
+   * in order.
+   * @param {Float64Array} x - The permuted right-hand side, overwritten with the solution.
+   * @param {number} m - The number of right-hand sides, the columns of `x`.
+   */
+  protected _substitute(x: Float64Array, m: number): void {
+    if (this._isSingular) {
+      throw new Error('Matrix is singular, and its inverse does not exist.');
+    }
+    const n = this._size,
+      lu = this._lu;
+    for (let i = 1; i < n; i++) {
+      const row = i * m;
+      for (let k = 0; k < i; k++) {
+        const factor = lu[i * n + k];
+        if (factor === 0) continue;
+        const source = k * m;
+        for (let j = 0; j < m; j++) x[row + j] -= factor * x[source + j];
+      }
+    }
+    for (let i = n - 1; i >= 0; i--) {
+      const row = i * m;
+      for (let k = i + 1; k < n; k++) {
+        const factor = lu[i * n + k];
+        if (factor === 0) continue;
+        const source = k * m;
+        for (let j = 0; j < m; j++) x[row + j] -= factor * x[source + j];
+      }
+      const diagonal = lu[i * n + i];
+      for (let j = 0; j < m; j++) x[row + j] /= diagonal;
+    }
+  }
+}
@@ -1,2 +1,3 @@
 export * from './matrix';
 export * from './navigator';
+export * from './dense-matrix';
@@ -6,6 +6,7 @@
  * @license MIT License
  */
 import type { MatrixOptions } from '../../types';
+import { DenseMatrix } from './dense-matrix';
 
 export class Matrix {
   /**
@@ -212,7 +213,7 @@ export class Matrix {
 
   /**
    * The `multiply` function performs matrix multiplication between two matrices and returns the result
-   * as a new matrix.
+   * as a new matrix. Without a custom `addFn` or `multiplyFn`, it runs on `DenseMatrix`.
    * @param {Matrix} matrix - The `matrix` parameter is an instance of the `Matrix` class.
    * @returns a new Matrix object.
    */
@@ -220,6 +221,7 @@ export class Matrix {
     if (this.cols !== matrix.rows) {
       throw new Error('Matrix dimensions must be compatible for multiplication (A.cols = B.rows).');
     }
+    if (this._isDense() && matrix._isDense()) return this._multiplyDense(matrix);
 
     const resultData: number[][] = [];
     for (let i = 0; i < this.rows; i++) {
@@ -358,7 +360,8 @@ export class Matrix {
   }
 
   /**
-   * The dot function calculates the dot product of two matrices and returns a new matrix.
+   * The dot function calculates the dot product of two matrices and returns a new matrix. Without a
+   * custom `addFn` or `multiplyFn`, it runs on `DenseMatrix`.
    * @param {Matrix} matrix - The `matrix` parameter is an instance of the `Matrix` class.
    * @returns a new Matrix object.
    */
@@ -368,6 +371,7 @@ export class Matrix {
         'Number of columns in the first matrix must be equal to the number of rows in the second matrix for dot product.'
       );
     }
+    if (this._isDense() && matrix._isDense()) return this._multiplyDense(matrix);
 
     const resultData: number[][] = [];
     for (let i = 0; i < this.rows; i++) {
@@ -425,6 +429,34 @@ export class Matrix {
     });
   }
 
+  /**
+   * The function checks if the matrix can be multiplied as a DenseMatrix: it uses the default
+   * `addFn` and `multiplyFn`, and every row holds `cols` elements.
+   * @returns A boolean value.
+   */
+  protected _isDense(): boolean {
+    if (this._addFn !== Matrix.prototype._addFn || this._multiplyFn !== Matrix.prototype._multiplyFn) return false;
+    if (this.rows === 0 || this.cols === 0 || this.data.length !== this.rows) return false;
+    return this.data.every(row => row.length === this.cols);
+  }
+
+  /**
+   * The function multiplies two matrices with `DenseMatrix.multiply` and copies the product back
+   * into rows.
+   * @param {Matrix} matrix - A matrix for which `_isDense` holds, with `cols` rows.
+   * @returns a new Matrix object.
+   */
+  protected _multiplyDense(matrix: Matrix): Matrix {
+    const product = DenseMatrix.from(this.data).multiply(DenseMatrix.from(matrix.data));
+    return new Matrix(product.toArray(), {
+      rows: this.rows,
+      cols: matrix.cols,
+      addFn: this.addFn,
+      subtractFn: this.subtractFn,
+      multiplyFn: this.multiplyFn
+    });
+  }
+
   protected _addFn(a: number | undefined, b: number): number | undefined {
     if (a === undefined) return b;
     return a + b;
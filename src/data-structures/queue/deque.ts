@@ -5,7 +5,7 @@
  * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
  * @license MIT License
  */
-import type { DequeOptions, ElementCallback, IterableWithSizeOrLength } from '../../types';
+import type { DequeOptions, ElementCallback, InstrumentedMethods, IterableWithSizeOrLength } from '../../types';
 import { IterableElementBase } from '../base';
 import { calcMinUnitsRequired, rangeCheck } from '../../utils';
 
@@ -932,6 +932,14 @@ export class Deque<E> extends IterableElementBase<E> {
     this._bucketCount = newBuckets.length;
   }
 
+  /**
+   * The function counts the reallocations of the bucket array.
+   * @returns The methods `enableStats` wraps.
+   */
+  protected override _instrumentedMethods(): InstrumentedMethods {
+    return { ...super._instrumentedMethods(), _reallocate: 'reallocations' };
+  }
+
   /**
    * Time Complexity: O(1)
    * Space Complexity: O(1)
@@ -1,2 +1,5 @@
 export * from './queue';
 export * from './deque';
+export * from './numeric-deque';
+export * from './shared-queue';
+export * from './persistent-deque';
@@ -0,0 +1,519 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { ElementCallback, NumericDequeOptions } from '../../types';
+import { IterableElementBase } from '../base';
+import { rangeCheck } from '../../utils';
+
+/**
+ * 1. Numbers Only: A NumericDeque stores numbers in `Float64Array` buckets, exactly 8 bytes per element and nothing the garbage collector has to trace, which suits streams of samples such as tick data.
+ * 2. Bucket Map: The buckets hang off a ring whose length is a power of two, and so is the bucket size, so finding an element takes a shift and two masks. Both ends grow and shrink in O(1); only the ring of bucket references ever doubles.
+ * 3. Pooling: A bucket emptied by `shift` or `pop` goes to a small pool and is reused by the next bucket needed, so a sliding window allocates nothing once it is warm.
+ * 4. Views: `sliceView` returns a window as subarrays of the buckets without copying. The views share memory with the deque and are only valid until it next changes.
+ */
+export class NumericDeque extends IterableElementBase<number> {
+  /**
+   * The constructor initializes a NumericDeque with optional numbers and options.
+   * @param elements - The numbers to push initially, in order.
+   * @param [options] - `bucketSize` is the number of elements per bucket, a power of two, 4096 by default. `poolSize`
+   * is the most empty buckets kept for reuse, 4 by default.
+   */
+  constructor(elements: Iterable<number> = [], options?: NumericDequeOptions) {
+    super();
+    if (options) {
+      const { bucketSize, poolSize } = options;
+      if (bucketSize !== undefined) {
+        if (!(Number.isInteger(bucketSize) && bucketSize > 0 && (bucketSize & (bucketSize - 1)) === 0)) {
+          throw new Error('NumericDeque bucketSize must be a power of two');
+        }
+        this._bucketSize = bucketSize;
+      }
+      if (poolSize !== undefined) this._poolSize = Math.max(0, poolSize);
+    }
+    this._bucketShift = 31 - Math.clz32(this._bucketSize);
+    this._bucketMask = this._bucketSize - 1;
+    this._map = [new Float64Array(this._bucketSize), undefined, undefined, undefined];
+    this._mapMask = this._map.length - 1;
+    this._start = this._bucketSize >> 1;
+
+    if (elements) {
+      for (const element of elements) this.push(element);
+    }
+  }
+
+  protected _bucketSize = 1 << 12;
+
+  /**
+   * The function returns the number of elements per bucket.
+   * @returns The `bucketSize` property is being returned.
+   */
+  get bucketSize(): number {
+    return this._bucketSize;
+  }
+
+  protected _poolSize = 4;
+
+  /**
+   * The function returns the most empty buckets kept for reuse.
+   * @returns The `poolSize` property is being returned.
+   */
+  get poolSize(): number {
+    return this._poolSize;
+  }
+
+  protected _bucketShift: number;
+
+  protected _bucketMask: number;
+
+  // The ring of buckets; the slots from `_mapHead` hold the buckets in use, in order
+  protected _map: (Float64Array | undefined)[];
+
+  protected _mapMask: number;
+
+  protected _mapHead = 0;
+
+  // The index of the first element within the first bucket
+  protected _start: number;
+
+  protected _pool: Float64Array[] = [];
+
+  protected _size = 0;
+
+  /**
+   * The size function returns the number of elements in the deque.
+   * @returns The number of elements.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  /**
+   * The function returns the number of buckets in use.
+   * @returns The number of buckets.
+   */
+  get bucketCount(): number {
+    return this._size === 0 ? 1 : ((this._start + this._size - 1) >>> this._bucketShift) + 1;
+  }
+
+  /**
+   * The function returns the first element, or undefined if the deque is empty.
+   * @returns The first number.
+   */
+  get first(): number | undefined {
+    if (this._size === 0) return;
+    return this._map[this._mapHead]![this._start];
+  }
+
+  /**
+   * The function returns the last element, or undefined if the deque is empty.
+   * @returns The last number.
+   */
+  get last(): number | undefined {
+    if (this._size === 0) return;
+    return this._read(this._size - 1);
+  }
+
+  /**
+   * Time Complexity: O(1) amortized
+   * Space Complexity: O(1)
+   */
+
+  /**
+   * Time Complexity: O(1) amortized
+   * Space Complexity: O(1)
+   *
+   * The push function adds a number to the back of the deque, taking a bucket from the pool when the last one is full.
+   * @param {number} element - The number to add.
+   * @returns `true`.
+   */
+  push(element: number): boolean {
+    const offset = this._start + this._size;
+    const bucket = offset >>> this._bucketShift;
+    if ((offset & this._bucketMask) === 0 && bucket > 0) {
+      if (bucket === this._map.length) this._growMap();
+      this._map[(this._mapHead + bucket) & this._mapMask] = this._acquire();
+    }
+    this._map[(this._mapHead + bucket) & this._mapMask]![offset & this._bucketMask] = element;
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `pop()` function removes and returns the last number, returning its bucket to the pool if it becomes empty.
+   * @returns The last number, or undefined if the deque is empty.
+   */
+  pop(): number | undefined {
+    if (this._size === 0) return;
+    this._size--;
+    const offset = this._start + this._size;
+    const bucket = offset >>> this._bucketShift;
+    const slot = (this._mapHead + bucket) & this._mapMask;
+    const element = this._map[slot]![offset & this._bucketMask];
+    if ((offset & this._bucketMask) === 0 && bucket > 0) {
+      this._release(this._map[slot]!);
+      this._map[slot] = undefined;
+    }
+    return element;
+  }
+
+  /**
+   * Time Complexity: O(1) amortized
+   * Space Complexity: O(1)
+   *
+   * The `unshift` function adds a number to the front of the deque, taking a bucket from the pool when the first one
+   * is full.
+   * @param {number} element - The number to add.
+   * @returns `true`.
+   */
+  unshift(element: number): boolean {
+    if (this._start === 0) {
+      if (this._size === 0) {
+        // An empty deque can start anywhere in its bucket
+        this._start = this._bucketSize;
+      } else {
+        if (this.bucketCount === this._map.length) this._growMap();
+        this._mapHead = (this._mapHead - 1) & this._mapMask;
+        this._map[this._mapHead] = this._acquire();
+        this._start = this._bucketSize;
+      }
+    }
+    this._start--;
+    this._map[this._mapHead]![this._start] = element;
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `shift()` function removes and returns the first number, returning its bucket to the pool if it becomes
+   * empty.
+   * @returns The first number, or undefined if the deque is empty.
+   */
+  shift(): number | undefined {
+    if (this._size === 0) return;
+    const element = this._map[this._mapHead]![this._start];
+    this._size--;
+    this._start++;
+    if (this._start === this._bucketSize) {
+      if (this._size === 0) {
+        this._start = this._bucketSize >> 1;
+      } else {
+        this._release(this._map[this._mapHead]!);
+        this._map[this._mapHead] = undefined;
+        this._mapHead = (this._mapHead + 1) & this._mapMask;
+        this._start = 0;
+      }
+    }
+    return element;
+  }
+
+  /**
+   * Time Complexity: O(k)
+   * Space Complexity: O(1)
+   *
+   * The `pushMany` function pushes numbers in order, filling each bucket with one `set` when given an array.
+   * @param elements - The numbers to push.
+   * @returns The number of elements pushed.
+   */
+  pushMany(elements: ArrayLike<number> | Iterable<number>): number {
+    if (!('length' in elements)) {
+      let count = 0;
+      for (const element of elements as Iterable<number>) count += this.push(element) ? 1 : 0;
+      return count;
+    }
+    const total = elements.length;
+    let i = 0;
+    while (i < total) {
+      // Make room for the next element, then copy as many as fit in its bucket
+      this.push(elements[i++]);
+      const offset = this._start + this._size;
+      const room = this._bucketSize - (offset & this._bucketMask);
+      const count = Math.min(room === this._bucketSize ? 0 : room, total - i);
+      if (count === 0) continue;
+      const bucket = this._map[(this._mapHead + (offset >>> this._bucketShift)) & this._mapMask]!;
+      const within = offset & this._bucketMask;
+      if (typeof (elements as Float64Array).subarray === 'function') {
+        bucket.set((elements as Float64Array).subarray(i, i + count), within);
+      } else {
+        for (let j = 0; j < count; j++) bucket[within + j] = elements[i + j];
+      }
+      this._size += count;
+      i += count;
+    }
+    return total;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function checks whether the deque is empty.
+   * @returns A boolean value indicating whether the size is 0.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Time Complexity: O(b), where b is the number of buckets
+   * Space Complexity: O(1)
+   *
+   * The clear() function removes every number, keeping one bucket and returning the others to the pool.
+   */
+  clear(): void {
+    const count = this.bucketCount;
+    for (let i = 1; i < count; i++) {
+      const slot = (this._mapHead + i) & this._mapMask;
+      this._release(this._map[slot]!);
+      this._map[slot] = undefined;
+    }
+    this._size = 0;
+    this._start = this._bucketSize >> 1;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `at` function returns the number at a position, counted from the front.
+   * @param {number} pos - The position, from 0 to `size - 1`.
+   * @returns The number at the position.
+   */
+  at(pos: number): number {
+    rangeCheck(pos, 0, this._size - 1);
+    return this._read(pos);
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `setAt` function replaces the number at a position, counted from the front.
+   * @param {number} pos - The position, from 0 to `size - 1`.
+   * @param {number} element - The new number.
+   * @returns `true`.
+   */
+  setAt(pos: number, element: number): boolean {
+    rangeCheck(pos, 0, this._size - 1);
+    const offset = this._start + pos;
+    this._map[(this._mapHead + (offset >>> this._bucketShift)) & this._mapMask]![offset & this._bucketMask] = element;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1 + k / bucketSize)
+   * Space Complexity: O(k / bucketSize)
+   *
+   * The `sliceView` function returns the numbers from `from` up to but not including `to` as subarrays of the
+   * buckets, without copying. A window inside one bucket is a single subarray. The views share memory with the deque:
+   * writing to them changes the deque, and they are only valid until the deque next changes, since emptied buckets
+   * are reused.
+   * @param {number} [from=0] - The first position.
+   * @param {number} [to=size] - The position after the last one.
+   * @returns The subarrays, in order.
+   */
+  sliceView(from = 0, to = this._size): Float64Array[] {
+    rangeCheck(from, 0, this._size);
+    rangeCheck(to, from, this._size);
+    const views: Float64Array[] = [];
+    let offset = this._start + from;
+    const end = this._start + to;
+    while (offset < end) {
+      const bucket = this._map[(this._mapHead + (offset >>> this._bucketShift)) & this._mapMask]!;
+      const within = offset & this._bucketMask;
+      const count = Math.min(this._bucketSize - within, end - offset);
+      views.push(bucket.subarray(within, within + count));
+      offset += count;
+    }
+    return views;
+  }
+
+  /**
+   * Time Complexity: O(k)
+   * Space Complexity: O(k)
+   *
+   * The `slice` function copies the numbers from `from` up to but not including `to`.
+   * @param {number} [from=0] - The first position.
+   * @param {number} [to=size] - The position after the last one.
+   * @returns A new `Float64Array`.
+   */
+  slice(from = 0, to = this._size): Float64Array {
+    const sliced = new Float64Array(to - from);
+    let at = 0;
+    for (const view of this.sliceView(from, to)) {
+      sliced.set(view, at);
+      at += view.length;
+    }
+    return sliced;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `toArray` function copies the numbers into an array, from front to back.
+   * @returns An array of numbers.
+   */
+  toArray(): number[] {
+    const array: number[] = new Array(this._size);
+    for (let i = 0; i < this._size; i++) array[i] = this._read(i);
+    return array;
+  }
+
+  /**
+   * Time Complexity: O(b), where b is the number of buckets
+   * Space Complexity: O(b)
+   *
+   * The `shrinkToFit` function frees the pooled buckets and shrinks the ring of buckets to fit the buckets in use.
+   */
+  shrinkToFit(): void {
+    this._pool.length = 0;
+    const count = this.bucketCount;
+    let length = 4;
+    while (length < count) length *= 2;
+    if (length === this._map.length) return;
+    this._remap(length);
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `clone()` function returns a new NumericDeque with the same numbers and options.
+   * @returns A new `NumericDeque`.
+   */
+  clone(): NumericDeque {
+    const cloned = new NumericDeque([], this._options());
+    for (const view of this.sliceView()) cloned.pushMany(view);
+    return cloned;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function creates a NumericDeque with the numbers that pass the predicate.
+   * @param predicate - A function called with the number, its index and the deque.
+   * @param {any} [thisArg] - The value of `this` within the predicate.
+   * @returns A new `NumericDeque`.
+   */
+  filter(predicate: ElementCallback<number, boolean>, thisArg?: any): NumericDeque {
+    const filtered = new NumericDeque([], this._options());
+    let index = 0;
+    for (const el of this) {
+      if (predicate.call(thisArg, el, index, this)) filtered.push(el);
+      index++;
+    }
+    return filtered;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function creates a NumericDeque with the results of the callback.
+   * @param callback - A function called with the number, its index and the deque.
+   * @param {any} [thisArg] - The value of `this` within the callback.
+   * @returns A new `NumericDeque`.
+   */
+  map(callback: ElementCallback<number, number>, thisArg?: any): NumericDeque {
+    const mapped = new NumericDeque([], this._options());
+    let index = 0;
+    for (const el of this) {
+      mapped.push(callback.call(thisArg, el, index, this));
+      index++;
+    }
+    return mapped;
+  }
+
+  /**
+   * The function adds a number to the back of the deque.
+   * @param {number} element - The number to add.
+   * @returns `true`.
+   */
+  addLast(element: number): boolean {
+    return this.push(element);
+  }
+
+  /**
+   * The function removes and returns the last number.
+   * @returns The last number, or undefined if the deque is empty.
+   */
+  pollLast(): number | undefined {
+    return this.pop();
+  }
+
+  /**
+   * The function adds a number to the front of the deque.
+   * @param {number} element - The number to add.
+   * @returns `true`.
+   */
+  addFirst(element: number): boolean {
+    return this.unshift(element);
+  }
+
+  /**
+   * The function removes and returns the first number.
+   * @returns The first number, or undefined if the deque is empty.
+   */
+  pollFirst(): number | undefined {
+    return this.shift();
+  }
+
+  /**
+   * The function iterates over the numbers from front to back, one bucket at a time.
+   */
+  protected* _getIterator(): IterableIterator<number> {
+    let offset = this._start;
+    const end = this._start + this._size;
+    while (offset < end) {
+      const bucket = this._map[(this._mapHead + (offset >>> this._bucketShift)) & this._mapMask]!;
+      const stop = Math.min(this._bucketSize, (offset & this._bucketMask) + end - offset);
+      for (let i = offset & this._bucketMask; i < stop; i++) yield bucket[i];
+      offset += stop - (offset & this._bucketMask);
+    }
+  }
+
+  protected _read(pos: number): number {
+    const offset = this._start + pos;
+    return this._map[(this._mapHead + (offset >>> this._bucketShift)) & this._mapMask]![offset & this._bucketMask];
+  }
+
+  protected _acquire(): Float64Array {
+    return this._pool.pop() ?? new Float64Array(this._bucketSize);
+  }
+
+  protected _release(bucket: Float64Array): void {
+    if (this._pool.length < this._poolSize) this._pool.push(bucket);
+  }
+
+  protected _growMap(): void {
+    this._remap(this._map.length * 2);
+  }
+
+  /**
+   * The function moves the bucket references into a new ring of the given length, from slot 0.
+   * @param {number} length - A power of two no less than the buckets in use.
+   */
+  protected _remap(length: number): void {
+    const map: (Float64Array | undefined)[] = new Array(length).fill(undefined);
+    const count = this.bucketCount;
+    for (let i = 0; i < count; i++) map[i] = this._map[(this._mapHead + i) & this._mapMask];
+    this._map = map;
+    this._mapMask = length - 1;
+    this._mapHead = 0;
+  }
+
+  protected _options(): NumericDequeOptions {
+    return { bucketSize: this._bucketSize, poolSize: this._poolSize };
+  }
+}
@@ -0,0 +1,389 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { ElementCallback } from '../../types';
+import { IterableElementBase } from '../base';
+import { rangeCheck } from '../../utils';
+
+export class PersistentDequeNode {
+  // Child nodes on inner levels, elements on the leaf level
+  slots: any[];
+  owner: object;
+
+  constructor(slots: any[], owner: object) {
+    this.slots = slots;
+    this.owner = owner;
+  }
+}
+
+/**
+ * A double-ended queue on a 32-way trie whose versions share structure.
+ * 1. Elements sit at consecutive virtual indexes of the trie, starting at an `origin`. Pushing at either end writes
+ *    the next index; when an end runs out of room the trie gains a level with the old root in its middle child.
+ * 2. `snapshot` (and `clone`) is O(1); an update copies only the nodes on its path, one per level, so a deque of a
+ *    million elements copies at most five nodes.
+ * 3. Nodes created since the last snapshot belong to the deque and are changed in place.
+ * 4. `at` and `setAt` are O(log32 n); iteration reads each leaf once.
+ */
+export class PersistentDeque<E = any> extends IterableElementBase<E> {
+  /**
+   * The constructor initializes a PersistentDeque with an optional iterable of elements.
+   * @param elements - The elements to push, in order.
+   */
+  constructor(elements: Iterable<E> = []) {
+    super();
+    if (elements) {
+      for (const element of elements) this.push(element);
+    }
+  }
+
+  protected _owner: object = {};
+
+  protected _root: PersistentDequeNode | undefined = undefined;
+
+  // Bits of the virtual index consumed below the root: 0 when the root is a leaf
+  protected _shift: number = 0;
+
+  protected _origin: number = 0;
+
+  protected _size: number = 0;
+
+  /**
+   * The size function returns the number of elements in the deque.
+   * @returns The number of elements.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  /**
+   * The function returns the first element, or undefined if the deque is empty.
+   * @returns The first element.
+   */
+  get first(): E | undefined {
+    return this._size === 0 ? undefined : this._get(this._origin);
+  }
+
+  /**
+   * The function returns the last element, or undefined if the deque is empty.
+   * @returns The last element.
+   */
+  get last(): E | undefined {
+    return this._size === 0 ? undefined : this._get(this._origin + this._size - 1);
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `snapshot` function returns a deque that shares every node with this one. Later updates on either side
+   * copy their path, so the other side keeps its elements.
+   * @returns A new PersistentDeque with the same elements.
+   */
+  snapshot(): PersistentDeque<E> {
+    const deque = new PersistentDeque<E>();
+    deque._root = this._root;
+    deque._shift = this._shift;
+    deque._origin = this._origin;
+    deque._size = this._size;
+    this._owner = {};
+    return deque;
+  }
+
+  /**
+   * Time Complexity: O(log32 n)
+   * Space Complexity: O(log32 n)
+   *
+   * The push function adds an element to the end of the deque.
+   * @param {E} element - The element to add.
+   * @returns True, like Deque.
+   */
+  push(element: E): boolean {
+    if (this._size === 0) this._reset();
+    else if (this._origin + this._size === 32 << this._shift) this._grow();
+    this._root = this._setIn(this._root, this._shift, this._origin + this._size, element);
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(log32 n)
+   * Space Complexity: O(log32 n)
+   *
+   * The unshift function adds an element to the front of the deque.
+   * @param {E} element - The element to add.
+   * @returns True, like Deque.
+   */
+  unshift(element: E): boolean {
+    if (this._size === 0) this._reset();
+    else if (this._origin === 0) this._grow();
+    this._origin--;
+    this._root = this._setIn(this._root, this._shift, this._origin, element);
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(log32 n)
+   * Space Complexity: O(log32 n)
+   *
+   * The pop function removes and returns the last element.
+   * @returns The last element, or undefined if the deque is empty.
+   */
+  pop(): E | undefined {
+    if (this._size === 0) return undefined;
+    const index = this._origin + this._size - 1;
+    const element = this._get(index);
+    this._size--;
+    this._remove(index);
+    return element;
+  }
+
+  /**
+   * Time Complexity: O(log32 n)
+   * Space Complexity: O(log32 n)
+   *
+   * The shift function removes and returns the first element.
+   * @returns The first element, or undefined if the deque is empty.
+   */
+  shift(): E | undefined {
+    if (this._size === 0) return undefined;
+    const index = this._origin;
+    const element = this._get(index);
+    this._origin++;
+    this._size--;
+    this._remove(index);
+    return element;
+  }
+
+  /**
+   * The addLast function adds an element to the end of the deque.
+   * @param {E} element - The element to add.
+   * @returns True, like Deque.
+   */
+  addLast(element: E): boolean {
+    return this.push(element);
+  }
+
+  /**
+   * The addFirst function adds an element to the front of the deque.
+   * @param {E} element - The element to add.
+   * @returns True, like Deque.
+   */
+  addFirst(element: E): boolean {
+    return this.unshift(element);
+  }
+
+  /**
+   * The pollLast function removes and returns the last element.
+   * @returns The last element, or undefined if the deque is empty.
+   */
+  pollLast(): E | undefined {
+    return this.pop();
+  }
+
+  /**
+   * The pollFirst function removes and returns the first element.
+   * @returns The first element, or undefined if the deque is empty.
+   */
+  pollFirst(): E | undefined {
+    return this.shift();
+  }
+
+  /**
+   * Time Complexity: O(log32 n)
+   * Space Complexity: O(1)
+   *
+   * The `at` function returns the element at a position.
+   * @param {number} pos - A position between 0 and `size - 1`.
+   * @returns The element at the position.
+   */
+  at(pos: number): E {
+    rangeCheck(pos, 0, this._size - 1);
+    return this._get(this._origin + pos);
+  }
+
+  /**
+   * Time Complexity: O(log32 n)
+   * Space Complexity: O(log32 n)
+   *
+   * The `setAt` function replaces the element at a position, copying the shared nodes on its path.
+   * @param {number} pos - A position between 0 and `size - 1`.
+   * @param {E} element - The new element.
+   * @returns True, like Deque.
+   */
+  setAt(pos: number, element: E): boolean {
+    rangeCheck(pos, 0, this._size - 1);
+    this._root = this._setIn(this._root, this._shift, this._origin + pos, element);
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function checks whether the deque is empty.
+   * @returns True if the deque has no elements.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function removes every element. Snapshots taken earlier keep theirs.
+   */
+  clear(): void {
+    this._root = undefined;
+    this._shift = 0;
+    this._origin = 0;
+    this._size = 0;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The toArray function returns the elements from first to last.
+   * @returns An array of the elements.
+   */
+  toArray(): E[] {
+    return [...this];
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The clone function is the same as `snapshot`: the copy shares the nodes and costs O(1).
+   * @returns A new PersistentDeque with the same elements.
+   */
+  clone(): PersistentDeque<E> {
+    return this.snapshot();
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function creates a new deque with the elements that pass a predicate.
+   * @param predicate - Called with `(element, index, deque)`.
+   * @param {any} [thisArg] - The value to use as `this` inside the predicate.
+   * @returns A new PersistentDeque.
+   */
+  filter(predicate: ElementCallback<E, boolean>, thisArg?: any): PersistentDeque<E> {
+    const deque = new PersistentDeque<E>();
+    let index = 0;
+    for (const element of this) {
+      if (predicate.call(thisArg, element, index++, this)) deque.push(element);
+    }
+    return deque;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function creates a new deque with the mapped elements.
+   * @param callback - Called with `(element, index, deque)`.
+   * @param {any} [thisArg] - The value to use as `this` inside the callback.
+   * @returns A new PersistentDeque.
+   */
+  map<T>(callback: ElementCallback<E, T>, thisArg?: any): PersistentDeque<T> {
+    const deque = new PersistentDeque<T>();
+    let index = 0;
+    for (const element of this) deque.push(callback.call(thisArg, element, index++, this));
+    return deque;
+  }
+
+  /**
+   * The function yields the elements from first to last, looking each leaf up once.
+   */
+  protected* _getIterator(): IterableIterator<E> {
+    const end = this._origin + this._size;
+    let leaf: PersistentDequeNode | undefined;
+    for (let index = this._origin; index < end; index++) {
+      if (leaf === undefined || (index & 31) === 0) leaf = this._leafOf(index);
+      yield leaf.slots[index & 31];
+    }
+  }
+
+  protected _reset(): void {
+    this._root = undefined;
+    this._shift = 0;
+    this._origin = 16;
+  }
+
+  // Puts the root in the middle child of a new root, leaving room on both sides
+  protected _grow(): void {
+    const span = 32 << this._shift;
+    const slots = new Array(32);
+    slots[16] = this._root;
+    this._root = new PersistentDequeNode(slots, this._owner);
+    this._origin += 16 * span;
+    this._shift += 5;
+  }
+
+  protected _leafOf(index: number): PersistentDequeNode {
+    let node = this._root!;
+    for (let shift = this._shift; shift > 0; shift -= 5) node = node.slots[(index >>> shift) & 31];
+    return node;
+  }
+
+  protected _get(index: number): E {
+    return this._leafOf(index).slots[index & 31];
+  }
+
+  protected _setIn(node: PersistentDequeNode | undefined, shift: number, index: number, value: any): PersistentDequeNode {
+    let owned: PersistentDequeNode;
+    if (node === undefined) owned = new PersistentDequeNode(new Array(32), this._owner);
+    else if (node.owner === this._owner) owned = node;
+    else owned = new PersistentDequeNode(node.slots.slice(), this._owner);
+
+    const slot = (index >>> shift) & 31;
+    owned.slots[slot] = shift === 0 ? value : this._setIn(owned.slots[slot], shift - 5, index, value);
+    return owned;
+  }
+
+  /**
+   * The function clears the slot of an element that has just left the live range, drops nodes that no longer
+   * hold live elements, and removes root levels that only have one live child.
+   * @param {number} index - The virtual index that was removed.
+   */
+  protected _remove(index: number): void {
+    if (this._size === 0) {
+      this.clear();
+      return;
+    }
+    this._root = this._clearIn(this._root!, this._shift, index, 0);
+    while (this._shift > 0) {
+      const first = (this._origin >>> this._shift) & 31;
+      const last = ((this._origin + this._size - 1) >>> this._shift) & 31;
+      if (first !== last) break;
+      this._root = this._root!.slots[first];
+      this._origin -= first << this._shift;
+      this._shift -= 5;
+    }
+  }
+
+  protected _clearIn(
+    node: PersistentDequeNode,
+    shift: number,
+    index: number,
+    base: number
+  ): PersistentDequeNode | undefined {
+    const end = this._origin + this._size;
+    if (base >= end || base + (32 << shift) <= this._origin) return undefined;
+    const owned = node.owner === this._owner ? node : new PersistentDequeNode(node.slots.slice(), this._owner);
+    const slot = (index >>> shift) & 31;
+    owned.slots[slot] =
+      shift === 0 ? undefined : this._clearIn(owned.slots[slot], shift - 5, index, base + (slot << shift));
+    return owned;
+  }
+}
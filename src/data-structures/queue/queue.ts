@@ -3,7 +3,7 @@
  * @copyright Tyler Zeng <zrwusa@gmail.com>
  * @class
  */
-import type { ElementCallback } from '../../types';
+import type { ElementCallback, InstrumentedMethods, QueueOptions } from '../../types';
 import { IterableElementBase } from '../base';
 import { SinglyLinkedList } from '../linked-list';
 
@@ -15,47 +15,88 @@ import { SinglyLinkedList } from '../linked-list';
  * 5. Data Buffering: Acting as a buffer for data packets in network communication.
  * 6. Breadth-First Search (BFS): In traversal algorithms for graphs and trees, queues store elements that are to be visited.
  * 7. Real-time Queuing: Like queuing systems in banks or supermarkets.
+ * 8. Ring Buffer: Elements live in a circular buffer whose length is a power of two, so every index is masked instead of taken modulo, `shift` never copies, and the buffer grows by doubling. A `maxSize` makes the queue bounded, with `push` returning `false` when it is full.
  */
 export class Queue<E = any> extends IterableElementBase<E> {
   /**
-   * The constructor initializes an instance of a class with an optional array of elements and sets the offset to 0.
-   * @param {E[]} [elements] - The `elements` parameter is an optional array of elements of type `E`. If provided, it
-   * will be used to initialize the `_elements` property of the class. If not provided, the `_elements` property will be
-   * initialized as an empty array.
+   * The constructor initializes an instance of a class with an optional array of elements and options.
+   * @param {E[]} [elements] - The `elements` parameter is an optional iterable of elements of type `E` that are pushed
+   * in order.
+   * @param [options] - `capacity` sizes the ring buffer up front, rounded up to a power of two, so that no growth
+   * happens below it. `maxSize` bounds the queue: once it holds `maxSize` elements, `push` returns `false` instead of
+   * growing.
    */
-  constructor(elements: Iterable<E> = []) {
+  constructor(elements: Iterable<E> = [], options?: QueueOptions) {
     super();
+    let capacity = 16;
+    if (options) {
+      const { capacity: initialCapacity, maxSize } = options;
+      if (maxSize !== undefined) {
+        if (!(Number.isInteger(maxSize) && maxSize > 0)) throw new Error('Queue maxSize must be a positive integer');
+        this._maxSize = maxSize;
+      }
+      if (initialCapacity !== undefined && initialCapacity > 0) capacity = initialCapacity;
+      if (capacity > this._maxSize) capacity = this._maxSize;
+    }
+    this._buffer = new Array(Queue._powerOfTwoAtLeast(capacity));
+    this._mask = this._buffer.length - 1;
+
     if (elements) {
       for (const el of elements) this.push(el);
     }
   }
 
-  protected _elements: E[] = [];
+  protected _buffer: (E | undefined)[];
+
+  protected _mask: number;
+
+  protected _maxSize = Infinity;
+
+  /**
+   * The function returns the most elements the queue holds before `push` returns `false`.
+   * @returns The `maxSize` property is being returned, Infinity for an unbounded queue.
+   */
+  get maxSize(): number {
+    return this._maxSize;
+  }
 
   /**
-   * The elements function returns the elements of this set.
-   * @return An array of the elements in the stack
+   * The function returns the number of slots in the ring buffer, a power of two.
+   * @returns The length of the buffer.
+   */
+  get capacity(): number {
+    return this._buffer.length;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The elements function returns the elements of the queue, from front to back.
+   * @return A new array of the elements in the queue
    */
   get elements(): E[] {
-    return this._elements;
+    return this.toArray();
   }
 
   protected _offset: number = 0;
 
   /**
-   * The offset function returns the offset of the current page.
+   * The offset function returns the slot of the first element in the ring buffer.
    * @return The value of the protected variable _offset
    */
   get offset(): number {
     return this._offset;
   }
 
+  protected _size = 0;
+
   /**
-   * The size function returns the number of elements in an array.
-   * @returns {number} The size of the array, which is the difference between the length of the array and the offset.
+   * The size function returns the number of elements in the queue.
+   * @returns {number} The size of the queue.
    */
   get size(): number {
-    return this.elements.length - this.offset;
+    return this._size;
   }
 
   /**
@@ -67,12 +108,12 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * Time Complexity: O(1)
    * Space Complexity: O(1)
    *
-   * The `first` function returns the first element of the array `_elements` if it exists, otherwise it returns `undefined`.
-   * @returns The `get first()` method returns the first element of the data structure, represented by the `_elements` array at
-   * the `_offset` index. If the data structure is empty (size is 0), it returns `undefined`.
+   * The `first` function returns the first element of the queue if it exists, otherwise it returns `undefined`.
+   * @returns The `get first()` method returns the first element of the data structure, in the slot `_offset` of the
+   * ring buffer. If the data structure is empty (size is 0), it returns `undefined`.
    */
   get first(): E | undefined {
-    return this.size > 0 ? this.elements[this.offset] : undefined;
+    return this._size > 0 ? this._buffer[this._offset] : undefined;
   }
 
   /**
@@ -84,12 +125,12 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * Time Complexity: O(1)
    * Space Complexity: O(1)
    *
-   * The `last` function returns the last element in an array-like data structure, or undefined if the structure is empty.
-   * @returns The method `get last()` returns the last element of the `_elements` array if the array is not empty. If the
-   * array is empty, it returns `undefined`.
+   * The `last` function returns the last element in the queue, or undefined if the queue is empty.
+   * @returns The method `get last()` returns the last element of the queue if it is not empty. If the queue is empty,
+   * it returns `undefined`.
    */
   get last(): E | undefined {
-    return this.size > 0 ? this.elements[this.elements.length - 1] : undefined;
+    return this._size > 0 ? this._buffer[(this._offset + this._size - 1) & this._mask] : undefined;
   }
 
   /**
@@ -109,27 +150,54 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * array.
    */
   static fromArray<E>(elements: E[]): Queue<E> {
-    return new Queue(elements);
+    return new Queue(elements, { capacity: elements.length });
   }
 
   /**
-   * Time Complexity: O(1)
+   * Time Complexity: O(1) amortized, O(n) when the buffer doubles
    * Space Complexity: O(1)
    */
 
   /**
-   * Time Complexity: O(1)
+   * Time Complexity: O(1) amortized, O(n) when the buffer doubles
    * Space Complexity: O(1)
    *
-   * The push function adds an element to the end of the queue and returns the updated queue.Adds an element at the back of the queue.
+   * The push function adds an element to the end of the queue. When the ring buffer is full it doubles, unless the
+   * queue already holds `maxSize` elements.
    * @param {E} element - The `element` parameter represents the element that you want to add to the queue.
-   * @returns The `add` method is returning a `Queue<E>` object.
+   * @returns `true` if the element was added, or `false` if the queue is full, so the producer can back off.
    */
   push(element: E): boolean {
-    this.elements.push(element);
+    if (this._size >= this._maxSize) return false;
+    if (this._size === this._buffer.length) this._grow(this._size * 2);
+    this._buffer[(this._offset + this._size) & this._mask] = element;
+    this._size++;
     return true;
   }
 
+  /**
+   * Time Complexity: O(k)
+   * Space Complexity: O(k)
+   */
+
+  /**
+   * Time Complexity: O(k)
+   * Space Complexity: O(k)
+   *
+   * The `pushMany` function pushes the elements in order. The buffer grows at most once for an array.
+   * @param elements - The elements to push.
+   * @returns An array of the results of `push`; once the queue is full, the results are `false`.
+   */
+  pushMany(elements: Iterable<E>): boolean[] {
+    if (Array.isArray(elements)) {
+      const needed = Math.min(this._size + elements.length, this._maxSize);
+      if (needed > this._buffer.length) this._grow(needed);
+    }
+    const results: boolean[] = [];
+    for (const element of elements) results.push(this.push(element));
+    return results;
+  }
+
   /**
    * Time Complexity: O(1)
    * Space Complexity: O(1)
@@ -139,23 +207,43 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * Time Complexity: O(1)
    * Space Complexity: O(1)
    *
-   * The `shift` function removes and returns the first element in the queue, and adjusts the internal data structure if
-   * necessary to optimize performance.
+   * The `shift` function removes and returns the first element in the queue. Its slot is cleared, so the queue does
+   * not keep the element alive.
    * @returns The function `shift()` returns either the first element in the queue or `undefined` if the queue is empty.
    */
   shift(): E | undefined {
-    if (this.size === 0) return undefined;
+    if (this._size === 0) return undefined;
 
-    const first = this.first;
-    this._offset += 1;
+    const first = this._buffer[this._offset];
+    this._buffer[this._offset] = undefined;
+    this._offset = (this._offset + 1) & this._mask;
+    this._size--;
+    return first;
+  }
 
-    if (this.offset * 2 < this.elements.length) return first;
+  /**
+   * Time Complexity: O(k)
+   * Space Complexity: O(k)
+   */
 
-    // only delete dequeued elements when reaching half size
-    // to decrease latency of shifting elements.
-    this._elements = this.elements.slice(this.offset);
-    this._offset = 0;
-    return first;
+  /**
+   * Time Complexity: O(k)
+   * Space Complexity: O(k)
+   *
+   * The `drain` function removes up to `count` elements from the front of the queue.
+   * @param {number} [count] - The most elements to remove, all of them by default.
+   * @returns An array of the removed elements, from front to back.
+   */
+  drain(count: number = this._size): E[] {
+    const n = Math.max(0, Math.min(Math.floor(count), this._size));
+    const drained: E[] = new Array(n);
+    for (let i = 0; i < n; i++) {
+      drained[i] = this._buffer[this._offset] as E;
+      this._buffer[this._offset] = undefined;
+      this._offset = (this._offset + 1) & this._mask;
+    }
+    this._size -= n;
+    return drained;
   }
 
   /**
@@ -164,18 +252,26 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * @return A boolean value indicating whether the element was successfully deleted or not
    */
   delete(element: E): boolean {
-    const index = this.elements.indexOf(element);
-    return this.deleteAt(index);
+    for (let i = 0; i < this._size; i++) {
+      if (this._buffer[(this._offset + i) & this._mask] === element) return this.deleteAt(i);
+    }
+    return false;
   }
 
   /**
-   * The deleteAt function deletes the element at a given index.
+   * The deleteAt function deletes the element at a given index, counted from the front, moving the elements behind it
+   * forward.
    * @param index: number Determine the index of the element to be deleted
    * @return A boolean value
    */
   deleteAt(index: number): boolean {
-    const spliced = this.elements.splice(index, 1);
-    return spliced.length === 1;
+    if (!(Number.isInteger(index) && index >= 0 && index < this._size)) return false;
+    for (let i = index; i < this._size - 1; i++) {
+      this._buffer[(this._offset + i) & this._mask] = this._buffer[(this._offset + i + 1) & this._mask];
+    }
+    this._buffer[(this._offset + this._size - 1) & this._mask] = undefined;
+    this._size--;
+    return true;
   }
 
   /**
@@ -187,9 +283,9 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * Time Complexity: O(1)
    * Space Complexity: O(1)
    *
-   * The `peek` function returns the first element of the array `_elements` if it exists, otherwise it returns `undefined`.
-   * @returns The `peek()` method returns the first element of the data structure, represented by the `_elements` array at
-   * the `_offset` index. If the data structure is empty (size is 0), it returns `undefined`.
+   * The `peek` function returns the first element of the queue if it exists, otherwise it returns `undefined`.
+   * @returns The `peek()` method returns the first element of the data structure. If the data structure is empty (size
+   * is 0), it returns `undefined`.
    */
   peek(): E | undefined {
     return this.first;
@@ -204,9 +300,9 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * Time Complexity: O(1)
    * Space Complexity: O(1)
    *
-   * The `peekLast` function returns the last element in an array-like data structure, or undefined if the structure is empty.
-   * @returns The method `peekLast()` returns the last element of the `_elements` array if the array is not empty. If the
-   * array is empty, it returns `undefined`.
+   * The `peekLast` function returns the last element in the queue, or undefined if the queue is empty.
+   * @returns The method `peekLast()` returns the last element of the queue if it is not empty. If the queue is empty,
+   * it returns `undefined`.
    */
   peekLast(): E | undefined {
     return this.last;
@@ -223,6 +319,7 @@ export class Queue<E = any> extends IterableElementBase<E> {
    *
    * The enqueue function adds a value to the end of a queue.
    * @param {E} value - The value parameter represents the value that you want to add to the queue.
+   * @returns `true` if the value was added, or `false` if the queue is full.
    */
   enqueue(value: E): boolean {
     return this.push(value);
@@ -253,10 +350,13 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * Time Complexity: O(1)
    * Space Complexity: O(1)
    *
-   * @param index
+   * The `at` function returns the element at a given index, counted from the front of the queue.
+   * @param {number} index - The index of the element.
+   * @returns The element, or `undefined` if the index is out of range.
    */
   at(index: number): E | undefined {
-    return this.elements[index];
+    if (!(Number.isInteger(index) && index >= 0 && index < this._size)) return undefined;
+    return this._buffer[(this._offset + index) & this._mask];
   }
 
   /**
@@ -272,39 +372,50 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * @returns {boolean} A boolean value indicating whether the size of the object is 0 or not.
    */
   isEmpty(): boolean {
-    return this.size === 0;
+    return this._size === 0;
   }
 
   /**
-   * Time Complexity: O(1)
+   * The function checks if the queue holds `maxSize` elements, so `push` would return `false`.
+   * @returns {boolean} A boolean value indicating whether the queue is full.
+   */
+  isFull(): boolean {
+    return this._size >= this._maxSize;
+  }
+
+  /**
+   * Time Complexity: O(n)
    * Space Complexity: O(n)
    */
 
   /**
-   * Time Complexity: O(1)
+   * Time Complexity: O(n)
    * Space Complexity: O(n)
    *
-   * The toArray() function returns an array of elements from the current offset to the end of the _elements array.
+   * The toArray() function returns an array of the elements in the queue, from front to back.
    * @returns An array of type E is being returned.
    */
   toArray(): E[] {
-    return this.elements.slice(this.offset);
+    const array: E[] = new Array(this._size);
+    for (let i = 0; i < this._size; i++) array[i] = this._buffer[(this._offset + i) & this._mask] as E;
+    return array;
   }
 
   /**
-   * Time Complexity: O(1)
+   * Time Complexity: O(n)
    * Space Complexity: O(1)
    */
 
   /**
-   * Time Complexity: O(1)
+   * Time Complexity: O(n)
    * Space Complexity: O(1)
    *
-   * The clear function resets the elements array and offset to their initial values.
+   * The clear function removes every element and resets the offset, keeping the capacity.
    */
   clear(): void {
-    this._elements = [];
+    this._buffer.fill(undefined);
     this._offset = 0;
+    this._size = 0;
   }
 
   /**
@@ -317,11 +428,11 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * Time Complexity: O(n)
    * Space Complexity: O(n)
    *
-   * The `clone()` function returns a new Queue object with the same elements as the original Queue.
+   * The `clone()` function returns a new Queue object with the same elements and `maxSize` as the original Queue.
    * @returns The `clone()` method is returning a new instance of the `Queue` class.
    */
   clone(): Queue<E> {
-    return new Queue(this.elements.slice(this.offset));
+    return new Queue(this, this._cloneOptions());
   }
 
   /**
@@ -346,7 +457,7 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * satisfy the given predicate function.
    */
   filter(predicate: ElementCallback<E, boolean>, thisArg?: any): Queue<E> {
-    const newDeque = new Queue<E>([]);
+    const newDeque = new Queue<E>([], this._cloneOptions());
     let index = 0;
     for (const el of this) {
       if (predicate.call(thisArg, el, index, this)) {
@@ -377,7 +488,7 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * @returns The `map` function is returning a new `Queue` object with the transformed elements.
    */
   map<T>(callback: ElementCallback<E, T>, thisArg?: any): Queue<T> {
-    const newDeque = new Queue<T>([]);
+    const newDeque = new Queue<T>([], this._cloneOptions());
     let index = 0;
     for (const el of this) {
       newDeque.push(callback.call(thisArg, el, index, this));
@@ -398,10 +509,43 @@ export class Queue<E = any> extends IterableElementBase<E> {
    * The function `_getIterator` returns an iterable iterator for the elements in the class.
    */
   protected* _getIterator(): IterableIterator<E> {
-    for (const item of this.elements) {
-      yield item;
+    for (let i = 0; i < this._size; i++) {
+      yield this._buffer[(this._offset + i) & this._mask] as E;
     }
   }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The function moves the elements, front first, into a new buffer of at least `capacity` slots.
+   * @param {number} capacity - The number of slots needed.
+   */
+  protected _grow(capacity: number): void {
+    const buffer: (E | undefined)[] = new Array(Queue._powerOfTwoAtLeast(capacity));
+    for (let i = 0; i < this._size; i++) buffer[i] = this._buffer[(this._offset + i) & this._mask];
+    this._buffer = buffer;
+    this._mask = buffer.length - 1;
+    this._offset = 0;
+  }
+
+  /**
+   * The function counts the times the ring buffer grows and copies its elements.
+   * @returns The methods `enableStats` wraps.
+   */
+  protected override _instrumentedMethods(): InstrumentedMethods {
+    return { ...super._instrumentedMethods(), _grow: 'growths' };
+  }
+
+  protected _cloneOptions(): QueueOptions {
+    return { capacity: this._size, maxSize: this._maxSize === Infinity ? undefined : this._maxSize };
+  }
+
+  protected static _powerOfTwoAtLeast(n: number): number {
+    let capacity = 1;
+    while (capacity < n) capacity *= 2;
+    return capacity;
+  }
 }
 
 /**
@@ -409,6 +553,7 @@ export class Queue<E = any> extends IterableElementBase<E> {
  * 2. Based on Linked List: LinkedListQueue uses a linked list to store elements. Each node in the linked list contains data and a pointer to the next node.
  * 3. Memory Usage: Since each element requires additional space to store a pointer to the next element, linked lists may use more memory compared to arrays.
  * 4. Frequent Enqueuing and Dequeuing Operations: If your application involves frequent enqueuing and dequeuing operations and is less concerned with random access, then LinkedListQueue is a good choice.
+ * 5. Node Pooling: Pass `nodePoolSize` to reuse dequeued nodes, so a queue that stays near a steady length does not allocate per operation.
  */
 export class LinkedListQueue<E = any> extends SinglyLinkedList<E> {
   /**
@@ -457,6 +602,6 @@ export class LinkedListQueue<E = any> extends SinglyLinkedList<E> {
    * values as the original `LinkedListQueue`.
    */
   clone(): LinkedListQueue<E> {
-    return new LinkedListQueue<E>(this.values());
+    return new LinkedListQueue<E>(this.values(), { nodePoolSize: this._nodePoolSize });
   }
 }
@@ -0,0 +1,461 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { SharedQueueOptions } from '../../types';
+
+// Slots of the Int32Array header. The two indices sit 64 bytes apart so producers and consumers do not share a
+// cache line.
+const HEAD = 0;
+const TAIL = 16;
+const ITEMS_SIGNAL = 32;
+const ITEM_WAITERS = 33;
+const SPACE_SIGNAL = 48;
+const SPACE_WAITERS = 49;
+const CLOSED = 64;
+const CAPACITY = 65;
+const RECORD_SIZE = 66;
+const KIND = 67;
+const HEADER_BYTES = 80 * 4;
+
+const SPSC_KIND = 1;
+const MPMC_KIND = 2;
+
+/**
+ * 1. Shared Memory: A shared queue lives in one `SharedArrayBuffer`. Post `buffer` to a worker and wrap it there with the same class; both sides then use the same ring, and no record is cloned.
+ * 2. Fixed-size Records: Every record is `recordSize` bytes. `push` copies the bytes of any typed array of that size in, and `shift` copies them out, into a given `Uint8Array` to avoid allocating.
+ * 3. Three Ways to Wait: `push` and `shift` never block. `pushWait` and `shiftWait` block the thread with `Atomics.wait`, which browsers allow only in workers. `pushAsync`, `shiftAsync` and `for await` use `Atomics.waitAsync`, or polling where it is missing.
+ * 4. Closing: After `close`, pushes fail and consumers drain what is left, then get `undefined`.
+ * 5. Wake-ups: A side only calls `Atomics.notify` when the other side has registered as waiting, so a busy pipeline makes no extra calls.
+ */
+export abstract class SharedQueue {
+  /**
+   * The constructor creates a queue on a new `SharedArrayBuffer`, or wraps the buffer of an existing queue of the
+   * same kind.
+   * @param {SharedQueueOptions | SharedArrayBuffer} optionsOrBuffer - `capacity`, the number of records, rounded up
+   * to a power of two, and `recordSize`, the bytes per record; or the `buffer` of a queue created elsewhere.
+   * @param {number} kind - Tags the buffer, so it is not wrapped by a queue of another kind.
+   * @param {number} slotBytes - The bytes of bookkeeping per slot, kept between the header and the records.
+   */
+  protected constructor(optionsOrBuffer: SharedQueueOptions | SharedArrayBuffer, kind: number, slotBytes: number) {
+    if (typeof SharedArrayBuffer === 'undefined') throw new Error('SharedQueue requires SharedArrayBuffer');
+    if (optionsOrBuffer instanceof SharedArrayBuffer) {
+      this._buffer = optionsOrBuffer;
+      this._header = new Int32Array(optionsOrBuffer, 0, HEADER_BYTES / 4);
+      if (this._header[KIND] !== kind) throw new Error('The buffer does not belong to a queue of this kind');
+    } else {
+      const { capacity, recordSize } = optionsOrBuffer;
+      if (!(Number.isInteger(capacity) && capacity > 0 && capacity <= 1 << 30)) {
+        throw new Error('SharedQueue capacity must be an integer from 1 to 2 ** 30');
+      }
+      if (!(Number.isInteger(recordSize) && recordSize > 0)) {
+        throw new Error('SharedQueue recordSize must be a positive integer');
+      }
+      // A ring of one slot cannot tell a full lap from an empty one
+      let slots = 2;
+      while (slots < capacity) slots *= 2;
+      this._buffer = new SharedArrayBuffer(HEADER_BYTES + slots * (slotBytes + recordSize));
+      this._header = new Int32Array(this._buffer, 0, HEADER_BYTES / 4);
+      this._header[CAPACITY] = slots;
+      this._header[RECORD_SIZE] = recordSize;
+      this._header[KIND] = kind;
+    }
+    this._capacity = this._header[CAPACITY];
+    this._recordSize = this._header[RECORD_SIZE];
+    this._mask = this._capacity - 1;
+    this._records = new Uint8Array(this._buffer, HEADER_BYTES + this._capacity * slotBytes);
+  }
+
+  protected _buffer: SharedArrayBuffer;
+
+  /**
+   * The function returns the shared memory of the queue, to post to other threads.
+   * @returns The `buffer` property is being returned.
+   */
+  get buffer(): SharedArrayBuffer {
+    return this._buffer;
+  }
+
+  protected _capacity: number;
+
+  /**
+   * The function returns the number of records the queue holds, a power of two.
+   * @returns The `capacity` property is being returned.
+   */
+  get capacity(): number {
+    return this._capacity;
+  }
+
+  protected _recordSize: number;
+
+  /**
+   * The function returns the number of bytes per record.
+   * @returns The `recordSize` property is being returned.
+   */
+  get recordSize(): number {
+    return this._recordSize;
+  }
+
+  /**
+   * The function returns the number of records in the queue. Other threads may change it at any moment.
+   * @returns The number of records pushed and not yet shifted.
+   */
+  get size(): number {
+    return (Atomics.load(this._header, TAIL) - Atomics.load(this._header, HEAD)) | 0;
+  }
+
+  /**
+   * The function tells whether `close` was called on any thread.
+   * @returns `true` if the queue is closed.
+   */
+  get isClosed(): boolean {
+    return Atomics.load(this._header, CLOSED) === 1;
+  }
+
+  protected _header: Int32Array;
+
+  protected _mask: number;
+
+  protected _records: Uint8Array;
+
+  /**
+   * Time Complexity: O(r), where r is the record size
+   * Space Complexity: O(1)
+   *
+   * The `push` function copies a record into the queue without blocking.
+   * @param {ArrayBufferView} record - A typed array or `DataView` of exactly `recordSize` bytes.
+   * @returns `true` if the record was added, or `false` if the queue is full or closed.
+   */
+  push(record: ArrayBufferView): boolean {
+    const bytes = this._bytesOf(record);
+    if (this.isClosed || !this._tryPush(bytes)) return false;
+    this._signal(ITEMS_SIGNAL, ITEM_WAITERS);
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(r), where r is the record size
+   * Space Complexity: O(r) without a target
+   *
+   * The `shift` function copies the oldest record out of the queue without blocking.
+   * @param {Uint8Array} [target] - Where to copy the record; a new array by default.
+   * @returns The record, or `undefined` if the queue is empty.
+   */
+  shift(target?: Uint8Array): Uint8Array | undefined {
+    const out = this._targetOf(target);
+    if (!this._tryShift(out)) return undefined;
+    this._signal(SPACE_SIGNAL, SPACE_WAITERS);
+    return out;
+  }
+
+  /**
+   * The `pushWait` function copies a record into the queue, blocking the thread while the queue is full.
+   * @param {ArrayBufferView} record - A typed array or `DataView` of exactly `recordSize` bytes.
+   * @param {number} [timeout=Infinity] - The most milliseconds to wait.
+   * @returns `true` if the record was added, or `false` on timeout or if the queue is closed.
+   */
+  pushWait(record: ArrayBufferView, timeout = Infinity): boolean {
+    const bytes = this._bytesOf(record);
+    const deadline = Date.now() + timeout;
+    for (;;) {
+      if (this.isClosed) return false;
+      if (this._tryPush(bytes)) {
+        this._signal(ITEMS_SIGNAL, ITEM_WAITERS);
+        return true;
+      }
+      const left = deadline - Date.now();
+      if (left <= 0) return false;
+      this._waitSync(SPACE_SIGNAL, SPACE_WAITERS, () => this._canPush(), left);
+    }
+  }
+
+  /**
+   * The `shiftWait` function copies the oldest record out of the queue, blocking the thread while it is empty.
+   * @param {Uint8Array} [target] - Where to copy the record; a new array by default.
+   * @param {number} [timeout=Infinity] - The most milliseconds to wait.
+   * @returns The record, or `undefined` on timeout or once the queue is closed and empty.
+   */
+  shiftWait(target?: Uint8Array, timeout = Infinity): Uint8Array | undefined {
+    const out = this._targetOf(target);
+    const deadline = Date.now() + timeout;
+    for (;;) {
+      // Read the flag first, so a record pushed just before `close` is not missed
+      const closed = this.isClosed;
+      if (this._tryShift(out)) {
+        this._signal(SPACE_SIGNAL, SPACE_WAITERS);
+        return out;
+      }
+      if (closed) return undefined;
+      const left = deadline - Date.now();
+      if (left <= 0) return undefined;
+      this._waitSync(ITEMS_SIGNAL, ITEM_WAITERS, () => this._canShift(), left);
+    }
+  }
+
+  /**
+   * The `pushAsync` function copies a record into the queue, waiting without blocking the thread while it is full.
+   * @param {ArrayBufferView} record - A typed array or `DataView` of exactly `recordSize` bytes.
+   * @returns A promise of `true` once the record is added, or `false` if the queue is closed.
+   */
+  async pushAsync(record: ArrayBufferView): Promise<boolean> {
+    const bytes = this._bytesOf(record);
+    for (;;) {
+      if (this.isClosed) return false;
+      if (this._tryPush(bytes)) {
+        this._signal(ITEMS_SIGNAL, ITEM_WAITERS);
+        return true;
+      }
+      await this._waitAsync(SPACE_SIGNAL, SPACE_WAITERS, () => this._canPush());
+    }
+  }
+
+  /**
+   * The `shiftAsync` function copies the oldest record out of the queue, waiting without blocking the thread while
+   * it is empty.
+   * @param {Uint8Array} [target] - Where to copy the record; a new array by default.
+   * @returns A promise of the record, or of `undefined` once the queue is closed and empty.
+   */
+  async shiftAsync(target?: Uint8Array): Promise<Uint8Array | undefined> {
+    const out = this._targetOf(target);
+    for (;;) {
+      const closed = this.isClosed;
+      if (this._tryShift(out)) {
+        this._signal(SPACE_SIGNAL, SPACE_WAITERS);
+        return out;
+      }
+      if (closed) return undefined;
+      await this._waitAsync(ITEMS_SIGNAL, ITEM_WAITERS, () => this._canShift());
+    }
+  }
+
+  /**
+   * The function consumes the queue as an async iterator, yielding a new array per record until the queue is closed
+   * and empty.
+   */
+  async *[Symbol.asyncIterator](): AsyncIterableIterator<Uint8Array> {
+    for (;;) {
+      const record = await this.shiftAsync();
+      if (record === undefined) return;
+      yield record;
+    }
+  }
+
+  /**
+   * The `close` function closes the queue for every thread and wakes all waiters. Records already pushed can still
+   * be shifted.
+   */
+  close(): void {
+    Atomics.store(this._header, CLOSED, 1);
+    for (const signal of [ITEMS_SIGNAL, SPACE_SIGNAL]) {
+      Atomics.add(this._header, signal, 1);
+      Atomics.notify(this._header, signal);
+    }
+  }
+
+  /**
+   * The function reserves a slot, copies the record in and publishes it.
+   * @param {Uint8Array} bytes - Exactly `recordSize` bytes.
+   * @returns `false` if the queue is full.
+   */
+  protected abstract _tryPush(bytes: Uint8Array): boolean;
+
+  /**
+   * The function claims the oldest published record and copies it out.
+   * @param {Uint8Array} target - At least `recordSize` bytes.
+   * @returns `false` if no record is published.
+   */
+  protected abstract _tryShift(target: Uint8Array): boolean;
+
+  protected abstract _canPush(): boolean;
+
+  protected abstract _canShift(): boolean;
+
+  /**
+   * The function wakes the threads waiting on a signal, if there are any.
+   * @param {number} signal - The header slot the waiters wait on.
+   * @param {number} waiters - The header slot counting them.
+   */
+  protected _signal(signal: number, waiters: number): void {
+    if (Atomics.load(this._header, waiters) === 0) return;
+    Atomics.add(this._header, signal, 1);
+    Atomics.notify(this._header, signal);
+  }
+
+  /**
+   * The function registers as a waiter, then sleeps on the signal unless the condition already holds. It can return
+   * early; callers check again.
+   * @param {number} signal - The header slot to wait on.
+   * @param {number} waiters - The header slot counting waiters.
+   * @param ready - Whether there is no need to wait any more.
+   * @param {number} timeout - The most milliseconds to sleep.
+   */
+  protected _waitSync(signal: number, waiters: number, ready: () => boolean, timeout: number): void {
+    Atomics.add(this._header, waiters, 1);
+    const observed = Atomics.load(this._header, signal);
+    if (!ready() && !this.isClosed) Atomics.wait(this._header, signal, observed, timeout);
+    Atomics.sub(this._header, waiters, 1);
+  }
+
+  /**
+   * The function is `_waitSync` without blocking: it awaits `Atomics.waitAsync`, or a short timer where that is
+   * missing.
+   * @param {number} signal - The header slot to wait on.
+   * @param {number} waiters - The header slot counting waiters.
+   * @param ready - Whether there is no need to wait any more.
+   */
+  protected async _waitAsync(signal: number, waiters: number, ready: () => boolean): Promise<void> {
+    Atomics.add(this._header, waiters, 1);
+    try {
+      const observed = Atomics.load(this._header, signal);
+      if (ready() || this.isClosed) return;
+      const waitAsync = (Atomics as any).waitAsync;
+      if (typeof waitAsync === 'function') {
+        const result = waitAsync(this._header, signal, observed);
+        if (result.async) await result.value;
+      } else {
+        await new Promise(resolve => setTimeout(resolve, 1));
+      }
+    } finally {
+      Atomics.sub(this._header, waiters, 1);
+    }
+  }
+
+  protected _bytesOf(record: ArrayBufferView): Uint8Array {
+    if (record.byteLength !== this._recordSize) {
+      throw new RangeError(`A record must be ${this._recordSize} bytes, got ${record.byteLength}`);
+    }
+    return record instanceof Uint8Array ? record : new Uint8Array(record.buffer, record.byteOffset, record.byteLength);
+  }
+
+  protected _targetOf(target?: Uint8Array): Uint8Array {
+    if (target === undefined) return new Uint8Array(this._recordSize);
+    if (target.length < this._recordSize) throw new RangeError(`The target must hold ${this._recordSize} bytes`);
+    return target;
+  }
+
+  protected _copyIn(slot: number, bytes: Uint8Array): void {
+    this._records.set(bytes, slot * this._recordSize);
+  }
+
+  protected _copyOut(slot: number, target: Uint8Array): void {
+    const start = slot * this._recordSize;
+    target.set(this._records.subarray(start, start + this._recordSize));
+  }
+}
+
+/**
+ * 1. Single Producer, Single Consumer: An SPSCQueue is a ring with one head and one tail index. The producer alone moves the tail and the consumer alone moves the head, so each operation is a plain copy and one atomic store, without compare-and-swap.
+ * 2. Threads: Only one thread may push and only one may shift at a time; use MPMCQueue otherwise.
+ */
+export class SPSCQueue extends SharedQueue {
+  /**
+   * The constructor creates a queue on a new `SharedArrayBuffer`, or wraps the buffer of an existing SPSCQueue.
+   * @param {SharedQueueOptions | SharedArrayBuffer} optionsOrBuffer - `capacity`, the number of records, rounded up
+   * to a power of two, and `recordSize`, the bytes per record; or the `buffer` of a queue created elsewhere.
+   */
+  constructor(optionsOrBuffer: SharedQueueOptions | SharedArrayBuffer) {
+    super(optionsOrBuffer, SPSC_KIND, 0);
+  }
+
+  protected _tryPush(bytes: Uint8Array): boolean {
+    const tail = Atomics.load(this._header, TAIL);
+    if (((tail - Atomics.load(this._header, HEAD)) | 0) === this._capacity) return false;
+    this._copyIn(tail & this._mask, bytes);
+    Atomics.store(this._header, TAIL, (tail + 1) | 0);
+    return true;
+  }
+
+  protected _tryShift(target: Uint8Array): boolean {
+    const head = Atomics.load(this._header, HEAD);
+    if (head === Atomics.load(this._header, TAIL)) return false;
+    this._copyOut(head & this._mask, target);
+    Atomics.store(this._header, HEAD, (head + 1) | 0);
+    return true;
+  }
+
+  protected _canPush(): boolean {
+    return this.size < this._capacity;
+  }
+
+  protected _canShift(): boolean {
+    return this.size > 0;
+  }
+}
+
+/**
+ * 1. Many Producers, Many Consumers: An MPMCQueue is a bounded ring in which every slot carries a sequence number, after Dmitry Vyukov's design. A thread claims a slot by moving the tail or head with compare-and-swap, copies its record, and then publishes the slot by advancing the sequence number.
+ * 2. Lock-free: A thread never waits for a lock. A producer or consumer stalled in the middle of a copy only delays the consumer or producer of that one slot.
+ * 3. Size: `size` counts claimed slots, so it can include records still being copied.
+ */
+export class MPMCQueue extends SharedQueue {
+  /**
+   * The constructor creates a queue on a new `SharedArrayBuffer`, or wraps the buffer of an existing MPMCQueue.
+   * @param {SharedQueueOptions | SharedArrayBuffer} optionsOrBuffer - `capacity`, the number of records, rounded up
+   * to a power of two, and `recordSize`, the bytes per record; or the `buffer` of a queue created elsewhere.
+   */
+  constructor(optionsOrBuffer: SharedQueueOptions | SharedArrayBuffer) {
+    const isNew = !(optionsOrBuffer instanceof SharedArrayBuffer);
+    super(optionsOrBuffer, MPMC_KIND, 4);
+    this._sequences = new Int32Array(this._buffer, HEADER_BYTES, this._capacity);
+    if (isNew) for (let i = 0; i < this._capacity; i++) this._sequences[i] = i;
+  }
+
+  protected _sequences: Int32Array;
+
+  protected _tryPush(bytes: Uint8Array): boolean {
+    let tail = Atomics.load(this._header, TAIL);
+    for (;;) {
+      const slot = tail & this._mask;
+      const diff = (Atomics.load(this._sequences, slot) - tail) | 0;
+      if (diff === 0) {
+        const seen = Atomics.compareExchange(this._header, TAIL, tail, (tail + 1) | 0);
+        if (seen === tail) {
+          this._copyIn(slot, bytes);
+          Atomics.store(this._sequences, slot, (tail + 1) | 0);
+          return true;
+        }
+        tail = seen;
+      } else if (diff < 0) {
+        // The slot still holds a record from the previous lap
+        return false;
+      } else {
+        tail = Atomics.load(this._header, TAIL);
+      }
+    }
+  }
+
+  protected _tryShift(target: Uint8Array): boolean {
+    let head = Atomics.load(this._header, HEAD);
+    for (;;) {
+      const slot = head & this._mask;
+      const diff = (Atomics.load(this._sequences, slot) - ((head + 1) | 0)) | 0;
+      if (diff === 0) {
+        const seen = Atomics.compareExchange(this._header, HEAD, head, (head + 1) | 0);
+        if (seen === head) {
+          this._copyOut(slot, target);
+          Atomics.store(this._sequences, slot, (head + this._capacity) | 0);
+          return true;
+        }
+        head = seen;
+      } else if (diff < 0) {
+        // The slot has not been published yet
+        return false;
+      } else {
+        head = Atomics.load(this._header, HEAD);
+      }
+    }
+  }
+
+  protected _canPush(): boolean {
+    const tail = Atomics.load(this._header, TAIL);
+    return ((Atomics.load(this._sequences, tail & this._mask) - tail) | 0) >= 0;
+  }
+
+  protected _canShift(): boolean {
+    const head = Atomics.load(this._header, HEAD);
+    return ((Atomics.load(this._sequences, head & this._mask) - ((head + 1) | 0)) | 0) >= 0;
+  }
+}
@@ -1 +1,2 @@
 export * from './trie';
+export * from './radix-trie';
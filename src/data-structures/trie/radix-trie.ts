@@ -0,0 +1,883 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { ElementCallback, RadixTrieOptions } from '../../types';
+import { IterableElementBase } from '../base';
+
+/**
+ * RadixTrieNode is a node of a RadixTrie. It holds the edge label leading to it, a flag telling
+ * whether a word ends here, and its children in two parallel arrays sorted by the first UTF-16 code
+ * unit of the child label.
+ */
+export class RadixTrieNode {
+  /**
+   * The constructor creates a node without children.
+   * @param {string} label - The edge label leading to the node.
+   * @param [isEnd=false] - Whether a word ends at the node.
+   */
+  constructor(label: string, isEnd = false) {
+    this._label = label;
+    this._isEnd = isEnd;
+  }
+
+  protected _label: string;
+
+  /**
+   * The function returns the edge label leading to the node. It is empty only for the root.
+   * @returns The value of the `_label` property, which is a string.
+   */
+  get label(): string {
+    return this._label;
+  }
+
+  /**
+   * The function sets the edge label. The first code unit must stay the same while the node is a
+   * child, since the parent finds the node by it.
+   * @param {string} value - The new label.
+   */
+  set label(value: string) {
+    this._label = value;
+  }
+
+  protected _isEnd: boolean;
+
+  /**
+   * The function returns whether a word ends at the node.
+   * @returns The value of the `_isEnd` property, which is a boolean.
+   */
+  get isEnd(): boolean {
+    return this._isEnd;
+  }
+
+  /**
+   * The function sets whether a word ends at the node.
+   * @param {boolean} value - The new flag.
+   */
+  set isEnd(value: boolean) {
+    this._isEnd = value;
+  }
+
+  protected _firsts: number[] = [];
+
+  /**
+   * The function returns the first code unit of each child label, in ascending order.
+   * @returns The `_firsts` array, parallel to `children`.
+   */
+  get firsts(): number[] {
+    return this._firsts;
+  }
+
+  protected _children: RadixTrieNode[] = [];
+
+  /**
+   * The function returns the children sorted by the first code unit of their labels.
+   * @returns The `_children` array, parallel to `firsts`.
+   */
+  get children(): RadixTrieNode[] {
+    return this._children;
+  }
+
+  /**
+   * Time Complexity: O(log k), where k is the number of children.
+   * Space Complexity: O(1)
+   *
+   * The function finds the child whose label starts with a code unit by binary search.
+   * @param {number} code - The first UTF-16 code unit of the child label.
+   * @returns The index of the child, or `-(insertion point) - 1` if there is none.
+   */
+  indexOf(code: number): number {
+    const firsts = this._firsts;
+    let lo = 0,
+      hi = firsts.length - 1;
+    while (lo <= hi) {
+      const mid = (lo + hi) >>> 1;
+      const first = firsts[mid];
+      if (first === code) return mid;
+      if (first < code) lo = mid + 1;
+      else hi = mid - 1;
+    }
+    return -lo - 1;
+  }
+
+  /**
+   * Time Complexity: O(k)
+   * Space Complexity: O(1)
+   *
+   * The function inserts a child at the index `indexOf` reported for its first code unit.
+   * @param {number} index - The insertion point.
+   * @param {RadixTrieNode} child - The child, whose label must not be empty.
+   */
+  insertChild(index: number, child: RadixTrieNode): void {
+    this._firsts.splice(index, 0, child.label.charCodeAt(0));
+    this._children.splice(index, 0, child);
+  }
+
+  /**
+   * Time Complexity: O(k)
+   * Space Complexity: O(1)
+   *
+   * The function removes the child at an index.
+   * @param {number} index - The index of the child.
+   */
+  removeChild(index: number): void {
+    this._firsts.splice(index, 1);
+    this._children.splice(index, 1);
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The function merges the only child into the node: the labels are joined and the node takes
+   * over the child's flag and children.
+   */
+  absorbChild(): void {
+    const child = this._children[0];
+    this._label += child.label;
+    this._isEnd = child.isEnd;
+    this._firsts = child.firsts;
+    this._children = child.children;
+  }
+}
+
+/**
+ * 1. Radix Tree: A RadixTrie (patricia trie) stores a set of strings like a Trie, but a chain of nodes with one child and no word ending is collapsed into one node whose edge label holds the whole chain. A node is either the end of a word or a branch, so there are at most 2n nodes for n words, independent of their length.
+ * 2. Compact Children: The children of a node are two sorted parallel arrays, the first code unit of each label and the nodes, searched by binary search, instead of a Map per character.
+ * 3. Order: Words come out in ascending UTF-16 code unit order, which `getWords` and the iterator produce with an explicit stack and one string concatenation per node.
+ * 4. Freezing: `freeze()` packs the trie into a FrozenRadixTrie, a read-only double-array trie in typed arrays for serving lookups from contiguous memory.
+ */
+export class RadixTrie extends IterableElementBase<string, RadixTrie> {
+  /**
+   * The constructor creates a RadixTrie and adds words to it.
+   * @param words - The words to add initially.
+   * @param {RadixTrieOptions} [options] - `caseSensitive` (default `true`) lowercases every input
+   * when `false`.
+   */
+  constructor(words: Iterable<string> = [], options?: RadixTrieOptions) {
+    super();
+    if (options) {
+      const { caseSensitive } = options;
+      if (caseSensitive !== undefined) this._caseSensitive = caseSensitive;
+    }
+    if (words) {
+      for (const word of words) this.add(word);
+    }
+  }
+
+  protected _size: number = 0;
+
+  /**
+   * The function returns the number of words.
+   * @returns The `_size` property is being returned.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  protected _nodeCount: number = 1;
+
+  /**
+   * The function returns the number of nodes, including the root.
+   * @returns The `_nodeCount` property is being returned.
+   */
+  get nodeCount(): number {
+    return this._nodeCount;
+  }
+
+  protected _caseSensitive: boolean = true;
+
+  /**
+   * The function returns whether the trie is case sensitive.
+   * @returns The `_caseSensitive` property is being returned.
+   */
+  get caseSensitive(): boolean {
+    return this._caseSensitive;
+  }
+
+  protected _root: RadixTrieNode = new RadixTrieNode('');
+
+  /**
+   * The function returns the root node, whose label is empty.
+   * @returns The `_root` property is being returned.
+   */
+  get root(): RadixTrieNode {
+    return this._root;
+  }
+
+  /**
+   * Time Complexity: O(l log k), where l is the length of the word and k the number of children of a node.
+   * Space Complexity: O(1), at most two nodes are created.
+   *
+   * Add a word. A node whose label only partly matches the word is split in two.
+   * @param {string} word - The word to add.
+   * @returns {boolean} True if the word was not in the trie before.
+   */
+  add(word: string): boolean {
+    word = this._caseProcess(word);
+    let cur = this._root;
+    let i = 0;
+    while (i < word.length) {
+      const index = cur.indexOf(word.charCodeAt(i));
+      if (index < 0) {
+        cur.insertChild(-index - 1, new RadixTrieNode(word.slice(i), true));
+        this._nodeCount++;
+        this._size++;
+        return true;
+      }
+
+      let child = cur.children[index];
+      const label = child.label;
+      const end = Math.min(label.length, word.length - i);
+      let common = 1;
+      while (common < end && label.charCodeAt(common) === word.charCodeAt(i + common)) common++;
+      if (common < label.length) {
+        const branch = new RadixTrieNode(label.slice(0, common));
+        child.label = label.slice(common);
+        branch.insertChild(0, child);
+        cur.children[index] = branch;
+        this._nodeCount++;
+        child = branch;
+      }
+      cur = child;
+      i += common;
+    }
+
+    if (cur.isEnd) return false;
+    cur.isEnd = true;
+    this._size++;
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(l log k)
+   * Space Complexity: O(1)
+   *
+   * Check if a word is in the trie.
+   * @param {string} word - The word to look for.
+   * @returns {boolean} True if the word was added.
+   */
+  has(word: string): boolean {
+    const found = this._locate(this._caseProcess(word));
+    return found !== undefined && found[1] === found[0].label.length && found[0].isEnd;
+  }
+
+  /**
+   * Check if the trie is empty.
+   * @returns {boolean} True if there are no words.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Remove all words.
+   */
+  clear(): void {
+    this._size = 0;
+    this._nodeCount = 1;
+    this._root = new RadixTrieNode('');
+  }
+
+  /**
+   * Time Complexity: O(l log k)
+   * Space Complexity: O(l / s), where s is the mean label length.
+   *
+   * Remove a word. A node left without a word and with one child is merged into it again, so the
+   * trie stays collapsed.
+   * @param {string} word - The word to remove.
+   * @returns {boolean} True if the word was in the trie.
+   */
+  delete(word: string): boolean {
+    word = this._caseProcess(word);
+    const parents: RadixTrieNode[] = [];
+    const indexes: number[] = [];
+    let cur = this._root;
+    let i = 0;
+    while (i < word.length) {
+      const index = cur.indexOf(word.charCodeAt(i));
+      if (index < 0) return false;
+      const child = cur.children[index];
+      if (!word.startsWith(child.label, i)) return false;
+      parents.push(cur);
+      indexes.push(index);
+      cur = child;
+      i += child.label.length;
+    }
+    if (!cur.isEnd) return false;
+
+    cur.isEnd = false;
+    this._size--;
+    if (cur !== this._root) {
+      if (cur.children.length === 0) {
+        const parent = parents[parents.length - 1];
+        parent.removeChild(indexes[indexes.length - 1]);
+        this._nodeCount--;
+        if (parent !== this._root && !parent.isEnd && parent.children.length === 1) {
+          parent.absorbChild();
+          this._nodeCount--;
+        }
+      } else if (cur.children.length === 1) {
+        cur.absorbChild();
+        this._nodeCount--;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Time Complexity: O(l log k)
+   * Space Complexity: O(1)
+   *
+   * Check if the input is a prefix of a word but not a word itself.
+   * @param {string} input - The prefix.
+   * @returns {boolean} True if some word extends the input and the input was not added.
+   */
+  hasPurePrefix(input: string): boolean {
+    const found = this._locate(this._caseProcess(input));
+    if (found === undefined) return false;
+    return found[1] < found[0].label.length || !found[0].isEnd;
+  }
+
+  /**
+   * Time Complexity: O(l log k)
+   * Space Complexity: O(1)
+   *
+   * Check if the input is a prefix of a word, the word itself included.
+   * @param {string} input - The prefix.
+   * @returns {boolean} True if some word starts with the input.
+   */
+  hasPrefix(input: string): boolean {
+    return this._locate(this._caseProcess(input)) !== undefined;
+  }
+
+  /**
+   * Time Complexity: O(l)
+   * Space Complexity: O(l)
+   *
+   * Check if the input is a prefix of the longest common prefix of all words.
+   * @param {string} input - The prefix.
+   * @returns {boolean} True if every word starts with the input.
+   */
+  hasCommonPrefix(input: string): boolean {
+    return this.getLongestCommonPrefix().startsWith(this._caseProcess(input));
+  }
+
+  /**
+   * Time Complexity: O(l)
+   * Space Complexity: O(l)
+   *
+   * Get the longest prefix shared by all words, following the root down while a node has exactly
+   * one child and no word ends at it.
+   * @returns {string} The longest common prefix.
+   */
+  getLongestCommonPrefix(): string {
+    let commonPre = '';
+    let cur = this._root;
+    while (!cur.isEnd && cur.children.length === 1) {
+      cur = cur.children[0];
+      commonPre += cur.label;
+    }
+    return commonPre;
+  }
+
+  /**
+   * Time Complexity: O(l log k + m), where m is the number of nodes visited.
+   * Space Complexity: O(m)
+   *
+   * Get the words starting with a prefix in ascending order.
+   * @param {string} prefix - The prefix.
+   * @param {number} max - The maximum number of words to return.
+   * @param {boolean} isAllWhenEmptyPrefix - Whether an empty prefix returns all words; it returns
+   * none by default.
+   * @returns {string[]} The words.
+   */
+  getWords(prefix = '', max = Number.MAX_SAFE_INTEGER, isAllWhenEmptyPrefix = false): string[] {
+    prefix = this._caseProcess(prefix);
+    const words: string[] = [];
+    if (prefix === '' && !isAllWhenEmptyPrefix) return words;
+    const found = this._locate(prefix);
+    if (found === undefined) return words;
+
+    const [start, matched] = found;
+    const nodes = [start];
+    const paths = [prefix + start.label.slice(matched)];
+    while (nodes.length > 0 && words.length < max) {
+      const node = nodes.pop()!;
+      const path = paths.pop()!;
+      if (node.isEnd) words.push(path);
+      const { children } = node;
+      for (let i = children.length - 1; i >= 0; i--) {
+        nodes.push(children[i]);
+        paths.push(path + children[i].label);
+      }
+    }
+    return words;
+  }
+
+  /**
+   * Time Complexity: O(n) for the traversal plus the layout, see FrozenRadixTrie.
+   * Space Complexity: O(n)
+   *
+   * Pack the trie into a read-only double-array trie. Later changes to this trie do not affect it.
+   * @returns {FrozenRadixTrie} The frozen copy.
+   */
+  freeze(): FrozenRadixTrie {
+    return new FrozenRadixTrie(this);
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * Clone the trie.
+   * @returns {RadixTrie} A new trie with the same words and case sensitivity.
+   */
+  clone(): RadixTrie {
+    return new RadixTrie(this.values(), { caseSensitive: this.caseSensitive });
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `filter` function creates a trie with the words that pass the predicate.
+   * @param predicate - A function called with `word`, `index` and the trie.
+   * @param {any} [thisArg] - The value of `this` within the predicate.
+   * @returns {RadixTrie} A new trie.
+   */
+  filter(predicate: ElementCallback<string, boolean>, thisArg?: any): RadixTrie {
+    const results = new RadixTrie([], { caseSensitive: this.caseSensitive });
+    let index = 0;
+    for (const word of this) {
+      if (predicate.call(thisArg, word, index, this)) results.add(word);
+      index++;
+    }
+    return results;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `map` function creates a trie with the words returned by the callback.
+   * @param callback - A function called with `word`, `index` and the trie.
+   * @param {any} [thisArg] - The value of `this` within the callback.
+   * @returns {RadixTrie} A new trie.
+   */
+  map(callback: ElementCallback<string, string>, thisArg?: any): RadixTrie {
+    const results = new RadixTrie([], { caseSensitive: this.caseSensitive });
+    let index = 0;
+    for (const word of this) {
+      results.add(callback.call(thisArg, word, index, this));
+      index++;
+    }
+    return results;
+  }
+
+  /**
+   * The function iterates over the words in ascending order.
+   */
+  protected* _getIterator(): IterableIterator<string> {
+    const nodes = [this._root];
+    const paths = [''];
+    while (nodes.length > 0) {
+      const node = nodes.pop()!;
+      const path = paths.pop()!;
+      if (node.isEnd) yield path;
+      const { children } = node;
+      for (let i = children.length - 1; i >= 0; i--) {
+        nodes.push(children[i]);
+        paths.push(path + children[i].label);
+      }
+    }
+  }
+
+  /**
+   * Time Complexity: O(l log k)
+   * Space Complexity: O(1)
+   *
+   * The function follows the input from the root.
+   * @param {string} input - A case processed string.
+   * @returns The node where the input ends and how many code units of its label the input
+   * covers, or undefined if no word starts with the input.
+   */
+  protected _locate(input: string): [RadixTrieNode, number] | undefined {
+    let cur = this._root;
+    let i = 0;
+    while (i < input.length) {
+      const index = cur.indexOf(input.charCodeAt(i));
+      if (index < 0) return;
+      const child = cur.children[index];
+      const label = child.label;
+      const end = Math.min(label.length, input.length - i);
+      for (let j = 1; j < end; j++) {
+        if (label.charCodeAt(j) !== input.charCodeAt(i + j)) return;
+      }
+      if (end < label.length) return [child, end];
+      cur = child;
+      i += end;
+    }
+    return [cur, cur.label.length];
+  }
+
+  protected _caseProcess(str: string) {
+    if (!this._caseSensitive) {
+      str = str.toLowerCase(); // Convert str to lowercase if case-insensitive
+    }
+    return str;
+  }
+}
+
+/**
+ * 1. Double-Array Trie: A FrozenRadixTrie is a read-only RadixTrie packed into typed arrays. Every node is a slot, and the child of slot `s` whose label starts with a code unit is the slot `base[s] + code`, valid if `check` of that slot is `s`. A step is two array reads instead of a search.
+ * 2. Alphabet: The code units that occur in the words get the codes 1..A in ascending order, so the children of a slot are laid out in sorted order and `code` stays small.
+ * 3. Labels: All edge labels are one Uint16Array; a slot covers `labels[labelStart[s]]` to `labels[labelEnd[s] - 1]`. Sibling links give the sorted children without scanning the alphabet.
+ * 4. Layout: Slots are assigned breadth-first, first fit, skipping ahead once the scanned region is nearly full, like darts. About 29 bytes per slot plus 2 per label code unit, and no objects per node, so a large dictionary can be built once and served without GC pressure.
+ */
+export class FrozenRadixTrie {
+  /**
+   * The constructor packs a RadixTrie. `RadixTrie.prototype.freeze` calls it.
+   * @param {RadixTrie} trie - The trie to pack.
+   */
+  constructor(trie: RadixTrie) {
+    this._size = trie.size;
+    this._caseSensitive = trie.caseSensitive;
+
+    const nodes: RadixTrieNode[] = [trie.root];
+    const firstChildIds: number[] = [];
+    let labelLength = 0;
+    let maxChar = 0;
+    for (let k = 0; k < nodes.length; k++) {
+      firstChildIds.push(nodes.length);
+      const { label, children } = nodes[k];
+      labelLength += label.length;
+      for (let i = 0; i < label.length; i++) {
+        const char = label.charCodeAt(i);
+        if (char > maxChar) maxChar = char;
+      }
+      for (const child of children) nodes.push(child);
+    }
+    this._nodeCount = nodes.length;
+
+    const seen = new Uint8Array(maxChar + 1);
+    for (const node of nodes) {
+      if (node.children.length > 0) for (const first of node.firsts) seen[first] = 1;
+    }
+    const codeOf = new Int32Array(maxChar + 1);
+    let alphabetSize = 0;
+    for (let char = 0; char <= maxChar; char++) if (seen[char]) codeOf[char] = ++alphabetSize;
+    this._codeOf = codeOf;
+
+    const slotOf = new Int32Array(nodes.length);
+    const baseOf = new Int32Array(nodes.length);
+    let check = new Int32Array(Math.max(2 * nodes.length, alphabetSize + 2)).fill(-1);
+    const ensure = (length: number) => {
+      if (length <= check.length) return;
+      let capacity = check.length * 2;
+      while (capacity < length) capacity *= 2;
+      const grown = new Int32Array(capacity).fill(-1);
+      grown.set(check);
+      check = grown;
+    };
+
+    check[0] = 0;
+    let slotCount = 1;
+    let nextFree = 1;
+    for (let k = 0; k < nodes.length; k++) {
+      const { firsts } = nodes[k];
+      if (firsts.length === 0) continue;
+      const firstCode = codeOf[firsts[0]];
+      const lastCode = codeOf[firsts[firsts.length - 1]];
+      const start = Math.max(nextFree, firstCode);
+      let pos = start;
+      let occupied = 0;
+      let base = 0;
+      for (; ; pos++) {
+        ensure(pos + lastCode - firstCode + 1);
+        if (check[pos] !== -1) {
+          occupied++;
+          continue;
+        }
+        base = pos - firstCode;
+        let fits = true;
+        for (let i = 1; i < firsts.length; i++) {
+          if (check[base + codeOf[firsts[i]]] !== -1) {
+            fits = false;
+            break;
+          }
+        }
+        if (fits) break;
+      }
+      if (start === nextFree && occupied >= 0.95 * (pos - start + 1)) nextFree = pos;
+
+      baseOf[k] = base;
+      const first = firstChildIds[k];
+      for (let i = 0; i < firsts.length; i++) {
+        const slot = base + codeOf[firsts[i]];
+        check[slot] = slotOf[k];
+        slotOf[first + i] = slot;
+        if (slot >= slotCount) slotCount = slot + 1;
+      }
+      ensure(slotCount + 1);
+      while (check[nextFree] !== -1) nextFree++;
+    }
+
+    this._check = check.slice(0, slotCount);
+    this._base = new Int32Array(slotCount);
+    this._isEnd = new Uint8Array(slotCount);
+    this._labelStart = new Int32Array(slotCount);
+    this._labelEnd = new Int32Array(slotCount);
+    this._firstChild = new Int32Array(slotCount).fill(-1);
+    this._nextSibling = new Int32Array(slotCount).fill(-1);
+    this._labels = new Uint16Array(labelLength);
+    let offset = 0;
+    for (let k = 0; k < nodes.length; k++) {
+      const { label, isEnd, children } = nodes[k];
+      const slot = slotOf[k];
+      this._base[slot] = baseOf[k];
+      this._isEnd[slot] = isEnd ? 1 : 0;
+      this._labelStart[slot] = offset;
+      for (let i = 0; i < label.length; i++) this._labels[offset++] = label.charCodeAt(i);
+      this._labelEnd[slot] = offset;
+      if (children.length > 0) {
+        const first = firstChildIds[k];
+        this._firstChild[slot] = slotOf[first];
+        for (let i = 1; i < children.length; i++) this._nextSibling[slotOf[first + i - 1]] = slotOf[first + i];
+      }
+    }
+  }
+
+  protected _size: number;
+
+  /**
+   * The function returns the number of words.
+   * @returns The `_size` property is being returned.
+   */
+  get size(): number {
+    return this._size;
+  }
+
+  protected _nodeCount: number;
+
+  /**
+   * The function returns the number of nodes, including the root.
+   * @returns The `_nodeCount` property is being returned.
+   */
+  get nodeCount(): number {
+    return this._nodeCount;
+  }
+
+  /**
+   * The function returns the number of slots, used or not. It is at least `nodeCount`.
+   * @returns The length of the `base` and `check` arrays.
+   */
+  get slotCount(): number {
+    return this._check.length;
+  }
+
+  protected _caseSensitive: boolean;
+
+  /**
+   * The function returns whether the trie is case sensitive.
+   * @returns The `_caseSensitive` property is being returned.
+   */
+  get caseSensitive(): boolean {
+    return this._caseSensitive;
+  }
+
+  protected _codeOf: Int32Array;
+
+  protected _base: Int32Array;
+
+  protected _check: Int32Array;
+
+  protected _isEnd: Uint8Array;
+
+  protected _labelStart: Int32Array;
+
+  protected _labelEnd: Int32Array;
+
+  protected _labels: Uint16Array;
+
+  protected _firstChild: Int32Array;
+
+  protected _nextSibling: Int32Array;
+
+  /**
+   * Time Complexity: O(l)
+   * Space Complexity: O(1)
+   *
+   * Check if a word is in the trie.
+   * @param {string} word - The word to look for.
+   * @returns {boolean} True if the word was in the trie when it was frozen.
+   */
+  has(word: string): boolean {
+    const found = this._locate(this._caseProcess(word));
+    return found !== undefined && found[1] === this._labelEnd[found[0]] && this._isEnd[found[0]] === 1;
+  }
+
+  /**
+   * Check if the trie is empty.
+   * @returns {boolean} True if there are no words.
+   */
+  isEmpty(): boolean {
+    return this._size === 0;
+  }
+
+  /**
+   * Time Complexity: O(l)
+   * Space Complexity: O(1)
+   *
+   * Check if the input is a prefix of a word, the word itself included.
+   * @param {string} input - The prefix.
+   * @returns {boolean} True if some word starts with the input.
+   */
+  hasPrefix(input: string): boolean {
+    return this._locate(this._caseProcess(input)) !== undefined;
+  }
+
+  /**
+   * Time Complexity: O(l)
+   * Space Complexity: O(1)
+   *
+   * Check if the input is a prefix of a word but not a word itself.
+   * @param {string} input - The prefix.
+   * @returns {boolean} True if some word extends the input and the input is not a word.
+   */
+  hasPurePrefix(input: string): boolean {
+    const found = this._locate(this._caseProcess(input));
+    if (found === undefined) return false;
+    return found[1] < this._labelEnd[found[0]] || this._isEnd[found[0]] === 0;
+  }
+
+  /**
+   * Time Complexity: O(l + m), where m is the number of nodes visited.
+   * Space Complexity: O(m)
+   *
+   * Get the words starting with a prefix in ascending order, like `RadixTrie.getWords`.
+   * @param {string} prefix - The prefix.
+   * @param {number} max - The maximum number of words to return.
+   * @param {boolean} isAllWhenEmptyPrefix - Whether an empty prefix returns all words.
+   * @returns {string[]} The words.
+   */
+  getWords(prefix = '', max = Number.MAX_SAFE_INTEGER, isAllWhenEmptyPrefix = false): string[] {
+    prefix = this._caseProcess(prefix);
+    const words: string[] = [];
+    if (prefix === '' && !isAllWhenEmptyPrefix) return words;
+    const found = this._locate(prefix);
+    if (found === undefined) return words;
+    const [slot, covered] = found;
+    for (const word of this._collect(slot, prefix + this._labelOf(covered, this._labelEnd[slot]))) {
+      if (words.length >= max) break;
+      words.push(word);
+    }
+    return words;
+  }
+
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * Build a mutable RadixTrie with the same words.
+   * @returns {RadixTrie} A new trie.
+   */
+  thaw(): RadixTrie {
+    return new RadixTrie(this, { caseSensitive: this._caseSensitive });
+  }
+
+  /**
+   * The function iterates over the words in ascending order.
+   */
+  [Symbol.iterator](): IterableIterator<string> {
+    return this._collect(0, '');
+  }
+
+  /**
+   * The function iterates over the words in ascending order.
+   */
+  values(): IterableIterator<string> {
+    return this._collect(0, '');
+  }
+
+  /**
+   * The function yields the words under a slot in ascending order. A stack entry is a slot and the
+   * path of its parent; the sibling is pushed before the first child so the child comes out first.
+   * @param {number} slot - The slot to start from.
+   * @param {string} path - The word the slot spells.
+   */
+  protected* _collect(slot: number, path: string): IterableIterator<string> {
+    if (this._isEnd[slot] === 1) yield path;
+    if (this._firstChild[slot] === -1) return;
+    const slots = [this._firstChild[slot]];
+    const parents = [path];
+    while (slots.length > 0) {
+      const cur = slots.pop()!;
+      const parent = parents.pop()!;
+      const word = parent + this._labelOf(this._labelStart[cur], this._labelEnd[cur]);
+      if (this._isEnd[cur] === 1) yield word;
+      if (this._nextSibling[cur] !== -1) {
+        slots.push(this._nextSibling[cur]);
+        parents.push(parent);
+      }
+      if (this._firstChild[cur] !== -1) {
+        slots.push(this._firstChild[cur]);
+        parents.push(word);
+      }
+    }
+  }
+
+  /**
+   * Time Complexity: O(l)
+   * Space Complexity: O(1)
+   *
+   * The function follows the input from the root slot.
+   * @param {string} input - A case processed string.
+   * @returns The slot where the input ends and the offset into `labels` where it stops covering
+   * the slot's label, or undefined if no word starts with the input.
+   */
+  protected _locate(input: string): [number, number] | undefined {
+    const { _codeOf: codeOf, _base: base, _check: check, _labels: labels } = this;
+    let slot = 0;
+    let i = 0;
+    while (i < input.length) {
+      const char = input.charCodeAt(i);
+      const code = char < codeOf.length ? codeOf[char] : 0;
+      if (code === 0) return;
+      const next = base[slot] + code;
+      if (next >= check.length || check[next] !== slot) return;
+      const end = this._labelEnd[next];
+      let j = this._labelStart[next] + 1;
+      i++;
+      while (j < end && i < input.length) {
+        if (labels[j] !== input.charCodeAt(i)) return;
+        j++;
+        i++;
+      }
+      slot = next;
+      if (j < end) return [slot, j];
+    }
+    return [slot, this._labelEnd[slot]];
+  }
+
+  /**
+   * The function decodes a range of `labels`.
+   * @param {number} start - The first offset.
+   * @param {number} end - The offset after the last.
+   * @returns {string} The string.
+   */
+  protected _labelOf(start: number, end: number): string {
+    if (start === end) return '';
+    return String.fromCharCode.apply(null, this._labels.subarray(start, end) as unknown as number[]);
+  }
+
+  protected _caseProcess(str: string) {
+    if (!this._caseSensitive) {
+      str = str.toLowerCase(); // Convert str to lowercase if case-insensitive
+    }
+    return str;
+  }
+}
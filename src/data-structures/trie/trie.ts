@@ -7,6 +7,7 @@
  */
 import type { ElementCallback, TrieOptions } from '../../types';
 import { IterableElementBase } from '../base';
+import { Heap } from '../heap';
 
 /**
  * TrieNode represents a node in the Trie data structure. It holds a character key, a map of children nodes,
@@ -78,6 +79,43 @@ export class TrieNode {
   set isEnd(value: boolean) {
     this._isEnd = value;
   }
+
+  protected _weight: number = 0;
+
+  /**
+   * The function returns the weight of the word ending at the node, used by `Trie.topK`.
+   * @returns The value of the `_weight` property, which is meaningful only when `isEnd` is true.
+   */
+  get weight(): number {
+    return this._weight;
+  }
+
+  /**
+   * The function sets the weight of the word ending at the node. `Trie.add` keeps `maxWeight` of the
+   * ancestors up to date; setting it directly does not.
+   * @param {number} value - The new weight.
+   */
+  set weight(value: number) {
+    this._weight = value;
+  }
+
+  protected _maxWeight: number = -Infinity;
+
+  /**
+   * The function returns the greatest weight of a word in the subtree of the node.
+   * @returns The value of the `_maxWeight` property, `-Infinity` if the subtree has no word.
+   */
+  get maxWeight(): number {
+    return this._maxWeight;
+  }
+
+  /**
+   * The function sets the greatest weight of a word in the subtree of the node.
+   * @param {number} value - The new maximum.
+   */
+  set maxWeight(value: number) {
+    this._maxWeight = value;
+  }
 }
 
 /**
@@ -147,17 +185,20 @@ export class Trie extends IterableElementBase<string, Trie> {
    */
 
   /**
-   * Time Complexity: O(l), where l is the length of the word being added.
+   * Time Complexity: O(l), where l is the length of the word being added. Lowering the weight of a
+   * word already in the Trie is O(l * k), where k is the number of children of a node on its path.
    * Space Complexity: O(l) - Each character in the word adds a TrieNode.
    *
    * Add a word to the Trie structure.
    * @param {string} word - The word to add.
+   * @param {number} [weight] - The weight `topK` ranks the word by. A new word gets 0 by default; the
+   * weight of a word already in the Trie changes only if it is given.
    * @returns {boolean} True if the word was successfully added.
    */
-  add(word: string): boolean {
+  add(word: string, weight?: number): boolean {
     word = this._caseProcess(word);
     let cur = this.root;
-    let isNewWord = false;
+    const path: TrieNode[] = [cur];
     for (const c of word) {
       let nodeC = cur.children.get(c);
       if (!nodeC) {
@@ -165,15 +206,40 @@ export class Trie extends IterableElementBase<string, Trie> {
         cur.children.set(c, nodeC);
       }
       cur = nodeC;
+      path.push(cur);
     }
-    if (!cur.isEnd) {
-      isNewWord = true;
+
+    const isNewWord = !cur.isEnd;
+    if (isNewWord) {
       cur.isEnd = true;
+      cur.weight = weight ?? 0;
       this._size++;
+    } else if (weight === undefined || weight === cur.weight) {
+      return false;
+    } else if (weight < cur.weight) {
+      cur.weight = weight;
+      for (let i = path.length - 1; i >= 0; i--) this._updateMaxWeight(path[i]);
+      return false;
+    } else {
+      cur.weight = weight;
     }
+    for (const node of path) if (cur.weight > node.maxWeight) node.maxWeight = cur.weight;
     return isNewWord;
   }
 
+  /**
+   * Time Complexity: O(l), where l is the length of the input word.
+   * Space Complexity: O(1) - Constant space.
+   *
+   * Get the weight of a word.
+   * @param {string} word - The word to look up.
+   * @returns {number | undefined} The weight, or undefined if the word is not in the Trie.
+   */
+  getWeight(word: string): number | undefined {
+    const node = this._getNode(this._caseProcess(word));
+    return node?.isEnd ? node.weight : undefined;
+  }
+
   /**
    * Time Complexity: O(l), where l is the length of the input word.
    * Space Complexity: O(1) - Constant space.
@@ -254,20 +320,21 @@ export class Trie extends IterableElementBase<string, Trie> {
           if (child.isEnd) {
             if (child.children.size > 0) {
               child.isEnd = false;
+              this._updateMaxWeight(child);
             } else {
               cur.children.delete(char);
             }
             isDeleted = true;
+            this._updateMaxWeight(cur);
             return true;
           }
           return false;
         }
         const res = dfs(child, i + 1);
-        if (res && !cur.isEnd && child.children.size === 0) {
-          cur.children.delete(char);
-          return true;
-        }
-        return false;
+        const isPruned = res && !cur.isEnd && child.children.size === 0;
+        if (isPruned) cur.children.delete(char);
+        if (isDeleted) this._updateMaxWeight(cur);
+        return isPruned;
       }
       return false;
     };
@@ -417,6 +484,7 @@ export class Trie extends IterableElementBase<string, Trie> {
    * Time Complexity: O(w * l), where w is the number of words retrieved, and l is the average length of the words.
    * Space Complexity: O(w * l) - The space required for the output array.
    *
+   * The search stops as soon as `max` words are found, and a prefix that is not in the Trie finds no words.
    * The `getAll` function returns an array of all words in a Trie data structure that start with a given prefix.
    * @param {string} prefix - The `prefix` parameter is a string that represents the prefix that we want to search for in the
    * trie. It is an optional parameter, so if no prefix is provided, it will default to an empty string.
@@ -430,31 +498,87 @@ export class Trie extends IterableElementBase<string, Trie> {
     let found = 0;
 
     function dfs(node: TrieNode, word: string) {
-      for (const char of node.children.keys()) {
-        const charNode = node.children.get(char);
-        if (charNode !== undefined) {
-          dfs(charNode, word.concat(char));
-        }
+      for (const [char, charNode] of node.children) {
+        if (found >= max) return;
+        dfs(charNode, word + char);
       }
-      if (node.isEnd) {
-        if (found > max - 1) return;
+      if (node.isEnd && found < max) {
         words.push(word);
         found++;
       }
     }
 
-    let startNode = this.root;
+    const startNode = this._getNode(prefix);
+    if (startNode === undefined || max <= 0) return words;
+
+    if (isAllWhenEmptyPrefix || startNode !== this.root) dfs(startNode, prefix);
 
-    if (prefix) {
-      for (const c of prefix) {
-        const nodeC = startNode.children.get(c);
-        if (nodeC) startNode = nodeC;
+    return words;
+  }
+
+  /**
+   * Time Complexity: O(p + k * (log k + c)), where p is the length of the prefix and c is the number
+   * of children of a node on the way to the results.
+   * Space Complexity: O(k * c) - The candidates in the heap.
+   */
+
+  /**
+   * Time Complexity: O(p + k * (log k + c)), where p is the length of the prefix and c is the number
+   * of children of a node on the way to the results.
+   * Space Complexity: O(k * c) - The candidates in the heap.
+   *
+   * The `topK` function returns the heaviest words starting with a prefix. It is a best-first search:
+   * a heap holds words ranked by weight and subtrees ranked by their `maxWeight`, so it only expands
+   * nodes on the way to the results instead of collecting the whole subtree.
+   * @param {string} prefix - The prefix; an empty prefix ranks all words.
+   * @param {number} k - The maximum number of words to return.
+   * @returns An array of `[word, weight]` by descending weight, then ascending word.
+   */
+  topK(prefix: string, k: number): [string, number][] {
+    prefix = this._caseProcess(prefix);
+    const results: [string, number][] = [];
+    const startNode = this._getNode(prefix);
+    if (startNode === undefined || startNode.maxWeight === -Infinity || k <= 0) return results;
+
+    type Candidate = { weight: number; word: string; node?: TrieNode };
+    const candidates = new Heap<Candidate>([{ weight: startNode.maxWeight, word: prefix, node: startNode }], {
+      comparator: (a, b) => {
+        if (a.weight !== b.weight) return a.weight > b.weight ? -1 : 1;
+        return a.word < b.word ? -1 : a.word > b.word ? 1 : 0;
+      }
+    });
+    while (results.length < k && candidates.size > 0) {
+      const { weight, word, node } = candidates.poll()!;
+      if (node === undefined) {
+        results.push([word, weight]);
+        continue;
+      }
+      if (node.isEnd) candidates.add({ weight: node.weight, word });
+      for (const [char, child] of node.children) {
+        candidates.add({ weight: child.maxWeight, word: word + char, node: child });
       }
     }
+    return results;
+  }
 
-    if (isAllWhenEmptyPrefix || startNode !== this.root) dfs(startNode, prefix);
+  /**
+   * Time Complexity: O(p) to start, then O(l) per word, where l is the length of the word.
+   * Space Complexity: O(h) - One iterator per level of the current path.
+   */
 
-    return words;
+  /**
+   * Time Complexity: O(p) to start, then O(l) per word, where l is the length of the word.
+   * Space Complexity: O(h) - One iterator per level of the current path.
+   *
+   * The `wordsWithPrefix` generator yields the words starting with a prefix one at a time, the prefix
+   * itself first and then each child's words in insertion order. Nothing after the last word taken is
+   * visited, so breaking out of the loop early is cheap.
+   * @param {string} [prefix=''] - The prefix; an empty prefix yields all words.
+   */
+  *wordsWithPrefix(prefix = ''): IterableIterator<string> {
+    prefix = this._caseProcess(prefix);
+    const startNode = this._getNode(prefix);
+    if (startNode !== undefined) yield* this._walk(startNode, prefix);
   }
 
   /**
@@ -471,7 +595,9 @@ export class Trie extends IterableElementBase<string, Trie> {
    * @returns A new instance of the Trie class is being returned.
    */
   clone(): Trie {
-    return new Trie(this.values(), { caseSensitive: this.caseSensitive });
+    const cloned = new Trie([], { caseSensitive: this.caseSensitive });
+    for (const [word, node] of this._walkNodes(this.root, '')) cloned.add(word, node.weight);
+    return cloned;
   }
 
   /**
@@ -496,9 +622,9 @@ export class Trie extends IterableElementBase<string, Trie> {
   filter(predicate: ElementCallback<string, boolean>, thisArg?: any): Trie {
     const results: Trie = new Trie();
     let index = 0;
-    for (const word of this) {
+    for (const [word, node] of this._walkNodes(this.root, '')) {
       if (predicate.call(thisArg, word, index, this)) {
-        results.add(word);
+        results.add(word, node.weight);
       }
       index++;
     }
@@ -526,8 +652,8 @@ export class Trie extends IterableElementBase<string, Trie> {
   map(callback: ElementCallback<string, string>, thisArg?: any): Trie {
     const newTrie = new Trie();
     let index = 0;
-    for (const word of this) {
-      newTrie.add(callback.call(thisArg, word, index, this));
+    for (const [word, node] of this._walkNodes(this.root, '')) {
+      newTrie.add(callback.call(thisArg, word, index, this), node.weight);
       index++;
     }
     return newTrie;
@@ -546,16 +672,69 @@ export class Trie extends IterableElementBase<string, Trie> {
    * trie data structure and yields all the paths to the end nodes.
    */
   protected* _getIterator(): IterableIterator<string> {
-    function* _dfs(node: TrieNode, path: string): IterableIterator<string> {
-      if (node.isEnd) {
-        yield path;
+    yield* this._walk(this.root, '');
+  }
+
+  /**
+   * The function yields the words in the subtree of a node, the node's word first and then each
+   * child's words in insertion order.
+   * @param {TrieNode} node - The node to start from.
+   * @param {string} path - The word the node spells.
+   */
+  protected* _walk(node: TrieNode, path: string): IterableIterator<string> {
+    for (const [word] of this._walkNodes(node, path)) yield word;
+  }
+
+  /**
+   * The function is `_walk` yielding the end node with each word. It keeps a stack of child
+   * iterators instead of recursing, so a long word does not nest generators.
+   * @param {TrieNode} node - The node to start from.
+   * @param {string} path - The word the node spells.
+   */
+  protected* _walkNodes(node: TrieNode, path: string): IterableIterator<[string, TrieNode]> {
+    if (node.isEnd) yield [path, node];
+    const iterators = [node.children.entries()];
+    const paths = [path];
+    while (iterators.length > 0) {
+      const next = iterators[iterators.length - 1].next();
+      if (next.done) {
+        iterators.pop();
+        paths.pop();
+        continue;
       }
-      for (const [char, childNode] of node.children) {
-        yield* _dfs(childNode, path + char);
+      const [char, child] = next.value;
+      const word = paths[paths.length - 1] + char;
+      if (child.isEnd) yield [word, child];
+      if (child.children.size > 0) {
+        iterators.push(child.children.entries());
+        paths.push(word);
       }
     }
+  }
+
+  /**
+   * The function follows a case processed string from the root.
+   * @param {string} input - The string to follow.
+   * @returns The node the input ends at, or undefined if no word starts with it.
+   */
+  protected _getNode(input: string): TrieNode | undefined {
+    let cur = this.root;
+    for (const c of input) {
+      const nodeC = cur.children.get(c);
+      if (!nodeC) return;
+      cur = nodeC;
+    }
+    return cur;
+  }
 
-    yield* _dfs(this.root, '');
+  /**
+   * The function recomputes the `maxWeight` of a node from its own word and its children.
+   * @param {TrieNode} node - The node to update.
+   */
+  protected _updateMaxWeight(node: TrieNode): void {
+    let maxWeight = node.isEnd ? node.weight : -Infinity;
+    for (const child of node.children.values()) if (child.maxWeight > maxWeight) maxWeight = child.maxWeight;
+    node.maxWeight = maxWeight;
   }
 
   /**
@@ -15,3 +15,9 @@ export type ReduceElementCallback<V, R> = (
   index: number,
   container: IterableElementBase<V>
 ) => R;
+
+export type LazyIteratorStage =
+  | { kind: 'filter'; fn: (value: any, index: number) => boolean }
+  | { kind: 'map'; fn: (value: any, index: number) => any }
+  | { kind: 'skip'; count: number }
+  | { kind: 'take'; count: number };
@@ -1 +1,5 @@
-export {};
+export type BinaryIndexedTreeStorage = 'sparse' | 'float64' | 'int32';
+
+export type BinaryIndexedTreeOptions = { frequency?: number; max: number; storage?: BinaryIndexedTreeStorage };
+
+export type DenseBinaryIndexedTreeStorage = Exclude<BinaryIndexedTreeStorage, 'sparse'>;
@@ -0,0 +1,7 @@
+export type CompactRBTreeOptions = {
+  initialCapacity?: number;
+};
+
+export type CompactRBTreeEntry<V> = [number, V | undefined];
+
+export type CompactRBTreeCallback<V, R = any> = (key: number, value: V | undefined, node: number) => R;
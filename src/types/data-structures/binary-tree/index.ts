@@ -4,3 +4,5 @@ export * from './avl-tree';
 export * from './segment-tree';
 export * from './tree-multimap';
 export * from './rb-tree';
+export * from './compact-rb-tree';
+export * from './persistent-rb-tree';
@@ -0,0 +1,5 @@
+import type { Comparator } from '../../common';
+
+export type PersistentRBTreeOptions<K> = {
+  comparator?: Comparator<K>;
+};
@@ -1 +1,10 @@
 export type SegmentTreeNodeVal = number;
+
+export type SegmentTreeMonoid = {
+  identity: number;
+  op: (a: number, b: number) => number;
+  add?: (aggregate: number, delta: number, length: number) => number;
+  assign?: (value: number, length: number) => number;
+};
+
+export type LazySegmentTreeOptions = { monoid?: SegmentTreeMonoid };
@@ -11,3 +11,12 @@ export type DijkstraResult<V> =
   minPath: V[];
 }
   | undefined;
+
+export type ShortestPathResult<V> = { distance: number; path: V[] } | undefined;
+
+export type JohnsonResult<V> =
+  | {
+  distMap: Map<V, Map<V, number>>;
+  preMap: Map<V, Map<V, V | undefined>>;
+}
+  | undefined;
@@ -0,0 +1,20 @@
+export type CSRShortestPaths = {
+  dist: Float64Array;
+  prev: Int32Array;
+  order: Int32Array;
+};
+
+export type CSRBellmanFordResult = {
+  dist: Float64Array;
+  prev: Int32Array;
+  hasNegativeCycle: boolean;
+};
+
+export type CSRTarjanResult = {
+  dfn: Int32Array;
+  low: Int32Array;
+  sccOf: Int32Array;
+  sccCount: number;
+  sccOrder: Int32Array;
+  sccOffsets: Int32Array;
+};
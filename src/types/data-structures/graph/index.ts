@@ -1,3 +1,5 @@
 export * from './abstract-graph';
 export * from './map-graph';
 export * from './directed-graph';
+export * from './csr-graph';
+export * from './parallel-graph';
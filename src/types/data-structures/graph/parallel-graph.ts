@@ -0,0 +1,30 @@
+/**
+ * The part of a worker that `ParallelGraph` uses. A Node.js `Worker` from `worker_threads` fits as it is; a browser
+ * `Worker` needs a small adapter for `on`.
+ */
+export type GraphWorkerLike = {
+  postMessage(message: any): void;
+  on(event: 'message', listener: (message: any) => void): unknown;
+  on(event: 'error', listener: (error: Error) => void): unknown;
+  terminate(): unknown;
+};
+
+export type ParallelGraphOptions = {
+  /**
+   * Creates a worker that runs the given script source, e.g.
+   * `source => new Worker(source, { eval: true })` with `Worker` from `worker_threads`.
+   */
+  createWorker: (source: string) => GraphWorkerLike;
+  concurrency?: number;
+};
+
+export type ParallelBFSResult = {
+  dist: Int32Array;
+  prev: Int32Array;
+};
+
+export type PageRankOptions = {
+  damping?: number;
+  tolerance?: number;
+  maxIterations?: number;
+};
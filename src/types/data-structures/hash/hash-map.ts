@@ -9,11 +9,13 @@ export type LinkedHashMapOptions<K, V, R> = {
   hashFn?: (key: K) => string;
   objHashFn?: (key: K) => object;
   toEntryFn?: (rawElement: R) => [K, V];
+  initialCapacity?: number;
 };
 
 export type HashMapOptions<K, V, R> = {
   hashFn?: (key: K) => string;
   toEntryFn?: (rawElement: R) => [K, V];
+  initialCapacity?: number;
 };
 
 export type HashMapStoreItem<K, V> = { key: K; value: V };
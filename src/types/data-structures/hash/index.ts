@@ -1,3 +1,5 @@
 export * from './hash-map';
+export * from './lru-cache';
+export * from './lfu-cache';
 
 export type HashFunction<K> = (key: K) => number;
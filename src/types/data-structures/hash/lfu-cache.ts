@@ -0,0 +1,26 @@
+import type { CacheEvictCallback } from './lru-cache';
+
+export type LFUCacheNode<K, V> = {
+  key: K;
+  value: V;
+  expiresAt: number;
+  bucket: LFUCacheBucket<K, V>;
+  prev: LFUCacheNode<K, V> | undefined;
+  next: LFUCacheNode<K, V> | undefined;
+};
+
+export type LFUCacheBucket<K, V> = {
+  frequency: number;
+  head: LFUCacheNode<K, V> | undefined;
+  tail: LFUCacheNode<K, V> | undefined;
+  prev: LFUCacheBucket<K, V>;
+  next: LFUCacheBucket<K, V>;
+};
+
+export type LFUCacheOptions<K, V, R> = {
+  hashFn?: (key: K) => string;
+  toEntryFn?: (rawElement: R) => [K, V];
+  maxSize?: number;
+  ttl?: number;
+  onEvict?: CacheEvictCallback<K, V>;
+};
@@ -0,0 +1,18 @@
+import type { HashMapLinkedNode, LinkedHashMapOptions } from './hash-map';
+
+export type CacheEvictionReason = 'evicted' | 'expired';
+
+export type CacheEvictCallback<K, V> = (key: K, value: V | undefined, reason: CacheEvictionReason) => void;
+
+export type LRUCacheNode<K, V> = HashMapLinkedNode<K, V> & {
+  weight: number;
+  expiresAt: number;
+};
+
+export type LRUCacheOptions<K, V, R> = LinkedHashMapOptions<K, V, R> & {
+  maxSize?: number;
+  maxWeight?: number;
+  weightFn?: (value: V | undefined, key: K) => number;
+  ttl?: number;
+  onEvict?: CacheEvictCallback<K, V>;
+};
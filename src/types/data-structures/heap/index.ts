@@ -1 +1,2 @@
 export * from './heap';
+export * from './indexed-heap';
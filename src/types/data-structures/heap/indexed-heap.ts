@@ -0,0 +1,5 @@
+export type IndexedHeapOptions = {
+  capacity?: number;
+  arity?: number;
+  isMax?: boolean;
+};
@@ -1 +1 @@
-export {};
+export type DoublyLinkedListOptions = { nodePoolSize?: number };
@@ -1,3 +1,4 @@
 export * from './singly-linked-list';
 export * from './doubly-linked-list';
 export * from './skip-linked-list';
+export * from './intrusive-linked-list';
@@ -0,0 +1 @@
+export type IntrusiveLinkedListNode<N> = { prev: N | undefined; next: N | undefined };
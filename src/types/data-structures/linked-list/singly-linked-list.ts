@@ -1 +1 @@
-export {};
+export type SinglyLinkedListOptions = { nodePoolSize?: number };
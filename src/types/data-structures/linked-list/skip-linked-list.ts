@@ -1 +1 @@
-export type SkipLinkedListOptions = { maxLevel?: number; probability?: number };
+export type SkipLinkedListOptions = { maxLevel?: number; probability?: number; seed?: number };
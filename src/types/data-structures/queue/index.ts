@@ -1,2 +1,4 @@
 export * from './queue';
 export * from './deque';
+export * from './numeric-deque';
+export * from './shared-queue';
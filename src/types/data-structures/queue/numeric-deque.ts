@@ -0,0 +1,4 @@
+export type NumericDequeOptions = {
+  bucketSize?: number;
+  poolSize?: number;
+};
@@ -1 +1,4 @@
-export {};
+export type QueueOptions = {
+  capacity?: number;
+  maxSize?: number;
+};
@@ -0,0 +1,4 @@
+export type SharedQueueOptions = {
+  capacity: number;
+  recordSize: number;
+};
@@ -0,0 +1 @@
+export type RadixTrieOptions = { caseSensitive?: boolean };
@@ -0,0 +1,39 @@
+import type { BinaryReader, BinaryWriter } from '../../utils';
+import type { VertexKey } from '../data-structures';
+
+export enum BinarySnapshotKind {
+  BST = 1,
+  HashMap = 2,
+  Heap = 3,
+  Graph = 4,
+  CSRGraph = 5,
+  SortedNumeric = 6,
+  TreeMultimap = 7
+}
+
+export type BinaryCodec<T> = {
+  write: (writer: BinaryWriter, value: T) => void;
+  read: (reader: BinaryReader) => T;
+};
+
+export type BinarySource = Uint8Array | ArrayBuffer | Iterable<Uint8Array>;
+
+export type BinaryWriterOptions = {
+  chunkSize?: number;
+  onChunk?: (chunk: Uint8Array) => void;
+};
+
+export type BinarySnapshotOptions<K, V> = {
+  keyCodec?: BinaryCodec<K>;
+  valueCodec?: BinaryCodec<V>;
+};
+
+export type BinaryElementSnapshotOptions<E> = {
+  elementCodec?: BinaryCodec<E>;
+};
+
+export type BinaryGraphSnapshotOptions<V, E> = {
+  keyCodec?: BinaryCodec<VertexKey>;
+  vertexValueCodec?: BinaryCodec<V | undefined>;
+  edgeValueCodec?: BinaryCodec<E | undefined>;
+};
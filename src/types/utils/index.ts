@@ -1,2 +1,4 @@
 export * from './utils';
 export * from './validate-type';
+export * from './binary';
+export * from './instrumentation';
@@ -0,0 +1,37 @@
+import type { Instrumentation } from '../../utils';
+
+export type InstrumentationOptions = {
+  /**
+   * Also time each instrumented call into a histogram. Off by default, since reading the clock costs more than
+   * counting.
+   */
+  timing?: boolean;
+};
+
+/**
+ * Calls whose duration in microseconds is below `2 ** i` and at least `2 ** (i - 1)` fall into `buckets[i]`;
+ * `buckets[0]` holds the calls under one microsecond.
+ */
+export type TimingHistogram = { count: number; totalMs: number; maxMs: number; buckets: number[] };
+
+/**
+ * A plain, JSON-serializable snapshot of an instance's counters, ready to forward to a metrics pipeline.
+ */
+export type InstrumentationStats = {
+  name: string;
+  enabled: boolean;
+  counters: { [counter: string]: number };
+  timings?: { [counter: string]: TimingHistogram };
+};
+
+/**
+ * Runs after each call of an instrumented method with its arguments, its result and the instance it ran on, to
+ * record more than a call count. The hook is shared by every instance of the class, so it must read the instance
+ * from `target` rather than close over one.
+ */
+export type InstrumentationHook = (instrumentation: Instrumentation, args: any[], result: any, target: any) => void;
+
+/**
+ * Maps a method name to the counter its calls increment, optionally with a hook that records more.
+ */
+export type InstrumentedMethods = { [method: string]: string | { counter: string; after: InstrumentationHook } };
@@ -0,0 +1,661 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { BinaryCodec, BinarySource, BinaryWriterOptions } from '../types';
+import { BinarySnapshotKind } from '../types';
+
+// Typed array views can only alias snapshot bytes when the platform is little-endian like the format
+const IS_LITTLE_ENDIAN = new Uint8Array(new Uint16Array([1]).buffer)[0] === 1;
+
+const textEncoder = new TextEncoder();
+const textDecoder = new TextDecoder();
+
+/**
+ * The version written into every snapshot header. Readers accept snapshots up to this version.
+ */
+export const BINARY_SNAPSHOT_VERSION = 1;
+
+// "DSTB" read as a little-endian uint32
+const BINARY_SNAPSHOT_MAGIC = 0x42545344;
+
+/**
+ * A little-endian binary writer.
+ * 1. Without `onChunk` it grows one buffer and `finish` returns the bytes written.
+ * 2. With `onChunk` it hands over each full `chunkSize` buffer as soon as it fills, so a snapshot can be streamed
+ *    to a file or socket without ever holding it whole.
+ * 3. `align` pads by absolute position, so typed arrays written after it can be read back as views in place.
+ */
+export class BinaryWriter {
+  /**
+   * The constructor creates a writer.
+   * @param [options] - `chunkSize`, the buffer size in bytes (64 KiB by default), and `onChunk`, which receives
+   * each filled buffer.
+   */
+  constructor(options?: BinaryWriterOptions) {
+    let chunkSize = 1 << 16;
+    if (options) {
+      const { chunkSize: size, onChunk } = options;
+      if (size !== undefined && size > 0) chunkSize = Math.ceil(size);
+      if (onChunk) this._onChunk = onChunk;
+    }
+    this._chunkSize = chunkSize;
+    this._buffer = new Uint8Array(chunkSize);
+    this._view = new DataView(this._buffer.buffer);
+  }
+
+  protected _chunkSize: number;
+
+  protected _onChunk: ((chunk: Uint8Array) => void) | undefined = undefined;
+
+  protected _buffer: Uint8Array;
+
+  protected _view: DataView;
+
+  protected _offset: number = 0;
+
+  protected _flushed: number = 0;
+
+  /**
+   * The function returns the number of bytes written so far, including the ones already handed to `onChunk`.
+   * @returns The byte length.
+   */
+  get byteLength(): number {
+    return this._flushed + this._offset;
+  }
+
+  writeUint8(value: number): void {
+    this._reserve(1);
+    this._buffer[this._offset++] = value;
+  }
+
+  writeUint32(value: number): void {
+    this._reserve(4);
+    this._view.setUint32(this._offset, value, true);
+    this._offset += 4;
+  }
+
+  writeInt32(value: number): void {
+    this._reserve(4);
+    this._view.setInt32(this._offset, value, true);
+    this._offset += 4;
+  }
+
+  writeFloat64(value: number): void {
+    this._reserve(8);
+    this._view.setFloat64(this._offset, value, true);
+    this._offset += 8;
+  }
+
+  /**
+   * The function writes a non-negative integer below 2^53 in 7-bit groups, small values first.
+   * @param {number} value - The integer to write.
+   */
+  writeVarUint(value: number): void {
+    this._reserve(8);
+    while (value >= 0x80) {
+      this._buffer[this._offset++] = (value % 0x80) | 0x80;
+      value = Math.floor(value / 0x80);
+      if (this._offset === this._buffer.length) this._reserve(8);
+    }
+    this._buffer[this._offset++] = value;
+  }
+
+  /**
+   * The function writes a string as its UTF-8 byte length followed by the bytes.
+   * @param {string} value - The string to write.
+   */
+  writeString(value: string): void {
+    const bytes = textEncoder.encode(value);
+    this.writeVarUint(bytes.length);
+    this.writeBytes(bytes);
+  }
+
+  writeBytes(bytes: Uint8Array): void {
+    let start = 0;
+    while (start < bytes.length) {
+      this._reserve(1);
+      const count = Math.min(bytes.length - start, this._buffer.length - this._offset);
+      this._buffer.set(bytes.subarray(start, start + count), this._offset);
+      this._offset += count;
+      start += count;
+    }
+  }
+
+  /**
+   * The function copies a typed array's bytes in platform order, which is little-endian on every platform
+   * that `BinaryReader` reads views on.
+   * @param array - The array to write.
+   */
+  writeTypedArray(array: Float64Array | Int32Array | Uint32Array | Uint8Array): void {
+    if (IS_LITTLE_ENDIAN || array.BYTES_PER_ELEMENT === 1) {
+      this.writeBytes(new Uint8Array(array.buffer, array.byteOffset, array.byteLength));
+    } else if (array instanceof Float64Array) {
+      for (let i = 0; i < array.length; i++) this.writeFloat64(array[i]);
+    } else if (array instanceof Int32Array) {
+      for (let i = 0; i < array.length; i++) this.writeInt32(array[i]);
+    } else {
+      for (let i = 0; i < array.length; i++) this.writeUint32(array[i]);
+    }
+  }
+
+  /**
+   * The function pads with zero bytes until the absolute position is a multiple of `alignment`.
+   * @param {number} alignment - The alignment in bytes.
+   */
+  align(alignment: number): void {
+    while (this.byteLength % alignment !== 0) this.writeUint8(0);
+  }
+
+  /**
+   * The function ends the stream. With `onChunk` the last partial buffer is handed over and an empty array is
+   * returned; otherwise the written bytes are returned without copying.
+   * @returns The bytes not yet handed to `onChunk`.
+   */
+  finish(): Uint8Array {
+    if (this._onChunk) {
+      this._flush();
+      return new Uint8Array(0);
+    }
+    return this._buffer.subarray(0, this._offset);
+  }
+
+  protected _reserve(bytes: number): void {
+    if (this._offset + bytes <= this._buffer.length) return;
+    if (this._onChunk) {
+      this._flush();
+      if (bytes <= this._buffer.length) return;
+    }
+    let capacity = this._buffer.length * 2;
+    while (capacity < this._offset + bytes) capacity *= 2;
+    const buffer = new Uint8Array(capacity);
+    buffer.set(this._buffer.subarray(0, this._offset));
+    this._buffer = buffer;
+    this._view = new DataView(buffer.buffer);
+  }
+
+  protected _flush(): void {
+    if (this._offset === 0) return;
+    this._onChunk!(this._buffer.subarray(0, this._offset));
+    this._flushed += this._offset;
+    this._buffer = new Uint8Array(this._chunkSize);
+    this._view = new DataView(this._buffer.buffer);
+    this._offset = 0;
+  }
+}
+
+/**
+ * A reader for the bytes of `BinaryWriter`.
+ * 1. The source is one buffer or an iterable of chunks; chunks are pulled only when a read needs them.
+ * 2. `readFloat64Array` and `readInt32Array` return views on the source instead of copies when the data is
+ *    aligned and contiguous, which is what makes snapshots loadable without rehydration.
+ */
+export class BinaryReader {
+  /**
+   * The constructor creates a reader.
+   * @param {BinarySource} source - A `Uint8Array` (a Node `Buffer` works), an `ArrayBuffer` or an iterable of
+   * `Uint8Array` chunks.
+   */
+  constructor(source: BinarySource) {
+    if (source instanceof Uint8Array) {
+      this._buffer = source;
+    } else if (source instanceof ArrayBuffer) {
+      this._buffer = new Uint8Array(source);
+    } else {
+      this._buffer = new Uint8Array(0);
+      this._chunks = source[Symbol.iterator]();
+    }
+    this._view = new DataView(this._buffer.buffer, this._buffer.byteOffset, this._buffer.byteLength);
+  }
+
+  protected _buffer: Uint8Array;
+
+  protected _view: DataView;
+
+  protected _offset: number = 0;
+
+  // Bytes consumed before the start of `_buffer`
+  protected _base: number = 0;
+
+  protected _chunks: Iterator<Uint8Array> | undefined = undefined;
+
+  /**
+   * The function returns the absolute position of the next byte to read.
+   * @returns The position.
+   */
+  get position(): number {
+    return this._base + this._offset;
+  }
+
+  readUint8(): number {
+    this._ensure(1);
+    return this._buffer[this._offset++];
+  }
+
+  readUint32(): number {
+    this._ensure(4);
+    const value = this._view.getUint32(this._offset, true);
+    this._offset += 4;
+    return value;
+  }
+
+  readInt32(): number {
+    this._ensure(4);
+    const value = this._view.getInt32(this._offset, true);
+    this._offset += 4;
+    return value;
+  }
+
+  readFloat64(): number {
+    this._ensure(8);
+    const value = this._view.getFloat64(this._offset, true);
+    this._offset += 8;
+    return value;
+  }
+
+  readVarUint(): number {
+    let value = 0;
+    let scale = 1;
+    for (;;) {
+      const byte = this.readUint8();
+      value += (byte & 0x7f) * scale;
+      if (byte < 0x80) return value;
+      scale *= 0x80;
+    }
+  }
+
+  readString(): string {
+    const length = this.readVarUint();
+    return textDecoder.decode(this.readBytes(length));
+  }
+
+  /**
+   * The function returns the next `length` bytes as a view on the source.
+   * @param {number} length - The number of bytes.
+   * @returns The bytes.
+   */
+  readBytes(length: number): Uint8Array {
+    this._ensure(length);
+    const bytes = this._buffer.subarray(this._offset, this._offset + length);
+    this._offset += length;
+    return bytes;
+  }
+
+  readFloat64Array(length: number): Float64Array {
+    const bytes = this.readBytes(length * 8);
+    if (IS_LITTLE_ENDIAN && bytes.byteOffset % 8 === 0) return new Float64Array(bytes.buffer, bytes.byteOffset, length);
+    const array = new Float64Array(length);
+    const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+    for (let i = 0; i < length; i++) array[i] = view.getFloat64(i * 8, true);
+    return array;
+  }
+
+  readInt32Array(length: number): Int32Array {
+    const bytes = this.readBytes(length * 4);
+    if (IS_LITTLE_ENDIAN && bytes.byteOffset % 4 === 0) return new Int32Array(bytes.buffer, bytes.byteOffset, length);
+    const array = new Int32Array(length);
+    const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+    for (let i = 0; i < length; i++) array[i] = view.getInt32(i * 4, true);
+    return array;
+  }
+
+  /**
+   * The function skips the padding `BinaryWriter.align` wrote.
+   * @param {number} alignment - The alignment in bytes.
+   */
+  align(alignment: number): void {
+    const padding = (alignment - (this.position % alignment)) % alignment;
+    if (padding > 0) this.readBytes(padding);
+  }
+
+  // Makes `bytes` bytes available at `_offset`, joining the rest of the buffer with the next chunks
+  protected _ensure(bytes: number): void {
+    if (this._offset + bytes <= this._buffer.length) return;
+    const parts: Uint8Array[] = [this._buffer.subarray(this._offset)];
+    let available = parts[0].length;
+    while (available < bytes && this._chunks) {
+      const next = this._chunks.next();
+      if (next.done) {
+        this._chunks = undefined;
+        break;
+      }
+      parts.push(next.value);
+      available += next.value.length;
+    }
+    if (available < bytes) throw new Error('Unexpected end of binary data');
+
+    // Keep the joined buffer 8-byte aligned with the absolute position, so aligned data stays viewable
+    const lead = (this._base + this._offset) % 8;
+    const buffer = new Uint8Array(lead + available);
+    let offset = lead;
+    for (const part of parts) {
+      buffer.set(part, offset);
+      offset += part.length;
+    }
+    this._base += this._offset - lead;
+    this._buffer = buffer;
+    this._view = new DataView(buffer.buffer);
+    this._offset = lead;
+  }
+}
+
+/**
+ * The function writes the 8-byte header every snapshot starts with.
+ * @param {BinaryWriter} writer - The writer.
+ * @param {BinarySnapshotKind} kind - The structure that follows.
+ */
+export const writeSnapshotHeader = (writer: BinaryWriter, kind: BinarySnapshotKind): void => {
+  writer.writeUint32(BINARY_SNAPSHOT_MAGIC);
+  writer.writeUint8(BINARY_SNAPSHOT_VERSION);
+  writer.writeUint8(kind);
+  writer.writeUint8(0);
+  writer.writeUint8(0);
+};
+
+/**
+ * The function reads and checks a snapshot header.
+ * @param {BinaryReader} reader - The reader.
+ * @param {BinarySnapshotKind} kind - The structure the caller expects.
+ * @returns The version of the snapshot.
+ */
+export const readSnapshotHeader = (reader: BinaryReader, kind: BinarySnapshotKind): number => {
+  if (reader.readUint32() !== BINARY_SNAPSHOT_MAGIC) throw new Error('Not a binary snapshot');
+  const version = reader.readUint8();
+  if (version > BINARY_SNAPSHOT_VERSION) throw new Error(`Unsupported binary snapshot version ${version}`);
+  const actual = reader.readUint8();
+  if (actual !== kind) {
+    throw new Error(`Expected a ${BinarySnapshotKind[kind]} snapshot but found ${BinarySnapshotKind[actual]}`);
+  }
+  reader.readUint8();
+  reader.readUint8();
+  return version;
+};
+
+/**
+ * The function wraps a snapshot source in a reader, or returns the reader it is given.
+ * @param source - The bytes, chunks or reader.
+ * @returns A reader.
+ */
+export const toBinaryReader = (source: BinarySource | BinaryReader): BinaryReader =>
+  source instanceof BinaryReader ? source : new BinaryReader(source);
+
+const enum AnyTag {
+  Undefined,
+  Null,
+  False,
+  True,
+  Int32,
+  Float64,
+  String,
+  Json
+}
+
+/**
+ * Codecs for keys, values and elements. `any` is the default: it tags each value with its type, so mixed
+ * numbers, strings and booleans come back as they went in, and other values go through JSON.
+ */
+export const binaryCodecs = {
+  float64: {
+    write: (writer: BinaryWriter, value: number) => writer.writeFloat64(value),
+    read: (reader: BinaryReader) => reader.readFloat64()
+  } as BinaryCodec<number>,
+  int32: {
+    write: (writer: BinaryWriter, value: number) => writer.writeInt32(value),
+    read: (reader: BinaryReader) => reader.readInt32()
+  } as BinaryCodec<number>,
+  varUint: {
+    write: (writer: BinaryWriter, value: number) => writer.writeVarUint(value),
+    read: (reader: BinaryReader) => reader.readVarUint()
+  } as BinaryCodec<number>,
+  string: {
+    write: (writer: BinaryWriter, value: string) => writer.writeString(value),
+    read: (reader: BinaryReader) => reader.readString()
+  } as BinaryCodec<string>,
+  boolean: {
+    write: (writer: BinaryWriter, value: boolean) => writer.writeUint8(value ? 1 : 0),
+    read: (reader: BinaryReader) => reader.readUint8() === 1
+  } as BinaryCodec<boolean>,
+  json: {
+    write: (writer: BinaryWriter, value: unknown) => writer.writeString(JSON.stringify(value) ?? 'null'),
+    read: (reader: BinaryReader) => JSON.parse(reader.readString())
+  } as BinaryCodec<any>,
+  none: {
+    write: () => undefined,
+    read: () => undefined
+  } as BinaryCodec<any>,
+  any: {
+    write: (writer: BinaryWriter, value: unknown) => {
+      if (value === undefined) writer.writeUint8(AnyTag.Undefined);
+      else if (value === null) writer.writeUint8(AnyTag.Null);
+      else if (value === false) writer.writeUint8(AnyTag.False);
+      else if (value === true) writer.writeUint8(AnyTag.True);
+      else if (typeof value === 'number') {
+        if ((value | 0) === value && !Object.is(value, -0)) {
+          writer.writeUint8(AnyTag.Int32);
+          writer.writeInt32(value);
+        } else {
+          writer.writeUint8(AnyTag.Float64);
+          writer.writeFloat64(value);
+        }
+      } else if (typeof value === 'string') {
+        writer.writeUint8(AnyTag.String);
+        writer.writeString(value);
+      } else {
+        writer.writeUint8(AnyTag.Json);
+        writer.writeString(JSON.stringify(value) ?? 'null');
+      }
+    },
+    read: (reader: BinaryReader) => {
+      switch (reader.readUint8()) {
+        case AnyTag.Undefined:
+          return undefined;
+        case AnyTag.Null:
+          return null;
+        case AnyTag.False:
+          return false;
+        case AnyTag.True:
+          return true;
+        case AnyTag.Int32:
+          return reader.readInt32();
+        case AnyTag.Float64:
+          return reader.readFloat64();
+        case AnyTag.String:
+          return reader.readString();
+        case AnyTag.Json:
+          return JSON.parse(reader.readString());
+        default:
+          throw new Error('Unknown value tag in binary snapshot');
+      }
+    }
+  } as BinaryCodec<any>
+};
+
+/**
+ * A read-only sorted map from numbers to numbers that queries a snapshot in place.
+ * 1. Layout after the header: a uint32 count, 4 bytes of padding, `count` float64 keys in ascending order, then
+ *    `count` float64 values. Missing values are stored as NaN.
+ * 2. Keys and values are `Float64Array` views on the snapshot bytes, so opening a snapshot of any size is O(1)
+ *    and lookups are binary searches over the mapped memory.
+ * 3. `encode` accepts any ascending `[key, value]` iterable, such as an `RBTree`, `CompactRBTree` or
+ *    `PersistentRBTree` with numeric keys.
+ */
+export class SortedNumericView {
+  /**
+   * Time Complexity: O(n)
+   * Space Complexity: O(n)
+   *
+   * The `encode` function writes a snapshot from entries in ascending key order.
+   * @param entries - `[key, value]` pairs with strictly ascending numeric keys.
+   * @param [options] - Writer options; with `onChunk` the snapshot is streamed and an empty array is returned.
+   * @returns The snapshot bytes.
+   */
+  static encode(entries: Iterable<[number, number | undefined]>, options?: BinaryWriterOptions): Uint8Array {
+    let keys = new Float64Array(1024);
+    let values = new Float64Array(1024);
+    let count = 0;
+    for (const [key, value] of entries) {
+      if (count > 0 && !(key > keys[count - 1])) {
+        throw new Error('SortedNumericView.encode requires strictly ascending keys');
+      }
+      if (count === keys.length) {
+        const grownKeys = new Float64Array(count * 2);
+        const grownValues = new Float64Array(count * 2);
+        grownKeys.set(keys);
+        grownValues.set(values);
+        keys = grownKeys;
+        values = grownValues;
+      }
+      keys[count] = key;
+      values[count] = value === undefined ? NaN : value;
+      count++;
+    }
+
+    const writer = new BinaryWriter({ chunkSize: 16 + count * 16, ...options });
+    writeSnapshotHeader(writer, BinarySnapshotKind.SortedNumeric);
+    writer.writeUint32(count);
+    writer.writeUint32(0);
+    writer.writeTypedArray(keys.subarray(0, count));
+    writer.writeTypedArray(values.subarray(0, count));
+    return writer.finish();
+  }
+
+  /**
+   * The constructor opens a snapshot written by `encode`. The bytes are referenced, not copied, when they are
+   * contiguous and 8-byte aligned.
+   * @param {BinarySource | BinaryReader} source - The snapshot bytes.
+   */
+  constructor(source: BinarySource | BinaryReader) {
+    const reader = toBinaryReader(source);
+    readSnapshotHeader(reader, BinarySnapshotKind.SortedNumeric);
+    const count = reader.readUint32();
+    reader.readUint32();
+    this._keys = reader.readFloat64Array(count);
+    this._values = reader.readFloat64Array(count);
+  }
+
+  protected _keys: Float64Array;
+
+  /**
+   * The function returns the keys in ascending order.
+   * @returns The keys.
+   */
+  get keys(): Float64Array {
+    return this._keys;
+  }
+
+  protected _values: Float64Array;
+
+  /**
+   * The function returns the values, by key index.
+   * @returns The values.
+   */
+  get values(): Float64Array {
+    return this._values;
+  }
+
+  /**
+   * The function returns the number of entries.
+   * @returns The size.
+   */
+  get size(): number {
+    return this._keys.length;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function returns the index of the first key not less than `key`.
+   * @param {number} key - The key to search for.
+   * @returns An index between 0 and `size`.
+   */
+  lowerBound(key: number): number {
+    const keys = this._keys;
+    let lo = 0;
+    let hi = keys.length;
+    while (lo < hi) {
+      const mid = (lo + hi) >>> 1;
+      if (keys[mid] < key) lo = mid + 1;
+      else hi = mid;
+    }
+    return lo;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function returns the index of a key.
+   * @param {number} key - The key to look for.
+   * @returns The index, or -1 if the key is absent.
+   */
+  indexOf(key: number): number {
+    const index = this.lowerBound(key);
+    return index < this._keys.length && this._keys[index] === key ? index : -1;
+  }
+
+  has(key: number): boolean {
+    return this.indexOf(key) !== -1;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function returns the value stored under a key.
+   * @param {number} key - The key to look for.
+   * @returns The value (NaN if it was stored as undefined), or undefined if the key is absent.
+   */
+  get(key: number): number | undefined {
+    const index = this.indexOf(key);
+    return index === -1 ? undefined : this._values[index];
+  }
+
+  /**
+   * The function returns the smallest key not less than `key`.
+   * @param {number} key - The bound.
+   * @returns The key, or undefined if there is none.
+   */
+  ceiling(key: number): number | undefined {
+    const index = this.lowerBound(key);
+    return index < this._keys.length ? this._keys[index] : undefined;
+  }
+
+  /**
+   * The function returns the largest key not greater than `key`.
+   * @param {number} key - The bound.
+   * @returns The key, or undefined if there is none.
+   */
+  floor(key: number): number | undefined {
+    const index = this.lowerBound(key);
+    if (index < this._keys.length && this._keys[index] === key) return key;
+    return index > 0 ? this._keys[index - 1] : undefined;
+  }
+
+  /**
+   * Time Complexity: O(log n)
+   * Space Complexity: O(1)
+   *
+   * The function counts the keys between two bounds, both inclusive.
+   * @param {number} lo - The lower bound.
+   * @param {number} hi - The upper bound.
+   * @returns The number of keys `k` with `lo <= k <= hi`.
+   */
+  countRange(lo: number, hi: number): number {
+    if (hi < lo) return 0;
+    const start = this.lowerBound(lo);
+    let end = this.lowerBound(hi);
+    if (end < this._keys.length && this._keys[end] === hi) end++;
+    return end - start;
+  }
+
+  /**
+   * The function yields the `[key, value]` pairs in key order.
+   */
+  *[Symbol.iterator](): IterableIterator<[number, number]> {
+    for (let i = 0; i < this._keys.length; i++) yield [this._keys[i], this._values[i]];
+  }
+}
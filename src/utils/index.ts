@@ -1 +1,3 @@
 export * from './utils';
+export * from './binary';
+export * from './instrumentation';
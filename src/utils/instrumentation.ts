@@ -0,0 +1,160 @@
+/**
+ * data-structure-typed
+ *
+ * @author Tyler Zeng
+ * @copyright Copyright (c) 2022 Tyler Zeng <zrwusa@gmail.com>
+ * @license MIT License
+ */
+import type { InstrumentationOptions, InstrumentationStats, InstrumentedMethods, TimingHistogram } from '../types';
+
+// Microsecond durations of up to 2 ** 31 fit, longer calls land in the last bucket
+const TIMING_BUCKETS = 32;
+
+const now: () => number =
+  typeof performance !== 'undefined' && typeof performance.now === 'function'
+    ? () => performance.now()
+    : () => Date.now();
+
+// The wrappers installed on prototypes, so a method is never wrapped twice
+const wrappers = new WeakSet<(...args: any[]) => any>();
+
+/**
+ * The counters of one structure instance, kept only while its stats are enabled. The first time stats are enabled
+ * on an instance of a class, each instrumented method is wrapped once on that class's prototype. The wrapper checks
+ * the `_instrumentation` field of the instance it runs on and calls the original method straight away when it is
+ * unset. Instances never get own methods, so they keep their hidden class and fast properties when stats are turned
+ * on and off, and call sites over them stay monomorphic. The wrappers stay in place: from then on every instance of
+ * the class pays one field check and one extra call per instrumented method, while other classes, including parent
+ * classes, pay nothing.
+ */
+export class Instrumentation {
+  /**
+   * The constructor starts with empty counters.
+   * @param {InstrumentationOptions} [options] - `timing` also records a duration histogram per counter.
+   */
+  constructor(options: InstrumentationOptions = {}) {
+    this._timing = options.timing === true;
+  }
+
+  protected _timing: boolean;
+
+  /**
+   * The function tells whether calls are timed.
+   * @returns True if timing histograms are recorded.
+   */
+  get timing(): boolean {
+    return this._timing;
+  }
+
+  protected _counters: { [counter: string]: number } = {};
+
+  /**
+   * The function returns the live counters.
+   * @returns The counters by name.
+   */
+  get counters(): { [counter: string]: number } {
+    return this._counters;
+  }
+
+  protected _timings: { [counter: string]: TimingHistogram } = {};
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `count` function adds to a counter.
+   * @param {string} counter - The counter name.
+   * @param {number} [by=1] - The amount to add.
+   */
+  count(counter: string, by = 1): void {
+    this._counters[counter] = (this._counters[counter] ?? 0) + by;
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `record` function adds a duration to a counter's timing histogram.
+   * @param {string} counter - The counter name.
+   * @param {number} ms - The duration in milliseconds.
+   */
+  record(counter: string, ms: number): void {
+    let histogram = this._timings[counter];
+    if (!histogram) {
+      histogram = { count: 0, totalMs: 0, maxMs: 0, buckets: new Array(TIMING_BUCKETS).fill(0) };
+      this._timings[counter] = histogram;
+    }
+    histogram.count++;
+    histogram.totalMs += ms;
+    if (ms > histogram.maxMs) histogram.maxMs = ms;
+    const micros = ms * 1000;
+    const bucket = micros < 1 ? 0 : Math.min(TIMING_BUCKETS - 1, Math.floor(Math.log2(micros)) + 1);
+    histogram.buckets[bucket]++;
+  }
+
+  /**
+   * Time Complexity: O(m), where m is the number of methods.
+   * Space Complexity: O(m)
+   *
+   * The `instrument` function makes the listed methods of `target` update these counters while `target` holds
+   * this instrumentation in its `_instrumentation` field. Methods not wrapped yet are wrapped on the prototype of
+   * `target`; `target` itself gets no own methods.
+   * @param {object} target - The instance to instrument.
+   * @param {InstrumentedMethods} methods - The methods and the counters they update.
+   */
+  instrument(target: object, methods: InstrumentedMethods): void {
+    for (const method in methods) {
+      const spec = methods[method];
+      const counter = typeof spec === 'string' ? spec : spec.counter;
+      if (!(counter in this._counters)) this._counters[counter] = 0;
+
+      const prototype = Object.getPrototypeOf(target);
+      const original = prototype[method];
+      if (typeof original !== 'function' || wrappers.has(original)) continue;
+      const after = typeof spec === 'string' ? undefined : spec.after;
+      const wrapper = function (this: { _instrumentation?: Instrumentation }, ...args: any[]) {
+        const instrumentation = this._instrumentation;
+        if (instrumentation === undefined) return original.apply(this, args);
+        const start = instrumentation._timing ? now() : 0;
+        const result = original.apply(this, args);
+        if (instrumentation._timing) instrumentation.record(counter, now() - start);
+        instrumentation.count(counter);
+        if (after) after(instrumentation, args, result, this);
+        return result;
+      };
+      wrappers.add(wrapper);
+      Object.defineProperty(prototype, method, { value: wrapper, configurable: true, writable: true });
+    }
+  }
+
+  /**
+   * Time Complexity: O(1)
+   * Space Complexity: O(1)
+   *
+   * The `reset` function zeroes every counter and histogram.
+   */
+  reset(): void {
+    for (const counter in this._counters) this._counters[counter] = 0;
+    this._timings = {};
+  }
+
+  /**
+   * Time Complexity: O(c), where c is the number of counters.
+   * Space Complexity: O(c)
+   *
+   * The `snapshot` function copies the counters and histograms into a plain object.
+   * @param {string} name - The name to report, usually the structure's class name.
+   * @returns The stats.
+   */
+  snapshot(name: string): InstrumentationStats {
+    const stats: InstrumentationStats = { name, enabled: true, counters: { ...this._counters } };
+    if (this._timing) {
+      stats.timings = {};
+      for (const counter in this._timings) {
+        const { count, totalMs, maxMs, buckets } = this._timings[counter];
+        stats.timings[counter] = { count, totalMs, maxMs, buckets: buckets.slice() };
+      }
+    }
+    return stats;
+  }
+}
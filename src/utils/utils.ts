@@ -105,3 +105,56 @@ export const roundFixed = (num: number, digit: number = 10) => {
   const multiplier = Math.pow(10, digit);
   return Math.round(num * multiplier) / multiplier;
 };
+
+/**
+ * The function returns the number of elements of a collection when it is cheap to know, so a
+ * structure can be sized once before loading it.
+ * @param collection - The collection to inspect.
+ * @returns the length of an array, the numeric `size` of a collection, or 0 if it is unknown.
+ */
+export const getSizeHint = (collection: Iterable<unknown>): number => {
+  if (Array.isArray(collection)) return collection.length;
+  const { size } = collection as { size?: unknown };
+  return typeof size === 'number' ? size : 0;
+};
+
+const FLOAT64_SCRATCH = new Float64Array(1);
+const INT32_SCRATCH = new Int32Array(FLOAT64_SCRATCH.buffer);
+
+/**
+ * The murmur3 finalizer, which spreads every input bit over the whole 32-bit result.
+ * @param {number} h - A 32-bit integer.
+ * @returns a well mixed 32-bit integer.
+ */
+export const mixHash = (h: number): number => {
+  h = Math.imul(h ^ (h >>> 16), 0x85ebca6b);
+  h = Math.imul(h ^ (h >>> 13), 0xc2b2ae35);
+  return h ^ (h >>> 16);
+};
+
+/**
+ * The function hashes a number by value without converting it to a string. Integers in the 32-bit range
+ * are mixed directly, other numbers are hashed from their IEEE 754 bits. `0` and `-0` hash alike, as do
+ * all NaNs.
+ * @param {number} key - The number to hash.
+ * @returns a 32-bit integer hash.
+ */
+export const hashNumber = (key: number): number => {
+  if ((key | 0) === key) return mixHash(key);
+  if (key !== key) return mixHash(0x7ff80000);
+  FLOAT64_SCRATCH[0] = key;
+  return mixHash(INT32_SCRATCH[0] ^ Math.imul(INT32_SCRATCH[1], 0x9e3779b1));
+};
+
+/**
+ * The function hashes a string with 32-bit FNV-1a over its UTF-16 code units.
+ * @param {string} key - The string to hash.
+ * @returns a 32-bit integer hash.
+ */
+export const hashString = (key: string): number => {
+  let h = 0x811c9dc5;
+  for (let i = 0; i < key.length; i++) {
+    h = Math.imul(h ^ key.charCodeAt(i), 0x01000193);
+  }
+  return mixHash(h);
+};
@@ -4,6 +4,7 @@ import { getRandomIntArray, magnitude } from '../../../utils';
 
 const suite = new Benchmark.Suite();
 const avl = new AVLTree<number>();
+const avlExtractor = new AVLTree<number>([], { extractor: key => Number(key) });
 const { TEN_THOUSAND } = magnitude;
 const arr = getRandomIntArray(TEN_THOUSAND, 0, TEN_THOUSAND, true);
 
@@ -23,6 +24,13 @@ suite
   })
   .add(`${TEN_THOUSAND.toLocaleString()} get`, () => {
     for (let i = 0; i < arr.length; i++) avl.get(arr[i]);
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} add randomly with extractor`, () => {
+    avlExtractor.clear();
+    for (let i = 0; i < arr.length; i++) avlExtractor.add(arr[i]);
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} get with extractor`, () => {
+    for (let i = 0; i < arr.length; i++) avlExtractor.get(arr[i]);
   });
 
 export { suite };
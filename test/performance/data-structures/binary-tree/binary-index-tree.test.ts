@@ -0,0 +1,45 @@
+import { BinaryIndexedTree, BinaryIndexedTree2D, RangeBinaryIndexedTree } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomInt, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { TEN_THOUSAND, HUNDRED_THOUSAND } = magnitude;
+const values = Array.from({ length: HUNDRED_THOUSAND }, () => getRandomInt(0, 100));
+const indexes = Array.from({ length: TEN_THOUSAND }, () => getRandomInt(0, HUNDRED_THOUSAND - 1));
+const sparse = new BinaryIndexedTree({ max: HUNDRED_THOUSAND });
+const dense = BinaryIndexedTree.fromArray(values);
+const range = new RangeBinaryIndexedTree(values);
+const heatmap = new BinaryIndexedTree2D(1000, 1000, 'int32');
+
+suite
+  .add(`sparse ${TEN_THOUSAND.toLocaleString()} update and getPrefixSum`, () => {
+    for (const index of indexes) {
+      sparse.update(index, 1);
+      sparse.getPrefixSum(index);
+    }
+  })
+  .add(`float64 ${TEN_THOUSAND.toLocaleString()} update and getPrefixSum`, () => {
+    for (const index of indexes) {
+      dense.update(index, 1);
+      dense.getPrefixSum(index);
+    }
+  })
+  .add(`float64 ${HUNDRED_THOUSAND.toLocaleString()} fromArray`, () => {
+    BinaryIndexedTree.fromArray(values);
+  })
+  .add(`range ${TEN_THOUSAND.toLocaleString()} addRange and query`, () => {
+    for (const index of indexes) {
+      range.addRange(index >> 1, index, 1);
+      range.query(index >> 1, index);
+    }
+  })
+  .add(`2D ${TEN_THOUSAND.toLocaleString()} update and query`, () => {
+    for (const index of indexes) {
+      const row = index % 1000,
+        col = (index >> 7) % 1000;
+      heatmap.update(row, col, 1);
+      heatmap.query(row >> 1, col >> 1, row, col);
+    }
+  });
+
+export { suite };
@@ -0,0 +1,41 @@
+import { CompactRBTree, RedBlackTree } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomIntArray, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const compact = new CompactRBTree<number>([], { initialCapacity: magnitude.HUNDRED_THOUSAND });
+const rbTree = new RedBlackTree<number, number>();
+const { HUNDRED_THOUSAND } = magnitude;
+const arr = getRandomIntArray(HUNDRED_THOUSAND, 0, HUNDRED_THOUSAND, true);
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} add`, () => {
+    compact.clear();
+    for (let i = 0; i < arr.length; i++) compact.add(arr[i], arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} RedBlackTree add`, () => {
+    rbTree.clear();
+    for (let i = 0; i < arr.length; i++) rbTree.add(arr[i], arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} getNode`, () => {
+    for (let i = 0; i < arr.length; i++) compact.getNode(arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} RedBlackTree getNode`, () => {
+    for (let i = 0; i < arr.length; i++) rbTree.getNode(arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} add & delete randomly`, () => {
+    compact.clear();
+    for (let i = 0; i < arr.length; i++) compact.add(arr[i]);
+    for (let i = 0; i < arr.length; i++) compact.delete(arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} RedBlackTree add & delete randomly`, () => {
+    rbTree.clear();
+    for (let i = 0; i < arr.length; i++) rbTree.add(arr[i]);
+    for (let i = 0; i < arr.length; i++) rbTree.delete(arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} iterator`, () => {
+    const entries = [...compact];
+    return entries.length === HUNDRED_THOUSAND;
+  });
+
+export { suite };
@@ -0,0 +1,34 @@
+import { PersistentRBTree, RedBlackTree } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomIntArray, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { HUNDRED_THOUSAND, TEN_THOUSAND, THOUSAND } = magnitude;
+const ROUNDS = THOUSAND / 10;
+const arr = getRandomIntArray(HUNDRED_THOUSAND, 0, HUNDRED_THOUSAND, true);
+
+const rbTree = new RedBlackTree<number, number>();
+const persistentTree = new PersistentRBTree<number, number>();
+for (let i = 0; i < TEN_THOUSAND; i++) {
+  rbTree.add(i, i);
+  persistentTree.set(i, i);
+}
+
+suite
+  .add(`PersistentRBTree ${HUNDRED_THOUSAND.toLocaleString()} set`, () => {
+    const tree = new PersistentRBTree<number, number>();
+    for (let i = 0; i < arr.length; i++) tree.set(arr[i], arr[i]);
+  })
+  .add(`PersistentRBTree ${HUNDRED_THOUSAND.toLocaleString()} set & delete`, () => {
+    const tree = new PersistentRBTree<number, number>();
+    for (let i = 0; i < arr.length; i++) tree.set(arr[i], arr[i]);
+    for (let i = 0; i < arr.length; i++) tree.delete(arr[i]);
+  })
+  .add(`RBTree ${ROUNDS.toLocaleString()} clone & add of ${TEN_THOUSAND.toLocaleString()}`, () => {
+    for (let i = 0; i < ROUNDS; i++) rbTree.clone().add(-i, i);
+  })
+  .add(`PersistentRBTree ${ROUNDS.toLocaleString()} snapshot & set of ${TEN_THOUSAND.toLocaleString()}`, () => {
+    for (let i = 0; i < ROUNDS; i++) persistentTree.snapshot().set(-i, i);
+  });
+
+export { suite };
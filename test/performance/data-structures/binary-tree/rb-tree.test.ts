@@ -1,8 +1,9 @@
-import { RedBlackTree } from '../../../../src';
+import { CP, RedBlackTree } from '../../../../src';
 import * as Benchmark from 'benchmark';
 import { getRandomIntArray, magnitude } from '../../../utils';
 import { OrderedMap } from 'js-sdsl';
 import { isCompetitor } from '../../../config';
+import { LatencyCase, ScalingCase } from '../../types';
 
 const suite = new Benchmark.Suite();
 const rbTree = new RedBlackTree();
@@ -21,6 +22,25 @@ if (isCompetitor) {
   });
 }
 
+// A class of its own, so the stats wrappers do not slow down the other trees of the run
+class StatsRedBlackTree extends RedBlackTree<number> {}
+
+const toggledTree = new StatsRedBlackTree();
+toggledTree.enableStats();
+toggledTree.disableStats();
+const countedTree = new StatsRedBlackTree();
+countedTree.enableStats();
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} add after stats toggled`, () => {
+    toggledTree.clear();
+    for (let i = 0; i < arr.length; i++) toggledTree.add(arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} add with stats`, () => {
+    countedTree.clear();
+    for (let i = 0; i < arr.length; i++) countedTree.add(arr[i]);
+  });
+
 suite
   .add(`${HUNDRED_THOUSAND.toLocaleString()} add & delete randomly`, () => {
     rbTree.clear();
@@ -31,6 +51,92 @@ suite
     for (let i = 0; i < arr.length; i++) rbTree.getNode(arr[i]);
   });
 
+const rbTreeComparator = new RedBlackTree<number>([], { comparator: (a, b) => a - b });
+const rbTreeExtractor = new RedBlackTree<number>([], { extractor: key => Number(key) });
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} add with comparator`, () => {
+    rbTreeComparator.clear();
+    for (let i = 0; i < arr.length; i++) rbTreeComparator.add(arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} add with extractor`, () => {
+    rbTreeExtractor.clear();
+    for (let i = 0; i < arr.length; i++) rbTreeExtractor.add(arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} getNode with comparator`, () => {
+    for (let i = 0; i < arr.length; i++) rbTreeComparator.getNode(arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} getNode with extractor`, () => {
+    for (let i = 0; i < arr.length; i++) rbTreeExtractor.getNode(arr[i]);
+  });
+
+const sortedKeys = Array.from({ length: HUNDRED_THOUSAND }, (_, i) => i);
+const rbTreeSorted = new RedBlackTree<number>();
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} add sorted`, () => {
+    rbTreeSorted.clear();
+    for (let i = 0; i < sortedKeys.length; i++) rbTreeSorted.add(sortedKeys[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} buildFromSorted`, () => {
+    rbTreeSorted.buildFromSorted(sortedKeys);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} perfectlyBalance`, () => {
+    rbTreeSorted.perfectlyBalance();
+  });
+
+const rbTreeOS = new RedBlackTree<number>(arr, { isOrderStatistic: true });
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} add with isOrderStatistic`, () => {
+    rbTreeOS.clear();
+    for (let i = 0; i < arr.length; i++) rbTreeOS.add(arr[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} select with isOrderStatistic`, () => {
+    for (let i = 0; i < rbTreeOS.size; i++) rbTreeOS.select(i);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} rank with isOrderStatistic`, () => {
+    for (let i = 0; i < arr.length; i++) rbTreeOS.rank(arr[i]);
+  });
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} lesserOrGreaterTraverse first 20`, () => {
+    for (let i = 0; i < 1000; i++) rbTreeOS.lesserOrGreaterTraverse(undefined, CP.gt, arr[i]).slice(0, 20);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} rangeIterator first 20`, () => {
+    for (let i = 0; i < 1000; i++) {
+      const iterator = rbTreeOS.rangeIterator(arr[i], undefined, { inclusive: false });
+      for (let j = 0; j < 20; j++) iterator.next();
+    }
+  });
+
+const { THOUSAND } = magnitude;
+const oddKeys = Array.from({ length: THOUSAND }, (_, i) => i * 97 + 1);
+const rbTreeOdd = new RedBlackTree<number>(oddKeys);
+const rbTreeShifted = new RedBlackTree<number>(sortedKeys.map(key => key + 1));
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} union with ${THOUSAND.toLocaleString()}`, () => {
+    rbTreeSorted.buildFromSorted(sortedKeys);
+    rbTreeSorted.union(rbTreeOdd);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} add ${THOUSAND.toLocaleString()}`, () => {
+    rbTreeSorted.buildFromSorted(sortedKeys);
+    for (let i = 0; i < oddKeys.length; i++) rbTreeSorted.add(oddKeys[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} union with ${HUNDRED_THOUSAND.toLocaleString()}`, () => {
+    rbTreeSorted.buildFromSorted(sortedKeys);
+    rbTreeSorted.union(rbTreeShifted);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} intersection with ${THOUSAND.toLocaleString()}`, () => {
+    rbTreeSorted.buildFromSorted(sortedKeys);
+    rbTreeSorted.intersection(rbTreeOdd);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} split & join`, () => {
+    rbTreeSorted.buildFromSorted(sortedKeys);
+    for (let i = 0; i < THOUSAND; i++) rbTreeSorted.join(rbTreeSorted.split(oddKeys[i]));
+  });
+
 suite.add(`${HUNDRED_THOUSAND.toLocaleString()} add & iterator`, () => {
   rbTree.clear();
   for (let i = 0; i < arr.length; i++) rbTree.add(arr[i]);
@@ -38,4 +144,25 @@ suite.add(`${HUNDRED_THOUSAND.toLocaleString()} add & iterator`, () => {
   return entries.length === HUNDRED_THOUSAND;
 });
 
-export { suite };
+const scaling: ScalingCase[] = [
+  {
+    name: 'add random keys',
+    build: n => {
+      const tree = new RedBlackTree<number>();
+      for (let i = 0; i < n; i++) tree.add((i * 2654435761) % n);
+      return tree;
+    }
+  }
+];
+
+const latency: LatencyCase[] = [
+  {
+    name: 'add random keys',
+    setup: () => {
+      const tree = new RedBlackTree<number>();
+      return i => tree.add((i * 2654435761) % HUNDRED_THOUSAND);
+    }
+  }
+];
+
+export { suite, scaling, latency };
@@ -0,0 +1,45 @@
+import { LazySegmentTree, SegmentTree } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomInt, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { TEN_THOUSAND, HUNDRED_THOUSAND } = magnitude;
+const values = Array.from({ length: HUNDRED_THOUSAND }, () => getRandomInt(0, 100));
+const segmentTree = new SegmentTree(values);
+const lazySegmentTree = new LazySegmentTree(values);
+const ranges = Array.from({ length: TEN_THOUSAND }, () => {
+  const a = getRandomInt(0, HUNDRED_THOUSAND - 1),
+    b = getRandomInt(0, HUNDRED_THOUSAND - 1);
+  return [Math.min(a, b), Math.max(a, b)];
+});
+
+suite
+  .add(`SegmentTree ${HUNDRED_THOUSAND.toLocaleString()} build`, () => {
+    new SegmentTree(values);
+  })
+  .add(`LazySegmentTree ${HUNDRED_THOUSAND.toLocaleString()} build`, () => {
+    new LazySegmentTree(values);
+  })
+  .add(`SegmentTree ${TEN_THOUSAND.toLocaleString()} updateNode and querySumByRange`, () => {
+    for (const [start, end] of ranges) {
+      segmentTree.updateNode(start, end);
+      segmentTree.querySumByRange(start, end);
+    }
+  })
+  .add(`LazySegmentTree ${TEN_THOUSAND.toLocaleString()} set and query`, () => {
+    for (const [start, end] of ranges) {
+      lazySegmentTree.set(start, end);
+      lazySegmentTree.query(start, end);
+    }
+  })
+  .add(`LazySegmentTree ${TEN_THOUSAND.toLocaleString()} addRange and query`, () => {
+    for (const [start, end] of ranges) {
+      lazySegmentTree.addRange(start, end, 1);
+      lazySegmentTree.query(start, end);
+    }
+  })
+  .add(`LazySegmentTree ${TEN_THOUSAND.toLocaleString()} maxRight`, () => {
+    for (const [start, end] of ranges) lazySegmentTree.maxRight(start, sum => sum <= end);
+  });
+
+export { suite };
@@ -0,0 +1,62 @@
+import { binaryCodecs, CSRGraph, DirectedGraph } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomInt, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { TEN_THOUSAND } = magnitude;
+const graph = new DirectedGraph<number, number>();
+for (let i = 0; i < TEN_THOUSAND; i++) graph.addVertex(i);
+for (let i = 0; i < TEN_THOUSAND * 5; i++) {
+  graph.addEdge(getRandomInt(0, TEN_THOUSAND - 1), getRandomInt(0, TEN_THOUSAND - 1), getRandomInt(1, 100));
+}
+const frozen = graph.clone();
+frozen.freeze();
+const chain = new DirectedGraph<number>();
+for (let i = 0; i < TEN_THOUSAND * 10; i++) chain.addVertex(i);
+for (let i = 0; i < TEN_THOUSAND * 10 - 1; i++) chain.addEdge(i, i + 1);
+chain.addEdge(TEN_THOUSAND * 10 - 1, 0);
+const snapshot = frozen.frozen!.toBinary(binaryCodecs.int32);
+const graphSnapshot = graph.toBinary({ keyCodec: binaryCodecs.int32 });
+
+suite
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices dijkstra`, () => {
+    graph.dijkstra(0);
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices frozen dijkstra`, () => {
+    frozen.dijkstra(0);
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices CSRGraph dijkstra`, () => {
+    frozen.frozen!.dijkstra(0);
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices freeze`, () => {
+    graph.clone().freeze();
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices frozen tarjan`, () => {
+    frozen.tarjan();
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices tarjan`, () => {
+    graph.tarjan();
+  })
+  .add(`${(TEN_THOUSAND * 10).toLocaleString()} vertices chain tarjan`, () => {
+    chain.tarjan();
+  })
+  .add(`${(TEN_THOUSAND * 10).toLocaleString()} vertices chain getCycles`, () => {
+    chain.getCycles();
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices dijkstra to dest`, () => {
+    graph.dijkstra(0, TEN_THOUSAND - 1, true, true);
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices bidirectionalDijkstra`, () => {
+    graph.bidirectionalDijkstra(0, TEN_THOUSAND - 1);
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices aStar`, () => {
+    graph.aStar(0, TEN_THOUSAND - 1);
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices graph loadBinary`, () => {
+    new DirectedGraph<number, number>().loadBinary(graphSnapshot, { keyCodec: binaryCodecs.int32 });
+  })
+  .add(`${TEN_THOUSAND.toLocaleString()} vertices CSRGraph fromBinary`, () => {
+    CSRGraph.fromBinary(snapshot, binaryCodecs.int32);
+  });
+
+export { suite };
@@ -1,8 +1,9 @@
-import { HashMap } from '../../../../src';
+import { HashMap, LinkedHashMap } from '../../../../src';
 import { HashMap as CHashMap } from 'js-sdsl';
 import * as Benchmark from 'benchmark';
-import { magnitude } from '../../../utils';
+import { getRandomIntArray, magnitude } from '../../../utils';
 import { isCompetitor } from '../../../config';
+import { LatencyCase, ScalingCase } from '../../types';
 
 const suite = new Benchmark.Suite();
 const { MILLION } = magnitude;
@@ -49,6 +50,42 @@ if (isCompetitor) {
   });
 }
 
+const randomIds = getRandomIntArray(MILLION, 0, 2 ** 31 - 1, false);
+
+suite.add(`${MILLION.toLocaleString()} random integer id set & get`, () => {
+  const hm = new HashMap<number, number>();
+
+  for (let i = 0; i < MILLION; i++) hm.set(randomIds[i], i);
+  for (let i = 0; i < MILLION; i++) hm.get(randomIds[i]);
+});
+
+suite.add(`Native Map ${MILLION.toLocaleString()} random integer id set & get`, () => {
+  const hm = new Map<number, number>();
+
+  for (let i = 0; i < MILLION; i++) hm.set(randomIds[i], i);
+  for (let i = 0; i < MILLION; i++) hm.get(randomIds[i]);
+});
+
+const entries: [number, number][] = randomIds.map((id, i) => [id, i]);
+
+suite.add(`${MILLION.toLocaleString()} set one by one`, () => {
+  const hm = new HashMap<number, number>();
+
+  for (let i = 0; i < MILLION; i++) hm.set(entries[i][0], entries[i][1]);
+});
+
+suite.add(`${MILLION.toLocaleString()} bulk load`, () => {
+  const hm = new HashMap<number, number>();
+
+  hm.bulkLoad(entries);
+});
+
+suite.add(`${MILLION.toLocaleString()} LinkedHashMap bulk load`, () => {
+  const hm = new LinkedHashMap<number, number>();
+
+  hm.bulkLoad(entries);
+});
+
 suite.add(`Native Map ${MILLION.toLocaleString()} set & get`, () => {
   const hm = new Map<number, number>();
 
@@ -96,4 +133,25 @@ suite.add(`Native Set ${MILLION.toLocaleString()} ObjKey add & has`, () => {
   for (let i = 0; i < MILLION; i++) hs.has(objs[i]);
 });
 
-export { suite };
+const scaling: ScalingCase[] = [
+  {
+    name: 'set number keys',
+    build: n => {
+      const hm = new HashMap<number, number>();
+      for (let i = 0; i < n; i++) hm.set(i, i);
+      return hm;
+    }
+  }
+];
+
+const latency: LatencyCase[] = [
+  {
+    name: 'set number keys',
+    setup: () => {
+      const hm = new HashMap<number, number>();
+      return i => hm.set(i, i);
+    }
+  }
+];
+
+export { suite, scaling, latency };
@@ -0,0 +1,37 @@
+import { LFUCache, LinkedHashMap, LRUCache } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomIntArray, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { HUNDRED_THOUSAND } = magnitude;
+const CAPACITY = HUNDRED_THOUSAND / 10;
+const keys = getRandomIntArray(HUNDRED_THOUSAND, 0, HUNDRED_THOUSAND / 5, false);
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} LinkedHashMap delete & set as LRU`, () => {
+    const cache = new LinkedHashMap<number, number>();
+    for (const key of keys) {
+      if (cache.has(key)) {
+        const value = cache.get(key)!;
+        cache.delete(key);
+        cache.set(key, value);
+      } else {
+        cache.set(key, key);
+        if (cache.size > CAPACITY) cache.delete(cache.first![0]);
+      }
+    }
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} LRUCache get & set`, () => {
+    const cache = new LRUCache<number, number>([], { maxSize: CAPACITY });
+    for (const key of keys) {
+      if (cache.get(key) === undefined) cache.set(key, key);
+    }
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} LFUCache get & set`, () => {
+    const cache = new LFUCache<number, number>([], { maxSize: CAPACITY });
+    for (const key of keys) {
+      if (cache.get(key) === undefined) cache.set(key, key);
+    }
+  });
+
+export { suite };
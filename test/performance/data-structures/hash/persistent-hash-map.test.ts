@@ -0,0 +1,30 @@
+import { HashMap, PersistentHashMap } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { HUNDRED_THOUSAND, TEN_THOUSAND, THOUSAND } = magnitude;
+
+const hashMap = new HashMap<number, number>();
+const persistentMap = new PersistentHashMap<number, number>();
+for (let i = 0; i < TEN_THOUSAND; i++) {
+  hashMap.set(i, i);
+  persistentMap.set(i, i);
+}
+
+suite
+  .add(`PersistentHashMap ${HUNDRED_THOUSAND.toLocaleString()} set`, () => {
+    const map = new PersistentHashMap<number, number>();
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) map.set(i, i);
+  })
+  .add(`PersistentHashMap ${HUNDRED_THOUSAND.toLocaleString()} get`, () => {
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) persistentMap.get(i % TEN_THOUSAND);
+  })
+  .add(`HashMap ${THOUSAND.toLocaleString()} clone & set of ${TEN_THOUSAND.toLocaleString()}`, () => {
+    for (let i = 0; i < THOUSAND; i++) hashMap.clone().set(i, -i);
+  })
+  .add(`PersistentHashMap ${THOUSAND.toLocaleString()} snapshot & set of ${TEN_THOUSAND.toLocaleString()}`, () => {
+    for (let i = 0; i < THOUSAND; i++) persistentMap.snapshot().set(i, -i);
+  });
+
+export { suite };
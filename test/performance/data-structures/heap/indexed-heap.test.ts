@@ -0,0 +1,38 @@
+import { Heap, IndexedHeap } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomIntArray, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { HUNDRED_THOUSAND } = magnitude;
+const priorities = getRandomIntArray(HUNDRED_THOUSAND, 0, HUNDRED_THOUSAND);
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} Heap add & poll`, () => {
+    const heap = new Heap<{ key: number; value: number }>([], { comparator: (a, b) => a.key - b.key });
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add({ key: priorities[i], value: i });
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.poll();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} IndexedHeap add & poll`, () => {
+    const heap = new IndexedHeap([], { capacity: HUNDRED_THOUSAND });
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(i, priorities[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.poll();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} 4-ary IndexedHeap add & poll`, () => {
+    const heap = new IndexedHeap([], { capacity: HUNDRED_THOUSAND, arity: 4 });
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(i, priorities[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.poll();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} Heap add, re-add lower & poll`, () => {
+    const heap = new Heap<{ key: number; value: number }>([], { comparator: (a, b) => a.key - b.key });
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add({ key: priorities[i], value: i });
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add({ key: priorities[i] - 1, value: i });
+    while (heap.size > 0) heap.poll();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} 4-ary IndexedHeap add, decreaseKey & poll`, () => {
+    const heap = new IndexedHeap([], { capacity: HUNDRED_THOUSAND, arity: 4 });
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(i, priorities[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.decreaseKey(i, priorities[i] - 1);
+    while (heap.size > 0) heap.poll();
+  });
+
+export { suite };
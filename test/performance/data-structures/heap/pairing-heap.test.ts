@@ -0,0 +1,47 @@
+import { FibonacciHeap, Heap, IndexedHeap, PairingHeap, PairingHeapNode } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomIntArray, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { HUNDRED_THOUSAND } = magnitude;
+const priorities = getRandomIntArray(HUNDRED_THOUSAND, 0, HUNDRED_THOUSAND);
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} Heap add & poll`, () => {
+    const heap = new Heap<number>();
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(priorities[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.poll();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} FibonacciHeap add & poll`, () => {
+    const heap = new FibonacciHeap<number>();
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(priorities[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.poll();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} PairingHeap add & poll`, () => {
+    const heap = new PairingHeap<number>();
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(priorities[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.poll();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} IndexedHeap add & poll`, () => {
+    const heap = new IndexedHeap([], { capacity: HUNDRED_THOUSAND, arity: 4 });
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(i, priorities[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.poll();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} PairingHeap add, decreaseKey & poll`, () => {
+    const heap = new PairingHeap<number>();
+    const nodes: PairingHeapNode<number>[] = [];
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) nodes.push(heap.addNode(priorities[i]));
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.decreaseKey(nodes[i], priorities[i] - 1);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.poll();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} PairingHeap merge 100 heaps & poll`, () => {
+    const heap = new PairingHeap<number>();
+    for (let h = 0; h < 100; h++) {
+      const part = new PairingHeap<number>();
+      for (let i = h; i < HUNDRED_THOUSAND; i += 100) part.add(priorities[i]);
+      heap.merge(part);
+    }
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.poll();
+  });
+
+export { suite };
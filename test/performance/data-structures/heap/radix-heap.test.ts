@@ -0,0 +1,40 @@
+import { FibonacciHeap, Heap, IndexedHeap, PairingHeap, RadixHeap } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomIntArray, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { HUNDRED_THOUSAND, TEN_THOUSAND } = magnitude;
+// A monotone workload like an event scheduler: every new timestamp lies after the one just polled
+const delays = getRandomIntArray(HUNDRED_THOUSAND, 1, 1000);
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} Heap monotone poll & add`, () => {
+    const heap = new Heap<number>();
+    for (let i = 0; i < TEN_THOUSAND; i++) heap.add(delays[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(heap.poll()! + delays[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} FibonacciHeap monotone poll & add`, () => {
+    const heap = new FibonacciHeap<number>();
+    for (let i = 0; i < TEN_THOUSAND; i++) heap.add(delays[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(heap.poll()! + delays[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} PairingHeap monotone poll & add`, () => {
+    const heap = new PairingHeap<number>();
+    for (let i = 0; i < TEN_THOUSAND; i++) heap.add(delays[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(heap.poll()! + delays[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} IndexedHeap monotone poll & add`, () => {
+    const heap = new IndexedHeap([], { capacity: TEN_THOUSAND, arity: 4 });
+    for (let i = 0; i < TEN_THOUSAND; i++) heap.add(i, delays[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) {
+      const priority = heap.peekPriority()!;
+      heap.add(heap.poll()!, priority + delays[i]);
+    }
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} RadixHeap monotone poll & add`, () => {
+    const heap = new RadixHeap<number>();
+    for (let i = 0; i < TEN_THOUSAND; i++) heap.add(delays[i]);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) heap.add(heap.poll()! + delays[i]);
+  });
+
+export { suite };
@@ -1,4 +1,4 @@
-import { DoublyLinkedList, DoublyLinkedListNode } from '../../../../src';
+import { DoublyLinkedList, DoublyLinkedListNode, IntrusiveLinkedList } from '../../../../src';
 import { LinkList as CLinkedList } from 'js-sdsl';
 import * as Benchmark from 'benchmark';
 import { magnitude } from '../../../utils';
@@ -54,6 +54,28 @@ suite
         doublyList.addBefore(midNode, i);
       }
     }
+  })
+  .add(`${MILLION.toLocaleString()} push & shift churn`, () => {
+    const list = new DoublyLinkedList<number>();
+    for (let i = 0; i < 1000; i++) list.push(i);
+    for (let i = 0; i < MILLION; i++) {
+      list.push(i);
+      list.shift();
+    }
+  })
+  .add(`${MILLION.toLocaleString()} push & shift churn pooled`, () => {
+    const list = new DoublyLinkedList<number>([], { nodePoolSize: 1024 });
+    for (let i = 0; i < 1000; i++) list.push(i);
+    for (let i = 0; i < MILLION; i++) {
+      list.push(i);
+      list.shift();
+    }
+  })
+  .add(`${MILLION.toLocaleString()} intrusive moveToFront`, () => {
+    type Slot = { id: number; prev: Slot | undefined; next: Slot | undefined };
+    const slots: Slot[] = Array.from({ length: 1000 }, (_, id) => ({ id, prev: undefined, next: undefined }));
+    const list = new IntrusiveLinkedList<Slot>(slots);
+    for (let i = 0; i < MILLION; i++) list.moveToFront(slots[(i * 7919) % 1000]);
   });
 
 export { suite };
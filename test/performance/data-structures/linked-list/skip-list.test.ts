@@ -0,0 +1,57 @@
+import { RedBlackTree, SkipList } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomIntArray, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { HUNDRED_THOUSAND, TEN_THOUSAND } = magnitude;
+const arr = getRandomIntArray(HUNDRED_THOUSAND, 0, HUNDRED_THOUSAND, true);
+const sorted = Array.from({ length: HUNDRED_THOUSAND }, (_, i): [number, number] => [i, i]);
+
+const skipList = new SkipList<number, number>();
+const rbTree = new RedBlackTree<number, number>();
+for (let i = 0; i < arr.length; i++) {
+  skipList.add(arr[i], arr[i]);
+  rbTree.add(arr[i], arr[i]);
+}
+
+suite
+  .add(`SkipList ${HUNDRED_THOUSAND.toLocaleString()} add randomly`, () => {
+    const list = new SkipList<number, number>();
+    for (let i = 0; i < arr.length; i++) list.add(arr[i], arr[i]);
+  })
+  .add(`RBTree ${HUNDRED_THOUSAND.toLocaleString()} add randomly`, () => {
+    const tree = new RedBlackTree<number, number>();
+    for (let i = 0; i < arr.length; i++) tree.add(arr[i], arr[i]);
+  })
+  .add(`SkipList ${HUNDRED_THOUSAND.toLocaleString()} addSorted`, () => {
+    const list = new SkipList<number, number>();
+    list.addSorted(sorted);
+  })
+  .add(`RBTree ${HUNDRED_THOUSAND.toLocaleString()} buildFromSorted`, () => {
+    const tree = new RedBlackTree<number, number>();
+    tree.buildFromSorted(sorted);
+  })
+  .add(`SkipList ${HUNDRED_THOUSAND.toLocaleString()} get`, () => {
+    for (let i = 0; i < arr.length; i++) skipList.get(arr[i]);
+  })
+  .add(`RBTree ${HUNDRED_THOUSAND.toLocaleString()} getNode`, () => {
+    for (let i = 0; i < arr.length; i++) rbTree.getNode(arr[i]);
+  })
+  .add(`SkipList ${TEN_THOUSAND.toLocaleString()} range of 10`, () => {
+    for (let i = 0; i < TEN_THOUSAND; i++) for (const entry of skipList.range(arr[i], arr[i] + 10)) entry;
+  })
+  .add(`RBTree ${TEN_THOUSAND.toLocaleString()} rangeIterator of 10`, () => {
+    for (let i = 0; i < TEN_THOUSAND; i++) for (const node of rbTree.rangeIterator(arr[i], arr[i] + 10)) node;
+  })
+  .add(`SkipList ${HUNDRED_THOUSAND.toLocaleString()} add & pollFirst`, () => {
+    const list = new SkipList<number, number>();
+    for (let i = 0; i < arr.length; i++) list.add(arr[i], arr[i]);
+    while (list.pollFirst());
+  })
+  .add(`RBTree ${HUNDRED_THOUSAND.toLocaleString()} add & delete leftmost`, () => {
+    const tree = new RedBlackTree<number, number>();
+    for (let i = 0; i < arr.length; i++) tree.add(arr[i], arr[i]);
+    while (tree.size > 0) tree.delete(tree.getLeftMost()!);
+  });
+
+export { suite };
@@ -0,0 +1,36 @@
+import { DenseMatrix, Matrix } from '../../../../src';
+import * as Benchmark from 'benchmark';
+
+const suite = new Benchmark.Suite();
+const SIZE = 200;
+const randomRows = () =>
+  Array.from({ length: SIZE }, () => Array.from({ length: SIZE }, () => Math.random()));
+const a = randomRows();
+const b = randomRows();
+const matrixA = new Matrix(a);
+const matrixB = new Matrix(b);
+const customA = new Matrix(a, { multiplyFn: (x: number, y: number) => x * y });
+const denseA = DenseMatrix.from(a);
+const denseB = DenseMatrix.from(b);
+
+suite
+  .add(`Matrix ${SIZE}x${SIZE} multiply with multiplyFn`, () => {
+    customA.multiply(matrixB);
+  })
+  .add(`Matrix ${SIZE}x${SIZE} multiply`, () => {
+    matrixA.multiply(matrixB);
+  })
+  .add(`DenseMatrix ${SIZE}x${SIZE} multiply`, () => {
+    denseA.multiply(denseB);
+  })
+  .add(`DenseMatrix ${SIZE}x${SIZE} addInPlace`, () => {
+    denseA.addInPlace(denseB);
+  })
+  .add(`Matrix ${SIZE}x${SIZE} inverse`, () => {
+    matrixA.inverse();
+  })
+  .add(`DenseMatrix ${SIZE}x${SIZE} inverse`, () => {
+    denseA.clone().inverse();
+  });
+
+export { suite };
@@ -57,3 +57,20 @@ suite
     for (let i = 0; i < HUNDRED_THOUSAND; i++) array.unshift(i);
     for (let i = 0; i < HUNDRED_THOUSAND; i++) array.shift();
   });
+
+const filled = new Deque<number>(Array.from({ length: HUNDRED_THOUSAND }, (_, i) => i));
+
+suite
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} filter & map`, () => {
+    filled
+      .filter(value => value % 3 === 0)
+      .map(value => value * 2)
+      .toArray();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} lazy filter & map`, () => {
+    filled
+      .lazy()
+      .filter(value => value % 3 === 0)
+      .map(value => value * 2)
+      .toArray();
+  });
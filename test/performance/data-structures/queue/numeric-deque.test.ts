@@ -0,0 +1,38 @@
+import { Deque, NumericDeque } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { MILLION, HUNDRED_THOUSAND } = magnitude;
+
+suite
+  .add(`${MILLION.toLocaleString()} push & pop`, () => {
+    const deque = new NumericDeque();
+
+    for (let i = 0; i < MILLION; i++) deque.push(i);
+    for (let i = 0; i < MILLION; i++) deque.pop();
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} unshift & shift`, () => {
+    const deque = new NumericDeque();
+
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) deque.unshift(i);
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) deque.shift();
+  })
+  .add(`${MILLION.toLocaleString()} sliding window`, () => {
+    const deque = new NumericDeque();
+
+    for (let i = 0; i < MILLION; i++) {
+      deque.push(i);
+      if (deque.size > 10000) deque.shift();
+    }
+  })
+  .add(`Deque ${MILLION.toLocaleString()} sliding window`, () => {
+    const deque = new Deque<number>();
+
+    for (let i = 0; i < MILLION; i++) {
+      deque.push(i);
+      if (deque.size > 10000) deque.shift();
+    }
+  });
+
+export { suite };
@@ -0,0 +1,32 @@
+import { Deque, PersistentDeque } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { MILLION, TEN_THOUSAND, THOUSAND } = magnitude;
+
+const deque = new Deque<number>();
+const persistentDeque = new PersistentDeque<number>();
+for (let i = 0; i < TEN_THOUSAND; i++) {
+  deque.push(i);
+  persistentDeque.push(i);
+}
+
+suite
+  .add(`PersistentDeque ${MILLION.toLocaleString()} push`, () => {
+    const queue = new PersistentDeque<number>();
+    for (let i = 0; i < MILLION; i++) queue.push(i);
+  })
+  .add(`PersistentDeque ${MILLION.toLocaleString()} push & shift`, () => {
+    const queue = new PersistentDeque<number>();
+    for (let i = 0; i < MILLION; i++) queue.push(i);
+    for (let i = 0; i < MILLION; i++) queue.shift();
+  })
+  .add(`Deque ${THOUSAND.toLocaleString()} clone & push of ${TEN_THOUSAND.toLocaleString()}`, () => {
+    for (let i = 0; i < THOUSAND; i++) deque.clone().push(i);
+  })
+  .add(`PersistentDeque ${THOUSAND.toLocaleString()} snapshot & push of ${TEN_THOUSAND.toLocaleString()}`, () => {
+    for (let i = 0; i < THOUSAND; i++) persistentDeque.snapshot().push(i);
+  });
+
+export { suite };
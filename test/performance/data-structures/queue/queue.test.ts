@@ -1,8 +1,9 @@
-import { Queue } from '../../../../src';
+import { LinkedListQueue, Queue } from '../../../../src';
 import { Queue as CQueue } from 'js-sdsl';
 import * as Benchmark from 'benchmark';
 import { magnitude } from '../../../utils';
 import { isCompetitor } from '../../../config';
+import { LatencyCase } from '../../types';
 
 const suite = new Benchmark.Suite();
 const { MILLION, HUNDRED_THOUSAND } = magnitude;
@@ -25,6 +26,29 @@ suite.add(`${HUNDRED_THOUSAND.toLocaleString()} push & shift`, () => {
   for (let i = 0; i < HUNDRED_THOUSAND; i++) queue.push(i);
   for (let i = 0; i < HUNDRED_THOUSAND; i++) queue.shift();
 });
+suite.add(`${HUNDRED_THOUSAND.toLocaleString()} LinkedListQueue enqueue & dequeue pooled`, () => {
+  const queue = new LinkedListQueue<number>([], { nodePoolSize: 1024 });
+
+  for (let i = 0; i < HUNDRED_THOUSAND; i++) {
+    queue.enqueue(i);
+    if (i % 2 === 1) queue.dequeue();
+  }
+});
+suite.add(`${HUNDRED_THOUSAND.toLocaleString()} push & shift interleaved`, () => {
+  const queue = new Queue<number>([], { capacity: 1024 });
+
+  for (let i = 0; i < HUNDRED_THOUSAND; i++) {
+    queue.push(i);
+    if (i % 3 !== 0) queue.shift();
+  }
+});
+suite.add(`${HUNDRED_THOUSAND.toLocaleString()} pushMany & drain`, () => {
+  const queue = new Queue<number>();
+  const batch = Array.from({ length: 100 }, (_, i) => i);
+
+  for (let i = 0; i < HUNDRED_THOUSAND; i += 100) queue.pushMany(batch);
+  while (!queue.isEmpty()) queue.drain(100);
+});
 suite
   .add(`Native Array ${HUNDRED_THOUSAND.toLocaleString()} push & shift`, () => {
     const arr = new Array<number>();
@@ -39,4 +63,17 @@ suite
     for (let i = 0; i < HUNDRED_THOUSAND; i++) arr.pop();
   });
 
-export { suite };
+const latency: LatencyCase[] = [
+  {
+    name: 'push & shift churn',
+    setup: () => {
+      const queue = new Queue<number>();
+      return i => {
+        queue.push(i);
+        if (i % 2 === 1) queue.shift();
+      };
+    }
+  }
+];
+
+export { suite, latency };
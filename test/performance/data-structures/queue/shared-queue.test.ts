@@ -0,0 +1,30 @@
+import { MPMCQueue, SPSCQueue } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { HUNDRED_THOUSAND } = magnitude;
+const spsc = new SPSCQueue({ capacity: 1024, recordSize: 16 });
+const mpmc = new MPMCQueue({ capacity: 1024, recordSize: 16 });
+const record = new Float64Array(2);
+const target = new Uint8Array(16);
+
+suite
+  .add(`SPSCQueue ${HUNDRED_THOUSAND.toLocaleString()} push & shift`, () => {
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) {
+      record[0] = i;
+      spsc.push(record);
+      if (i % 4 === 3) while (spsc.shift(target));
+    }
+    while (spsc.shift(target));
+  })
+  .add(`MPMCQueue ${HUNDRED_THOUSAND.toLocaleString()} push & shift`, () => {
+    for (let i = 0; i < HUNDRED_THOUSAND; i++) {
+      record[0] = i;
+      mpmc.push(record);
+      if (i % 4 === 3) while (mpmc.shift(target));
+    }
+    while (mpmc.shift(target));
+  });
+
+export { suite };
@@ -0,0 +1,41 @@
+import { RadixTrie, Trie } from '../../../../src';
+import * as Benchmark from 'benchmark';
+import { getRandomWords, magnitude } from '../../../utils';
+
+const suite = new Benchmark.Suite();
+const { HUNDRED_THOUSAND } = magnitude;
+const randomWords = getRandomWords(HUNDRED_THOUSAND, false);
+const trie = new Trie(randomWords);
+const radixTrie = new RadixTrie(randomWords);
+const frozen = radixTrie.freeze();
+
+suite
+  .add(`Trie ${HUNDRED_THOUSAND.toLocaleString()} build`, () => {
+    new Trie(randomWords);
+  })
+  .add(`RadixTrie ${HUNDRED_THOUSAND.toLocaleString()} build`, () => {
+    new RadixTrie(randomWords);
+  })
+  .add(`RadixTrie ${HUNDRED_THOUSAND.toLocaleString()} freeze`, () => {
+    radixTrie.freeze();
+  })
+  .add(`Trie ${HUNDRED_THOUSAND.toLocaleString()} has`, () => {
+    for (let i = 0; i < randomWords.length; i++) trie.has(randomWords[i]);
+  })
+  .add(`RadixTrie ${HUNDRED_THOUSAND.toLocaleString()} has`, () => {
+    for (let i = 0; i < randomWords.length; i++) radixTrie.has(randomWords[i]);
+  })
+  .add(`FrozenRadixTrie ${HUNDRED_THOUSAND.toLocaleString()} has`, () => {
+    for (let i = 0; i < randomWords.length; i++) frozen.has(randomWords[i]);
+  })
+  .add(`Trie ${HUNDRED_THOUSAND.toLocaleString()} getWords`, () => {
+    for (let i = 0; i < randomWords.length; i++) trie.getWords(randomWords[i].slice(0, 3), 10);
+  })
+  .add(`RadixTrie ${HUNDRED_THOUSAND.toLocaleString()} getWords`, () => {
+    for (let i = 0; i < randomWords.length; i++) radixTrie.getWords(randomWords[i].slice(0, 3), 10);
+  })
+  .add(`FrozenRadixTrie ${HUNDRED_THOUSAND.toLocaleString()} getWords`, () => {
+    for (let i = 0; i < randomWords.length; i++) frozen.getWords(randomWords[i].slice(0, 3), 10);
+  });
+
+export { suite };
@@ -13,6 +13,20 @@ suite
   })
   .add(`${HUNDRED_THOUSAND.toLocaleString()} getWords`, () => {
     for (let i = 0; i < randomWords.length; i++) trie.getWords(randomWords[i]);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} weighted push`, () => {
+    for (let i = 0; i < randomWords.length; i++) trie.add(randomWords[i], i);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} topK`, () => {
+    for (let i = 0; i < randomWords.length; i++) trie.topK(randomWords[i].slice(0, 2), 10);
+  })
+  .add(`${HUNDRED_THOUSAND.toLocaleString()} wordsWithPrefix first 10`, () => {
+    for (let i = 0; i < randomWords.length; i++) {
+      let count = 0;
+      for (const word of trie.wordsWithPrefix(randomWords[i].slice(0, 2))) {
+        if (word && ++count === 10) break;
+      }
+    }
   });
 
 export { suite };
@@ -2,12 +2,36 @@ import * as Benchmark from 'benchmark';
 import * as path from 'path';
 import * as fs from 'fs';
 import * as fastGlob from 'fast-glob';
-import { Color, numberFix, render } from '../utils';
-import { PerformanceTest } from './types';
+import { performance } from 'perf_hooks';
+import {
+  Color,
+  estimateBigO,
+  flushGcEntries,
+  GcTracker,
+  magnitude,
+  measureLatency,
+  measureRetainedHeap,
+  numberFix,
+  render
+} from '../utils';
+import { LatencyCase, PerformanceTest, Regression, ScalingCase } from './types';
 
-const args = process.argv.slice(2);
+// Words filter the test files; `--name` or `--name=value` flags tune the run:
+// --baseline[=file]     compare with a saved report and exit with 1 on regressions (default benchmark/baseline.json)
+// --threshold=percent   the change that counts as a regression, 10 by default
+// --save-baseline       save this report as the baseline
+// --latency-budget=ms   time spent timing single calls of each benchmark, 1000 by default; 0 turns it off
+// --min-samples=count   the latency samples both reports need before p99 is compared, 500 by default
+const flags = new Map<string, string>();
+const args: string[] = [];
+for (const arg of process.argv.slice(2)) {
+  const match = /^--([^=]+)(?:=(.*))?$/.exec(arg);
+  if (match) flags.set(match[1], match[2] ?? '');
+  else args.push(arg);
+}
 
-const { GREEN, BOLD, END, YELLOW, GRAY, CYAN, BG_YELLOW } = Color;
+const { GREEN, BOLD, END, YELLOW, GRAY, CYAN, BG_YELLOW, RED } = Color;
+const { THOUSAND, TEN_THOUSAND, HUNDRED_THOUSAND } = magnitude;
 
 const getRelativePath = (file: string) => {
   return path.relative(__dirname, file);
@@ -22,6 +46,16 @@ const coloredLabeled = (label: string, file: string) => {
 const parentDirectory = path.resolve(__dirname, '../..');
 const reportDistPath = path.join(parentDirectory, 'benchmark');
 
+const baselinePath = flags.has('baseline')
+  ? path.resolve(flags.get('baseline') || path.join(reportDistPath, 'baseline.json'))
+  : undefined;
+const regressionThreshold = Number(flags.get('threshold') || 10);
+const latencyBudget = flags.has('latency-budget') ? Number(flags.get('latency-budget')) : 1000;
+const minGatedSamples = Number(flags.get('min-samples') || 500);
+const LATENCY_SAMPLES = 1000;
+const OP_LATENCY_SAMPLES = 100000;
+const SCALING_SIZES = [THOUSAND, TEN_THOUSAND, HUNDRED_THOUSAND];
+
 const testDir = path.join(__dirname, 'data-structures');
 const allFiles = fastGlob.sync(path.join(testDir, '**', '*.test.ts'));
 let testFiles: string[];
@@ -50,8 +84,8 @@ const performanceTests: PerformanceTest[] = [];
 testFiles.forEach((file: string) => {
   const testName = path.basename(file, '.test.ts');
   const testFunction = require(file);
-  const { suite } = testFunction;
-  if (suite) performanceTests.push({ testName, suite, file });
+  const { suite, scaling, latency } = testFunction;
+  if (suite) performanceTests.push({ testName, suite, file, scaling, latency });
 });
 
 const composeReport = () => {
@@ -121,6 +155,20 @@ const composeReport = () => {
           }
         ]
       });
+      if (report[r].scaling) {
+        const rows = report[r].scaling.map((item: { [key: string]: any }) => ({
+          'scaling case': item.name,
+          sizes: item.sizes.map((size: number) => size.toLocaleString()).join(' / '),
+          'time (ms)': item['time (ms)'].join(' / '),
+          'bytes per element': item['bytes per element'].join(' / '),
+          'log-log slope': item['log-log slope'],
+          'estimated complexity': item['estimated complexity']
+        }));
+        htmlTables += render(`${report[r].testName} scaling`, rows, { plainHtml: true });
+      }
+      if (report[r].latency) {
+        htmlTables += render(`${report[r].testName} latency per op`, report[r].latency, { plainHtml: true });
+      }
     }
   }
   htmlTables += `
@@ -171,45 +219,199 @@ function replaceMarkdownContent(startMarker: string, endMarker: string, newText:
   });
 }
 
-performanceTests.forEach(item => {
-  const { suite, testName, file } = item;
+/**
+ * Times single calls of a benchmark function and records the heap and garbage collection around them. A call runs
+ * the whole benchmark, so slow benchmarks get few samples; their p99 is reported but kept out of the gate by
+ * `--min-samples`.
+ */
+const profileBenchmark = async (benchmark: Benchmark, gcTracker: GcTracker) => {
+  const fn = (benchmark as unknown as { fn: unknown }).fn;
+  if (latencyBudget <= 0 || typeof fn !== 'function') return {};
+
+  const heapBefore = process.memoryUsage().heapUsed;
+  const start = performance.now();
+  const latency = measureLatency(fn as () => unknown, LATENCY_SAMPLES, latencyBudget);
+  const end = performance.now();
+  const heapAfter = process.memoryUsage().heapUsed;
+  await flushGcEntries();
+  const gc = gcTracker.between(start, end);
+  return {
+    'latency samples': latency.samples,
+    'p50 (ms)': numberFix(latency.p50, 4),
+    'p99 (ms)': numberFix(latency.p99, 4),
+    'p999 (ms)': numberFix(latency.p999, 4),
+    'heap before (MB)': numberFix(heapBefore / 1048576, 2),
+    'heap after (MB)': numberFix(heapAfter / 1048576, 2),
+    'gc count': gc.count,
+    'gc time (ms)': numberFix(gc.duration, 2)
+  };
+};
+
+/**
+ * Times each single operation of a latency case on a fresh structure, after a warm-up run on another one, and
+ * returns the percentiles in microseconds.
+ */
+const measureOpLatency = ({ name, setup, samples = OP_LATENCY_SAMPLES }: LatencyCase) => {
+  const warmUp = setup();
+  for (let i = 0; i < Math.min(samples, 10000); i++) warmUp(i);
+  const latency = measureLatency(setup(), samples, Math.max(latencyBudget, 1));
+  return {
+    name,
+    'latency samples': latency.samples,
+    'p50 (µs)': numberFix(latency.p50 * 1000, 3),
+    'p99 (µs)': numberFix(latency.p99 * 1000, 3),
+    'p999 (µs)': numberFix(latency.p999 * 1000, 3),
+    'max (µs)': numberFix(latency.max * 1000, 3)
+  };
+};
+
+/**
+ * The least-squares slope of log(time) against log(size): about 1 for linear growth, a little above 1 for
+ * n log n and 2 for quadratic.
+ */
+const logLogSlope = (sizes: number[], times: number[]) => {
+  const xs = sizes.map(Math.log);
+  const ys = times.map(time => Math.log(Math.max(time, 1e-6)));
+  const meanX = xs.reduce((sum, x) => sum + x, 0) / xs.length;
+  const meanY = ys.reduce((sum, y) => sum + y, 0) / ys.length;
+  let numerator = 0;
+  let denominator = 0;
+  for (let i = 0; i < xs.length; i++) {
+    numerator += (xs[i] - meanX) * (ys[i] - meanY);
+    denominator += (xs[i] - meanX) ** 2;
+  }
+  return denominator === 0 ? NaN : numerator / denominator;
+};
+
+/**
+ * Builds a scaling case at each size and fits the build times against the usual complexities.
+ */
+const measureScaling = ({ name, build, sizes = SCALING_SIZES }: ScalingCase) => {
+  const times: number[] = [];
+  const bytesPerElement: number[] = [];
+  // Warm up so that the smallest size is not timed while the build is still interpreted
+  for (let i = 0; i < 3; i++) build(sizes[0]);
+  for (const size of sizes) {
+    const { time, bytesPerElement: bytes } = measureRetainedHeap(build, size);
+    times.push(Number(time.toFixed(3)));
+    bytesPerElement.push(Number(bytes.toFixed(1)));
+  }
+  return {
+    name,
+    sizes,
+    'time (ms)': times,
+    'bytes per element': bytesPerElement,
+    'log-log slope': Number(logLogSlope(sizes, times).toFixed(2)),
+    'estimated complexity': estimateBigO(times, sizes)
+  };
+};
+
+/**
+ * Lists the benchmarks that got slower than the baseline by more than the threshold, in executions per second
+ * or in p99 latency. A p99 is only compared when both reports took at least `--min-samples` latency samples, as
+ * the tail of a few samples moves by more than the threshold from run to run.
+ */
+const compareWithBaseline = (baseline: { [key: string]: any }): Regression[] => {
+  const regressions: Regression[] = [];
+  type Row = { [key: string]: any };
+  const enoughSamples = (row: Row) => row['latency samples'] >= minGatedSamples;
+  const check = (testName: string, old: Row, current: Row, metric: string, lowerIsBetter: boolean) => {
+    if (old[metric] === undefined || current[metric] === undefined) return;
+    if (metric.startsWith('p99') && !(enoughSamples(old) && enoughSamples(current))) return;
+    const before = Number(old[metric]);
+    const after = Number(current[metric]);
+    if (!(before > 0) || !Number.isFinite(after)) return;
+    const change = ((after - before) / before) * 100;
+    if ((lowerIsBetter ? change : -change) > regressionThreshold) {
+      const name = current['test name'] ?? current.name;
+      regressions.push({ testName, name, metric, baseline: before, current: after, change: Number(change.toFixed(2)) });
+    }
+  };
+  for (const testName in report) {
+    const previous = baseline[testName];
+    if (!previous) continue;
+    for (const benchmark of report[testName].benchmarks) {
+      const name = benchmark['test name'];
+      const old = previous.benchmarks.find((item: Row) => item['test name'] === name);
+      if (!old) continue;
+      check(testName, old, benchmark, 'executions per sec', false);
+      check(testName, old, benchmark, 'p99 (ms)', true);
+    }
+    for (const item of report[testName].latency ?? []) {
+      const old = previous.latency?.find((row: Row) => row.name === item.name);
+      if (old) check(testName, old, item, 'p99 (µs)', true);
+    }
+  }
+  return regressions;
+};
+
+const gateRegressions = () => {
+  if (!baselinePath) return;
+  if (!fs.existsSync(baselinePath)) {
+    console.log(`${YELLOW}No baseline at ${baselinePath}, nothing to compare${END}`);
+    return;
+  }
+  const regressions = compareWithBaseline(JSON.parse(fs.readFileSync(baselinePath, 'utf8')));
+  if (regressions.length === 0) {
+    console.log(`${GREEN}No regressions beyond ${regressionThreshold}% against ${baselinePath}${END}`);
+    return;
+  }
+  for (const { testName, name, metric, baseline, current, change } of regressions) {
+    console.log(
+      `${RED}Regression${END} ${testName} ${BOLD}${name}${END} ${metric}: ${baseline} -> ${current} (${change}%)`
+    );
+  }
+  process.exitCode = 1;
+};
+
+const runPerformanceTests = async () => {
+  const gcTracker = new GcTracker();
+  for (const item of performanceTests) {
+    const { suite, testName, file, scaling, latency } = item;
 
-  console.log(coloredLabeled('Running', file));
+    console.log(coloredLabeled('Running', file));
 
-  if (suite) {
     let runTime = 0;
-    suite
-      .on('complete', function (this: Benchmark.Suite) {
-        completedCount++;
-        report[testName] = {};
-        report[testName].benchmarks = this.map((benchmark: Benchmark) => {
-          runTime += benchmark.times.elapsed;
-          return {
-            'test name': benchmark.name,
-            'time taken (ms)': numberFix(benchmark.times.period * 1000, 2),
-            'executions per sec': numberFix(benchmark.hz, 2),
-            // 'executed times': numberFix(benchmark.count, 0),
-            // 'sample mean (secs)': numberFix(benchmark.stats.mean, 2),
-            'sample deviation': numberFix(benchmark.stats.deviation, 2)
-          };
-        });
-
-        report[testName].testName = testName;
-        const isDone = completedCount === performanceTests.length;
-        runTime = Number(runTime.toFixed(2));
-        const isTimeWarn = runTime > 120;
-        console.log(
-          // `Files: ${GREEN}${testFileCount}${END} `,
-          // `Suites: ${GREEN}${performanceTests.length}${END} `,
-          `Suites Progress: ${isDone ? GREEN : YELLOW}${completedCount}${END}/${isDone ? GREEN : YELLOW}${
-            performanceTests.length
-          }${END}`,
-          `Time: ${isTimeWarn ? YELLOW : GREEN}${runTime}s${END}`
-        );
-        if (isDone) {
-          composeReport();
-        }
-      })
-      .run({ async: false });
+    suite.run({ async: false });
+    completedCount++;
+    report[testName] = { testName, benchmarks: [] };
+    for (const benchmark of suite.map((benchmark: Benchmark) => benchmark) as Benchmark[]) {
+      runTime += benchmark.times.elapsed;
+      report[testName].benchmarks.push({
+        'test name': benchmark.name,
+        'time taken (ms)': numberFix(benchmark.times.period * 1000, 2),
+        'executions per sec': numberFix(benchmark.hz, 2),
+        // 'executed times': numberFix(benchmark.count, 0),
+        // 'sample mean (secs)': numberFix(benchmark.stats.mean, 2),
+        'sample deviation': numberFix(benchmark.stats.deviation, 2),
+        ...(await profileBenchmark(benchmark, gcTracker))
+      });
+    }
+    if (scaling) report[testName].scaling = scaling.map(measureScaling);
+    if (latency && latencyBudget > 0) report[testName].latency = latency.map(measureOpLatency);
+
+    const isDone = completedCount === performanceTests.length;
+    runTime = Number(runTime.toFixed(2));
+    const isTimeWarn = runTime > 120;
+    console.log(
+      // `Files: ${GREEN}${testFileCount}${END} `,
+      // `Suites: ${GREEN}${performanceTests.length}${END} `,
+      `Suites Progress: ${isDone ? GREEN : YELLOW}${completedCount}${END}/${isDone ? GREEN : YELLOW}${
+        performanceTests.length
+      }${END}`,
+      `Time: ${isTimeWarn ? YELLOW : GREEN}${runTime}s${END}`
+    );
   }
-});
+  gcTracker.disconnect();
+
+  if (performanceTests.length === 0) return;
+  composeReport();
+  gateRegressions();
+  if (flags.has('save-baseline')) {
+    const savePath = baselinePath ?? path.join(reportDistPath, 'baseline.json');
+    fs.writeFileSync(savePath, JSON.stringify(report, null, 2));
+    console.log(`Baseline saved in file://${BOLD}${GREEN}${savePath}${END}`);
+  }
+};
+
+runPerformanceTests();
@@ -1,3 +1,30 @@
 import * as Benchmark from 'benchmark';
 
-export type PerformanceTest = { testName: string; suite: Benchmark.Suite; file: string };
+/**
+ * A structure to build at several sizes. The reportor records the build time and the retained heap per element at
+ * each size, and estimates the growth of the build time.
+ */
+export type ScalingCase = { name: string; build: (n: number) => unknown; sizes?: number[] };
+
+/**
+ * A single operation to time call by call. `setup` returns the operation on a fresh structure; it is called with the
+ * index of each call, so the reportor can take enough samples for stable tail percentiles.
+ */
+export type LatencyCase = { name: string; setup: () => (index: number) => unknown; samples?: number };
+
+export type PerformanceTest = {
+  testName: string;
+  suite: Benchmark.Suite;
+  file: string;
+  scaling?: ScalingCase[];
+  latency?: LatencyCase[];
+};
+
+export type Regression = {
+  testName: string;
+  name: string;
+  metric: string;
+  baseline: number;
+  current: number;
+  change: number;
+};
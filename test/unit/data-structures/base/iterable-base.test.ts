@@ -0,0 +1,128 @@
+import { Deque, HashMap, Heap, LazyIterator, MinHeap, Queue, RedBlackTree, Trie } from '../../../../src';
+
+describe('LazyIterator', () => {
+  it('should fuse filter, map, skip and take in one pass', () => {
+    const deque = new Deque<number>(Array.from({ length: 100 }, (_, i) => i));
+    const seen: number[] = [];
+    const result = deque
+      .lazy()
+      .filter(value => {
+        seen.push(value);
+        return value % 2 === 0;
+      })
+      .map(value => value * 10)
+      .skip(2)
+      .take(3)
+      .toArray();
+    expect(result).toEqual([40, 60, 80]);
+    expect(seen).toEqual([0, 1, 2, 3, 4, 5, 6, 7, 8]);
+  });
+
+  it('should pass each step the index of the values reaching it', () => {
+    const indexes: number[][] = [[], []];
+    new Queue<string>(['a', 'b', 'c', 'd'])
+      .lazy()
+      .filter((value, index) => {
+        indexes[0].push(index);
+        return value !== 'b';
+      })
+      .map((value, index) => {
+        indexes[1].push(index);
+        return value;
+      })
+      .forEach(() => undefined);
+    expect(indexes).toEqual([
+      [0, 1, 2, 3],
+      [0, 1, 2]
+    ]);
+  });
+
+  it('should be reusable and leave the source untouched', () => {
+    const heap = new MinHeap<number>([5, 1, 4, 2, 3]);
+    const evens = heap.lazy().filter(value => value % 2 === 0);
+    expect(evens.count()).toBe(2);
+    expect(evens.map(value => value + 1).toArray().sort()).toEqual([3, 5]);
+    expect(evens.reduce((sum, value) => sum + value, 0)).toBe(6);
+    expect(heap.size).toBe(5);
+  });
+
+  it('should know its length when no step filters', () => {
+    const deque = new Deque<number>([1, 2, 3, 4, 5]);
+    expect(deque.lazy().skip(1).take(3).knownLength).toBe(3);
+    expect(deque.lazy().skip(10).knownLength).toBe(0);
+    expect(deque.lazy().filter(() => true).knownLength).toBeUndefined();
+    expect(new LazyIterator([1, 2, 3]).knownLength).toBeUndefined();
+    expect(deque.lazy().map(value => value * 2).skip(1).take(3).toArray()).toEqual([4, 6, 8]);
+    expect(deque.lazy().take(0).toArray()).toEqual([]);
+    expect(deque.lazy().skip(0.5).take(2.5).knownLength).toBe(2);
+    expect(deque.lazy().skip(0.5).take(2.5).toArray()).toEqual([1, 2]);
+    expect(deque.lazy().first()).toBe(1);
+    expect(deque.lazy().filter(value => value > 9).first()).toBeUndefined();
+  });
+
+  it('should stop reading an endless source once take is full', () => {
+    function* naturals() {
+      let n = 0;
+      while (true) yield n++;
+    }
+    let pulled = 0;
+    const source = {
+      *[Symbol.iterator]() {
+        for (const n of naturals()) {
+          pulled++;
+          yield n;
+        }
+      }
+    };
+    const squares = new LazyIterator<number>(source).map(n => n * n).take(4);
+    expect([...squares]).toEqual([0, 1, 4, 9]);
+    expect(pulled).toBe(4);
+  });
+
+  it('should iterate entries of keyed containers', () => {
+    const map = new HashMap<string, number>([
+      ['a', 1],
+      ['b', 2],
+      ['c', 3]
+    ]);
+    expect(
+      map
+        .lazy()
+        .filter(([, value]) => value > 1)
+        .map(([key]) => key)
+        .toArray()
+    ).toEqual(['b', 'c']);
+
+    const tree = new RedBlackTree<number, string>([
+      [3, 'c'],
+      [1, 'a'],
+      [2, 'b']
+    ]);
+    expect(
+      tree
+        .lazy()
+        .map(([key]) => key)
+        .take(2)
+        .toArray()
+    ).toEqual([1, 2]);
+  });
+
+  it('should collect into other containers', () => {
+    const trie = new Trie(['apple', 'app', 'banana', 'band']);
+    const lengths = trie
+      .lazy()
+      .map(word => word.length)
+      .collectInto(Heap, { comparator: (a: number, b: number) => b - a });
+    expect(lengths.poll()).toBe(6);
+    const deque = trie
+      .lazy()
+      .filter(word => word.startsWith('ban'))
+      .collectInto(Deque);
+    expect(deque.size).toBe(2);
+    const map = new Deque<number>([1, 2, 3])
+      .lazy()
+      .map((value): [number, number] => [value, value * value])
+      .collectInto(HashMap);
+    expect(map.get(3)).toBe(9);
+  });
+});
@@ -1,4 +1,5 @@
 import { AVLTree, AVLTreeNode, BinaryTreeNode, BSTNode, CP, IterationType } from '../../../../src';
+import { getRandomIntArray } from '../../../utils';
 
 describe('AVL Tree Test', () => {
   it('should perform various operations on a AVL Tree', () => {
@@ -45,7 +46,7 @@ describe('AVL Tree Test', () => {
 
     expect(tree.delete(tree.getNode(11))[0].deleted?.key).toBe(11);
     expect(tree.isAVLBalanced()).toBe(true);
-    expect(node15 && tree.getHeight(node15)).toBe(2);
+    expect(node15 && tree.getHeight(node15)).toBe(1);
 
     expect(tree.delete(1)[0].deleted?.key).toBe(1);
     expect(tree.isAVLBalanced()).toBe(true);
@@ -154,7 +155,7 @@ describe('AVL Tree Test recursively', () => {
 
     expect(tree.delete(11)[0].deleted?.key).toBe(11);
     expect(tree.isAVLBalanced()).toBe(true);
-    expect(node15 && tree.getHeight(node15)).toBe(2);
+    expect(node15 && tree.getHeight(node15)).toBe(1);
 
     expect(tree.delete(1)[0].deleted?.key).toBe(1);
     expect(tree.isAVLBalanced()).toBe(true);
@@ -406,3 +407,117 @@ describe('AVLTree iterative methods test', () => {
     expect([...values]).toEqual(['a', 'b', 'c']);
   });
 });
+
+describe('AVLTree buildFromSorted', () => {
+  it('should set heights without rotations', () => {
+    const tree = new AVLTree<number>();
+    tree.buildFromSorted(Array.from({ length: 1000 }, (_, i) => i));
+    expect(tree.isAVLBalanced()).toBe(true);
+    expect(tree.root?.height).toBe(tree.getHeight());
+    expect(tree.getHeight()).toBe(9);
+    const checkHeights = (node: AVLTreeNode<number> | undefined): number => {
+      if (!node) return -1;
+      const height = 1 + Math.max(checkHeights(node.left), checkHeights(node.right));
+      expect(node.height).toBe(height);
+      return height;
+    };
+    checkHeights(tree.root);
+    for (let i = 0; i < 1000; i += 2) tree.delete(i);
+    expect(tree.isAVLBalanced()).toBe(true);
+    expect(tree.size).toBe(500);
+  });
+});
+
+describe('AVLTree order statistics', () => {
+  // Returns the subtree size, throwing when a stored size is stale
+  const checkSizes = (tree: AVLTree<number>, node: AVLTreeNode<number> | undefined): number => {
+    if (!tree.isRealNode(node)) return 0;
+    const size = 1 + checkSizes(tree, node.left) + checkSizes(tree, node.right);
+    if (node.subtreeSize !== size) throw new Error(`stale subtree size at ${node.key}`);
+    return size;
+  };
+
+  it('should keep subtree sizes through rotations', () => {
+    const tree = new AVLTree<number>([], { isOrderStatistic: true });
+    const keys = getRandomIntArray(1000, 0, 500, false);
+    const expected = new Set<number>();
+    for (const key of keys) {
+      tree.add(key);
+      expected.add(key);
+    }
+    checkSizes(tree, tree.root);
+    for (let i = 0; i < keys.length; i += 3) {
+      tree.delete(keys[i]);
+      expected.delete(keys[i]);
+    }
+    expect(checkSizes(tree, tree.root)).toBe(expected.size);
+
+    const sorted = [...expected].sort((a, b) => a - b);
+    for (let i = 0; i < sorted.length; i += 7) {
+      expect(tree.select(i)?.key).toBe(sorted[i]);
+      expect(tree.rank(sorted[i])).toBe(i);
+    }
+    expect(tree.countRange(100, 300)).toBe(sorted.filter(key => key >= 100 && key <= 300).length);
+  });
+
+  it('should carry the option into clones', () => {
+    const tree = new AVLTree<number>([4, 2, 6, 1, 3, 5, 7], { isOrderStatistic: true });
+    const cloned = tree.clone();
+    expect(cloned.isOrderStatistic).toBe(true);
+    cloned.delete(1);
+    expect(cloned.select(0)?.key).toBe(2);
+    expect(tree.select(0)?.key).toBe(1);
+    expect(checkSizes(cloned, cloned.root)).toBe(6);
+  });
+});
+
+describe('AVLTree set operations', () => {
+  // Returns the height of the subtree, throwing when a stored height is stale or the tree is out of balance
+  const checkHeights = (node: AVLTreeNode<number> | undefined): number => {
+    if (!node) return -1;
+    const left = checkHeights(node.left),
+      right = checkHeights(node.right);
+    if (Math.abs(left - right) > 1) throw new Error(`unbalanced at ${node.key}`);
+    if (node.height !== 1 + Math.max(left, right)) throw new Error(`stale height at ${node.key}`);
+    return node.height;
+  };
+
+  it('should split, join and stay balanced', () => {
+    const tree = new AVLTree<number>();
+    tree.buildFromSorted(Array.from({ length: 1000 }, (_, i) => i + 1));
+    const right = tree.split(301);
+    checkHeights(tree.root);
+    checkHeights(right.root);
+    expect(tree.size).toBe(300);
+    expect(right.size).toBe(700);
+    expect(tree.getRightMost()?.key).toBe(300);
+    expect(right.getLeftMost()?.key).toBe(301);
+
+    tree.join(right);
+    checkHeights(tree.root);
+    expect(tree.size).toBe(1000);
+    expect(tree.dfs()).toEqual(Array.from({ length: 1000 }, (_, i) => i + 1));
+  });
+
+  it('should unite, intersect and subtract', () => {
+    const evens = new AVLTree<number>(Array.from({ length: 200 }, (_, i) => (i + 1) * 2));
+    const threes = new AVLTree<number>(Array.from({ length: 100 }, (_, i) => (i + 1) * 3));
+
+    const union = new AVLTree<number>(evens.keys());
+    union.union(threes);
+    checkHeights(union.root);
+    expect(union.size).toBe(200 + 100 - 50);
+
+    const intersection = new AVLTree<number>(evens.keys());
+    intersection.intersection(threes);
+    checkHeights(intersection.root);
+    expect(intersection.dfs()).toEqual(Array.from({ length: 50 }, (_, i) => (i + 1) * 6));
+
+    const difference = new AVLTree<number>(evens.keys());
+    difference.difference(threes);
+    checkHeights(difference.root);
+    expect(difference.size).toBe(200 - 50);
+    expect(difference.has(6)).toBe(false);
+    expect(difference.has(8)).toBe(true);
+  });
+});
@@ -1,4 +1,4 @@
-import { BinaryIndexedTree } from '../../../../src';
+import { BinaryIndexedTree, BinaryIndexedTree2D, RangeBinaryIndexedTree } from '../../../../src';
 // import {isDebugTest} from '../../../config';
 
 // const isDebug = isDebugTest;
@@ -318,3 +318,127 @@ describe('', () => {
     expect(numArray.sumRange(3, 4)).toBe(4);
   });
 });
+
+describe('BinaryIndexedTree dense storage', () => {
+  it('should behave like the sparse storage', () => {
+    for (const storage of ['float64', 'int32'] as const) {
+      const sparse = new BinaryIndexedTree({ frequency: 3, max: 50 });
+      const dense = new BinaryIndexedTree({ frequency: 3, max: 50, storage });
+      expect(dense.tree!.length).toBe(51);
+      expect(sparse.tree).toBeUndefined();
+      for (let i = 0; i < 200; i++) {
+        const index = Math.floor(Math.random() * 50);
+        const freq = Math.floor(Math.random() * 20);
+        if (i % 2) {
+          sparse.writeSingle(index, freq);
+          dense.writeSingle(index, freq);
+        } else {
+          sparse.update(index, freq);
+          dense.update(index, freq);
+        }
+      }
+      for (let i = 0; i < 50; i++) {
+        expect(dense.readSingle(i)).toBe(sparse.readSingle(i));
+        expect(dense.getPrefixSum(i)).toBe(sparse.getPrefixSum(i));
+      }
+      expect(dense.read(50)).toBe(sparse.read(50));
+      const total = dense.read(50);
+      for (const sum of [0, 1, total >> 1, total - 1, total, total + 5]) {
+        expect(dense.lowerBound(sum)).toBe(sparse.lowerBound(sum));
+        expect(dense.upperBound(sum)).toBe(sparse.upperBound(sum));
+      }
+    }
+  });
+
+  it('should build from an array in linear time', () => {
+    const values = Array.from({ length: 37 }, () => Math.floor(Math.random() * 10));
+    const bit = BinaryIndexedTree.fromArray(values);
+    const updated = new BinaryIndexedTree({ max: values.length, storage: 'float64' });
+    values.forEach((value, i) => updated.update(i, value));
+    expect([...bit.tree!]).toEqual([...updated.tree!]);
+    let sum = 0;
+    for (let i = 0; i < values.length; i++) {
+      sum += values[i];
+      expect(bit.getPrefixSum(i)).toBe(sum);
+    }
+    expect(BinaryIndexedTree.fromArray([1, -2, 3], 'int32').negativeCount).toBe(1);
+  });
+});
+
+describe('RangeBinaryIndexedTree', () => {
+  it('should add to ranges and sum ranges', () => {
+    const bit = new RangeBinaryIndexedTree([1, 2, 3, 4, 5]);
+    expect(bit.size).toBe(5);
+    expect(bit.query(0, 4)).toBe(15);
+    bit.addRange(1, 3, 10);
+    expect(bit.query(0, 4)).toBe(45);
+    expect(bit.query(2, 2)).toBe(13);
+    expect(bit.get(4)).toBe(5);
+    bit.add(4, -5);
+    expect(bit.query(3, 4)).toBe(14);
+    expect(bit.query(3, 2)).toBe(0);
+    expect(() => bit.addRange(3, 5, 1)).toThrow('Index out of range');
+  });
+
+  it('should agree with a plain array', () => {
+    const n = 41;
+    const values = new Array<number>(n).fill(0);
+    const bit = new RangeBinaryIndexedTree(n);
+    for (let round = 0; round < 1000; round++) {
+      const a = Math.floor(Math.random() * n),
+        b = Math.floor(Math.random() * n);
+      const start = Math.min(a, b),
+        end = Math.max(a, b);
+      if (round % 2) {
+        const delta = Math.floor(Math.random() * 21) - 10;
+        bit.addRange(start, end, delta);
+        for (let i = start; i <= end; i++) values[i] += delta;
+      } else {
+        expect(bit.query(start, end)).toBe(values.slice(start, end + 1).reduce((x, y) => x + y, 0));
+      }
+    }
+    expect(Array.from({ length: n }, (_, i) => bit.get(i))).toEqual(values);
+    const rebuilt = new RangeBinaryIndexedTree(values);
+    expect(rebuilt.query(0, n - 1)).toBe(bit.query(0, n - 1));
+  });
+});
+
+describe('BinaryIndexedTree2D', () => {
+  it('should count cells and sum rectangles', () => {
+    const heatmap = new BinaryIndexedTree2D(4, 5, 'int32');
+    heatmap.update(0, 0, 1);
+    heatmap.update(1, 2, 5);
+    heatmap.update(3, 4, 2);
+    heatmap.update(1, 2, 1);
+    expect(heatmap.get(1, 2)).toBe(6);
+    expect(heatmap.prefixSum(1, 2)).toBe(7);
+    expect(heatmap.query(1, 1, 3, 4)).toBe(8);
+    expect(heatmap.query(2, 0, 3, 3)).toBe(0);
+    expect(heatmap.prefixSum(-1, 4)).toBe(0);
+    expect(() => heatmap.update(4, 0, 1)).toThrow('Index out of range');
+  });
+
+  it('should agree with a plain grid', () => {
+    const rows = 9,
+      cols = 13;
+    const grid = Array.from({ length: rows }, () => Array.from({ length: cols }, () => Math.floor(Math.random() * 5)));
+    const bit = BinaryIndexedTree2D.fromArray(grid);
+    for (let round = 0; round < 300; round++) {
+      const row = Math.floor(Math.random() * rows),
+        col = Math.floor(Math.random() * cols);
+      const delta = Math.floor(Math.random() * 7) - 3;
+      bit.update(row, col, delta);
+      grid[row][col] += delta;
+
+      const r1 = Math.floor(Math.random() * rows),
+        r2 = Math.floor(Math.random() * rows);
+      const c1 = Math.floor(Math.random() * cols),
+        c2 = Math.floor(Math.random() * cols);
+      let expected = 0;
+      for (let i = Math.min(r1, r2); i <= Math.max(r1, r2); i++) {
+        for (let j = Math.min(c1, c2); j <= Math.max(c1, c2); j++) expected += grid[i][j];
+      }
+      expect(bit.query(Math.min(r1, r2), Math.min(c1, c2), Math.max(r1, r2), Math.max(c1, c2))).toBe(expected);
+    }
+  });
+});
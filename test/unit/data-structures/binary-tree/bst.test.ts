@@ -290,7 +290,7 @@ describe('BST operations test', () => {
 
     expect(objBST.isAVLBalanced()).toBe(true);
 
-    expect(node15 && objBST.getHeight(node15)).toBe(2);
+    expect(node15 && objBST.getHeight(node15)).toBe(1);
 
     const removed1 = objBST.delete(1);
     expect(removed1).toBeInstanceOf(Array);
@@ -678,7 +678,7 @@ describe('BST operations test recursively', () => {
 
     expect(objBST.isAVLBalanced()).toBe(true);
 
-    expect(node15 && objBST.getHeight(node15)).toBe(2);
+    expect(node15 && objBST.getHeight(node15)).toBe(1);
 
     const removed1 = objBST.delete(1);
     expect(removed1).toBeInstanceOf(Array);
@@ -875,6 +875,203 @@ describe('BST isBST', function () {
   });
 });
 
+describe('BST comparator', () => {
+  it('should order keys with a custom comparator', () => {
+    const bst = new BST<string, number>([], { comparator: (a, b) => a.localeCompare(b) });
+    bst.addMany([
+      ['banana', 2],
+      ['apple', 1],
+      ['cherry', 3]
+    ]);
+    expect([...bst.keys()]).toEqual(['apple', 'banana', 'cherry']);
+    expect(bst.getNode('cherry')?.value).toBe(3);
+    expect(bst.has('durian')).toBe(false);
+  });
+
+  it('should combine a custom comparator with the INVERSE variant', () => {
+    const bst = new BST<number>([3, 1, 2], { comparator: (a, b) => a - b, variant: BSTVariant.INVERSE });
+    expect(bst.dfs()).toEqual([3, 2, 1]);
+    expect(bst.lesserOrGreaterTraverse(node => node.key, CP.gt, 2)).toEqual([1]);
+  });
+
+  it('should fall back to the extractor when no comparator is given', () => {
+    const [a, b, c] = [{ id: 3 }, { id: 1 }, { id: 2 }];
+    const bst = new BST<{ id: number }>([a, b, c], { extractor: key => key.id });
+    expect([...bst.keys()]).toEqual([b, c, a]);
+    expect(bst.comparator(b, a)).toBeLessThan(0);
+  });
+
+  it('should pass the comparator on to created trees', () => {
+    const bst = new BST<number>([5, 3, 8], { comparator: (a, b) => b - a });
+    expect(bst.createTree().comparator).toBe(bst.comparator);
+    expect([...bst.clone().keys()]).toEqual([8, 5, 3]);
+  });
+});
+
+describe('BST buildFromSorted', () => {
+  it('should link sorted entries into a perfectly balanced tree', () => {
+    const bst = new BST<number, string>();
+    bst.add(100);
+    const keys = Array.from({ length: 100 }, (_, i) => i);
+    expect(bst.buildFromSorted(keys.map(key => [key, `${key}`]))).toBe(100);
+    expect(bst.has(100)).toBe(false);
+    expect(bst.isPerfectlyBalanced()).toBe(true);
+    expect(bst.isBST()).toBe(true);
+    expect(bst.root?.parent).toBe(undefined);
+    expect(bst.dfs()).toEqual(keys);
+    expect(bst.getNode(42)?.value).toBe('42');
+    bst.add(-1);
+    expect(bst.getLeftMost()?.key).toBe(-1);
+  });
+
+  it('should pair values and follow the variant order', () => {
+    const bst = new BST<number, string>([], { variant: BSTVariant.INVERSE });
+    bst.buildFromSorted([3, 2, 1], ['c', 'b', 'a']);
+    expect([...bst]).toEqual([
+      [3, 'c'],
+      [2, 'b'],
+      [1, 'a']
+    ]);
+    expect(() => bst.buildFromSorted([1, 2, 3])).toThrow();
+    expect(() => bst.buildFromSorted([3, 3])).toThrow();
+    expect(bst.size).toBe(3);
+  });
+
+  it('should rebalance in place and keep node references', () => {
+    const bst = new BST<number>();
+    for (let i = 0; i < 10; i++) bst.add(i);
+    const node7 = bst.getNode(7);
+    expect(bst.perfectlyBalance()).toBe(true);
+    expect(bst.getNode(7)).toBe(node7);
+    expect(bst.getHeight()).toBe(3);
+    expect(bst.dfs()).toEqual([0, 1, 2, 3, 4, 5, 6, 7, 8, 9]);
+    expect(new BST<number>().perfectlyBalance()).toBe(false);
+  });
+});
+
+describe('BST order statistics', () => {
+  it('should rank, select and count ranges', () => {
+    const bst = new BST<number>([], { isOrderStatistic: true });
+    bst.addMany([11, 3, 15, 1, 8, 13, 16, 2, 6, 9, 12, 14, 4, 7, 10, 5], undefined, false);
+    expect(bst.isOrderStatistic).toBe(true);
+    expect(bst.root?.subtreeSize).toBe(16);
+    expect(bst.rank(1)).toBe(0);
+    expect(bst.rank(8)).toBe(7);
+    expect(bst.rank(100)).toBe(16);
+    expect(bst.rank(8.5)).toBe(8);
+    expect(bst.select(0)?.key).toBe(1);
+    expect(bst.select(7)?.key).toBe(8);
+    expect(bst.select(15)?.key).toBe(16);
+    expect(bst.select(16)).toBe(undefined);
+    expect(bst.select(-1)).toBe(undefined);
+    expect(bst.countRange(4, 10)).toBe(7);
+    expect(bst.countRange(4.5, 9.5)).toBe(5);
+    expect(bst.countRange(10, 4)).toBe(0);
+
+    bst.delete(8);
+    bst.delete(11);
+    expect(bst.root?.subtreeSize).toBe(14);
+    expect(bst.rank(9)).toBe(7);
+    expect(bst.select(7)?.key).toBe(9);
+    expect(bst.countRange(4, 10)).toBe(6);
+    expect(bst.clone().select(7)?.key).toBe(9);
+  });
+
+  it('should answer the same without the augmentation', () => {
+    const keys = [5, 2, 9, 1, 7, 3, 8];
+    const plain = new BST<number>(keys);
+    const augmented = new BST<number>(keys, { isOrderStatistic: true });
+    for (let i = 0; i <= 10; i++) {
+      expect(plain.rank(i)).toBe(augmented.rank(i));
+      expect(plain.select(i)?.key).toBe(augmented.select(i)?.key);
+      expect(plain.countRange(i, i + 3)).toBe(augmented.countRange(i, i + 3));
+    }
+  });
+
+  it('should follow the variant order', () => {
+    const bst = new BST<number>([1, 2, 3, 4, 5], { variant: BSTVariant.INVERSE, isOrderStatistic: true });
+    expect(bst.select(0)?.key).toBe(5);
+    expect(bst.rank(2)).toBe(3);
+    expect(bst.countRange(4, 2)).toBe(3);
+  });
+
+  it('should keep sizes after buildFromSorted and perfectlyBalance', () => {
+    const bst = new BST<number>([], { isOrderStatistic: true });
+    bst.buildFromSorted(Array.from({ length: 20 }, (_, i) => i));
+    expect(bst.root?.subtreeSize).toBe(20);
+    expect(bst.select(13)?.key).toBe(13);
+    bst.add(20);
+    bst.perfectlyBalance();
+    expect(bst.rank(20)).toBe(20);
+    expect(bst.select(20)?.key).toBe(20);
+  });
+});
+
+describe('BST range queries', () => {
+  const keys = [11, 3, 15, 1, 8, 13, 16, 2, 6, 9, 12, 14, 4, 7, 10, 5];
+  let bst: BST<number, string>;
+
+  beforeEach(() => {
+    bst = new BST<number, string>();
+    for (const key of keys) bst.add(key, `${key}`);
+  });
+
+  it('should iterate a range lazily in both directions', () => {
+    expect([...bst.rangeIterator(4, 9)]).toEqual([4, 5, 6, 7, 8, 9]);
+    expect([...bst.rangeIterator(4, 9, { inclusive: false })]).toEqual([5, 6, 7, 8]);
+    expect([...bst.rangeIterator(4, 9, { reverse: true })]).toEqual([9, 8, 7, 6, 5, 4]);
+    expect([...bst.rangeIterator(3.5, 6.5)]).toEqual([4, 5, 6]);
+    expect([...bst.rangeIterator(undefined, 3)]).toEqual([1, 2, 3]);
+    expect([...bst.rangeIterator(14, undefined)]).toEqual([14, 15, 16]);
+    expect([...bst.rangeIterator(9, 4)]).toEqual([]);
+    expect([...bst.rangeIterator(4, 6, {}, node => node.value)]).toEqual(['4', '5', '6']);
+    expect([...new BST<number>().rangeIterator(undefined, undefined)]).toEqual([]);
+  });
+
+  it('should stop without walking the rest of the range', () => {
+    const visited: number[] = [];
+    for (const key of bst.rangeIterator(2, undefined, undefined, node => (visited.push(node.key), node.key))) {
+      if (key === 4) break;
+    }
+    expect(visited).toEqual([2, 3, 4]);
+  });
+
+  it('should navigate to the closest keys', () => {
+    expect(bst.ceiling(8)?.key).toBe(8);
+    expect(bst.ceiling(8.5)?.key).toBe(9);
+    expect(bst.higher(8)?.key).toBe(9);
+    expect(bst.floor(8)?.key).toBe(8);
+    expect(bst.floor(8.5)?.key).toBe(8);
+    expect(bst.lower(8)?.key).toBe(7);
+    expect(bst.ceiling(17)).toBe(undefined);
+    expect(bst.higher(16)).toBe(undefined);
+    expect(bst.floor(0)).toBe(undefined);
+    expect(bst.lower(1)).toBe(undefined);
+  });
+
+  it('should page through keys with keysFrom', () => {
+    const page = (from: number) => {
+      const result: number[] = [];
+      for (const key of bst.keysFrom(from)) {
+        result.push(key);
+        if (result.length === 5) break;
+      }
+      return result;
+    };
+    expect(page(1)).toEqual([1, 2, 3, 4, 5]);
+    expect(page(5.5)).toEqual([6, 7, 8, 9, 10]);
+    expect(page(14)).toEqual([14, 15, 16]);
+    expect([...bst.keysFrom(3, true)]).toEqual([3, 2, 1]);
+  });
+
+  it('should follow the variant order', () => {
+    const inverse = new BST<number>(keys, { variant: BSTVariant.INVERSE });
+    expect([...inverse.rangeIterator(9, 4)]).toEqual([9, 8, 7, 6, 5, 4]);
+    expect(inverse.ceiling(8.5)?.key).toBe(8);
+    expect(inverse.lower(8)?.key).toBe(9);
+  });
+});
+
 describe('BST Performance test', function () {
   const bst = new BST<number, number>();
   const inputSize = 10000; // Adjust input sizes as needed
@@ -0,0 +1,140 @@
+import { CompactRBTree, CP, RBTNColor } from '../../../../src';
+import { getRandomIntArray } from '../../../utils';
+
+// Returns the black height of the subtree, throwing when a red-black or search-tree invariant is broken
+const checkRBInvariants = (tree: CompactRBTree, node: number = tree.root, lo = -Infinity, hi = Infinity): number => {
+  if (!tree.isRealNode(node)) return 1;
+  const key = tree.getKey(node);
+  if (key <= lo || key >= hi) throw new Error(`key ${key} out of order`);
+  const left = tree.getLeft(node),
+    right = tree.getRight(node);
+  if (tree.isRealNode(left) && tree.getParent(left) !== node) throw new Error(`broken parent link at ${key}`);
+  if (tree.isRealNode(right) && tree.getParent(right) !== node) throw new Error(`broken parent link at ${key}`);
+  if (tree.getColor(node) === RBTNColor.RED) {
+    if (tree.getColor(left) === RBTNColor.RED || tree.getColor(right) === RBTNColor.RED) {
+      throw new Error(`red node ${key} has a red child`);
+    }
+  }
+  const leftHeight = checkRBInvariants(tree, left, lo, key);
+  const rightHeight = checkRBInvariants(tree, right, key, hi);
+  if (leftHeight !== rightHeight) throw new Error(`black height mismatch at ${key}`);
+  return leftHeight + (tree.getColor(node) === RBTNColor.BLACK ? 1 : 0);
+};
+
+describe('CompactRBTree', () => {
+  let tree: CompactRBTree<string>;
+
+  beforeEach(() => {
+    tree = new CompactRBTree<string>();
+  });
+
+  it('should add and get entries', () => {
+    expect(tree.add(10, 'a')).toBe(true);
+    expect(tree.add([5, 'b'])).toBe(true);
+    expect(tree.add(20)).toBe(true);
+    expect(tree.size).toBe(3);
+    expect(tree.get(5)).toBe('b');
+    expect(tree.has(20)).toBe(true);
+    expect(tree.has(15)).toBe(false);
+    expect(tree.getNode(15)).toBe(undefined);
+
+    const node = tree.getNode(10)!;
+    expect(tree.getKey(node)).toBe(10);
+    expect(tree.getValue(node)).toBe('a');
+    expect(tree.getColor(tree.root)).toBe(RBTNColor.BLACK);
+  });
+
+  it('should replace the value of an existing key', () => {
+    tree.add(1, 'a');
+    expect(tree.add(1, 'b')).toBe(false);
+    expect(tree.size).toBe(1);
+    expect(tree.get(1)).toBe('b');
+    expect(tree.add(NaN)).toBe(false);
+  });
+
+  it('should delete keys, including 0', () => {
+    tree.addMany([3, 0, -1, 2, 1]);
+    expect(tree.delete(0)).toBe(true);
+    expect(tree.delete(0)).toBe(false);
+    expect(tree.size).toBe(4);
+    expect(tree.dfs()).toEqual([-1, 1, 2, 3]);
+    checkRBInvariants(tree);
+  });
+
+  it('should recycle deleted slots instead of growing', () => {
+    const compact = new CompactRBTree<number>([], { initialCapacity: 8 });
+    for (let i = 0; i < 8; i++) compact.add(i, i);
+    expect(compact.capacity).toBe(8);
+    for (let i = 0; i < 4; i++) compact.delete(i);
+    for (let i = 100; i < 104; i++) compact.add(i, i);
+    expect(compact.capacity).toBe(8);
+    compact.add(200);
+    expect(compact.capacity).toBe(16);
+    expect([...compact.keys()]).toEqual([4, 5, 6, 7, 100, 101, 102, 103, 200]);
+    expect(compact.get(101)).toBe(101);
+  });
+
+  it('should keep the red-black invariants under random adds and deletes', () => {
+    const compact = new CompactRBTree<number>();
+    const keys = getRandomIntArray(2000, 0, 1000, false);
+    const expected = new Set<number>();
+    for (const key of keys) {
+      compact.add(key, key);
+      expected.add(key);
+    }
+    checkRBInvariants(compact);
+    for (let i = 0; i < keys.length; i += 2) {
+      expect(compact.delete(keys[i])).toBe(expected.delete(keys[i]));
+    }
+    checkRBInvariants(compact);
+    expect(compact.size).toBe(expected.size);
+    expect(compact.dfs()).toEqual([...expected].sort((a, b) => a - b));
+  });
+
+  it('should traverse in pre, in and post order', () => {
+    tree.addMany([4, 2, 6, 1, 3, 5, 7]);
+    expect(tree.dfs(key => key, 'in')).toEqual([1, 2, 3, 4, 5, 6, 7]);
+    expect(tree.dfs(key => key, 'pre')).toEqual([4, 2, 1, 3, 6, 5, 7]);
+    expect(tree.dfs(key => key, 'post')).toEqual([1, 3, 2, 5, 7, 6, 4]);
+    expect(tree.dfs(key => key, 'in', tree.getNode(6)!)).toEqual([5, 6, 7]);
+  });
+
+  it('should traverse lesser or greater keys', () => {
+    tree.addMany([8, 3, 10, 1, 6, 14, 4, 7, 13]);
+    expect(tree.lesserOrGreaterTraverse(key => key, CP.lt, 7)).toEqual([1, 3, 4, 6]);
+    expect(tree.lesserOrGreaterTraverse(key => key, CP.gt, 7)).toEqual([8, 10, 13, 14]);
+    expect(tree.lesserOrGreaterTraverse(key => key, CP.eq, 6)).toEqual([6]);
+    expect(tree.lesserOrGreaterTraverse(key => key, CP.lt, 0)).toEqual([]);
+  });
+
+  it('should clone, map and filter', () => {
+    tree.addMany([
+      [2, 'b'],
+      [1, 'a'],
+      [3, 'c']
+    ]);
+    const cloned = tree.clone();
+    cloned.delete(1);
+    expect(tree.has(1)).toBe(true);
+    expect([...cloned]).toEqual([
+      [2, 'b'],
+      [3, 'c']
+    ]);
+
+    const mapped = tree.map((value, key) => `${value}${key}`);
+    expect([...mapped.values()]).toEqual(['a1', 'b2', 'c3']);
+    checkRBInvariants(mapped);
+
+    const filtered = tree.filter((value, key) => key > 1);
+    expect([...filtered.keys()]).toEqual([2, 3]);
+  });
+
+  it('should clear and be reusable', () => {
+    tree.addMany([1, 2, 3]);
+    tree.clear();
+    expect(tree.isEmpty()).toBe(true);
+    expect(tree.dfs()).toEqual([]);
+    tree.add(5, 'e');
+    expect([...tree]).toEqual([[5, 'e']]);
+  });
+});
@@ -0,0 +1,125 @@
+import { LazySegmentTree } from '../../../../src';
+
+describe('LazySegmentTree', () => {
+  it('should answer sum queries with range add and assign', () => {
+    const tree = new LazySegmentTree([1, 2, 3, 4, 5]);
+    expect(tree.length).toBe(5);
+    expect(tree.all()).toBe(15);
+    expect(tree.query(1, 3)).toBe(9);
+    expect(tree.query(2, 1)).toBe(0);
+    tree.addRange(0, 4, 10);
+    expect(tree.query(1, 3)).toBe(39);
+    tree.assignRange(2, 3, 1);
+    expect([...tree.toArray()]).toEqual([11, 12, 1, 1, 15]);
+    tree.addRange(1, 2, -1);
+    expect(tree.get(2)).toBe(0);
+    tree.set(4, 0);
+    expect(tree.all()).toBe(23);
+    expect(() => tree.query(0, 5)).toThrow(RangeError);
+    expect(() => tree.get(-1)).toThrow(RangeError);
+  });
+
+  it('should support min, max and gcd monoids', () => {
+    const min = new LazySegmentTree([5, 3, 8, 6], { monoid: LazySegmentTree.MIN });
+    expect(min.query(0, 3)).toBe(3);
+    min.addRange(1, 1, 10);
+    expect(min.query(0, 3)).toBe(5);
+    min.assignRange(2, 3, -1);
+    expect(min.query(0, 1)).toBe(5);
+    expect(min.all()).toBe(-1);
+
+    const max = new LazySegmentTree([5, 3, 8, 6], { monoid: LazySegmentTree.MAX });
+    max.addRange(0, 1, 4);
+    expect(max.query(0, 1)).toBe(9);
+    expect(max.all()).toBe(9);
+
+    const gcd = new LazySegmentTree([12, 18, 24, 36], { monoid: LazySegmentTree.GCD });
+    expect(gcd.all()).toBe(6);
+    expect(gcd.query(2, 3)).toBe(12);
+    gcd.assignRange(0, 0, 8);
+    expect(gcd.all()).toBe(2);
+    expect(() => gcd.addRange(0, 1, 1)).toThrow('The monoid does not support range add.');
+  });
+
+  it('should find range ends with maxRight and minLeft', () => {
+    const tree = new LazySegmentTree([3, 1, 4, 1, 5, 9, 2, 6]);
+    expect(tree.maxRight(0, sum => sum <= 8)).toBe(2);
+    expect(tree.maxRight(0, sum => sum <= 2)).toBe(-1);
+    expect(tree.maxRight(3, sum => sum <= 100)).toBe(7);
+    expect(tree.maxRight(8, sum => sum <= 0)).toBe(7);
+    expect(tree.minLeft(7, sum => sum <= 17)).toBe(5);
+    expect(tree.minLeft(7, sum => sum <= 5)).toBe(8);
+    expect(tree.minLeft(2, sum => sum <= 100)).toBe(0);
+    expect(tree.minLeft(-1, sum => sum <= 0)).toBe(0);
+    tree.assignRange(0, 7, 1);
+    expect(tree.maxRight(2, sum => sum <= 3)).toBe(4);
+    expect(tree.minLeft(6, sum => sum < 4)).toBe(4);
+  });
+
+  it('should agree with a plain array under random operations', () => {
+    for (const [monoid, reduce, hasAdd] of [
+      [LazySegmentTree.SUM, (values: number[]) => values.reduce((a, b) => a + b, 0), true],
+      [LazySegmentTree.MIN, (values: number[]) => Math.min(...values), true],
+      [LazySegmentTree.MAX, (values: number[]) => Math.max(...values), true]
+    ] as const) {
+      const n = 37;
+      const values = Array.from({ length: n }, () => Math.floor(Math.random() * 100));
+      const tree = new LazySegmentTree(values, { monoid });
+      for (let round = 0; round < 2000; round++) {
+        const a = Math.floor(Math.random() * n);
+        const b = Math.floor(Math.random() * n);
+        const start = Math.min(a, b),
+          end = Math.max(a, b);
+        const value = Math.floor(Math.random() * 21) - 10;
+        const kind = Math.floor(Math.random() * 4);
+        if (kind === 0 && hasAdd) {
+          tree.addRange(start, end, value);
+          for (let i = start; i <= end; i++) values[i] += value;
+        } else if (kind === 1) {
+          tree.assignRange(start, end, value);
+          for (let i = start; i <= end; i++) values[i] = value;
+        } else if (kind === 2) {
+          tree.set(a, value);
+          values[a] = value;
+        } else {
+          expect(tree.query(start, end)).toBe(reduce(values.slice(start, end + 1)));
+        }
+      }
+      expect([...tree.toArray()]).toEqual(values);
+    }
+  });
+
+  it('should agree with a linear scan in maxRight and minLeft', () => {
+    const n = 50;
+    const values = Array.from({ length: n }, () => Math.floor(Math.random() * 10));
+    const tree = new LazySegmentTree(values);
+    tree.addRange(10, 30, 2);
+    for (let i = 10; i <= 30; i++) values[i] += 2;
+    for (let round = 0; round < 200; round++) {
+      const limit = Math.floor(Math.random() * 120);
+      const start = Math.floor(Math.random() * (n + 1));
+      let end = start - 1,
+        sum = 0;
+      while (end + 1 < n && sum + values[end + 1] <= limit) sum += values[++end];
+      expect(tree.maxRight(start, s => s <= limit)).toBe(end);
+
+      const last = Math.floor(Math.random() * n);
+      let first = last + 1;
+      sum = 0;
+      while (first - 1 >= 0 && sum + values[first - 1] <= limit) sum += values[--first];
+      expect(tree.minLeft(last, s => s <= limit)).toBe(first);
+    }
+  });
+
+  it('should handle an empty tree and clone', () => {
+    const empty = new LazySegmentTree();
+    expect(empty.all()).toBe(0);
+    expect(empty.query(0, -1)).toBe(0);
+    const tree = new LazySegmentTree(new Float64Array(10));
+    tree.addRange(0, 9, 1);
+    const cloned = tree.clone();
+    tree.addRange(0, 9, 1);
+    expect(cloned.all()).toBe(10);
+    expect(tree.all()).toBe(20);
+  });
+});
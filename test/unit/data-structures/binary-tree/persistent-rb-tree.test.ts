@@ -0,0 +1,95 @@
+import { PersistentRBTree, PersistentRBTreeNode, RBTNColor } from '../../../../src';
+
+const blackHeight = (node: PersistentRBTreeNode<number, number> | undefined, lo: number, hi: number): number => {
+  if (!node) return 1;
+  expect(node.key > lo && node.key < hi).toBe(true);
+  expect(node.right?.color === RBTNColor.RED).toBe(false);
+  if (node.color === RBTNColor.RED) expect(node.left?.color === RBTNColor.RED).toBe(false);
+  const left = blackHeight(node.left, lo, node.key);
+  expect(blackHeight(node.right, node.key, hi)).toBe(left);
+  return left + (node.color === RBTNColor.BLACK ? 1 : 0);
+};
+
+describe('PersistentRBTree', () => {
+  it('should set, get and delete like a sorted map', () => {
+    const tree = new PersistentRBTree<number, string>([
+      [5, 'e'],
+      [1, 'a'],
+      [3, 'c']
+    ]);
+    tree.set(4, 'd');
+    tree.set(3, 'C');
+    expect(tree.size).toBe(4);
+    expect([...tree.keys()]).toEqual([1, 3, 4, 5]);
+    expect(tree.get(3)).toBe('C');
+    expect(tree.has(2)).toBe(false);
+    expect(tree.firstKey()).toBe(1);
+    expect(tree.lastKey()).toBe(5);
+    expect(tree.delete(2)).toBe(false);
+    expect(tree.delete(1)).toBe(true);
+    expect([...tree]).toEqual([
+      [3, 'C'],
+      [4, 'd'],
+      [5, 'e']
+    ]);
+    tree.clear();
+    expect(tree.isEmpty()).toBe(true);
+    expect(tree.firstKey()).toBeUndefined();
+  });
+
+  it('should keep snapshots unchanged and share unchanged nodes', () => {
+    const tree = new PersistentRBTree<number, number>();
+    for (let i = 0; i < 1000; i++) tree.set(i, i);
+    const snapshot = tree.snapshot();
+    expect(snapshot.root).toBe(tree.root);
+
+    tree.set(1000, 1000);
+    tree.delete(0);
+    tree.set(500, -1);
+    expect(snapshot.size).toBe(1000);
+    expect(snapshot.get(0)).toBe(0);
+    expect(snapshot.get(500)).toBe(500);
+    expect(snapshot.has(1000)).toBe(false);
+    expect(tree.get(500)).toBe(-1);
+
+    snapshot.set(2000, 2000);
+    expect(tree.has(2000)).toBe(false);
+    expect(tree.clone().size).toBe(tree.size);
+  });
+
+  it('should stay balanced and agree with a Map under random operations', () => {
+    const tree = new PersistentRBTree<number, number>();
+    const model = new Map<number, number>();
+    const versions: [PersistentRBTree<number, number>, [number, number][]][] = [];
+    for (let i = 0; i < 5000; i++) {
+      const key = Math.floor(Math.random() * 500);
+      if (Math.random() < 0.6) {
+        tree.set(key, i);
+        model.set(key, i);
+      } else {
+        expect(tree.delete(key)).toBe(model.delete(key));
+      }
+      if (i % 250 === 0) versions.push([tree.snapshot(), [...model].sort((a, b) => a[0] - b[0])]);
+    }
+    blackHeight(tree.root, -Infinity, Infinity);
+    expect(tree.size).toBe(model.size);
+    for (const [version, entries] of versions) {
+      blackHeight(version.root, -Infinity, Infinity);
+      expect([...version]).toEqual(entries);
+    }
+  });
+
+  it('should order keys with a comparator and keep it in derived trees', () => {
+    const tree = new PersistentRBTree<string, number>([], { comparator: (a, b) => b.localeCompare(a) });
+    for (const word of ['pear', 'apple', 'fig']) tree.set(word, word.length);
+    expect([...tree.keys()]).toEqual(['pear', 'fig', 'apple']);
+    const long = tree.filter(value => value! > 3);
+    expect([...long.keys()]).toEqual(['pear', 'apple']);
+    const doubled = tree.map(value => value! * 2);
+    expect([...doubled]).toEqual([
+      ['pear', 8],
+      ['fig', 6],
+      ['apple', 10]
+    ]);
+  });
+});
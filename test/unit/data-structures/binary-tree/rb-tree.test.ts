@@ -177,6 +177,129 @@ describe('RedBlackTree', () => {
   });
 });
 
+describe('RedBlackTree comparator', () => {
+  it('should keep a custom order for add, getNode and delete', () => {
+    const tree = new RedBlackTree<number>([], { comparator: (a, b) => b - a });
+    tree.addMany([1, 5, 3, 4, 2]);
+    expect([...tree.keys()]).toEqual([5, 4, 3, 2, 1]);
+    expect(tree.getNode(4)?.key).toBe(4);
+    tree.delete(4);
+    expect(tree.getNode(4)).toBe(undefined);
+    expect([...tree.keys()]).toEqual([5, 3, 2, 1]);
+  });
+
+  it('should delete the zero key', () => {
+    const tree = new RedBlackTree<number>([2, 0, 1, -1]);
+    tree.delete(0);
+    expect([...tree.keys()]).toEqual([-1, 1, 2]);
+  });
+});
+
+describe('RedBlackTree buildFromSorted', () => {
+  // Returns the black height of the subtree, throwing when a red-black invariant is broken
+  const blackHeight = (tree: RedBlackTree<number>, node: RedBlackTreeNode<number> = tree.root): number => {
+    if (!tree.isRealNode(node)) return 1;
+    if (node.color === RBTNColor.RED && (node.left?.color === RBTNColor.RED || node.right?.color === RBTNColor.RED)) {
+      throw new Error(`red node ${node.key} has a red child`);
+    }
+    const left = blackHeight(tree, node.left),
+      right = blackHeight(tree, node.right);
+    if (left !== right) throw new Error(`black height mismatch at ${node.key}`);
+    return left + (node.color === RBTNColor.BLACK ? 1 : 0);
+  };
+
+  it('should color a linked tree validly for every size', () => {
+    for (let n = 0; n <= 64; n++) {
+      const tree = new RedBlackTree<number>();
+      tree.buildFromSorted(Array.from({ length: n }, (_, i) => i));
+      expect(tree.size).toBe(n);
+      expect(tree.root.color).toBe(RBTNColor.BLACK);
+      blackHeight(tree);
+      expect(tree.dfs()).toEqual(Array.from({ length: n }, (_, i) => i));
+    }
+  });
+
+  it('should stay valid under later adds and deletes', () => {
+    const tree = new RedBlackTree<number>();
+    tree.buildFromSorted(Array.from({ length: 100 }, (_, i) => i * 2));
+    for (let i = 0; i < 100; i++) tree.add(i * 2 + 1);
+    for (let i = 0; i < 200; i += 3) tree.delete(i);
+    blackHeight(tree);
+    expect(tree.size).toBe(133);
+    expect(tree.getLeftMost()?.key).toBe(1);
+  });
+
+  it('should rebalance in place', () => {
+    const tree = new RedBlackTree<number>([5, 1, 4, 2, 3, 0]);
+    expect(tree.perfectlyBalance()).toBe(true);
+    expect(tree.isPerfectlyBalanced()).toBe(true);
+    blackHeight(tree);
+    expect(tree.dfs()).toEqual([0, 1, 2, 3, 4, 5]);
+  });
+});
+
+describe('RedBlackTree order statistics', () => {
+  // Returns the subtree size, throwing when a stored size is stale
+  const checkSizes = (tree: RedBlackTree<number>, node: RedBlackTreeNode<number> | undefined): number => {
+    if (!tree.isRealNode(node)) return 0;
+    const size = 1 + checkSizes(tree, node.left) + checkSizes(tree, node.right);
+    if (node.subtreeSize !== size) throw new Error(`stale subtree size at ${node.key}`);
+    return size;
+  };
+
+  it('should keep subtree sizes through rotations', () => {
+    const tree = new RedBlackTree<number>([], { isOrderStatistic: true });
+    const keys = getRandomIntArray(1000, 0, 500, false);
+    const expected = new Set<number>();
+    for (const key of keys) {
+      tree.add(key);
+      expected.add(key);
+    }
+    checkSizes(tree, tree.root);
+    for (let i = 0; i < keys.length; i += 3) {
+      tree.delete(keys[i]);
+      expected.delete(keys[i]);
+    }
+    expect(checkSizes(tree, tree.root)).toBe(expected.size);
+
+    const sorted = [...expected].sort((a, b) => a - b);
+    for (let i = 0; i < sorted.length; i += 7) {
+      expect(tree.select(i)?.key).toBe(sorted[i]);
+      expect(tree.rank(sorted[i])).toBe(i);
+    }
+    expect(tree.countRange(100, 300)).toBe(sorted.filter(key => key >= 100 && key <= 300).length);
+  });
+
+  it('should carry the option into clones', () => {
+    const tree = new RedBlackTree<number>([4, 2, 6, 1, 3, 5, 7], { isOrderStatistic: true });
+    const cloned = tree.clone();
+    expect(cloned.isOrderStatistic).toBe(true);
+    cloned.delete(1);
+    expect(cloned.select(0)?.key).toBe(2);
+    expect(tree.select(0)?.key).toBe(1);
+    expect(checkSizes(cloned, cloned.root)).toBe(6);
+  });
+});
+
+describe('RedBlackTree range queries', () => {
+  it('should match a sorted array under random adds and deletes', () => {
+    const tree = new RedBlackTree<number>();
+    const keys = getRandomIntArray(1000, 0, 500, false);
+    for (const key of keys) tree.add(key);
+    for (let i = 0; i < keys.length; i += 3) tree.delete(keys[i]);
+    const sorted = tree.dfs();
+
+    for (let lo = -10; lo < 520; lo += 37) {
+      const hi = lo + 60;
+      const expected = sorted.filter(key => key >= lo && key <= hi);
+      expect([...tree.rangeIterator(lo, hi)]).toEqual(expected);
+      expect([...tree.rangeIterator(lo, hi, { reverse: true })]).toEqual(expected.reverse());
+      expect(tree.ceiling(lo)?.key).toBe(sorted.find(key => key >= lo));
+      expect(tree.lower(lo)?.key).toBe(sorted.filter(key => key < lo).pop());
+    }
+  });
+});
+
 describe('RedBlackTree 2', () => {
   let tree: RedBlackTree<number>;
 
@@ -609,3 +732,111 @@ describe('RedBlackTree iterative methods test', () => {
     ]);
   });
 });
+
+describe('RedBlackTree set operations', () => {
+  // Returns the black height of the subtree, throwing when a red-black invariant or a parent link is broken
+  const blackHeight = (tree: RedBlackTree<number>, node: RedBlackTreeNode<number> = tree.root): number => {
+    if (!tree.isRealNode(node)) return 1;
+    if (node.color === RBTNColor.RED && (node.left?.color === RBTNColor.RED || node.right?.color === RBTNColor.RED)) {
+      throw new Error(`red node ${node.key} has a red child`);
+    }
+    if (tree.isRealNode(node.left) && node.left.parent !== node) throw new Error(`stale parent at ${node.key}`);
+    if (tree.isRealNode(node.right) && node.right.parent !== node) throw new Error(`stale parent at ${node.key}`);
+    const left = blackHeight(tree, node.left),
+      right = blackHeight(tree, node.right);
+    if (left !== right) throw new Error(`black height mismatch at ${node.key}`);
+    return left + (node.color === RBTNColor.BLACK ? 1 : 0);
+  };
+
+  const treeOf = (keys: number[]) => {
+    const tree = new RedBlackTree<number, string>([], { isOrderStatistic: true });
+    for (const key of keys) tree.add(key, `v${key}`);
+    return tree;
+  };
+
+  it('should split and join back', () => {
+    const keys = getRandomIntArray(500, 0, 1000, true);
+    const tree = treeOf(keys);
+    const right = tree.split(500);
+    blackHeight(tree);
+    blackHeight(right);
+    expect(tree.size + right.size).toBe(500);
+    expect(right.size).toBe(right.root.subtreeSize);
+    expect(tree.dfs()).toEqual([...keys].sort((a, b) => a - b).filter(key => key < 500));
+    expect(right.getLeftMost()?.key).toBeGreaterThanOrEqual(500);
+
+    expect(tree.join(right)).toBe(500);
+    expect(right.size).toBe(0);
+    blackHeight(tree);
+    expect(tree.dfs()).toEqual([...keys].sort((a, b) => a - b));
+    expect(tree.select(250)?.key).toBe([...keys].sort((a, b) => a - b)[250]);
+    expect(() => tree.join(treeOf([0]))).toThrow('join requires every key');
+
+    // A tree that was not split off has its leaves relinked first
+    tree.join(treeOf([5000, 5001]));
+    expect(tree.size).toBe(502);
+    tree.delete(5000);
+    blackHeight(tree);
+  });
+
+  it('should unite, intersect and subtract', () => {
+    const a = getRandomIntArray(300, 0, 600, true);
+    const b = getRandomIntArray(200, 0, 600, true);
+    const inB = new Set(b);
+    const sorted = (keys: number[]) => [...new Set(keys)].sort((x, y) => x - y);
+
+    const union = treeOf(a);
+    expect(union.union(treeOf(b))).toBe(sorted([...a, ...b]).length);
+    blackHeight(union);
+    expect(union.dfs()).toEqual(sorted([...a, ...b]));
+    expect(union.get(b[0])).toBe(`v${b[0]}`);
+    expect(union.root.subtreeSize).toBe(union.size);
+
+    const intersection = treeOf(a);
+    intersection.intersection(treeOf(b), (value, otherValue) => `${value}&${otherValue}`);
+    blackHeight(intersection);
+    expect(intersection.dfs()).toEqual(sorted(a.filter(key => inB.has(key))));
+    for (const key of intersection.keys()) expect(intersection.get(key)).toBe(`v${key}&v${key}`);
+
+    const difference = treeOf(a);
+    difference.difference(treeOf(b));
+    blackHeight(difference);
+    expect(difference.dfs()).toEqual(sorted(a.filter(key => !inB.has(key))));
+    difference.add(-1);
+    difference.delete(difference.getRightMost()!.key);
+    blackHeight(difference);
+  });
+
+  it('should merge values with a callback and leave the other tree unchanged', () => {
+    const tree = treeOf([1, 2, 3]);
+    const other = treeOf([2, 3, 4]);
+    tree.union(other, (value, otherValue, key) => `${value}|${otherValue}|${key}`);
+    expect([...tree]).toEqual([
+      [1, 'v1'],
+      [2, 'v2|v2|2'],
+      [3, 'v3|v3|3'],
+      [4, 'v4']
+    ]);
+    expect(other.dfs()).toEqual([2, 3, 4]);
+    expect(new RedBlackTree<number>().union(other)).toBe(3);
+  });
+
+  it('should combine a tree with itself', () => {
+    const keys = Array.from({ length: 100 }, (_, i) => i + 1);
+    const tree = treeOf(keys);
+    expect(tree.union(tree)).toBe(100);
+    expect(tree.dfs()).toEqual(keys);
+    blackHeight(tree);
+
+    expect(tree.intersection(tree)).toBe(100);
+    expect(tree.dfs()).toEqual(keys);
+    tree.intersection(tree, (value, otherValue) => `${value}+${otherValue}`);
+    expect(tree.get(7)).toBe('v7+v7');
+    expect(tree.size).toBe(100);
+    blackHeight(tree);
+
+    expect(tree.difference(tree)).toBe(0);
+    expect(tree.size).toBe(0);
+    expect(tree.dfs()).toEqual([]);
+  });
+});
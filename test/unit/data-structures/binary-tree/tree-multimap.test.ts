@@ -7,6 +7,7 @@ import {
   TreeMultimap,
   TreeMultimapNode
 } from '../../../../src';
+import { getRandomIntArray } from '../../../utils';
 import { isDebugTest } from '../../../config';
 
 const isDebug = isDebugTest;
@@ -40,6 +41,64 @@ describe('TreeMultimap count', () => {
   });
 });
 
+describe('TreeMultimap buildFromSorted', () => {
+  it('should keep node counts and heights', () => {
+    const tm = new TreeMultimap<number>();
+    tm.buildFromSorted([1, 2, 3, 4, 5].map(key => new TreeMultimapNode(key, key, key)));
+    expect(tm.size).toBe(5);
+    expect(tm.count).toBe(15);
+    expect(tm.isAVLBalanced()).toBe(true);
+    expect(tm.root?.height).toBe(2);
+    tm.add(3);
+    expect(tm.count).toBe(16);
+    expect(tm.perfectlyBalance()).toBe(true);
+    expect(tm.count).toBe(16);
+  });
+});
+
+describe('TreeMultimap order statistics', () => {
+  // Returns the subtree size, throwing when a stored size is stale
+  const checkSizes = (tree: TreeMultimap<number>, node: TreeMultimapNode<number> | undefined): number => {
+    if (!tree.isRealNode(node)) return 0;
+    const size = 1 + checkSizes(tree, node.left) + checkSizes(tree, node.right);
+    if (node.subtreeSize !== size) throw new Error(`stale subtree size at ${node.key}`);
+    return size;
+  };
+
+  it('should keep subtree sizes through rotations', () => {
+    const tree = new TreeMultimap<number>([], { isOrderStatistic: true });
+    const keys = getRandomIntArray(1000, 0, 500, false);
+    const expected = new Set<number>();
+    for (const key of keys) {
+      tree.add(key);
+      expected.add(key);
+    }
+    checkSizes(tree, tree.root);
+    for (let i = 0; i < keys.length; i += 3) {
+      tree.delete(keys[i], undefined, true);
+      expected.delete(keys[i]);
+    }
+    expect(checkSizes(tree, tree.root)).toBe(expected.size);
+
+    const sorted = [...expected].sort((a, b) => a - b);
+    for (let i = 0; i < sorted.length; i += 7) {
+      expect(tree.select(i)?.key).toBe(sorted[i]);
+      expect(tree.rank(sorted[i])).toBe(i);
+    }
+    expect(tree.countRange(100, 300)).toBe(sorted.filter(key => key >= 100 && key <= 300).length);
+  });
+
+  it('should carry the option into clones', () => {
+    const tree = new TreeMultimap<number>([4, 2, 6, 1, 3, 5, 7], { isOrderStatistic: true });
+    const cloned = tree.clone();
+    expect(cloned.isOrderStatistic).toBe(true);
+    cloned.delete(1);
+    expect(cloned.select(0)?.key).toBe(2);
+    expect(tree.select(0)?.key).toBe(1);
+    expect(checkSizes(cloned, cloned.root)).toBe(6);
+  });
+});
+
 describe('TreeMultimap operations test1', () => {
   it('should perform various operations on a Binary Search Tree with numeric values1', () => {
     const treeMultimap = new TreeMultimap();
@@ -694,3 +753,89 @@ describe('TreeMultimap iterative methods test', () => {
     expect([...values]).toEqual(['a', 'b', 'c']);
   });
 });
+
+describe('TreeMultimap union', () => {
+  it('should add up the counts of shared keys', () => {
+    const tm = new TreeMultimap<number, string>();
+    tm.add(1, 'a', 2);
+    tm.add(2, 'b');
+    const other = new TreeMultimap<number, string>();
+    other.add(2, 'B', 3);
+    other.add(5, 'E', 4);
+
+    expect(tm.union(other)).toBe(3);
+    expect(tm.count).toBe(10);
+    expect(tm.getNode(1)?.count).toBe(2);
+    expect(tm.getNode(2)?.count).toBe(4);
+    expect(tm.getNode(2)?.value).toBe('B');
+    expect(tm.getNode(5)?.count).toBe(4);
+    expect(other.count).toBe(7);
+    expect(tm.isAVLBalanced()).toBe(true);
+  });
+
+  it('should double every count when united with itself', () => {
+    const tm = new TreeMultimap<number, string>();
+    for (let i = 1; i <= 20; i++) tm.add(i, `v${i}`, (i % 3) + 1);
+    const count = tm.count;
+    expect(tm.union(tm)).toBe(20);
+    expect(tm.count).toBe(count * 2);
+    expect(tm.getNode(5)?.count).toBe(6);
+    expect(tm.getNode(20)?.count).toBe(6);
+    expect(tm.isAVLBalanced()).toBe(true);
+  });
+});
+
+describe('TreeMultimap split, join, intersection and difference', () => {
+  // Keys 1 to 30, the key k added (k % 3) + 1 times
+  const multimapOf = () => {
+    const tm = new TreeMultimap<number, string>();
+    for (let i = 1; i <= 30; i++) tm.add(i, `v${i}`, (i % 3) + 1);
+    return tm;
+  };
+  const sumOf = (tm: TreeMultimap<number, string>) => tm.dfs(node => node.count).reduce((sum, c) => sum + c, 0);
+
+  it('should move the counts with split and join', () => {
+    const tm = multimapOf();
+    const total = tm.count;
+    const right = tm.split(16);
+    expect(right.size).toBe(15);
+    expect(right.count).toBe(sumOf(right));
+    expect(tm.count).toBe(sumOf(tm));
+    expect(tm.count + right.count).toBe(total);
+    expect(right.getNode(16)?.count).toBe(2);
+
+    expect(tm.join(right)).toBe(30);
+    expect(tm.count).toBe(total);
+    expect(right.count).toBe(0);
+    expect(tm.isAVLBalanced()).toBe(true);
+  });
+
+  it('should keep the counts of the kept keys with intersection', () => {
+    const tm = multimapOf();
+    const evens = new TreeMultimap<number, string>();
+    for (let i = 2; i <= 30; i += 2) evens.add(i, `e${i}`, 5);
+    expect(tm.intersection(evens)).toBe(15);
+    expect(tm.count).toBe(sumOf(tm));
+    expect(tm.getNode(4)?.count).toBe(2);
+    expect(tm.has(3)).toBe(false);
+
+    const count = tm.count;
+    expect(tm.intersection(tm)).toBe(15);
+    expect(tm.count).toBe(count);
+  });
+
+  it('should drop the counts of the removed keys with difference', () => {
+    const tm = multimapOf();
+    const evens = new TreeMultimap<number, string>();
+    for (let i = 2; i <= 30; i += 2) evens.add(i, `e${i}`, 5);
+    expect(tm.difference(evens)).toBe(15);
+    expect(tm.count).toBe(sumOf(tm));
+    expect(tm.getNode(3)?.count).toBe(1);
+    expect(tm.has(4)).toBe(false);
+    expect(tm.isAVLBalanced()).toBe(true);
+
+    expect(tm.difference(tm)).toBe(0);
+    expect(tm.count).toBe(0);
+    expect(tm.size).toBe(0);
+  });
+});
@@ -0,0 +1,228 @@
+import { CSRGraph, DirectedGraph, UndirectedGraph } from '../../../../src';
+
+describe('CSRGraph', () => {
+  it('should build from an edge list', () => {
+    const csr = CSRGraph.fromEdgeList(['a', 'b', 'c', 'd'], [0, 2, 0, 1], [1, 3, 2, 3], [5, 1, 2, 4]);
+    expect(csr.vertexCount).toBe(4);
+    expect(csr.arcCount).toBe(4);
+    expect([...csr.offsets]).toEqual([0, 2, 3, 4, 4]);
+    expect([...csr.neighborsOf(0)]).toEqual([1, 2]);
+    expect(csr.degreeOf(3)).toBe(0);
+    expect(csr.indexOf('c')).toBe(2);
+    expect(csr.indexOf('x')).toBe(-1);
+    expect(csr.keyOf(1)).toBe('b');
+
+    const { dist, prev, order } = csr.dijkstra(0);
+    expect([...dist]).toEqual([0, 5, 2, 3]);
+    expect([...prev]).toEqual([-1, 0, 0, 2]);
+    expect([...order]).toEqual([0, 2, 3, 1]);
+    expect([...csr.dijkstra(0, 2).order]).toEqual([0, 2]);
+  });
+
+  it('should store undirected edges both ways', () => {
+    const csr = CSRGraph.fromEdgeList([0, 1, 2], [0, 1], [1, 2], undefined, false);
+    expect(csr.isDirected).toBe(false);
+    expect(csr.arcCount).toBe(4);
+    expect([...csr.neighborsOf(1)]).toEqual([0, 2]);
+    expect([...csr.dijkstra(2).dist]).toEqual([2, 1, 0]);
+  });
+
+  it('should reject inconsistent arrays', () => {
+    expect(() => CSRGraph.fromEdgeList([0, 1], [0], [2])).toThrow();
+    expect(() => CSRGraph.fromEdgeList([0, 1], [0, 1], [1])).toThrow();
+    expect(() => new CSRGraph([0], new Int32Array(1), new Int32Array(0), new Float64Array(0))).toThrow();
+  });
+
+  it('should detect negative cycles and cycles', () => {
+    const csr = CSRGraph.fromEdgeList([0, 1, 2], [0, 1, 2], [1, 2, 1], [1, -2, 1]);
+    expect(csr.bellmanFord(0).hasNegativeCycle).toBe(true);
+    expect(csr.topologicalSort()).toBeUndefined();
+    const positiveCycle = CSRGraph.fromEdgeList([0, 1, 2], [0, 1, 2], [1, 2, 1], [1, -2, 3]);
+    expect(positiveCycle.bellmanFord(0).hasNegativeCycle).toBe(false);
+    expect([...positiveCycle.bellmanFord(0).dist]).toEqual([0, 1, -1]);
+    const noCycle = CSRGraph.fromEdgeList([0, 1, 2], [0, 0, 1], [1, 2, 2], [1, 4, -2]);
+    const result = noCycle.bellmanFord(0);
+    expect(result.hasNegativeCycle).toBe(false);
+    expect([...result.dist]).toEqual([0, 1, -1]);
+    expect([...noCycle.topologicalSort()!]).toEqual([0, 1, 2]);
+  });
+
+  it('should not overflow the stack on a long path', () => {
+    const n = 100000;
+    const sources = new Int32Array(n - 1);
+    const targets = new Int32Array(n - 1);
+    for (let i = 0; i < n - 1; i++) {
+      sources[i] = i;
+      targets[i] = i + 1;
+    }
+    const keys = Array.from({ length: n }, (_, i) => i);
+    const csr = CSRGraph.fromEdgeList(keys, sources, targets);
+    expect(csr.topologicalSort()![n - 1]).toBe(n - 1);
+    expect(csr.tarjan().sccCount).toBe(n);
+  });
+
+  it('should search only the vertices from a start index', () => {
+    const csr = CSRGraph.fromEdgeList([0, 1, 2, 3], [0, 1, 2, 3, 2], [1, 2, 0, 2, 3]);
+    expect(csr.tarjan().sccCount).toBe(1);
+    const { dfn, sccOf, sccCount } = csr.tarjan(1);
+    expect(sccCount).toBe(2);
+    expect(dfn[0]).toBe(-1);
+    expect([...sccOf]).toEqual([-1, 1, 0, 0]);
+  });
+});
+
+describe('DirectedGraph freeze', () => {
+  const createRandomGraph = (vertexCount: number, edgeCount: number) => {
+    const graph = new DirectedGraph<number>();
+    for (let i = 0; i < vertexCount; i++) graph.addVertex(i);
+    for (let i = 0; i < edgeCount; i++) {
+      const src = Math.floor(Math.random() * vertexCount);
+      const dest = Math.floor(Math.random() * vertexCount);
+      if (src !== dest && !graph.hasEdge(src, dest)) graph.addEdge(src, dest, Math.floor(Math.random() * 100));
+    }
+    return graph;
+  };
+
+  it('should keep the snapshot until the graph changes', () => {
+    const graph = createRandomGraph(10, 20);
+    const frozen = graph.freeze();
+    expect(graph.frozen).toBe(frozen);
+    expect(graph.freeze()).toBe(frozen);
+    expect(frozen.vertexCount).toBe(10);
+    expect(frozen.arcCount).toBe(graph.edgeSet().length);
+
+    graph.addVertex(10);
+    expect(graph.frozen).toBeUndefined();
+    graph.freeze();
+    graph.addEdge(0, 10, 1);
+    expect(graph.frozen).toBeUndefined();
+    graph.freeze();
+    graph.setEdgeWeight(0, 10, 2);
+    expect(graph.frozen).toBeUndefined();
+    graph.freeze();
+    graph.deleteEdge(0, 10);
+    expect(graph.frozen).toBeUndefined();
+    graph.freeze();
+    graph.deleteVertex(10);
+    expect(graph.frozen).toBeUndefined();
+    graph.freeze();
+    graph.clear();
+    expect(graph.frozen).toBeUndefined();
+  });
+
+  it('should see changes made after freezing', () => {
+    const graph = new DirectedGraph<string>();
+    for (const key of ['A', 'B', 'C']) graph.addVertex(key);
+    graph.addEdge('A', 'B', 5);
+    graph.addEdge('B', 'C', 5);
+    graph.freeze();
+    expect(graph.dijkstra('A', 'C', true)!.minDist).toBe(10);
+    graph.addEdge('A', 'C', 3);
+    graph.freeze();
+    expect(graph.dijkstra('A', 'C', true)!.minDist).toBe(3);
+  });
+
+  it('should give the same results as the map-based algorithms', () => {
+    for (let round = 0; round < 5; round++) {
+      const graph = createRandomGraph(80, 240);
+      const dijkstra = graph.dijkstra(0, undefined, true, true)!;
+      const toDest = graph.dijkstra(0, 7, true, true)!;
+      const ford = graph.bellmanFord(0, true, true, true);
+      const { dfnMap, lowMap, SCCs } = graph.tarjan();
+      const sorted = graph.topologicalSort();
+
+      graph.freeze();
+      const frozenDijkstra = graph.dijkstra(0, undefined, true, true)!;
+      expect([...frozenDijkstra.distMap]).toEqual([...dijkstra.distMap]);
+      expect(frozenDijkstra.seen).toEqual(dijkstra.seen);
+      expect(frozenDijkstra.minDist).toBe(dijkstra.minDist);
+      for (let i = 0; i < dijkstra.paths.length; i++) {
+        expect(graph.getPathSumWeight(frozenDijkstra.paths[i])).toBe(graph.getPathSumWeight(dijkstra.paths[i]));
+      }
+
+      const frozenToDest = graph.dijkstra(0, 7, true, true)!;
+      expect(frozenToDest.minDist).toBe(toDest.minDist);
+      expect(graph.getPathSumWeight(frozenToDest.minPath)).toBe(graph.getPathSumWeight(toDest.minPath));
+
+      const frozenFord = graph.bellmanFord(0, true, true, true);
+      expect([...frozenFord.distMap]).toEqual([...ford.distMap]);
+      expect(frozenFord.hasNegativeCycle).toBe(false);
+      expect(frozenFord.min).toBe(ford.min);
+
+      const frozenTarjan = graph.tarjan();
+      expect([...frozenTarjan.dfnMap]).toEqual([...dfnMap]);
+      expect([...frozenTarjan.lowMap]).toEqual([...lowMap]);
+      expect([...frozenTarjan.SCCs]).toEqual([...SCCs]);
+      expect(graph.topologicalSort()).toEqual(sorted);
+    }
+  });
+
+  it('should topologically sort a DAG like the map-based search', () => {
+    const graph = new DirectedGraph<number>();
+    for (let i = 0; i < 50; i++) graph.addVertex(i);
+    for (let i = 0; i < 200; i++) {
+      const a = Math.floor(Math.random() * 50);
+      const b = Math.floor(Math.random() * 50);
+      if (a < b) graph.addEdge(a, b);
+    }
+    const keys = graph.topologicalSort('key');
+    const vertices = graph.topologicalSort('vertex');
+    graph.freeze();
+    expect(graph.topologicalSort('key')).toEqual(keys);
+    expect(graph.topologicalSort('vertex')).toEqual(vertices);
+  });
+
+  it('should relax every parallel edge with its own weight', () => {
+    const graph = new DirectedGraph<string>();
+    graph.addVertex('A');
+    graph.addVertex('B');
+    graph.addEdge('A', 'B', 9);
+    graph.addEdge('A', 'B', 2);
+    graph.freeze();
+    expect(graph.freeze().arcCount).toBe(2);
+    expect(graph.dijkstra('A', 'B', true)!.minDist).toBe(2);
+  });
+
+  it('should detect negative cycles with and without a snapshot', () => {
+    const graph = new DirectedGraph<string>();
+    for (const key of ['A', 'B', 'C']) graph.addVertex(key);
+    graph.addEdge('A', 'B', 1);
+    graph.addEdge('B', 'C', -1);
+    expect(graph.bellmanFord('A', true).hasNegativeCycle).toBe(false);
+    graph.addEdge('C', 'B', -1);
+    expect(graph.bellmanFord('A', true).hasNegativeCycle).toBe(true);
+    graph.freeze();
+    expect(graph.bellmanFord('A', true).hasNegativeCycle).toBe(true);
+  });
+});
+
+describe('UndirectedGraph freeze', () => {
+  it('should give the same distances as the map-based dijkstra', () => {
+    for (let round = 0; round < 5; round++) {
+      const graph = new UndirectedGraph<number>();
+      for (let i = 0; i < 60; i++) graph.addVertex(i);
+      for (let i = 0; i < 150; i++) {
+        const a = Math.floor(Math.random() * 60);
+        const b = Math.floor(Math.random() * 60);
+        if (!graph.hasEdge(a, b)) graph.addEdge(a, b, Math.floor(Math.random() * 100));
+      }
+      const expected = graph.dijkstra(0, undefined, true)!;
+      const frozen = graph.freeze();
+      expect(frozen.isDirected).toBe(false);
+      const actual = graph.dijkstra(0, undefined, true)!;
+      expect([...actual.distMap]).toEqual([...expected.distMap]);
+      expect(actual.minDist).toBe(expected.minDist);
+    }
+  });
+
+  it('should drop the snapshot when edges change', () => {
+    const graph = new UndirectedGraph<string>();
+    graph.addVertex('A');
+    graph.addVertex('B');
+    graph.addEdge('A', 'B', 3);
+    expect(graph.freeze().arcCount).toBe(2);
+    graph.deleteEdgeBetween('A', 'B');
+    expect(graph.frozen).toBeUndefined();
+    expect(graph.freeze().arcCount).toBe(0);
+  });
+});
@@ -995,3 +995,200 @@ describe('DirectedGraph tarjan', () => {
     expect(getAsVerticesArrays(sccs)).toEqual([['K', 'J', 'I', 'H', 'D', 'C', 'B'], ['G', 'F', 'E'], ['A']]);
   });
 });
+
+describe('DirectedGraph shortest paths', () => {
+  const createRandomGraph = (vertexCount: number, edgeCount: number) => {
+    const graph = new DirectedGraph<number>();
+    for (let i = 0; i < vertexCount; i++) graph.addVertex(i);
+    for (let i = 0; i < edgeCount; i++) {
+      const src = Math.floor(Math.random() * vertexCount);
+      const dest = Math.floor(Math.random() * vertexCount);
+      if (src !== dest && !graph.hasEdge(src, dest)) graph.addEdge(src, dest, Math.floor(Math.random() * 100));
+    }
+    return graph;
+  };
+
+  it('should agree with dijkstraWithoutHeap and bellmanFord on random graphs', () => {
+    for (let round = 0; round < 5; round++) {
+      const graph = createRandomGraph(60, 300);
+      const expected = graph.dijkstraWithoutHeap(0, undefined, true)!.distMap;
+      const actual = graph.dijkstra(0, undefined, true)!.distMap;
+      const ford = graph.bellmanFord(0).distMap;
+      for (const [vertex, dist] of expected) {
+        expect(actual.get(vertex)).toBe(dist);
+        expect(ford.get(vertex)).toBe(dist);
+      }
+    }
+  });
+
+  it('should stop at the destination with the minimum path', () => {
+    const graph = new DirectedGraph<string>();
+    for (const key of ['A', 'B', 'C', 'D']) graph.addVertex(key);
+    graph.addEdge('A', 'B', 4);
+    graph.addEdge('A', 'C', 1);
+    graph.addEdge('C', 'B', 1);
+    graph.addEdge('B', 'D', 1);
+    graph.addEdge('C', 'D', 5);
+    const result = graph.dijkstra('A', 'D', true, true)!;
+    expect(result.minDist).toBe(3);
+    expect(result.minPath.map(vertex => vertex.key)).toEqual(['A', 'C', 'B', 'D']);
+  });
+});
+
+describe('DirectedGraph point-to-point and all-pairs paths', () => {
+  const createRandomGraph = (vertexCount: number, edgeCount: number, minWeight = 0) => {
+    const graph = new DirectedGraph<number>();
+    for (let i = 0; i < vertexCount; i++) graph.addVertex(i);
+    for (let i = 0; i < edgeCount; i++) {
+      const src = Math.floor(Math.random() * vertexCount);
+      const dest = Math.floor(Math.random() * vertexCount);
+      if (src !== dest && !graph.hasEdge(src, dest)) {
+        graph.addEdge(src, dest, minWeight + Math.floor(Math.random() * 100));
+      }
+    }
+    return graph;
+  };
+
+  it('should agree with dijkstra for every destination', () => {
+    for (let round = 0; round < 3; round++) {
+      const graph = createRandomGraph(50, 150);
+      const { distMap } = graph.dijkstraWithoutHeap(0)!;
+      for (const [vertex, dist] of distMap) {
+        const bidirectional = graph.bidirectionalDijkstra(0, vertex)!;
+        const aStar = graph.aStar(0, vertex)!;
+        expect(bidirectional.distance).toBe(dist);
+        expect(aStar.distance).toBe(dist);
+        expect(graph.getMinCostBetween(0, vertex, true)).toBe(dist);
+        if (dist !== Infinity) {
+          expect(bidirectional.path[0].key).toBe(0);
+          expect(bidirectional.path[bidirectional.path.length - 1]).toBe(vertex);
+          expect(graph.getPathSumWeight(bidirectional.path)).toBe(dist);
+          expect(graph.getPathSumWeight(aStar.path)).toBe(dist);
+        } else {
+          expect(bidirectional.path).toEqual([]);
+        }
+      }
+    }
+  });
+
+  it('should handle missing and identical endpoints', () => {
+    const graph = createRandomGraph(5, 5);
+    expect(graph.bidirectionalDijkstra(0, 99)).toBeUndefined();
+    expect(graph.aStar(99, 0)).toBeUndefined();
+    expect(graph.bidirectionalDijkstra(3, 3)).toEqual({ distance: 0, path: [graph.getVertex(3)] });
+    expect(graph.aStar(3, 3)).toEqual({ distance: 0, path: [graph.getVertex(3)] });
+  });
+
+  it('should follow an admissible heuristic on a grid', () => {
+    const size = 20;
+    const graph = new DirectedGraph<number>();
+    const key = (x: number, y: number) => x * size + y;
+    for (let i = 0; i < size * size; i++) graph.addVertex(i);
+    for (let x = 0; x < size; x++) {
+      for (let y = 0; y < size; y++) {
+        if (x + 1 < size) graph.addEdge(key(x, y), key(x + 1, y), 1 + ((x * 7 + y) % 3));
+        if (y + 1 < size) graph.addEdge(key(x, y), key(x, y + 1), 1 + ((x + y * 5) % 3));
+      }
+    }
+    const dest = graph.getVertex(key(size - 1, size - 1))!;
+    const manhattan = (vertex: DirectedVertex<number>) =>
+      size - 1 - Math.floor(Number(vertex.key) / size) + (size - 1 - (Number(vertex.key) % size));
+    const expected = graph.dijkstra(0, dest, true)!.minDist;
+    expect(graph.aStar(0, dest, manhattan)!.distance).toBe(expected);
+    expect(graph.bidirectionalDijkstra(0, dest)!.distance).toBe(expected);
+  });
+
+  it('should match floydWarshall with johnson', () => {
+    // floydWarshall reads a zero weight as a missing edge
+    const graph = createRandomGraph(30, 90, 1);
+    const { costs } = graph.floydWarshall();
+    const vertices = [...graph.vertexMap.values()];
+    const { distMap, preMap } = graph.johnson()!;
+    for (let i = 0; i < vertices.length; i++) {
+      for (let j = 0; j < vertices.length; j++) {
+        // floydWarshall leaves the length of the shortest cycle on the diagonal
+        const dist = distMap.get(vertices[i])!.get(vertices[j]);
+        expect(dist ?? Infinity).toBe(i === j ? 0 : costs[i][j]);
+      }
+      expect(preMap.get(vertices[i])!.get(vertices[i])).toBeUndefined();
+    }
+  });
+
+  it('should handle negative weights with johnson', () => {
+    // Negative weights only on edges that go forward in key order, so there is no negative cycle
+    const graph = createRandomGraph(30, 60);
+    for (const edge of graph.edgeSet()) if (edge.src > edge.dest) graph.deleteEdge(edge);
+    for (const edge of graph.edgeSet()) edge.weight -= 50;
+    const { distMap } = graph.johnson()!;
+    for (const vertex of graph.vertexMap.values()) {
+      const ford = graph.bellmanFord(vertex).distMap;
+      for (const [other, dist] of ford) expect(distMap.get(vertex)!.get(other) ?? Infinity).toBe(dist);
+    }
+
+    graph.addEdge(0, 1, -1);
+    graph.addEdge(1, 0, -1);
+    expect(graph.johnson()).toBeUndefined();
+  });
+
+  it('should keep in-edges consistent after deleteVertex', () => {
+    const graph = new DirectedGraph<string>();
+    for (const key of ['A', 'B', 'C']) graph.addVertex(key);
+    graph.addEdge('A', 'B', 1);
+    graph.addEdge('C', 'B', 1);
+    graph.addEdge('B', 'C', 1);
+    graph.deleteVertex('A');
+    expect(graph.incomingEdgesOf('B').map(edge => edge.src)).toEqual(['C']);
+    expect(graph.bidirectionalDijkstra('C', 'B')!.distance).toBe(1);
+    graph.deleteVertex('B');
+    expect(graph.outgoingEdgesOf('C')).toEqual([]);
+  });
+});
+
+describe('DirectedGraph deep and lazy searches', () => {
+  it('should run tarjan on a long chain without overflowing the stack', () => {
+    const graph = new DirectedGraph<number>();
+    const n = 100000;
+    for (let i = 0; i < n; i++) graph.addVertex(i);
+    for (let i = 0; i < n - 1; i++) graph.addEdge(i, i + 1);
+    graph.addEdge(n - 1, 0);
+    const { dfnMap, lowMap, SCCs } = graph.tarjan();
+    expect(dfnMap.size).toBe(n);
+    expect(lowMap.get(graph.getVertex(n - 1)!)).toBe(0);
+    expect(SCCs.size).toBe(1);
+    expect(SCCs.get(0)!.length).toBe(n);
+    expect(graph.getCycles()).toEqual([Array.from({ length: n }, (_, i) => i)]);
+  });
+
+  it('should yield cycles lazily in the order of getCycles', () => {
+    const graph = new DirectedGraph<number>();
+    for (let i = 0; i < 8; i++) graph.addVertex(i);
+    // Every arc between distinct vertices, so there are thousands of cycles
+    for (let i = 0; i < 8; i++) for (let j = 0; j < 8; j++) if (i !== j) graph.addEdge(i, j);
+
+    const cycles = graph.getCycles(true);
+    // One cycle per set of at least two vertices
+    expect(cycles.length).toBe(2 ** 8 - 8 - 1);
+    const iterator = graph.cyclesIterator(true);
+    expect(iterator.next().value).toEqual(cycles[0]);
+    expect(iterator.next().value).toEqual(cycles[1]);
+    expect([...graph.cyclesIterator()]).toEqual(graph.getCycles());
+  });
+
+  it('should yield paths lazily in the order of getAllPathsBetween', () => {
+    const graph = new DirectedGraph<number>();
+    for (let i = 0; i < 10; i++) graph.addVertex(i);
+    for (let i = 0; i < 10; i++) for (let j = i + 1; j < 10; j++) graph.addEdge(i, j);
+
+    const paths = graph.getAllPathsBetween(0, 9, 300);
+    expect(paths.length).toBe(2 ** 8);
+    const taken = [];
+    for (const path of graph.pathsIterator(0, 9)) {
+      taken.push(path);
+      if (taken.length === 5) break;
+    }
+    expect(taken).toEqual(paths.slice(0, 5));
+    expect(graph.getAllPathsBetween(0, 9, 3)).toEqual(paths.slice(0, 3));
+    expect([...graph.pathsIterator(9, 0)]).toEqual([]);
+    expect([...graph.pathsIterator(4, 4)].map(path => path.map(vertex => vertex.key))).toEqual([[4]]);
+  });
+});
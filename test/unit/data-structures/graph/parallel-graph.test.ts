@@ -0,0 +1,168 @@
+import { Worker } from 'worker_threads';
+import { CSRGraph, ParallelGraph } from '../../../../src';
+
+describe('ParallelGraph', () => {
+  const createWorker = (source: string) => new Worker(source, { eval: true });
+
+  const createRandomCSR = (vertexCount: number, edgeCount: number, maxWeight = 100) => {
+    const sources = new Int32Array(edgeCount);
+    const targets = new Int32Array(edgeCount);
+    const weights = new Float64Array(edgeCount);
+    for (let i = 0; i < edgeCount; i++) {
+      sources[i] = Math.floor(Math.random() * vertexCount);
+      targets[i] = Math.floor(Math.random() * vertexCount);
+      weights[i] = Math.floor(Math.random() * maxWeight);
+    }
+    const keys = Array.from({ length: vertexCount }, (_, i) => i);
+    return CSRGraph.fromEdgeList(keys, sources, targets, weights);
+  };
+
+  const sequentialBFS = (csr: CSRGraph, src: number) => {
+    const dist = new Array(csr.vertexCount).fill(-1);
+    const queue = [src];
+    dist[src] = 0;
+    for (let i = 0; i < queue.length; i++) {
+      for (const w of csr.neighborsOf(queue[i])) {
+        if (dist[w] === -1) {
+          dist[w] = dist[queue[i]] + 1;
+          queue.push(w);
+        }
+      }
+    }
+    return dist;
+  };
+
+  // Two labelings describe the same partition if they map onto each other one to one
+  const expectSamePartition = (actual: ArrayLike<number>, expected: ArrayLike<number>) => {
+    const forward = new Map<number, number>(),
+      backward = new Map<number, number>();
+    for (let i = 0; i < expected.length; i++) {
+      if (!forward.has(actual[i])) forward.set(actual[i], expected[i]);
+      if (!backward.has(expected[i])) backward.set(expected[i], actual[i]);
+      expect(forward.get(actual[i])).toBe(expected[i]);
+      expect(backward.get(expected[i])).toBe(actual[i]);
+    }
+  };
+
+  const csr = createRandomCSR(400, 1200);
+  let parallel: ParallelGraph;
+
+  beforeAll(() => {
+    parallel = new ParallelGraph(csr, { createWorker, concurrency: 3 });
+  });
+
+  afterAll(() => parallel.close());
+
+  it('should share the snapshot and its transpose', () => {
+    expect(csr.isShared).toBe(false);
+    expect(parallel.graph.isShared).toBe(true);
+    expect(parallel.graph.share()).toBe(parallel.graph);
+    expect(parallel.concurrency).toBe(3);
+
+    const small = CSRGraph.fromEdgeList(['a', 'b', 'c'], [0, 0, 2], [1, 2, 1], [4, 5, 6]);
+    const transposed = small.transpose();
+    expect([...transposed.offsets]).toEqual([0, 0, 2, 3]);
+    expect([...transposed.neighborsOf(1)]).toEqual([0, 2]);
+    expect([...transposed.weights]).toEqual([4, 6, 5]);
+  });
+
+  it('should search breadth-first like a sequential search', async () => {
+    for (const src of [0, 17, 399]) {
+      const { dist, prev } = await parallel.bfs(src);
+      expect([...dist]).toEqual(sequentialBFS(csr, src));
+      for (let v = 0; v < csr.vertexCount; v++) {
+        if (v === src || dist[v] === -1) expect(prev[v]).toBe(-1);
+        else expect(dist[prev[v]]).toBe(dist[v] - 1);
+      }
+    }
+  });
+
+  it('should find the same distances as dijkstra', async () => {
+    for (const src of [0, 42]) {
+      const expected = csr.dijkstra(src).dist;
+      expect([...(await parallel.deltaStepping(src))]).toEqual([...expected]);
+      expect([...(await parallel.deltaStepping(src, 5))]).toEqual([...expected]);
+      expect([...(await parallel.deltaStepping(src, Infinity))]).toEqual([...expected]);
+    }
+  });
+
+  it('should reject negative weights and bad vertices', async () => {
+    const negative = new ParallelGraph(CSRGraph.fromEdgeList([0, 1], [0], [1], [-1]), { createWorker, concurrency: 1 });
+    await expect(negative.deltaStepping(0)).rejects.toThrow();
+    await negative.close();
+    await expect(negative.bfs(0)).rejects.toThrow();
+    await expect(parallel.bfs(400)).rejects.toThrow();
+    expect(() => new ParallelGraph(csr, { createWorker, concurrency: 0 })).toThrow();
+  });
+
+  it('should reject every later job once a worker fails', async () => {
+    const broken = new ParallelGraph(csr, {
+      createWorker: () => new Worker('throw new Error("worker crashed")', { eval: true }),
+      concurrency: 1
+    });
+    await expect(broken.bfs(0)).rejects.toThrow('worker crashed');
+    await expect(broken.pageRank()).rejects.toThrow('worker crashed');
+    await broken.close();
+  });
+
+  it('should pass the port into the worker source instead of requiring it at bundle time', () => {
+    let source = '';
+    const graph = new ParallelGraph(csr, {
+      createWorker: text => {
+        source = text;
+        return new Worker(text, { eval: true });
+      },
+      concurrency: 1
+    });
+    expect(source).toContain("require('worker_threads').parentPort : self");
+    expect(source.indexOf('require(')).toBe(source.lastIndexOf('require('));
+    return graph.close();
+  });
+
+  it('should label connected components with their least vertex', async () => {
+    const sparse = createRandomCSR(300, 200);
+    const graph = new ParallelGraph(sparse, { createWorker, concurrency: 2 });
+    const label = await graph.connectedComponents();
+    await graph.close();
+
+    // A sequential union-find over the arcs in both directions
+    const parent = Array.from({ length: 300 }, (_, i) => i);
+    const find = (v: number): number => (parent[v] === v ? v : (parent[v] = find(parent[v])));
+    for (let u = 0; u < 300; u++) {
+      for (const w of sparse.neighborsOf(u)) parent[Math.max(find(u), find(w))] = Math.min(find(u), find(w));
+    }
+    for (let v = 0; v < 300; v++) expect(label[v]).toBe(find(v));
+  });
+
+  it('should find the same strongly connected components as tarjan', async () => {
+    expectSamePartition(await parallel.stronglyConnectedComponents(), csr.tarjan().sccOf);
+
+    const sparse = createRandomCSR(300, 330);
+    const graph = new ParallelGraph(sparse, { createWorker, concurrency: 2 });
+    expectSamePartition(await graph.stronglyConnectedComponents(), sparse.tarjan().sccOf);
+    await graph.close();
+  });
+
+  it('should rank vertices like a sequential power iteration', async () => {
+    const n = csr.vertexCount;
+    let rank = new Array(n).fill(1 / n);
+    for (let iteration = 0; iteration < 100; iteration++) {
+      const next = new Array(n).fill(0);
+      let dangling = 0;
+      for (let v = 0; v < n; v++) {
+        const degree = csr.degreeOf(v);
+        if (degree === 0) dangling += rank[v];
+        for (const w of csr.neighborsOf(v)) next[w] += rank[v] / degree;
+      }
+      rank = next.map(sum => 0.15 / n + (0.85 * dangling) / n + 0.85 * sum);
+    }
+
+    const actual = await parallel.pageRank({ tolerance: 1e-12 });
+    let total = 0;
+    for (let v = 0; v < n; v++) {
+      expect(actual[v]).toBeCloseTo(rank[v], 8);
+      total += actual[v];
+    }
+    expect(total).toBeCloseTo(1, 8);
+  });
+});
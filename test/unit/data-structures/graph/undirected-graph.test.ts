@@ -601,3 +601,41 @@ describe('UndirectedGraph tarjan', () => {
   //   expect(getAsVerticesArrays(ccs)).toEqual([["K", "J", "I", "H", "D", "C", "B"], ["G", "F", "E"], ["A"]]);
   // });
 });
+
+describe('UndirectedGraph point-to-point paths', () => {
+  it('should agree with dijkstra in both directions', () => {
+    const graph = new UndirectedGraph<number>();
+    for (let i = 0; i < 50; i++) graph.addVertex(i);
+    for (let i = 0; i < 120; i++) {
+      const a = Math.floor(Math.random() * 50);
+      const b = Math.floor(Math.random() * 50);
+      if (a !== b && !graph.hasEdge(a, b)) graph.addEdge(a, b, Math.floor(Math.random() * 100));
+    }
+    const { distMap } = graph.dijkstra(7)!;
+    for (const [vertex, dist] of distMap) {
+      expect(graph.bidirectionalDijkstra(7, vertex)!.distance).toBe(dist);
+      expect(graph.bidirectionalDijkstra(vertex, 7)!.distance).toBe(dist);
+      expect(graph.aStar(vertex, 7)!.distance).toBe(dist);
+    }
+    const { distMap: allPairs } = graph.johnson()!;
+    for (const [vertex, dist] of distMap) expect(allPairs.get(vertex)!.get(graph.getVertex(7)!) ?? Infinity).toBe(dist);
+  });
+});
+
+describe('UndirectedGraph deep searches', () => {
+  it('should find the bridges of a long path without overflowing the stack', () => {
+    const graph = new UndirectedGraph<number>();
+    const n = 100000;
+    for (let i = 0; i < n; i++) graph.addVertex(i);
+    for (let i = 0; i < n - 1; i++) graph.addEdge(i, i + 1);
+    const { dfnMap, bridges, cutVertices } = graph.tarjan();
+    expect(dfnMap.size).toBe(n);
+    expect(bridges.length).toBe(n - 1);
+    expect(cutVertices.length).toBe(n - 2);
+
+    graph.addEdge(n - 1, 0);
+    expect(graph.getBridges().length).toBe(0);
+    expect(graph.getCutVertices().length).toBe(0);
+    expect(graph.cyclesIterator().next().value!.length).toBe(n);
+  });
+});
@@ -333,6 +333,94 @@ describe('HashMap', () => {
   });
 });
 
+describe('HashMap primitive keys', () => {
+  it('should hash numbers by value', () => {
+    const hm = new HashMap<number, string>();
+    hm.set(NaN, 'nan');
+    hm.set(-0, 'zero');
+    hm.set(0.5, 'half');
+    hm.set(2 ** 40, 'big');
+    expect(hm.get(NaN)).toBe('nan');
+    expect(hm.get(0)).toBe('zero');
+    expect(hm.get(0.5)).toBe('half');
+    expect(hm.get(2 ** 40)).toBe('big');
+    expect(hm.has(2 ** 40 + 1)).toBe(false);
+    expect(hm.size).toBe(4);
+  });
+
+  it('should keep number and string keys apart', () => {
+    const hm = new HashMap<number | string, string>();
+    hm.set(1, 'number');
+    hm.set('1', 'string');
+    expect(hm.size).toBe(2);
+    expect(hm.get(1)).toBe('number');
+    expect(hm.get('1')).toBe('string');
+  });
+
+  it('should hash other primitives with hashFn', () => {
+    const hm = new HashMap<boolean | undefined, number>([], { hashFn: key => `hash:${key}` });
+    hm.set(true, 1);
+    hm.set(undefined, 2);
+    expect(hm.get(true)).toBe(1);
+    expect(hm.get(undefined)).toBe(2);
+    expect(hm.get(false)).toBe(undefined);
+    expect(Object.keys(hm.store)).toEqual(['hash:true', 'hash:undefined']);
+  });
+
+  it('should keep symbol keys by identity', () => {
+    const first = Symbol('a');
+    const second = Symbol('a');
+    const hm = new HashMap<symbol | string, number>();
+    hm.set(first, 1);
+    hm.set(second, 2);
+    hm.set('Symbol(a)', 3);
+    expect(hm.size).toBe(3);
+    expect(hm.get(first)).toBe(1);
+    expect(hm.get(second)).toBe(2);
+    expect(hm.get('Symbol(a)')).toBe(3);
+    expect(hm.get(Symbol('a'))).toBe(undefined);
+    expect(hm.delete(first)).toBe(true);
+    expect(hm.has(first)).toBe(false);
+    expect(hm.get(second)).toBe(2);
+    expect(hm.size).toBe(2);
+  });
+
+  it('should iterate in insertion order across deletes and growth', () => {
+    const hm = new HashMap<number, number>();
+    const stdMap = new Map<number, number>();
+    const keys = getRandomIntArray(5000, -100000, 100000);
+    for (const key of keys) {
+      hm.set(key, key);
+      stdMap.set(key, key);
+    }
+    for (let i = 0; i < keys.length; i += 3) {
+      expect(hm.delete(keys[i])).toBe(stdMap.delete(keys[i]));
+      expect(hm.delete(keys[i])).toBe(false);
+    }
+    for (let i = 0; i < keys.length; i += 6) {
+      hm.set(keys[i], -keys[i]);
+      stdMap.set(keys[i], -keys[i]);
+    }
+    expect(hm.size).toBe(stdMap.size);
+    expect([...hm]).toEqual([...stdMap]);
+  });
+
+  it('should reserve capacity and bulk load', () => {
+    const entries: [number, number][] = [];
+    for (let i = 0; i < 1000; i++) entries.push([i * 7, i]);
+    const hm = new HashMap<number, number>([], { initialCapacity: 1000 });
+    const rehashSpy = jest.spyOn(hm as any, '_rehash');
+    hm.bulkLoad(entries);
+    expect(rehashSpy).toHaveBeenCalledTimes(0);
+    expect(hm.size).toBe(1000);
+    expect(hm.get(7 * 999)).toBe(999);
+
+    const loaded = new HashMap<number, number>(entries);
+    expect([...loaded]).toEqual(entries);
+    expect([...loaded.clone()]).toEqual(entries);
+  });
+});
+
 describe('LinkedHashMap', () => {
   let hashMap: LinkedHashMap;
 
@@ -360,6 +448,14 @@ describe('LinkedHashMap', () => {
     expect(hashMap.get(999)).toEqual({ a: '999Value' });
   });
 
+  it('should keep number and string keys apart', () => {
+    hashMap.set(1, 'number');
+    hashMap.set('1', 'string');
+    expect(hashMap.size).toBe(2);
+    expect(hashMap.get(1)).toBe('number');
+    expect(hashMap.get('1')).toBe('string');
+  });
+
   it('should update the value for an existing key', () => {
     hashMap.set('key1', 'value1');
     hashMap.set('key1', 'newValue');
@@ -647,4 +743,38 @@ describe('LinkedHashMap', () => {
       // hm.print();
     });
   });
+
+  describe('capacity and bulk load', () => {
+    it('should bulk load with an initial capacity', () => {
+      const entries: [number, string][] = [];
+      for (let i = 0; i < 1000; i++) entries.push([i, `${i}`]);
+      const lhm = new LinkedHashMap<number, string>([], { initialCapacity: 1000 });
+      lhm.bulkLoad(entries);
+      expect(lhm.size).toBe(1000);
+      expect(lhm.first).toEqual([0, '0']);
+      expect(lhm.last).toEqual([999, '999']);
+      expect(lhm.get(500)).toBe('500');
+      expect([...lhm.clone()]).toEqual(entries);
+    });
+
+    it('should index keys by a custom hashFn', () => {
+      const lhm = new LinkedHashMap<string, number>([], { hashFn: key => key.toLowerCase() });
+      lhm.set('Key', 1);
+      lhm.set('KEY', 2);
+      expect(lhm.size).toBe(1);
+      expect(lhm.get('key')).toBe(2);
+      expect(lhm.delete('kEy')).toBe(true);
+      expect(lhm.isEmpty()).toBe(true);
+    });
+
+    it('should forget object keys on clear', () => {
+      const lhm = new LinkedHashMap<object, number>();
+      const key = {};
+      lhm.set(key, 1);
+      lhm.clear();
+      expect(lhm.has(key)).toBe(false);
+      lhm.set(key, 2);
+      expect(lhm.size).toBe(1);
+    });
+  });
 });
@@ -0,0 +1,120 @@
+import { LFUCache } from '../../../../src';
+
+describe('LFUCache', () => {
+  let now: number;
+  const realNow = Date.now;
+
+  beforeEach(() => {
+    now = 1000;
+    Date.now = () => now;
+  });
+
+  afterEach(() => {
+    Date.now = realNow;
+  });
+
+  it('should evict the least frequently used entry', () => {
+    const evicted: [number, string | undefined, string][] = [];
+    const cache = new LFUCache<number, string>([], {
+      maxSize: 2,
+      onEvict: (key, value, reason) => evicted.push([key, value, reason])
+    });
+    cache.set(1, 'a');
+    cache.set(2, 'b');
+    cache.get(1);
+    cache.get(1);
+    expect(cache.frequency(1)).toBe(3);
+    expect(cache.frequency(2)).toBe(1);
+    cache.set(3, 'c');
+    expect(cache.has(2)).toBe(false);
+    expect(evicted).toEqual([[2, 'b', 'evicted']]);
+    expect([...cache.keys()]).toEqual([3, 1]);
+  });
+
+  it('should break ties by recency', () => {
+    const cache = new LFUCache<string, number>([], { maxSize: 3 });
+    cache.set('a', 1);
+    cache.set('b', 2);
+    cache.set('c', 3);
+    cache.get('a');
+    cache.get('b');
+    cache.set('d', 4);
+    expect([...cache.keys()]).toEqual(['d', 'a', 'b']);
+    cache.get('d');
+    cache.set('e', 5);
+    expect([...cache.keys()]).toEqual(['e', 'b', 'd']);
+  });
+
+  it('should not count peek and has', () => {
+    const cache = new LFUCache<number, number>();
+    cache.set(1, 1);
+    cache.peek(1);
+    cache.has(1);
+    expect(cache.frequency(1)).toBe(1);
+    cache.set(1, 2);
+    expect(cache.frequency(1)).toBe(2);
+    expect(cache.peek(1)).toBe(2);
+    expect(cache.frequency(5)).toBe(0);
+  });
+
+  it('should delete and keep buckets consistent', () => {
+    const cache = new LFUCache<number, number>([
+      [1, 1],
+      [2, 2],
+      [3, 3]
+    ]);
+    cache.get(2);
+    expect(cache.delete(2)).toBe(true);
+    expect(cache.delete(2)).toBe(false);
+    cache.get(3);
+    expect([...cache]).toEqual([
+      [1, 1],
+      [3, 3]
+    ]);
+    expect(cache.size).toBe(2);
+  });
+
+  it('should expire entries lazily and on prune', () => {
+    const evicted: string[] = [];
+    const cache = new LFUCache<string, number>([], {
+      ttl: 100,
+      onEvict: (key, value, reason) => evicted.push(`${key}:${reason}`)
+    });
+    cache.set('a', 1);
+    cache.set('b', 2, Infinity);
+    cache.set('c', 3, 50);
+    now += 50;
+    expect(cache.get('c')).toBe(undefined);
+    now += 50;
+    expect(cache.size).toBe(2);
+    expect(cache.prune()).toBe(1);
+    expect(cache.get('b')).toBe(2);
+    expect(evicted).toEqual(['c:expired', 'a:expired']);
+  });
+
+  it('should clone with access counts', () => {
+    const cache = new LFUCache<number, number>([], { maxSize: 2 });
+    cache.set(1, 1);
+    cache.set(2, 2);
+    cache.get(1);
+    const cloned = cache.clone();
+    expect(cloned.frequency(1)).toBe(2);
+    cloned.set(3, 3);
+    expect([...cloned.keys()]).toEqual([3, 1]);
+    expect([...cache.keys()]).toEqual([2, 1]);
+  });
+
+  it('should map, filter and clear', () => {
+    const cache = new LFUCache<number, number>([
+      [1, 1],
+      [2, 2],
+      [3, 3]
+    ]);
+    expect([...cache.map(value => value! * 10).values()]).toEqual([10, 20, 30]);
+    expect([...cache.filter((value, key) => key !== 2).keys()]).toEqual([1, 3]);
+    cache.clear();
+    expect(cache.isEmpty()).toBe(true);
+    cache.set(4, 4);
+    expect([...cache]).toEqual([[4, 4]]);
+  });
+});
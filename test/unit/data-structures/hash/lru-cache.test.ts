@@ -0,0 +1,145 @@
+import { LRUCache } from '../../../../src';
+
+describe('LRUCache', () => {
+  let now: number;
+  const realNow = Date.now;
+
+  beforeEach(() => {
+    now = 1000;
+    Date.now = () => now;
+  });
+
+  afterEach(() => {
+    Date.now = realNow;
+  });
+
+  it('should evict the least recently used entry beyond maxSize', () => {
+    const evicted: [number, string | undefined, string][] = [];
+    const cache = new LRUCache<number, string>([], {
+      maxSize: 2,
+      onEvict: (key, value, reason) => evicted.push([key, value, reason])
+    });
+    cache.set(1, 'a');
+    cache.set(2, 'b');
+    expect(cache.get(1)).toBe('a');
+    cache.set(3, 'c');
+    expect(cache.has(2)).toBe(false);
+    expect([...cache.keys()]).toEqual([1, 3]);
+    expect(evicted).toEqual([[2, 'b', 'evicted']]);
+    expect(cache.size).toBe(2);
+    expect(cache.noObjMap.size).toBe(2);
+  });
+
+  it('should promote on set and not on peek or has', () => {
+    const cache = new LRUCache<string, number>([], { maxSize: 3 });
+    cache.set('a', 1);
+    cache.set('b', 2);
+    cache.set('c', 3);
+    cache.set('a', 10);
+    expect([...cache.keys()]).toEqual(['b', 'c', 'a']);
+    expect(cache.peek('b')).toBe(2);
+    expect(cache.has('c')).toBe(true);
+    expect([...cache.keys()]).toEqual(['b', 'c', 'a']);
+    cache.set('d', 4);
+    expect([...cache]).toEqual([
+      ['c', 3],
+      ['a', 10],
+      ['d', 4]
+    ]);
+    expect(cache.first).toEqual(['c', 3]);
+    expect(cache.last).toEqual(['d', 4]);
+  });
+
+  it('should bound the total weight', () => {
+    const cache = new LRUCache<string, string>([], { maxWeight: 10, weightFn: value => value!.length });
+    cache.set('a', 'xxxx');
+    cache.set('b', 'yyyy');
+    expect(cache.weight).toBe(8);
+    cache.set('c', 'zzzz');
+    expect([...cache.keys()]).toEqual(['b', 'c']);
+    expect(cache.weight).toBe(8);
+    cache.set('b', 'y');
+    expect(cache.weight).toBe(5);
+    cache.delete('c');
+    expect(cache.weight).toBe(1);
+    cache.set('big', 'x'.repeat(11));
+    expect(cache.size).toBe(0);
+    expect(cache.weight).toBe(0);
+  });
+
+  it('should expire entries lazily', () => {
+    const evicted: string[] = [];
+    const cache = new LRUCache<string, number>([], {
+      ttl: 100,
+      onEvict: (key, value, reason) => evicted.push(`${key}:${reason}`)
+    });
+    cache.set('a', 1);
+    cache.set('b', 2, 500);
+    cache.set('c', 3, Infinity);
+    now += 100;
+    expect(cache.size).toBe(3);
+    expect(cache.get('a')).toBe(undefined);
+    expect(cache.size).toBe(2);
+    expect(cache.get('b')).toBe(2);
+    now += 400;
+    expect(cache.has('b')).toBe(false);
+    expect(cache.get('c')).toBe(3);
+    expect(evicted).toEqual(['a:expired', 'b:expired']);
+  });
+
+  it('should prune expired entries', () => {
+    const cache = new LRUCache<number, number>([], { ttl: 10 });
+    for (let i = 0; i < 5; i++) cache.set(i, i, i % 2 ? Infinity : 10);
+    now += 10;
+    expect(cache.prune()).toBe(3);
+    expect([...cache.keys()]).toEqual([1, 3]);
+  });
+
+  it('should keep object keys and load from a collection', () => {
+    const x = { id: 1 },
+      y = { id: 2 };
+    const cache = new LRUCache<object, number>(
+      [
+        [x, 1],
+        [y, 2]
+      ],
+      { maxSize: 1 }
+    );
+    expect(cache.size).toBe(1);
+    expect(cache.get(y)).toBe(2);
+    expect(cache.get(x)).toBe(undefined);
+  });
+
+  it('should clone with options and order', () => {
+    const cache = new LRUCache<number, number>([], { maxSize: 3 });
+    cache.set(1, 1);
+    cache.set(2, 2);
+    cache.get(1);
+    const cloned = cache.clone();
+    expect([...cloned.keys()]).toEqual([2, 1]);
+    cloned.set(3, 3);
+    cloned.set(4, 4);
+    expect([...cloned.keys()]).toEqual([1, 3, 4]);
+    expect([...cache.keys()]).toEqual([2, 1]);
+  });
+
+  it('should clear and stay usable', () => {
+    const cache = new LRUCache<number, number>([], { maxSize: 2 });
+    cache.set(1, 1);
+    cache.set(2, 2);
+    cache.clear();
+    expect(cache.isEmpty()).toBe(true);
+    expect(cache.weight).toBe(0);
+    cache.set(3, 3);
+    expect([...cache]).toEqual([[3, 3]]);
+  });
+
+  it('should remove keys from the index on deleteAt', () => {
+    const cache = new LRUCache<number, number>();
+    cache.set(1, 1);
+    cache.set(2, 2);
+    cache.deleteAt(0);
+    expect(cache.has(1)).toBe(false);
+    expect(cache.weight).toBe(1);
+  });
+});
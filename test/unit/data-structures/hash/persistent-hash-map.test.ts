@@ -0,0 +1,101 @@
+import { PersistentHashMap } from '../../../../src';
+
+describe('PersistentHashMap', () => {
+  it('should compare keys like Map', () => {
+    const key = { id: 1 };
+    const map = new PersistentHashMap<unknown, string>([
+      [1, 'number'],
+      ['1', 'string'],
+      [key, 'object'],
+      [NaN, 'nan'],
+      [true, 'boolean']
+    ]);
+    map.set(-0, 'zero');
+    expect(map.size).toBe(6);
+    expect(map.get(1)).toBe('number');
+    expect(map.get('1')).toBe('string');
+    expect(map.get(key)).toBe('object');
+    expect(map.get({ id: 1 })).toBeUndefined();
+    expect(map.get(NaN)).toBe('nan');
+    expect(map.get(0)).toBe('zero');
+    expect(map.get('true')).toBeUndefined();
+    expect(map.delete('missing')).toBe(false);
+    expect(map.delete(key)).toBe(true);
+    expect(map.has(key)).toBe(false);
+    expect(map.size).toBe(5);
+  });
+
+  it('should keep snapshots unchanged', () => {
+    const map = new PersistentHashMap<number, number>();
+    for (let i = 0; i < 2000; i++) map.set(i, i);
+    const snapshot = map.snapshot();
+    expect(snapshot.root).toBe(map.root);
+    map.set(0, -1);
+    map.delete(1);
+    map.set(5000, 5000);
+    expect(snapshot.get(0)).toBe(0);
+    expect(snapshot.get(1)).toBe(1);
+    expect(snapshot.has(5000)).toBe(false);
+    expect(snapshot.size).toBe(2000);
+    expect(map.size).toBe(2000);
+    snapshot.clear();
+    expect(map.get(2)).toBe(2);
+  });
+
+  it('should handle keys with equal hashes', () => {
+    class CollidingMap extends PersistentHashMap<number, number> {
+      protected override _hash(key: number): number {
+        return key % 3;
+      }
+    }
+    const map = new CollidingMap();
+    for (let i = 0; i < 30; i++) map.set(i, i);
+    const snapshot = map.snapshot();
+    for (let i = 0; i < 30; i += 2) map.delete(i);
+    expect(map.size).toBe(15);
+    expect([...map.keys()].sort((a, b) => a - b)).toEqual(Array.from({ length: 15 }, (_, i) => 2 * i + 1));
+    expect(snapshot.size).toBe(30);
+    for (let i = 0; i < 30; i++) expect(snapshot.get(i)).toBe(i);
+  });
+
+  it('should agree with a Map under random operations', () => {
+    const map = new PersistentHashMap<number | string, number>();
+    const model = new Map<number | string, number>();
+    const versions: [PersistentHashMap<number | string, number>, Map<number | string, number>][] = [];
+    for (let i = 0; i < 10000; i++) {
+      const n = Math.floor(Math.random() * 1000);
+      const key = Math.random() < 0.5 ? n : `k${n}`;
+      if (Math.random() < 0.6) {
+        map.set(key, i);
+        model.set(key, i);
+      } else {
+        expect(map.delete(key)).toBe(model.delete(key));
+      }
+      if (i % 500 === 0) versions.push([map.snapshot(), new Map(model)]);
+    }
+    versions.push([map, model]);
+    for (const [version, expected] of versions) {
+      expect(version.size).toBe(expected.size);
+      expect(new Map(version)).toEqual(expected);
+    }
+    for (const key of [...model.keys()]) map.delete(key);
+    expect(map.isEmpty()).toBe(true);
+    expect(map.root.children.length).toBe(0);
+  });
+
+  it('should filter and map into new maps', () => {
+    const map = new PersistentHashMap<string, number>([
+      ['a', 1],
+      ['b', 2],
+      ['c', 3]
+    ]);
+    expect(new Map(map.filter(value => value % 2 === 1))).toEqual(
+      new Map([
+        ['a', 1],
+        ['c', 3]
+      ])
+    );
+    expect(map.map(value => value * 10).get('b')).toBe(20);
+    expect(map.clone().get('c')).toBe(3);
+  });
+});
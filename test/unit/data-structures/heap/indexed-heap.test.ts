@@ -0,0 +1,116 @@
+import { IndexedHeap } from '../../../../src';
+import { getRandomIntArray } from '../../../utils';
+
+describe('IndexedHeap', () => {
+  it('should poll handles in priority order', () => {
+    const heap = new IndexedHeap();
+    heap.add(3, 30);
+    heap.add(1, 10);
+    heap.add(4, 5);
+    heap.add(0, 20);
+    expect(heap.size).toBe(4);
+    expect(heap.peek()).toBe(4);
+    expect(heap.peekPriority()).toBe(5);
+    expect(heap.getPriority(0)).toBe(20);
+    expect(heap.getPriority(2)).toBe(undefined);
+    expect([heap.poll(), heap.poll(), heap.poll(), heap.poll()]).toEqual([4, 1, 0, 3]);
+    expect(heap.poll()).toBe(undefined);
+    expect(heap.peekPriority()).toBe(undefined);
+    expect(heap.isEmpty()).toBe(true);
+  });
+
+  it('should decrease, update and remove in place', () => {
+    const heap = new IndexedHeap([
+      [0, 5],
+      [1, 6],
+      [2, 7],
+      [3, 8]
+    ]);
+    expect(heap.decreaseKey(3, 1)).toBe(true);
+    expect(heap.peek()).toBe(3);
+    expect(heap.decreaseKey(3, 2)).toBe(false);
+    expect(heap.decreaseKey(9, 0)).toBe(false);
+    expect(heap.update(3, 10)).toBe(true);
+    expect(heap.peek()).toBe(0);
+    expect(heap.remove(0)).toBe(true);
+    expect(heap.remove(0)).toBe(false);
+    expect(heap.has(0)).toBe(false);
+    heap.add(1, 0);
+    expect(heap.size).toBe(3);
+    expect([heap.poll(), heap.poll(), heap.poll()]).toEqual([1, 2, 3]);
+  });
+
+  it('should grow past its capacity and reject bad handles', () => {
+    const heap = new IndexedHeap([], { capacity: 2 });
+    heap.add(100, 1);
+    expect(heap.capacity).toBeGreaterThan(100);
+    expect(heap.peek()).toBe(100);
+    expect(() => heap.add(-1, 0)).toThrow();
+    expect(() => heap.add(1.5, 0)).toThrow();
+    expect(() => new IndexedHeap([], { arity: 1 })).toThrow();
+    expect(new IndexedHeap([], { capacity: 10.5 }).capacity).toBe(11);
+  });
+
+  it('should put the greatest priority on top with isMax', () => {
+    const heap = new IndexedHeap([], { isMax: true, arity: 4 });
+    for (let i = 0; i < 10; i++) heap.add(i, i);
+    expect(heap.peekPriority()).toBe(9);
+    expect(heap.decreaseKey(0, 100)).toBe(true);
+    expect(heap.poll()).toBe(0);
+    expect([...heap.map(priority => -priority)].length).toBe(9);
+    expect(heap.map(priority => -priority).peek()).toBe(1);
+  });
+
+  it('should match a sorted reference for every arity', () => {
+    for (const arity of [2, 3, 4, 8]) {
+      const heap = new IndexedHeap([], { arity });
+      const priorities = getRandomIntArray(500, 0, 1000);
+      const expected = new Map<number, number>();
+      priorities.forEach((priority, handle) => {
+        heap.add(handle, priority);
+        expected.set(handle, priority);
+      });
+      for (let handle = 0; handle < 500; handle += 3) {
+        const priority = priorities[handle] - 500;
+        heap.update(handle, priority);
+        expected.set(handle, priority);
+      }
+      for (let handle = 1; handle < 500; handle += 7) {
+        heap.remove(handle);
+        expected.delete(handle);
+      }
+      const sorted = [...expected.values()].sort((a, b) => a - b);
+      const polled: number[] = [];
+      while (!heap.isEmpty()) {
+        polled.push(heap.peekPriority()!);
+        heap.poll();
+      }
+      expect(polled).toEqual(sorted);
+    }
+  });
+
+  it('should clone, filter and clear', () => {
+    const heap = new IndexedHeap([
+      [0, 3],
+      [1, 1],
+      [2, 2]
+    ]);
+    const cloned = heap.clone();
+    cloned.poll();
+    expect(heap.size).toBe(3);
+    expect(cloned.peek()).toBe(2);
+    const filtered = heap.filter(priority => priority > 1);
+    expect(filtered.peek()).toBe(2);
+    expect(filtered.has(1)).toBe(false);
+    expect([...heap].sort((a, b) => a[0] - b[0])).toEqual([
+      [0, 3],
+      [1, 1],
+      [2, 2]
+    ]);
+    heap.clear();
+    expect(heap.size).toBe(0);
+    expect(heap.has(0)).toBe(false);
+    heap.add(0, 1);
+    expect(heap.peek()).toBe(0);
+  });
+});
@@ -0,0 +1,72 @@
+import { PairingHeap, PairingHeapNode } from '../../../../src';
+import { getRandomIntArray } from '../../../utils';
+
+describe('PairingHeap', () => {
+  it('should poll numbers in ascending order', () => {
+    const heap = new PairingHeap<number>([5, 1, 4, 2, 3]);
+    expect(heap.size).toBe(5);
+    expect(heap.peek()).toBe(1);
+    expect(heap.sort()).toEqual([1, 2, 3, 4, 5]);
+    expect([heap.poll(), heap.poll()]).toEqual([1, 2]);
+    expect(heap.size).toBe(3);
+    heap.clear();
+    expect(heap.isEmpty()).toBe(true);
+    expect(heap.poll()).toBe(undefined);
+    expect(heap.peek()).toBe(undefined);
+  });
+
+  it('should decrease keys and delete nodes through their handles', () => {
+    const heap = new PairingHeap<{ key: number }>([], { comparator: (a, b) => a.key - b.key });
+    const nodes: PairingHeapNode<{ key: number }>[] = [];
+    for (let i = 0; i < 10; i++) nodes.push(heap.addNode({ key: i * 10 }));
+    heap.poll();
+    expect(heap.decreaseKey(nodes[7], { key: 5 })).toBe(true);
+    expect(heap.decreaseKey(nodes[8], { key: 100 })).toBe(false);
+    expect(heap.peek()?.key).toBe(5);
+    expect(heap.deleteNode(nodes[3])).toBe(true);
+    expect(heap.deleteNode(nodes[7])).toBe(true);
+    expect(heap.size).toBe(7);
+    expect(heap.sort().map(item => item.key)).toEqual([10, 20, 40, 50, 60, 80, 90]);
+  });
+
+  it('should match a sorted reference under random operations', () => {
+    const heap = new PairingHeap<number>();
+    const nodes = getRandomIntArray(1000, 0, 10000).map(key => heap.addNode(key));
+    const expected: number[] = [];
+    nodes.forEach((node, i) => {
+      if (i % 5 === 0) {
+        heap.deleteNode(node);
+      } else {
+        if (i % 3 === 0) heap.decreaseKey(node, node.element - 5000);
+        expected.push(node.element);
+      }
+    });
+    expected.sort((a, b) => a - b);
+    expect([...heap].length).toBe(expected.length);
+    const polled: number[] = [];
+    while (!heap.isEmpty()) polled.push(heap.poll()!);
+    expect(polled).toEqual(expected);
+  });
+
+  it('should merge in place', () => {
+    const a = new PairingHeap<number>([5, 3, 9]);
+    const b = new PairingHeap<number>([4, 1]);
+    a.merge(b);
+    expect(b.size).toBe(0);
+    expect(a.size).toBe(5);
+    expect(a.sort()).toEqual([1, 3, 4, 5, 9]);
+  });
+
+  it('should clone, filter and map', () => {
+    const heap = new PairingHeap<number>([3, 1, 2]);
+    const cloned = heap.clone();
+    cloned.poll();
+    expect(heap.peek()).toBe(1);
+    expect(heap.filter(n => n > 1).sort()).toEqual([2, 3]);
+    const mapped = heap.map(
+      n => `${n}`,
+      (a, b) => b.localeCompare(a)
+    );
+    expect(mapped.sort()).toEqual(['3', '2', '1']);
+  });
+});
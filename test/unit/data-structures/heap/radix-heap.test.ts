@@ -0,0 +1,68 @@
+import { RadixHeap } from '../../../../src';
+import { getRandomIntArray } from '../../../utils';
+
+describe('RadixHeap', () => {
+  it('should poll entries in priority order', () => {
+    const heap = new RadixHeap<string>([
+      [30, 'c'],
+      [10, 'a'],
+      [20, 'b']
+    ]);
+    expect(heap.size).toBe(3);
+    expect(heap.peek()).toBe('a');
+    expect(heap.peekPriority()).toBe(10);
+    expect(heap.poll()).toBe('a');
+    expect(heap.last).toBe(10);
+    heap.add(15, 'd');
+    expect([heap.poll(), heap.poll(), heap.poll()]).toEqual(['d', 'b', 'c']);
+    expect(heap.poll()).toBe(undefined);
+    expect(heap.peekPriority()).toBe(undefined);
+  });
+
+  it('should reject priorities below the last one polled', () => {
+    const heap = new RadixHeap();
+    heap.add(5);
+    heap.poll();
+    expect(() => heap.add(4)).toThrow();
+    expect(() => heap.add(-1)).toThrow();
+    expect(() => heap.add(1.5)).toThrow();
+    expect(heap.add(5)).toBe(true);
+    heap.clear();
+    expect(heap.last).toBe(0);
+    expect(heap.add(0)).toBe(true);
+  });
+
+  it('should behave as a sorted queue for monotone workloads', () => {
+    const heap = new RadixHeap<number>();
+    const reference: number[] = [];
+    for (const priority of getRandomIntArray(200, 0, 1 << 30)) {
+      heap.add(priority);
+      reference.push(priority);
+    }
+    for (let round = 0; round < 2000; round++) {
+      reference.sort((a, b) => a - b);
+      const min = reference.shift()!;
+      expect(heap.poll()).toBe(min);
+      const next = min + Math.floor(Math.random() * 1000);
+      heap.add(next, next);
+      reference.push(next);
+    }
+    expect(heap.size).toBe(reference.length);
+    expect([...heap].map(([priority]) => priority).sort((a, b) => a - b)).toEqual(reference.sort((a, b) => a - b));
+  });
+
+  it('should clone, filter and map with the same last priority', () => {
+    const heap = new RadixHeap<string>([
+      [1, 'a'],
+      [2, 'b'],
+      [3, 'c']
+    ]);
+    heap.poll();
+    const cloned = heap.clone();
+    expect(cloned.last).toBe(1);
+    expect(cloned.poll()).toBe('b');
+    expect(heap.size).toBe(2);
+    expect(heap.filter(element => element !== 'b').poll()).toBe('c');
+    expect(heap.map(element => element.toUpperCase()).poll()).toBe('B');
+  });
+});
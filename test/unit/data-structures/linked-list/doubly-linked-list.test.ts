@@ -470,3 +470,33 @@ describe('iterable methods', () => {
     expect(dl.some(value => value > 100)).toBe(false);
   });
 });
+
+describe('DoublyLinkedList node pool and moves', () => {
+  it('should reuse removed nodes up to nodePoolSize', () => {
+    const list = new DoublyLinkedList<number>([1, 2, 3, 4], { nodePoolSize: 3 });
+    list.delete(2);
+    list.deleteAt(1);
+    list.shift();
+    list.pop();
+    expect(list.pooledNodeCount).toBe(3);
+    expect(list.isEmpty()).toBe(true);
+    for (let i = 0; i < 5; i++) list.push(i);
+    expect(list.pooledNodeCount).toBe(0);
+    expect(list.toArray()).toEqual([0, 1, 2, 3, 4]);
+    expect(list.toReversedArray()).toEqual([4, 3, 2, 1, 0]);
+  });
+
+  it('should move nodes to the front and back in place', () => {
+    const list = new DoublyLinkedList<string>(['a', 'b', 'c']);
+    const b = list.getNode('b')!;
+    expect(list.moveToFront(b)).toBe(b);
+    expect(list.toArray()).toEqual(['b', 'a', 'c']);
+    list.moveToBack(list.head!);
+    expect(list.toArray()).toEqual(['a', 'c', 'b']);
+    list.moveToFront(list.tail!);
+    list.moveToFront(list.head!);
+    expect(list.toArray()).toEqual(['b', 'a', 'c']);
+    expect(list.toReversedArray()).toEqual(['c', 'a', 'b']);
+    expect(list.size).toBe(3);
+  });
+});
@@ -0,0 +1,66 @@
+import { IntrusiveLinkedList } from '../../../../src';
+
+class Order {
+  prev: Order | undefined = undefined;
+  next: Order | undefined = undefined;
+
+  constructor(public id: number) {}
+}
+
+const ids = (list: IntrusiveLinkedList<Order>) => list.map(order => order.id);
+
+describe('IntrusiveLinkedList', () => {
+  it('should link the caller objects without wrapping them', () => {
+    const orders = [1, 2, 3].map(id => new Order(id));
+    const list = new IntrusiveLinkedList<Order>(orders);
+    expect(list.size).toBe(3);
+    expect(list.head).toBe(orders[0]);
+    expect(orders[1].prev).toBe(orders[0]);
+    expect(orders[1].next).toBe(orders[2]);
+    expect(ids(list)).toEqual([1, 2, 3]);
+  });
+
+  it('should remove and move elements by handle', () => {
+    const orders = [1, 2, 3, 4].map(id => new Order(id));
+    const list = new IntrusiveLinkedList<Order>(orders);
+    expect(list.remove(orders[1])).toBe(orders[1]);
+    expect(orders[1].prev).toBe(undefined);
+    expect(list.has(orders[1])).toBe(false);
+    expect(ids(list)).toEqual([1, 3, 4]);
+
+    list.moveToFront(orders[3]);
+    expect(ids(list)).toEqual([4, 1, 3]);
+    list.moveToBack(orders[3]);
+    expect(ids(list)).toEqual([1, 3, 4]);
+    list.addBefore(orders[2], orders[1]);
+    list.addAfter(orders[3], new Order(5));
+    expect(ids(list)).toEqual([1, 2, 3, 4, 5]);
+    expect(list.size).toBe(5);
+    expect(list.has(orders[0])).toBe(true);
+
+    expect(list.shift()).toBe(orders[0]);
+    expect(list.pop()?.id).toBe(5);
+    expect(list.tail).toBe(orders[3]);
+    expect(ids(list)).toEqual([2, 3, 4]);
+  });
+
+  it('should allow removing the current element while iterating', () => {
+    const list = new IntrusiveLinkedList<Order>([1, 2, 3, 4].map(id => new Order(id)));
+    for (const order of list) if (order.id % 2 === 0) list.remove(order);
+    expect(ids(list)).toEqual([1, 3]);
+  });
+
+  it('should reset every element on clear', () => {
+    const orders = [1, 2].map(id => new Order(id));
+    const list = new IntrusiveLinkedList<Order>(orders);
+    list.clear();
+    expect(list.isEmpty()).toBe(true);
+    expect(orders[0].next).toBe(undefined);
+    const other = new IntrusiveLinkedList<Order>();
+    other.unshift(orders[1]);
+    other.unshift(orders[0]);
+    expect(ids(other)).toEqual([1, 2]);
+    expect(other.clone()).toEqual(orders);
+    expect(other.filter(order => order.id > 1)).toEqual([orders[1]]);
+  });
+});
@@ -513,3 +513,30 @@ describe('iterable methods', () => {
     expect(sl.reduce((accumulator, element) => accumulator + element, 0)).toEqual(6);
   });
 });
+
+describe('SinglyLinkedList node pool', () => {
+  it('should reuse removed nodes up to nodePoolSize', () => {
+    const list = new SinglyLinkedList<number>([1, 2, 3], { nodePoolSize: 2 });
+    const head = list.head;
+    expect(list.shift()).toBe(1);
+    expect(list.pop()).toBe(3);
+    expect(list.pop()).toBe(2);
+    expect(list.pooledNodeCount).toBe(2);
+    expect(list.tail).toBe(undefined);
+
+    list.push(10);
+    list.unshift(9);
+    expect(list.pooledNodeCount).toBe(0);
+    expect(list.toArray()).toEqual([9, 10]);
+    expect([list.head, list.tail]).toContain(head);
+    list.addAt(1, 11);
+    expect(list.toArray()).toEqual([9, 11, 10]);
+  });
+
+  it('should not pool by default and should keep the option in clone', () => {
+    const list = new SinglyLinkedList<number>([1, 2]);
+    list.shift();
+    expect(list.pooledNodeCount).toBe(0);
+    expect(new SinglyLinkedList<number>([], { nodePoolSize: 8 }).clone().nodePoolSize).toBe(8);
+  });
+});
@@ -84,3 +84,108 @@ describe('SkipList Test2', () => {
     expect(skipList.lower(1)).toBe(undefined);
   });
 });
+
+describe('SkipList event index', () => {
+  it('should build the same shape from the same seed', () => {
+    const a = new SkipList<number, number>([], { seed: 42 });
+    const b = new SkipList<number, number>([], { seed: 42 });
+    const levels = (list: SkipList<number, number>) => {
+      const result: number[] = [];
+      for (let node = list.head.forward[0]; node; node = node.forward[0]) result.push(node.forward.length);
+      return result;
+    };
+    for (let i = 0; i < 200; i++) {
+      a.add(i, i);
+      b.add(i, i);
+    }
+    expect(a.seed).toBe(42);
+    expect(levels(a)).toEqual(levels(b));
+    a.clear();
+    expect(a.size).toBe(0);
+    expect(a.first).toBeUndefined();
+    for (let i = 0; i < 200; i++) a.add(i, i);
+    expect(levels(a)).toEqual(levels(b));
+  });
+
+  it('should draw levels with the requested probability', () => {
+    for (const probability of [0.5, 0.25, 0.3]) {
+      const list = new SkipList<number, number>([], { probability, maxLevel: 32, seed: 7 });
+      list.addSorted(Array.from({ length: 20000 }, (_, i): [number, number] => [i, i]));
+      let total = 0;
+      for (let node = list.head.forward[0]; node; node = node.forward[0]) total += node.forward.length;
+      expect(total / list.size).toBeCloseTo(1 / (1 - probability), 1);
+    }
+  });
+
+  it('should bulk append sorted entries', () => {
+    const list = new SkipList<number, string>();
+    expect(list.addSorted([[1, 'a'], [3, 'c'], [3, 'd'], [5, 'e']])).toBe(4);
+    list.addSorted([[5, 'f'], [8, 'h']]);
+    expect(list.size).toBe(6);
+    expect([...list]).toEqual([[1, 'a'], [3, 'c'], [3, 'd'], [5, 'e'], [5, 'f'], [8, 'h']]);
+    expect(list.get(8)).toBe('h');
+    expect(list.higher(5)).toBe('h');
+    list.add(4, 'x');
+    expect(list.get(4)).toBe('x');
+    expect(() => list.addSorted([[9, 'i'], [2, 'b']])).toThrow();
+    expect(list.size).toBe(8);
+    expect(list.lastEntry()).toEqual([9, 'i']);
+  });
+
+  it('should iterate a range and poll in time order', () => {
+    const list = new SkipList<number, string>();
+    const keys = [50, 10, 30, 20, 40, 30];
+    keys.forEach((key, i) => list.add(key, `e${i}`));
+    expect(list.size).toBe(6);
+    expect([...list.range(15, 30)]).toEqual([[20, 'e3'], [30, 'e2'], [30, 'e5']]);
+    expect([...list.range(60, 70)]).toEqual([]);
+    expect(list.firstEntry()).toEqual([10, 'e1']);
+    expect(list.lastEntry()).toEqual([50, 'e0']);
+
+    const polled: string[] = [];
+    let entry;
+    while ((entry = list.pollFirst())) polled.push(entry[1]);
+    expect(polled).toEqual(['e1', 'e3', 'e2', 'e5', 'e4', 'e0']);
+    expect(list.isEmpty()).toBe(true);
+    expect(list.level).toBe(0);
+    expect(list.pollFirst()).toBeUndefined();
+    expect(list.firstEntry()).toBeUndefined();
+    expect(list.lastEntry()).toBeUndefined();
+  });
+
+  it('should keep a running range going while nodes are added and deleted', () => {
+    const list = new SkipList<number, number>();
+    for (let i = 0; i < 10; i += 2) list.add(i, i);
+    const seen: number[] = [];
+    for (const [key] of list.range(0, 9)) {
+      seen.push(key);
+      if (key === 4) list.add(5, 5);
+      list.delete(key);
+    }
+    expect(seen).toEqual([0, 2, 4, 5, 6, 8]);
+    expect(list.size).toBe(0);
+  });
+
+  it('should agree with a sorted array under random operations', () => {
+    const list = new SkipList<number, number>([], { seed: 3 });
+    const model: number[] = [];
+    for (let i = 0; i < 3000; i++) {
+      const key = Math.floor(Math.random() * 500);
+      const op = Math.random();
+      if (op < 0.5) {
+        list.add(key, key);
+        model.push(key);
+        model.sort((a, b) => a - b);
+      } else if (op < 0.8) {
+        const index = model.indexOf(key);
+        expect(list.delete(key)).toBe(index >= 0);
+        if (index >= 0) model.splice(index, 1);
+      } else {
+        expect(list.pollFirst()?.[0]).toBe(model.shift());
+      }
+      expect(list.size).toBe(model.length);
+    }
+    expect([...list].map(([key]) => key)).toEqual(model);
+    expect([...list.range(100, 200)].map(([key]) => key)).toEqual(model.filter(key => key >= 100 && key <= 200));
+  });
+});
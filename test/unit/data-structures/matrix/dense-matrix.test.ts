@@ -0,0 +1,156 @@
+import { DenseMatrix, Matrix } from '../../../../src';
+
+const randomMatrix = (rows: number, cols: number) => {
+  const data = new Float64Array(rows * cols);
+  for (let i = 0; i < data.length; i++) data[i] = Math.floor(Math.random() * 21) - 10;
+  return new DenseMatrix(rows, cols, data);
+};
+
+const naiveMultiply = (a: DenseMatrix, b: DenseMatrix) => {
+  const result = new DenseMatrix(a.rows, b.cols);
+  for (let i = 0; i < a.rows; i++) {
+    for (let j = 0; j < b.cols; j++) {
+      let sum = 0;
+      for (let k = 0; k < a.cols; k++) sum += a.get(i, k)! * b.get(k, j)!;
+      result.set(i, j, sum);
+    }
+  }
+  return result;
+};
+
+describe('DenseMatrix', () => {
+  it('should store elements row-major', () => {
+    const matrix = DenseMatrix.from([
+      [1, 2, 3],
+      [4, 5, 6]
+    ]);
+    expect(matrix.rows).toBe(2);
+    expect(matrix.cols).toBe(3);
+    expect([...matrix.data]).toEqual([1, 2, 3, 4, 5, 6]);
+    expect(matrix.get(1, 0)).toBe(4);
+    expect(matrix.get(2, 0)).toBeUndefined();
+    expect(matrix.set(0, 2, 9)).toBe(true);
+    expect(matrix.set(0, 3, 9)).toBe(false);
+    expect(matrix.toArray()).toEqual([
+      [1, 2, 9],
+      [4, 5, 6]
+    ]);
+    expect(() => new DenseMatrix(2, 2, new Float64Array(3))).toThrow();
+    expect(() => DenseMatrix.from([[1, 2], [3]])).toThrow();
+  });
+
+  it('should add, subtract and scale in place', () => {
+    const a = DenseMatrix.from([
+      [1, 2],
+      [3, 4]
+    ]);
+    const b = DenseMatrix.from([
+      [5, 6],
+      [7, 8]
+    ]);
+    expect(a.add(b).toArray()).toEqual([
+      [6, 8],
+      [10, 12]
+    ]);
+    expect(a.subtract(b).toArray()).toEqual([
+      [-4, -4],
+      [-4, -4]
+    ]);
+    expect(a.scale(2).toArray()).toEqual([
+      [2, 4],
+      [6, 8]
+    ]);
+    expect(a.toArray()).toEqual([
+      [1, 2],
+      [3, 4]
+    ]);
+    expect(a.addInPlace(b).scaleInPlace(0.5).subtractInPlace(b)).toBe(a);
+    expect(a.toArray()).toEqual([
+      [-2, -2],
+      [-2, -2]
+    ]);
+    expect(() => a.addInPlace(new DenseMatrix(1, 2))).toThrow('Matrix dimensions must match for addition.');
+  });
+
+  it('should multiply like the textbook loop across tile boundaries', () => {
+    for (const [rows, inner, cols] of [
+      [1, 1, 1],
+      [3, 5, 2],
+      [70, 65, 131],
+      [64, 128, 64]
+    ]) {
+      const a = randomMatrix(rows, inner);
+      const b = randomMatrix(inner, cols);
+      const product = a.multiply(b);
+      expect(product.rows).toBe(rows);
+      expect(product.cols).toBe(cols);
+      expect([...product.data]).toEqual([...naiveMultiply(a, b).data]);
+    }
+    expect(() => randomMatrix(2, 3).multiply(randomMatrix(2, 3))).toThrow();
+  });
+
+  it('should transpose', () => {
+    const matrix = randomMatrix(67, 130);
+    const transposed = matrix.transpose();
+    expect(transposed.rows).toBe(130);
+    expect(transposed.cols).toBe(67);
+    expect(transposed.get(129, 3)).toBe(matrix.get(3, 129));
+    expect([...transposed.transpose().data]).toEqual([...matrix.data]);
+  });
+
+  it('should invert, solve and compute the determinant from one LU decomposition', () => {
+    const matrix = DenseMatrix.from([
+      [4, 7, 2],
+      [2, 6, 3],
+      [1, 2, 5]
+    ]);
+    const lu = matrix.lu();
+    expect(matrix.lu()).toBe(lu);
+    expect(matrix.determinant()).toBeCloseTo(43);
+    const inverse = matrix.inverse().toArray();
+    const expected = [
+      [24 / 43, -31 / 43, 9 / 43],
+      [-7 / 43, 18 / 43, -8 / 43],
+      [-2 / 43, -1 / 43, 10 / 43]
+    ];
+    for (let i = 0; i < 3; i++) for (let j = 0; j < 3; j++) expect(inverse[i][j]).toBeCloseTo(expected[i][j], 12);
+    const x = matrix.solve([13, 11, 8]);
+    expect([...x].map(value => Math.round(value * 1e9) / 1e9)).toEqual([1, 1, 1]);
+
+    matrix.set(0, 0, 5);
+    expect(matrix.lu()).not.toBe(lu);
+    expect(matrix.determinant()).toBeCloseTo(67);
+  });
+
+  it('should invert a large matrix', () => {
+    const n = 80;
+    const matrix = randomMatrix(n, n).addInPlace(DenseMatrix.identity(n).scaleInPlace(100));
+    const product = matrix.multiply(matrix.inverse());
+    const identity = DenseMatrix.identity(n);
+    for (let i = 0; i < n * n; i++) expect(product.data[i]).toBeCloseTo(identity.data[i], 9);
+  });
+
+  it('should detect singular matrices', () => {
+    const matrix = DenseMatrix.from([
+      [1, 2],
+      [2, 4]
+    ]);
+    expect(matrix.lu().isSingular).toBe(true);
+    expect(matrix.determinant()).toBe(0);
+    expect(() => matrix.inverse()).toThrow('Matrix is singular, and its inverse does not exist.');
+    expect(() => new DenseMatrix(2, 3).lu()).toThrow();
+  });
+});
+
+describe('Matrix dense multiplication', () => {
+  it('should give the same product with and without the default functions', () => {
+    const a = randomMatrix(20, 30).toArray();
+    const b = randomMatrix(30, 10).toArray();
+    const dense = new Matrix(a).multiply(new Matrix(b))!;
+    const generic = new Matrix(a, { multiplyFn: (x: number, y: number) => x * y }).multiply(new Matrix(b))!;
+    expect(dense.data).toEqual(generic.data);
+    expect(new Matrix(a).dot(new Matrix(b))!.data).toEqual(generic.data);
+    expect(dense.rows).toBe(20);
+    expect(dense.cols).toBe(10);
+  });
+});
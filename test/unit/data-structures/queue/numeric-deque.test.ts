@@ -0,0 +1,87 @@
+import { NumericDeque } from '../../../../src';
+
+describe('NumericDeque', () => {
+  it('should behave like an array used as a deque', () => {
+    const deque = new NumericDeque([], { bucketSize: 8 });
+    const expected: number[] = [];
+    for (let i = 0; i < 3000; i++) {
+      const op = Math.floor(Math.random() * 4);
+      const value = Math.random();
+      if (op === 0) {
+        deque.push(value);
+        expected.push(value);
+      } else if (op === 1) {
+        deque.unshift(value);
+        expected.unshift(value);
+      } else if (op === 2) {
+        expect(deque.pop()).toBe(expected.pop());
+      } else {
+        expect(deque.shift()).toBe(expected.shift());
+      }
+      expect(deque.size).toBe(expected.length);
+      expect(deque.first).toBe(expected[0]);
+      expect(deque.last).toBe(expected[expected.length - 1]);
+    }
+    expect(deque.toArray()).toEqual(expected);
+    expect([...deque]).toEqual(expected);
+    if (expected.length > 0) expect(deque.at(expected.length - 1)).toBe(expected[expected.length - 1]);
+  });
+
+  it('should reuse emptied buckets', () => {
+    const deque = new NumericDeque([], { bucketSize: 4, poolSize: 2 });
+    for (let i = 0; i < 10; i++) deque.push(i);
+    expect(deque.bucketCount).toBe(3);
+    const firstBucket = deque.sliceView(0, 1)[0].buffer;
+    for (let i = 0; i < 4; i++) deque.shift();
+    expect(deque['_pool'].length).toBe(1);
+    for (let i = 10; i < 14; i++) deque.push(i);
+    expect(deque['_pool'].length).toBe(0);
+    expect(deque.sliceView(9, 10)[0].buffer).toBe(firstBucket);
+    expect(deque.toArray()).toEqual([4, 5, 6, 7, 8, 9, 10, 11, 12, 13]);
+
+    deque.clear();
+    expect(deque.size).toBe(0);
+    expect(deque['_pool'].length).toBe(2);
+    deque.shrinkToFit();
+    expect(deque['_pool'].length).toBe(0);
+    deque.unshift(1);
+    deque.unshift(0);
+    expect(deque.toArray()).toEqual([0, 1]);
+  });
+
+  it('should return windows without copying', () => {
+    const deque = new NumericDeque([], { bucketSize: 4 });
+    deque.pushMany(Array.from({ length: 14 }, (_, i) => i));
+    deque.shift();
+
+    // An empty deque starts in the middle of its first bucket, so the first element is at offset 3 now
+    const views = deque.sliceView(2, 11);
+    expect(views.map(view => [...view])).toEqual([
+      [3, 4, 5],
+      [6, 7, 8, 9],
+      [10, 11]
+    ]);
+    expect(deque.sliceView(1, 3).length).toBe(1);
+    expect(deque.sliceView(5, 5)).toEqual([]);
+    views[0][0] = 30;
+    expect(deque.at(2)).toBe(30);
+    expect([...deque.slice(1, 4)]).toEqual([2, 30, 4]);
+    expect(() => deque.sliceView(3, 2)).toThrow();
+    expect(() => deque.sliceView(0, 14)).toThrow();
+  });
+
+  it('should push many numbers from arrays, typed arrays and iterables', () => {
+    const deque = new NumericDeque([1], { bucketSize: 4 });
+    expect(deque.pushMany([2, 3, 4, 5, 6])).toBe(5);
+    expect(deque.pushMany(new Float64Array([7, 8, 9, 10, 11]))).toBe(5);
+    expect(deque.pushMany(new Set([12, 13]))).toBe(2);
+    expect(deque.toArray()).toEqual(Array.from({ length: 13 }, (_, i) => i + 1));
+    expect(deque.clone().toArray()).toEqual(deque.toArray());
+    expect(deque.filter(x => x % 2 === 0).toArray()).toEqual([2, 4, 6, 8, 10, 12]);
+    expect(deque.map(x => x * 2).at(12)).toBe(26);
+    deque.setAt(0, -1);
+    expect(deque.first).toBe(-1);
+    expect(() => deque.at(13)).toThrow();
+    expect(() => new NumericDeque([], { bucketSize: 6 })).toThrow();
+  });
+});
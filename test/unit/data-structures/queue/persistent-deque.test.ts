@@ -0,0 +1,92 @@
+import { PersistentDeque } from '../../../../src';
+
+describe('PersistentDeque', () => {
+  it('should push and poll at both ends', () => {
+    const deque = new PersistentDeque<number>([2, 3]);
+    deque.unshift(1);
+    deque.push(4);
+    expect(deque.size).toBe(4);
+    expect(deque.first).toBe(1);
+    expect(deque.last).toBe(4);
+    expect(deque.toArray()).toEqual([1, 2, 3, 4]);
+    expect(deque.at(2)).toBe(3);
+    deque.setAt(2, 30);
+    expect(deque.pollFirst()).toBe(1);
+    expect(deque.pollLast()).toBe(4);
+    expect(deque.toArray()).toEqual([2, 30]);
+    expect(() => deque.at(2)).toThrow();
+    deque.clear();
+    expect(deque.isEmpty()).toBe(true);
+    expect(deque.shift()).toBeUndefined();
+    expect(deque.pop()).toBeUndefined();
+    expect(deque.first).toBeUndefined();
+  });
+
+  it('should grow and shrink across many levels', () => {
+    const deque = new PersistentDeque<number>();
+    const n = 100000;
+    for (let i = 0; i < n; i++) {
+      deque.push(i);
+      deque.unshift(-i - 1);
+    }
+    expect(deque.size).toBe(2 * n);
+    expect(deque.at(0)).toBe(-n);
+    expect(deque.at(2 * n - 1)).toBe(n - 1);
+    let expected = -n;
+    for (const element of deque) expect(element).toBe(expected++);
+    for (let i = 0; i < 2 * n - 1; i++) deque.shift();
+    expect(deque.toArray()).toEqual([n - 1]);
+  });
+
+  it('should keep snapshots unchanged', () => {
+    const deque = new PersistentDeque<number>(Array.from({ length: 1000 }, (_, i) => i));
+    const snapshot = deque.snapshot();
+    deque.shift();
+    deque.pop();
+    deque.setAt(10, -1);
+    deque.unshift(-2);
+    snapshot.push(1000);
+    expect(snapshot.size).toBe(1001);
+    expect(snapshot.at(11)).toBe(11);
+    expect(snapshot.first).toBe(0);
+    expect(snapshot.last).toBe(1000);
+    expect(deque.size).toBe(999);
+    expect(deque.first).toBe(-2);
+    expect(deque.at(11)).toBe(-1);
+    expect(deque.last).toBe(998);
+  });
+
+  it('should agree with an array under random operations', () => {
+    const deque = new PersistentDeque<number>();
+    const model: number[] = [];
+    const versions: [PersistentDeque<number>, number[]][] = [];
+    for (let i = 0; i < 20000; i++) {
+      const r = Math.random();
+      if (r < 0.3) {
+        deque.push(i);
+        model.push(i);
+      } else if (r < 0.6) {
+        deque.unshift(i);
+        model.unshift(i);
+      } else if (r < 0.75) {
+        expect(deque.pop()).toBe(model.pop());
+      } else if (r < 0.9) {
+        expect(deque.shift()).toBe(model.shift());
+      } else if (model.length > 0) {
+        const pos = Math.floor(Math.random() * model.length);
+        deque.setAt(pos, -i);
+        model[pos] = -i;
+      }
+      if (i % 1000 === 0) versions.push([deque.snapshot(), model.slice()]);
+    }
+    versions.push([deque, model]);
+    for (const [version, expected] of versions) expect(version.toArray()).toEqual(expected);
+  });
+
+  it('should filter and map into new deques', () => {
+    const deque = new PersistentDeque<number>([1, 2, 3, 4]);
+    expect(deque.filter(element => element % 2 === 0).toArray()).toEqual([2, 4]);
+    expect(deque.map(element => element * 2).toArray()).toEqual([2, 4, 6, 8]);
+    expect(deque.clone().toArray()).toEqual([1, 2, 3, 4]);
+  });
+});
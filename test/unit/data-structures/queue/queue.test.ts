@@ -261,3 +261,91 @@ describe('LinkedListQueue', () => {
     expect(queue.peek()).toBe('A');
   });
 });
+
+describe('Queue - Ring Buffer', () => {
+  test('should wrap around and grow by doubling without losing order', () => {
+    const queue = new Queue<number>([], { capacity: 4 });
+    expect(queue.capacity).toBe(4);
+    let next = 0,
+      expected = 0;
+    for (let round = 0; round < 50; round++) {
+      for (let i = 0; i < round % 7; i++) queue.push(next++);
+      for (let i = 0; i < round % 5 && !queue.isEmpty(); i++) expect(queue.shift()).toBe(expected++);
+      expect(queue.size).toBe(next - expected);
+      expect(queue.first).toBe(queue.size > 0 ? expected : undefined);
+      expect(queue.last).toBe(queue.size > 0 ? next - 1 : undefined);
+      expect(queue.toArray()).toEqual(Array.from({ length: next - expected }, (_, i) => expected + i));
+    }
+    expect(queue.capacity & (queue.capacity - 1)).toBe(0);
+    expect(queue.at(0)).toBe(expected);
+    expect([...queue]).toEqual(queue.elements);
+  });
+
+  test('should clear the slot of a shifted element', () => {
+    const queue = new Queue<object>();
+    queue.push({});
+    queue.push({});
+    const offset = queue.offset;
+    queue.shift();
+    expect(queue['_buffer'][offset]).toBeUndefined();
+    queue.drain();
+    expect(queue['_buffer'].every(slot => slot === undefined)).toBe(true);
+  });
+
+  test('should refuse to push past maxSize', () => {
+    const queue = new Queue<number>([1, 2, 3, 4, 5], { maxSize: 3 });
+    expect(queue.toArray()).toEqual([1, 2, 3]);
+    expect(queue.isFull()).toBe(true);
+    expect(queue.push(6)).toBe(false);
+    expect(queue.enqueue(6)).toBe(false);
+    expect(queue.shift()).toBe(1);
+    expect(queue.push(6)).toBe(true);
+    expect(queue.toArray()).toEqual([2, 3, 6]);
+    expect(queue.clone().maxSize).toBe(3);
+    expect(queue.map(x => x * 2).push(0)).toBe(false);
+    expect(() => new Queue([], { maxSize: 0 })).toThrow();
+  });
+
+  test('should push and drain in bulk', () => {
+    const queue = new Queue<number>([], { maxSize: 5 });
+    expect(queue.pushMany([1, 2, 3])).toEqual([true, true, true]);
+    expect(queue.pushMany(new Set([4, 5, 6]))).toEqual([true, true, false]);
+    expect(queue.drain(2)).toEqual([1, 2]);
+    expect(queue.drain(0)).toEqual([]);
+    expect(queue.pushMany([7])).toEqual([true]);
+    expect(queue.drain(10)).toEqual([3, 4, 5, 7]);
+    expect(queue.drain()).toEqual([]);
+    expect(queue.isEmpty()).toBe(true);
+  });
+
+  test('should delete across the wrap point', () => {
+    const queue = new Queue<number>([], { capacity: 4 });
+    queue.pushMany([0, 1, 2, 3]);
+    queue.shift();
+    queue.shift();
+    queue.pushMany([4, 5]);
+    expect(queue.capacity).toBe(4);
+    expect(queue.delete(3)).toBe(true);
+    expect(queue.delete(9)).toBe(false);
+    expect(queue.toArray()).toEqual([2, 4, 5]);
+    expect(queue.deleteAt(-1)).toBe(false);
+    expect(queue.deleteAt(2)).toBe(true);
+    expect(queue.toArray()).toEqual([2, 4]);
+    expect(queue.at(1)).toBe(4);
+  });
+});
+
+describe('LinkedListQueue node pool', () => {
+  it('should reuse dequeued nodes while churning', () => {
+    const queue = new LinkedListQueue<number>([], { nodePoolSize: 4 });
+    for (let i = 0; i < 100; i++) {
+      queue.enqueue(i);
+      queue.enqueue(i + 0.5);
+      expect(queue.dequeue()).toBe(i / 2);
+    }
+    expect(queue.size).toBe(100);
+    while (queue.dequeue() !== undefined);
+    expect(queue.pooledNodeCount).toBe(4);
+    expect(queue.clone().nodePoolSize).toBe(4);
+  });
+});
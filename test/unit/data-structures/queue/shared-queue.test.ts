@@ -0,0 +1,123 @@
+import { MPMCQueue, SPSCQueue } from '../../../../src';
+
+describe('SPSCQueue', () => {
+  it('should pass records between two views of the same buffer', () => {
+    const producer = new SPSCQueue({ capacity: 3, recordSize: 8 });
+    const consumer = new SPSCQueue(producer.buffer);
+    expect(consumer.capacity).toBe(4);
+    expect(consumer.recordSize).toBe(8);
+
+    const record = new Float64Array(1);
+    for (let i = 0; i < 4; i++) {
+      record[0] = i;
+      expect(producer.push(record)).toBe(true);
+    }
+    expect(producer.push(record)).toBe(false);
+    expect(consumer.size).toBe(4);
+
+    const target = new Uint8Array(8);
+    const view = new Float64Array(target.buffer);
+    for (let lap = 0; lap < 10; lap++) {
+      expect(consumer.shift(target)).toBe(target);
+      expect(view[0]).toBe(lap);
+      record[0] = lap + 4;
+      expect(producer.push(record)).toBe(true);
+    }
+    expect(consumer.size).toBe(4);
+    expect(new Float64Array(consumer.shift()!.buffer)[0]).toBe(10);
+  });
+
+  it('should reject records of the wrong size and foreign buffers', () => {
+    const queue = new SPSCQueue({ capacity: 2, recordSize: 4 });
+    expect(() => queue.push(new Uint8Array(3))).toThrow();
+    expect(() => queue.shift(new Uint8Array(2))).toThrow();
+    expect(() => new MPMCQueue(queue.buffer)).toThrow();
+    expect(() => new SPSCQueue({ capacity: 0, recordSize: 4 })).toThrow();
+    expect(queue.shiftWait(undefined, 5)).toBeUndefined();
+    queue.push(new Int32Array([7]));
+    queue.push(new Int32Array([8]));
+    expect(queue.pushWait(new Int32Array([9]), 5)).toBe(false);
+  });
+
+  it('should wait asynchronously and end iteration on close', async () => {
+    const queue = new SPSCQueue({ capacity: 2, recordSize: 4 });
+    const received: number[] = [];
+    const consuming = (async () => {
+      for await (const record of new SPSCQueue(queue.buffer)) received.push(new Int32Array(record.buffer)[0]);
+    })();
+
+    for (let i = 0; i < 20; i++) expect(await queue.pushAsync(new Int32Array([i]))).toBe(true);
+    queue.close();
+    await consuming;
+    expect(received).toEqual(Array.from({ length: 20 }, (_, i) => i));
+    expect(queue.isClosed).toBe(true);
+    expect(queue.push(new Int32Array([1]))).toBe(false);
+    expect(await queue.pushAsync(new Int32Array([1]))).toBe(false);
+    expect(await queue.shiftAsync()).toBeUndefined();
+  });
+
+  it('should let consumers drain after close', async () => {
+    const queue = new SPSCQueue({ capacity: 4, recordSize: 1 });
+    queue.push(new Uint8Array([1]));
+    queue.push(new Uint8Array([2]));
+    queue.close();
+    expect(queue.shiftWait()![0]).toBe(1);
+    expect((await queue.shiftAsync())![0]).toBe(2);
+    expect(queue.shiftWait()).toBeUndefined();
+  });
+});
+
+describe('MPMCQueue', () => {
+  it('should keep each producer in order with many producers and consumers', async () => {
+    const queue = new MPMCQueue({ capacity: 8, recordSize: 8 });
+    const producers = 4,
+      count = 200;
+    const produce = async (id: number) => {
+      const handle = new MPMCQueue(queue.buffer);
+      for (let i = 0; i < count; i++) {
+        expect(await handle.pushAsync(new Int32Array([id, i]))).toBe(true);
+        if (i % 7 === 0) await Promise.resolve();
+      }
+    };
+    const consume = async () => {
+      const handle = new MPMCQueue(queue.buffer);
+      const seen: [number, number][] = [];
+      for await (const record of handle) {
+        const [id, i] = new Int32Array(record.buffer);
+        seen.push([id, i]);
+      }
+      return seen;
+    };
+
+    const consumers = [consume(), consume(), consume()];
+    await Promise.all(Array.from({ length: producers }, (_, id) => produce(id)));
+    queue.close();
+    const results = await Promise.all(consumers);
+
+    const all = results.flat();
+    expect(all.length).toBe(producers * count);
+    for (const seen of results) {
+      const last = new Array(producers).fill(-1);
+      for (const [id, i] of seen) {
+        expect(i).toBeGreaterThan(last[id]);
+        last[id] = i;
+      }
+    }
+    expect(new Set(all.map(([id, i]) => id * count + i)).size).toBe(producers * count);
+  });
+
+  it('should report full and empty', () => {
+    const queue = new MPMCQueue({ capacity: 1, recordSize: 2 });
+    expect(queue.capacity).toBe(2);
+    expect(queue.shift()).toBeUndefined();
+    expect(queue.push(new Uint16Array([1]))).toBe(true);
+    expect(queue.push(new Uint16Array([2]))).toBe(true);
+    expect(queue.push(new Uint16Array([3]))).toBe(false);
+    expect(queue.size).toBe(2);
+    expect(new Uint16Array(queue.shift()!.buffer)[0]).toBe(1);
+    expect(queue.push(new Uint16Array([3]))).toBe(true);
+    expect(new Uint16Array(queue.shift()!.buffer)[0]).toBe(2);
+    expect(new Uint16Array(queue.shift()!.buffer)[0]).toBe(3);
+    expect(queue.size).toBe(0);
+  });
+});
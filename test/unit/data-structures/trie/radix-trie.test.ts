@@ -0,0 +1,151 @@
+import { RadixTrie, RadixTrieNode } from '../../../../src';
+
+describe('RadixTrieNode', () => {
+  it('should keep children sorted by their first code unit', () => {
+    const node = new RadixTrieNode('');
+    for (const label of ['m', 'b', 'x']) node.insertChild(-node.indexOf(label.charCodeAt(0)) - 1, new RadixTrieNode(label));
+    expect(node.children.map(child => child.label)).toEqual(['b', 'm', 'x']);
+    expect(node.firsts).toEqual([98, 109, 120]);
+    expect(node.indexOf(109)).toBe(1);
+    expect(node.indexOf(99)).toBe(-2);
+    node.removeChild(0);
+    expect(node.children.map(child => child.label)).toEqual(['m', 'x']);
+  });
+});
+
+describe('RadixTrie', () => {
+  it('should collapse single-child chains into edge labels', () => {
+    const trie = new RadixTrie(['romane', 'romanus', 'romulus', 'rubens', 'ruber', 'rubicon', 'rubicundus']);
+    expect(trie.size).toBe(7);
+    expect(trie.root.children.map(child => child.label)).toEqual(['r']);
+    expect(trie.root.children[0].children.map(child => child.label)).toEqual(['om', 'ub']);
+    expect(trie.nodeCount).toBe(14);
+    expect(trie.has('romanus')).toBe(true);
+    expect(trie.has('roman')).toBe(false);
+    expect(trie.has('romanuss')).toBe(false);
+    expect(trie.add('romane')).toBe(false);
+    expect(trie.add('roman')).toBe(true);
+    expect(trie.nodeCount).toBe(14);
+    expect(trie.has('roman')).toBe(true);
+  });
+
+  it('should list words in ascending order', () => {
+    const trie = new RadixTrie(['banana', 'band', 'ban', 'apple', 'bandana', 'app']);
+    expect([...trie]).toEqual(['app', 'apple', 'ban', 'banana', 'band', 'bandana']);
+    expect(trie.getWords('ban')).toEqual(['ban', 'banana', 'band', 'bandana']);
+    expect(trie.getWords('bana')).toEqual(['banana']);
+    expect(trie.getWords('ban', 2)).toEqual(['ban', 'banana']);
+    expect(trie.getWords('c')).toEqual([]);
+    expect(trie.getWords()).toEqual([]);
+    expect(trie.getWords('', 3, true)).toEqual(['app', 'apple', 'ban']);
+  });
+
+  it('should answer prefix queries', () => {
+    const trie = new RadixTrie(['apple', 'app', 'application']);
+    expect(trie.hasPrefix('appl')).toBe(true);
+    expect(trie.hasPrefix('apx')).toBe(false);
+    expect(trie.hasPurePrefix('appl')).toBe(true);
+    expect(trie.hasPurePrefix('app')).toBe(false);
+    expect(trie.hasPurePrefix('apple')).toBe(false);
+    expect(trie.getLongestCommonPrefix()).toBe('app');
+    expect(trie.hasCommonPrefix('ap')).toBe(true);
+    expect(trie.hasCommonPrefix('appl')).toBe(false);
+    trie.delete('app');
+    expect(trie.getLongestCommonPrefix()).toBe('appl');
+  });
+
+  it('should merge nodes again after deleting', () => {
+    const trie = new RadixTrie(['test', 'team', 'tea']);
+    expect(trie.nodeCount).toBe(5);
+    expect(trie.delete('te')).toBe(false);
+    expect(trie.delete('tea')).toBe(true);
+    expect(trie.delete('tea')).toBe(false);
+    expect(trie.nodeCount).toBe(4);
+    expect(trie.delete('team')).toBe(true);
+    expect(trie.nodeCount).toBe(2);
+    expect(trie.root.children[0].label).toBe('test');
+    expect([...trie]).toEqual(['test']);
+    trie.add('');
+    expect(trie.has('')).toBe(true);
+    expect(trie.delete('')).toBe(true);
+    expect(trie.size).toBe(1);
+    trie.clear();
+    expect(trie.isEmpty()).toBe(true);
+    expect(trie.nodeCount).toBe(1);
+  });
+
+  it('should match a set of strings under random changes', () => {
+    const randomWord = () => {
+      let word = '';
+      const length = Math.floor(Math.random() * 6);
+      for (let i = 0; i < length; i++) word += 'abcd'[Math.floor(Math.random() * 4)];
+      return word;
+    };
+    const trie = new RadixTrie();
+    const expected = new Set<string>();
+    for (let i = 0; i < 2000; i++) {
+      const word = randomWord();
+      if (Math.random() < 0.6) {
+        expect(trie.add(word)).toBe(!expected.has(word));
+        expected.add(word);
+      } else {
+        expect(trie.delete(word)).toBe(expected.has(word));
+        expected.delete(word);
+      }
+    }
+    expect([...trie]).toEqual([...expected].sort());
+    expect(trie.size).toBe(expected.size);
+  });
+
+  it('should support case-insensitive words, clone, filter and map', () => {
+    const trie = new RadixTrie(['Hello', 'HELP', 'world'], { caseSensitive: false });
+    expect(trie.has('hello')).toBe(true);
+    expect(trie.getWords('HEL')).toEqual(['hello', 'help']);
+    const cloned = trie.clone();
+    cloned.delete('help');
+    expect(trie.size).toBe(3);
+    expect(cloned.caseSensitive).toBe(false);
+    expect([...trie.filter(word => word.startsWith('h'))]).toEqual(['hello', 'help']);
+    expect([...trie.map(word => word.slice(0, 3))]).toEqual(['hel', 'wor']);
+  });
+});
+
+describe('FrozenRadixTrie', () => {
+  it('should answer the same queries as the trie it was frozen from', () => {
+    const words = ['banana', 'band', 'ban', 'apple', 'bandana', 'app', 'zebra', 'über', ''];
+    const trie = new RadixTrie(words);
+    const frozen = trie.freeze();
+    expect(frozen.size).toBe(trie.size);
+    expect(frozen.nodeCount).toBe(trie.nodeCount);
+    expect(frozen.slotCount).toBeGreaterThanOrEqual(frozen.nodeCount);
+    expect([...frozen]).toEqual([...trie]);
+    for (const query of ['', 'b', 'ban', 'bana', 'bandanas', 'app', 'appl', 'c', 'ü', 'z']) {
+      expect(frozen.has(query)).toBe(trie.has(query));
+      expect(frozen.hasPrefix(query)).toBe(trie.hasPrefix(query));
+      expect(frozen.hasPurePrefix(query)).toBe(trie.hasPurePrefix(query));
+      expect(frozen.getWords(query, 3, true)).toEqual(trie.getWords(query, 3, true));
+    }
+    trie.delete('banana');
+    expect(frozen.has('banana')).toBe(true);
+    expect([...frozen.thaw()]).toEqual([...frozen]);
+  });
+
+  it('should pack a large random dictionary', () => {
+    const words: string[] = [];
+    for (let i = 0; i < 20000; i++) {
+      let word = '';
+      const length = 1 + Math.floor(Math.random() * 10);
+      for (let j = 0; j < length; j++) word += String.fromCharCode(97 + Math.floor(Math.random() * 26));
+      words.push(word);
+    }
+    const trie = new RadixTrie(words);
+    const frozen = trie.freeze();
+    expect(frozen.slotCount).toBeLessThan(frozen.nodeCount * 1.5);
+    for (const word of words) expect(frozen.has(word)).toBe(true);
+    expect(frozen.has('0')).toBe(false);
+    expect([...frozen]).toEqual([...trie]);
+    const lowered = new RadixTrie(['Mixed'], { caseSensitive: false }).freeze();
+    expect(lowered.has('MIXED')).toBe(true);
+    expect(new RadixTrie().freeze().getWords('', 10, true)).toEqual([]);
+  });
+});
@@ -873,3 +873,99 @@ describe('Trie class', () => {
     expect(concatenatedWords).toEqual('appapplebananabandbandana');
   });
 });
+
+describe('Trie weighted autocomplete', () => {
+  it('should rank words by weight with topK', () => {
+    const trie = new Trie();
+    trie.add('car', 5);
+    trie.add('cart', 9);
+    trie.add('carpet', 2);
+    trie.add('camera', 7);
+    trie.add('cat');
+    expect(trie.topK('ca', 3)).toEqual([
+      ['cart', 9],
+      ['camera', 7],
+      ['car', 5]
+    ]);
+    expect(trie.topK('car', 10)).toEqual([
+      ['cart', 9],
+      ['car', 5],
+      ['carpet', 2]
+    ]);
+    expect(trie.topK('', 1)).toEqual([['cart', 9]]);
+    expect(trie.topK('cab', 3)).toEqual([]);
+    expect(trie.topK('ca', 0)).toEqual([]);
+    expect(trie.getWeight('cat')).toBe(0);
+    expect(trie.getWeight('ca')).toBeUndefined();
+  });
+
+  it('should keep subtree maxima up to date', () => {
+    const trie = new Trie(['alpha', 'alps', 'alp']);
+    expect(trie.add('alps', 10)).toBe(false);
+    expect(trie.root.maxWeight).toBe(10);
+    trie.add('alps', 1);
+    expect(trie.root.maxWeight).toBe(1);
+    expect(trie.topK('al', 2)).toEqual([
+      ['alps', 1],
+      ['alp', 0]
+    ]);
+    trie.add('alpha', 4);
+    trie.delete('alpha');
+    expect(trie.root.maxWeight).toBe(1);
+    trie.delete('alps');
+    trie.delete('alp');
+    expect(trie.root.maxWeight).toBe(-Infinity);
+    expect(trie.topK('', 5)).toEqual([]);
+  });
+
+  it('should agree with sorting all words', () => {
+    const trie = new Trie();
+    const weights = new Map<string, number>();
+    for (let i = 0; i < 1000; i++) {
+      let word = '';
+      const length = 1 + Math.floor(Math.random() * 5);
+      for (let j = 0; j < length; j++) word += 'abc'[Math.floor(Math.random() * 3)];
+      if (Math.random() < 0.2) {
+        trie.delete(word);
+        weights.delete(word);
+      } else {
+        const weight = Math.floor(Math.random() * 50);
+        trie.add(word, weight);
+        weights.set(word, weight);
+      }
+    }
+    for (const prefix of ['', 'a', 'ab', 'cab', 'bbb']) {
+      const expected = [...weights]
+        .filter(([word]) => word.startsWith(prefix))
+        .sort((a, b) => b[1] - a[1] || (a[0] < b[0] ? -1 : 1))
+        .slice(0, 7);
+      expect(trie.topK(prefix, 7)).toEqual(expected);
+    }
+    const cloned = trie.clone();
+    expect(cloned.topK('', 7)).toEqual(trie.topK('', 7));
+  });
+
+  it('should yield words with a prefix lazily', () => {
+    const trie = new Trie(['app', 'apple', 'application', 'banana']);
+    expect([...trie.wordsWithPrefix('app')]).toEqual(['app', 'apple', 'application']);
+    expect([...trie.wordsWithPrefix('appx')]).toEqual([]);
+    expect([...trie.wordsWithPrefix()]).toEqual([...trie]);
+    const iterator = trie.wordsWithPrefix('ap');
+    expect(iterator.next().value).toBe('app');
+    expect(iterator.next().value).toBe('apple');
+  });
+
+  it('should not fall back to a partial prefix in getWords', () => {
+    const trie = new Trie(['apple', 'apply', 'banana']);
+    expect(trie.getWords('apx')).toEqual([]);
+    expect(trie.getWords('bx')).toEqual([]);
+    expect(trie.getWords('appl', 1)).toEqual(['apple']);
+    expect(trie.getWords('appl', 0)).toEqual([]);
+  });
+
+  it('should iterate a long word without deep recursion', () => {
+    const word = 'a'.repeat(20000);
+    const trie = new Trie([word]);
+    expect([...trie]).toEqual([word]);
+  });
+});
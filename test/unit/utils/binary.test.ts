@@ -0,0 +1,215 @@
+import {
+  BinaryReader,
+  binaryCodecs,
+  BinaryWriter,
+  BST,
+  CSRGraph,
+  DirectedGraph,
+  HashMap,
+  MaxHeap,
+  RedBlackTree,
+  SortedNumericView,
+  TreeMultimap,
+  UndirectedGraph
+} from '../../../src';
+
+describe('BinaryWriter and BinaryReader', () => {
+  it('should round-trip every primitive', () => {
+    const writer = new BinaryWriter({ chunkSize: 4 });
+    writer.writeUint8(255);
+    writer.writeUint32(0xdeadbeef);
+    writer.writeInt32(-7);
+    writer.writeFloat64(Math.PI);
+    writer.writeVarUint(0);
+    writer.writeVarUint(300);
+    writer.writeVarUint(2 ** 40 + 3);
+    writer.writeString('héllo, 世界');
+    writer.align(8);
+    writer.writeTypedArray(new Float64Array([1.5, -2]));
+    writer.writeTypedArray(new Int32Array([3, -4, 5]));
+    const bytes = writer.finish();
+    expect(bytes.length).toBe(writer.byteLength);
+    expect(writer.byteLength % 4).toBe(0);
+
+    const reader = new BinaryReader(bytes);
+    expect(reader.readUint8()).toBe(255);
+    expect(reader.readUint32()).toBe(0xdeadbeef);
+    expect(reader.readInt32()).toBe(-7);
+    expect(reader.readFloat64()).toBe(Math.PI);
+    expect(reader.readVarUint()).toBe(0);
+    expect(reader.readVarUint()).toBe(300);
+    expect(reader.readVarUint()).toBe(2 ** 40 + 3);
+    expect(reader.readString()).toBe('héllo, 世界');
+    reader.align(8);
+    expect([...reader.readFloat64Array(2)]).toEqual([1.5, -2]);
+    expect([...reader.readInt32Array(3)]).toEqual([3, -4, 5]);
+    expect(() => reader.readUint8()).toThrow('Unexpected end of binary data');
+  });
+
+  it('should stream chunks and read them back across chunk boundaries', () => {
+    const chunks: Uint8Array[] = [];
+    const writer = new BinaryWriter({ chunkSize: 5, onChunk: chunk => chunks.push(chunk) });
+    for (let i = 0; i < 100; i++) writer.writeFloat64(i / 3);
+    writer.writeString('x'.repeat(40));
+    expect(writer.finish().length).toBe(0);
+    expect(chunks.length).toBeGreaterThan(1);
+    expect(chunks.reduce((sum, chunk) => sum + chunk.length, 0)).toBe(writer.byteLength);
+
+    const reader = new BinaryReader(chunks);
+    for (let i = 0; i < 100; i++) expect(reader.readFloat64()).toBe(i / 3);
+    expect(reader.readString()).toBe('x'.repeat(40));
+    expect(reader.position).toBe(writer.byteLength);
+  });
+
+  it('should tag values with the any codec', () => {
+    const values = [undefined, null, true, false, 0, -0, 42, -1.25, 2 ** 40, 'text', { a: [1, 2] }];
+    const writer = new BinaryWriter();
+    for (const value of values) binaryCodecs.any.write(writer, value);
+    const reader = new BinaryReader(writer.finish());
+    for (const value of values) expect(binaryCodecs.any.read(reader)).toEqual(value);
+  });
+});
+
+describe('binary snapshots', () => {
+  it('should round-trip a BST and reject other kinds', () => {
+    const tree = new BST<number, string>();
+    for (let i = 0; i < 500; i++) tree.add((i * 37) % 500, `v${i}`);
+    const bytes = tree.toBinary({ keyCodec: binaryCodecs.float64, valueCodec: binaryCodecs.string });
+
+    const loaded = new RedBlackTree<number, string>();
+    expect(loaded.loadBinary(bytes, { keyCodec: binaryCodecs.float64, valueCodec: binaryCodecs.string })).toBe(500);
+    expect([...loaded]).toEqual([...tree]);
+    expect(loaded.isAVLBalanced()).toBe(true);
+    expect(() => new HashMap().loadBinary(bytes)).toThrow('Expected a HashMap snapshot but found BST');
+    expect(() => new BST().loadBinary(new Uint8Array(16))).toThrow('Not a binary snapshot');
+  });
+
+  it('should round-trip the counts of a TreeMultimap', () => {
+    const multimap = new TreeMultimap<number, string>();
+    for (let i = 0; i < 100; i++) multimap.add(i, `v${i}`, 3);
+    multimap.add(50, 'v50');
+    const bytes = multimap.toBinary();
+
+    const loaded = new TreeMultimap<number, string>();
+    expect(loaded.loadBinary(bytes)).toBe(100);
+    expect(loaded.count).toBe(301);
+    expect(loaded.getNode(50)?.count).toBe(4);
+    expect(loaded.getNode(7)?.count).toBe(3);
+    expect(loaded.get(7)).toBe('v7');
+    expect(loaded.isAVLBalanced()).toBe(true);
+    expect(() => new BST().loadBinary(bytes)).toThrow('Expected a BST snapshot but found TreeMultimap');
+  });
+
+  it('should load a streamed HashMap snapshot', () => {
+    const map = new HashMap<number | string, number[]>();
+    for (let i = 0; i < 200; i++) map.set(i % 2 ? i : `k${i}`, [i, i * 2]);
+    const chunks: Uint8Array[] = [];
+    map.toBinary({ chunkSize: 64, onChunk: chunk => chunks.push(chunk) });
+
+    const loaded = new HashMap<number | string, number[]>([['stale', []]]);
+    expect(loaded.loadBinary(chunks)).toBe(200);
+    expect(loaded.has('stale')).toBe(false);
+    expect(loaded.get(7)).toEqual([7, 14]);
+    expect(loaded.get('k8')).toEqual([8, 16]);
+  });
+
+  it('should round-trip a Heap in heap order', () => {
+    const heap = new MaxHeap<number>([5, 1, 9, 3, 7, 2]);
+    const loaded = new MaxHeap<number>();
+    loaded.loadBinary(heap.toBinary({ elementCodec: binaryCodecs.int32 }), { elementCodec: binaryCodecs.int32 });
+    expect(loaded.toArray()).toEqual(heap.toArray());
+    expect(loaded.poll()).toBe(9);
+  });
+
+  it('should round-trip directed and undirected graphs', () => {
+    const graph = new DirectedGraph<string, string>();
+    graph.addVertex('a', 'A');
+    graph.addVertex('b');
+    graph.addVertex(3, 'C');
+    graph.addEdge('a', 'b', 2.5, 'ab');
+    graph.addEdge('b', 3, 1);
+    graph.addEdge(3, 'a', 4, 'ca');
+
+    const loaded = new DirectedGraph<string, string>();
+    loaded.addVertex('stale');
+    expect(loaded.loadBinary(graph.toBinary())).toBe(3);
+    expect(loaded.hasVertex('stale')).toBe(false);
+    expect(loaded.getVertex('a')?.value).toBe('A');
+    expect(loaded.getEdge('a', 'b')?.weight).toBe(2.5);
+    expect(loaded.getEdge('a', 'b')?.value).toBe('ab');
+    expect(loaded.getEdge(3, 'a')?.value).toBe('ca');
+    expect(loaded.edgeSet().length).toBe(3);
+    expect(() => new UndirectedGraph().loadBinary(graph.toBinary())).toThrow('differ in direction');
+
+    const undirected = new UndirectedGraph();
+    undirected.addVertex(1);
+    undirected.addVertex(2);
+    undirected.addEdge(1, 2, 7);
+    const copy = new UndirectedGraph();
+    copy.loadBinary(undirected.toBinary());
+    expect(copy.edgeSet().length).toBe(1);
+    expect(copy.getEdge(2, 1)?.weight).toBe(7);
+  });
+
+  it('should map a CSRGraph snapshot without copying its arrays', () => {
+    const graph = new DirectedGraph();
+    for (const key of ['s', 'a', 'b', 't']) graph.addVertex(key);
+    graph.addEdge('s', 'a', 1);
+    graph.addEdge('s', 'b', 4);
+    graph.addEdge('a', 'b', 1);
+    graph.addEdge('b', 't', 1);
+    const csr = graph.freeze();
+
+    const bytes = csr.toBinary(binaryCodecs.string);
+    const mapped = CSRGraph.fromBinary(bytes, binaryCodecs.string);
+    expect(mapped.weights.buffer).toBe(bytes.buffer);
+    expect(mapped.targets.buffer).toBe(bytes.buffer);
+    expect(mapped.keys).toEqual(csr.keys);
+    expect([...mapped.offsets]).toEqual([...csr.offsets]);
+    expect(mapped.dijkstra(mapped.indexOf('s')).dist[mapped.indexOf('t')]).toBe(3);
+
+    // A misaligned copy still loads, through copies
+    const shifted = new Uint8Array(bytes.length + 1).subarray(1);
+    shifted.set(bytes);
+    expect([...CSRGraph.fromBinary(shifted, binaryCodecs.string).weights]).toEqual([...csr.weights]);
+  });
+});
+
+describe('SortedNumericView', () => {
+  const tree = new RedBlackTree<number, number>();
+  for (let i = 0; i < 1000; i++) tree.add(i * 2, i * 10);
+  const view = new SortedNumericView(SortedNumericView.encode(tree));
+
+  it('should answer queries on the mapped bytes', () => {
+    expect(view.size).toBe(1000);
+    expect(view.get(10)).toBe(50);
+    expect(view.get(11)).toBe(undefined);
+    expect(view.has(1998)).toBe(true);
+    expect(view.ceiling(11)).toBe(12);
+    expect(view.floor(11)).toBe(10);
+    expect(view.floor(-1)).toBe(undefined);
+    expect(view.ceiling(2000)).toBe(undefined);
+    expect(view.countRange(10, 20)).toBe(6);
+    expect(view.countRange(20, 10)).toBe(0);
+    expect([...view].slice(0, 2)).toEqual([
+      [0, 0],
+      [2, 10]
+    ]);
+  });
+
+  it('should store missing values as NaN and reject unsorted keys', () => {
+    const sparse = new SortedNumericView(
+      SortedNumericView.encode([
+        [1, undefined],
+        [2, 3]
+      ])
+    );
+    expect(sparse.get(1)).toBeNaN();
+    expect(() =>
+      SortedNumericView.encode([
+        [2, 0],
+        [1, 0]
+      ])
+    ).toThrow('strictly ascending');
+  });
+});
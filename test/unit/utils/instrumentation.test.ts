@@ -0,0 +1,142 @@
+import {
+  AVLTree,
+  BST,
+  Deque,
+  DirectedGraph,
+  HashMap,
+  Instrumentation,
+  LinkedHashMap,
+  MinHeap,
+  Queue,
+  RedBlackTree
+} from '../../../src';
+
+describe('Instrumentation', () => {
+  it('should bucket timings by powers of two microseconds', () => {
+    const instrumentation = new Instrumentation({ timing: true });
+    instrumentation.record('op', 0.0005);
+    instrumentation.record('op', 0.003);
+    instrumentation.record('op', 0.003);
+    const { timings } = instrumentation.snapshot('x');
+    expect(timings!.op.count).toBe(3);
+    expect(timings!.op.maxMs).toBe(0.003);
+    expect(timings!.op.buckets[0]).toBe(1);
+    expect(timings!.op.buckets[2]).toBe(2);
+  });
+});
+
+describe('structure stats', () => {
+  it('should count through the prototype without adding methods to the instance', () => {
+    const tree = new BST<number>([5, 3, 8]);
+    const keys = Object.keys(tree);
+    expect(tree.stats()).toEqual({ name: 'BST', enabled: false, counters: {} });
+
+    tree.enableStats();
+    expect(Object.prototype.hasOwnProperty.call(tree, '_compareKeys')).toBe(false);
+    expect(Object.getPrototypeOf(tree)).toBe(BST.prototype);
+    tree.has(8);
+    expect(tree.stats().counters.comparisons).toBeGreaterThan(0);
+
+    tree.resetStats();
+    expect(tree.stats().counters.comparisons).toBe(0);
+    tree.disableStats();
+    tree.has(8);
+    expect(Object.keys(tree)).toEqual(keys);
+    expect(tree.stats().enabled).toBe(false);
+
+    tree.enableStats();
+    tree.has(8);
+    const { comparisons } = tree.stats().counters;
+    tree.enableStats();
+    tree.has(8);
+    expect(tree.stats().counters.comparisons).toBe(comparisons);
+  });
+
+  it('should only count the instance it was enabled on', () => {
+    const counted = new RedBlackTree<number>();
+    const plain = new RedBlackTree<number>();
+    counted.enableStats();
+    for (let i = 0; i < 100; i++) {
+      counted.add(i);
+      plain.add(i);
+    }
+    const { counters } = counted.stats();
+    expect(counters.rotations).toBeGreaterThan(0);
+    expect(counters.insertFixups).toBeGreaterThan(0);
+    expect(counters.comparisons).toBeGreaterThan(100);
+    expect(plain.stats().counters).toEqual({});
+  });
+
+  it('should count AVL rotations and time them', () => {
+    const tree = new AVLTree<number>();
+    tree.enableStats({ timing: true });
+    for (let i = 0; i < 64; i++) tree.add(i);
+    const stats = tree.stats();
+    expect(stats.counters.rotations).toBeGreaterThan(0);
+    expect(stats.timings!.rotations.count).toBe(stats.counters.rotations);
+    expect(JSON.parse(JSON.stringify(stats))).toEqual(stats);
+  });
+
+  it('should count sifts, probes, reallocations and growths', () => {
+    const heap = new MinHeap<number>();
+    heap.enableStats();
+    for (let i = 10; i > 0; i--) heap.add(i);
+    heap.poll();
+    expect(heap.stats().counters.siftUps).toBe(10);
+    expect(heap.stats().counters.siftDowns).toBe(1);
+
+    const map = new HashMap<number, number>();
+    map.enableStats();
+    for (let i = 0; i < 1000; i++) map.set(i, i);
+    map.get(500);
+    map.get(-1);
+    const { counters } = map.stats();
+    expect(counters.rehashes).toBeGreaterThan(0);
+    expect(counters.misses).toBeGreaterThan(0);
+    expect(counters.probes).toBeGreaterThanOrEqual(counters.lookups - counters.misses);
+    expect(counters.bucketInserts).toBeGreaterThan(1000);
+
+    // The probe hook is shared by the class, so it must measure the table of the map it ran on
+    const small = new HashMap<number, number>();
+    small.enableStats();
+    for (let i = 0; i < 10; i++) small.set(i, i);
+    for (let i = 0; i < 10; i++) small.get(i);
+    const smallCounters = small.stats().counters;
+    expect(smallCounters.probes).toBeGreaterThanOrEqual(10);
+    expect(smallCounters.probes).toBeLessThan(smallCounters.lookups * 16);
+
+    const linked = new LinkedHashMap<string, number>();
+    linked.enableStats();
+    linked.set('a', 1);
+    linked.get('a');
+    expect(linked.stats().counters.keyHashes).toBe(2);
+
+    const deque = new Deque<number>([], { bucketSize: 4 });
+    deque.enableStats();
+    for (let i = 0; i < 100; i++) deque.push(i);
+    expect(deque.stats().counters.reallocations).toBeGreaterThan(0);
+
+    const queue = new Queue<number>();
+    queue.enableStats();
+    for (let i = 0; i < 1000; i++) queue.push(i);
+    expect(queue.stats().counters.growths).toBeGreaterThan(0);
+  });
+
+  it('should count graph relaxations', () => {
+    const graph = new DirectedGraph();
+    for (const key of ['s', 'a', 'b', 't']) graph.addVertex(key);
+    graph.addEdge('s', 'a', 1);
+    graph.addEdge('s', 'b', 4);
+    graph.addEdge('a', 'b', 1);
+    graph.addEdge('b', 't', 1);
+    graph.enableStats();
+    expect(graph.dijkstra('s', 't', true).minDist).toBe(3);
+    expect(graph.stats().counters.dijkstraRuns).toBe(1);
+    expect(graph.stats().counters.relaxations).toBe(4);
+
+    graph.resetStats();
+    graph.bellmanFord('s');
+    expect(graph.stats().counters.bellmanFordRuns).toBe(1);
+    expect(graph.stats().counters.relaxations).toBeGreaterThanOrEqual(3);
+  });
+});
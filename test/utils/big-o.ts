@@ -84,7 +84,7 @@ function linearRegression(x: number[], y: number[]) {
   return { slope, intercept, rSquared };
 }
 
-function estimateBigO(runtimes: number[], dataSizes: number[]): string {
+export function estimateBigO(runtimes: number[], dataSizes: number[]): string {
   // Make sure the input runtimes and data sizes have the same length
   if (runtimes.length !== dataSizes.length) {
     return 'Lengths of input arrays do not match';
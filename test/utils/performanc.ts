@@ -1,7 +1,122 @@
-import { performance } from 'perf_hooks';
+import { performance, PerformanceEntry, PerformanceObserver } from 'perf_hooks';
+import * as v8 from 'v8';
+import * as vm from 'vm';
 
 export const calcRunTime = (callback: (...args: any[]) => any) => {
   const startTime = performance.now();
   callback();
   return performance.now() - startTime;
 };
+
+export type LatencyStats = { samples: number; p50: number; p99: number; p999: number; max: number };
+
+export type GcStats = { count: number; duration: number };
+
+/**
+ * The value below which `p` (0 to 1) of the sorted samples fall, by the nearest-rank method.
+ */
+export const percentile = (sorted: ArrayLike<number>, p: number): number => {
+  if (sorted.length === 0) return NaN;
+  const rank = Math.min(sorted.length - 1, Math.max(0, Math.ceil(p * sorted.length) - 1));
+  return sorted[rank];
+};
+
+/**
+ * Times each call of `fn` with `process.hrtime.bigint` until `maxSamples` calls or `budgetMs` milliseconds,
+ * whichever comes first, and returns the latency percentiles in milliseconds. `fn` gets the index of the call,
+ * so a single operation can be timed per call; the timer itself adds a few tens of nanoseconds to each sample.
+ */
+export const measureLatency = (fn: (index: number) => unknown, maxSamples = 1000, budgetMs = 2000): LatencyStats => {
+  const samples = new Float64Array(maxSamples);
+  const deadline = process.hrtime.bigint() + BigInt(Math.round(budgetMs * 1e6));
+  let count = 0;
+  while (count < maxSamples) {
+    const start = process.hrtime.bigint();
+    fn(count);
+    const end = process.hrtime.bigint();
+    samples[count++] = Number(end - start) / 1e6;
+    if (end > deadline) break;
+  }
+  const sorted = samples.subarray(0, count).sort();
+  return {
+    samples: count,
+    p50: percentile(sorted, 0.5),
+    p99: percentile(sorted, 0.99),
+    p999: percentile(sorted, 0.999),
+    max: sorted[count - 1]
+  };
+};
+
+/**
+ * Collects garbage collection entries from `perf_hooks`. Node delivers them asynchronously, so read a window
+ * with `between` only after yielding to the event loop, for example with `await flushGcEntries()`.
+ */
+export class GcTracker {
+  protected _entries: PerformanceEntry[] = [];
+
+  protected _observer: PerformanceObserver;
+
+  constructor() {
+    this._observer = new PerformanceObserver(list => {
+      for (const entry of list.getEntries()) this._entries.push(entry);
+    });
+    this._observer.observe({ entryTypes: ['gc'] });
+  }
+
+  /**
+   * The collections that started between two `performance.now()` readings.
+   */
+  between(start: number, end: number): GcStats {
+    let count = 0;
+    let duration = 0;
+    for (const entry of this._entries) {
+      if (entry.startTime >= start && entry.startTime <= end) {
+        count++;
+        duration += entry.duration;
+      }
+    }
+    return { count, duration };
+  }
+
+  disconnect() {
+    this._observer.disconnect();
+  }
+}
+
+export const flushGcEntries = () => new Promise<void>(resolve => setTimeout(resolve, 0));
+
+let forcedGc: (() => void) | undefined;
+
+/**
+ * Runs a full garbage collection, exposing `gc` at runtime when node was not started with `--expose-gc`.
+ */
+export const collectGarbage = () => {
+  if (!forcedGc) {
+    const exposed = (globalThis as { gc?: () => void }).gc;
+    if (exposed) forcedGc = exposed;
+    else {
+      v8.setFlagsFromString('--expose-gc');
+      forcedGc = vm.runInNewContext('gc');
+    }
+  }
+  forcedGc!();
+};
+
+// Holds the structure being measured, so the collection after the build cannot free it
+let retained: unknown;
+
+/**
+ * Builds a structure of `n` elements and returns the build time in milliseconds and the heap it keeps alive,
+ * per element.
+ */
+export const measureRetainedHeap = (build: (n: number) => unknown, n: number) => {
+  collectGarbage();
+  const before = process.memoryUsage().heapUsed;
+  const start = process.hrtime.bigint();
+  retained = build(n);
+  const time = Number(process.hrtime.bigint() - start) / 1e6;
+  collectGarbage();
+  const after = process.memoryUsage().heapUsed;
+  retained = undefined;
+  return { time, bytesPerElement: (after - before) / n };
+};